@@ -0,0 +1,120 @@
+/**
+ * @file BM_BatchLookup.cpp
+ * @brief Benchmark the batched hash-and-prefetch lookup pipeline
+ * @details Compares one-at-a-time probing against batchLookup() on a std::vector-backed
+ *          linear-probing table, both in cache and well beyond the last level cache
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// Batched lookup benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test table
+	//----------------------------------------------
+
+	struct Entry
+	{
+		uint64_t key = 0;
+		uint64_t value = 0;
+	};
+
+	static constexpr uint64_t TABLE_SEED = 0x5EED;
+
+	/** @brief Linear-probing table at 50% load holding random non-zero keys, plus matching queries */
+	struct TableFixture
+	{
+		explicit TableFixture( size_t bucketCount )
+			: entries( bucketCount )
+		{
+			std::mt19937_64 gen( 42 );
+			keys.reserve( bucketCount / 2 );
+			for ( size_t i = 0; i < bucketCount / 2; ++i )
+			{
+				const uint64_t key = gen() | 1;
+				uint64_t bucket = bucketIndex( hasher, key, bucketCount, TABLE_SEED );
+				while ( entries[bucket].key != 0 )
+				{
+					bucket = ( bucket + 1 ) & ( bucketCount - 1 );
+				}
+				entries[bucket] = { key, i };
+				keys.push_back( key );
+			}
+			std::shuffle( keys.begin(), keys.end(), gen );
+		}
+
+		uint64_t probe( uint64_t key, uint64_t bucket ) const
+		{
+			while ( entries[bucket].key != key )
+			{
+				bucket = ( bucket + 1 ) & ( entries.size() - 1 );
+			}
+
+			return entries[bucket].value;
+		}
+
+		std::vector<Entry> entries;
+		std::vector<uint64_t> keys;
+		Hasher<uint64_t> hasher;
+	};
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	static void BM_ProbeOneAtATime( ::benchmark::State& state )
+	{
+		const TableFixture table{ static_cast<size_t>( state.range( 0 ) ) };
+
+		for ( auto _ : state )
+		{
+			uint64_t sum = 0;
+			for ( const auto key : table.keys )
+			{
+				sum += table.probe( key, bucketIndex( table.hasher, key, table.entries.size(), TABLE_SEED ) );
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+		state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( table.keys.size() ) );
+	}
+
+	static void BM_BatchLookup( ::benchmark::State& state )
+	{
+		const TableFixture table{ static_cast<size_t>( state.range( 0 ) ) };
+
+		for ( auto _ : state )
+		{
+			uint64_t sum = 0;
+			batchLookup(
+				table.keys, table.entries.size(),
+				[&]( uint64_t bucket ) { return &table.entries[bucket]; },
+				[&]( size_t, uint64_t key, uint64_t bucket ) { sum += table.probe( key, bucket ); },
+				TABLE_SEED );
+			::benchmark::DoNotOptimize( sum );
+		}
+		state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( table.keys.size() ) );
+	}
+} // namespace nfx::hashing::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------
+// In cache (256 KiB) and beyond the last level cache (256 MiB)
+//----------------------------
+
+BENCHMARK( nfx::hashing::benchmark::BM_ProbeOneAtATime )->Arg( 1 << 14 )->Arg( 1 << 24 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_BatchLookup )->Arg( 1 << 14 )->Arg( 1 << 24 )->Repetitions( 3 );
+
+BENCHMARK_MAIN();
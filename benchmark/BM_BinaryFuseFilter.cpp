@@ -0,0 +1,135 @@
+/**
+ * @file BM_BinaryFuseFilter.cpp
+ * @brief Static set filters: BinaryFuseFilter versus a BloomFilter of the same false positive rate
+ * @details Times queries of present and absent keys against both filters, reports their bits per
+ *          key, and times the build on one thread and on all threads
+ */
+
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// Binary fuse filter benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Dataset
+	//----------------------------------------------
+
+	static constexpr std::size_t KEY_COUNT{ 4u << 20 };
+	static constexpr std::size_t PROBE_COUNT{ 1u << 16 };
+
+	/** @brief False positive rate of 8-bit fingerprints, given to the Bloom filter for comparison */
+	static constexpr double FALSE_POSITIVE_RATE{ 1.0 / 256.0 };
+
+	static const std::vector<uint64_t>& keys()
+	{
+		static const std::vector<uint64_t> result = [] {
+			std::vector<uint64_t> values( KEY_COUNT );
+			std::mt19937_64 rng{ 42 };
+			for ( auto& value : values )
+			{
+				value = rng();
+			}
+
+			return values;
+		}();
+
+		return result;
+	}
+
+	/** @brief Random inserted keys (positive) or fresh random keys (negative) */
+	static const std::vector<uint64_t>& probes( bool positive )
+	{
+		static const auto make = []( bool present ) {
+			std::mt19937_64 rng{ 7 };
+			std::vector<uint64_t> values( PROBE_COUNT );
+			for ( auto& value : values )
+			{
+				value = present ? keys()[rng() % KEY_COUNT] : rng();
+			}
+
+			return values;
+		};
+		static const std::vector<uint64_t> present = make( true );
+		static const std::vector<uint64_t> absent = make( false );
+
+		return positive ? present : absent;
+	}
+
+	//----------------------------------------------
+	// Query
+	//----------------------------------------------
+
+	static void BM_BinaryFuse_Contains( ::benchmark::State& state )
+	{
+		const auto filter = BinaryFuseFilter<>::build( keys() );
+		const auto& queries = probes( state.range( 0 ) != 0 );
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( filter.contains( queries[i++ % PROBE_COUNT] ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+		state.counters["bits_per_key"] = filter.bitsPerKey();
+	}
+
+	static void BM_BlockedBloom_Contains( ::benchmark::State& state )
+	{
+		BloomFilter<> filter{ KEY_COUNT, FALSE_POSITIVE_RATE };
+		for ( const auto key : keys() )
+		{
+			filter.insert( key );
+		}
+		const auto& queries = probes( state.range( 0 ) != 0 );
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( filter.contains( queries[i++ % PROBE_COUNT] ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+		state.counters["bits_per_key"] = static_cast<double>( filter.byteSize() * 8 ) / KEY_COUNT;
+	}
+
+	//----------------------------------------------
+	// Build
+	//----------------------------------------------
+
+	static void BM_BinaryFuse_Build( ::benchmark::State& state )
+	{
+		const auto threads = static_cast<std::size_t>( state.range( 0 ) );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( BinaryFuseFilter<>::build( keys(), { .threadCount = threads } ).size() );
+		}
+		state.SetItemsProcessed( state.iterations() * KEY_COUNT );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------
+	// Query (1 = present, 0 = absent)
+	//----------------------------
+
+	BENCHMARK( BM_BinaryFuse_Contains )->Arg( 1 )->Arg( 0 )->Repetitions( 3 );
+	BENCHMARK( BM_BlockedBloom_Contains )->Arg( 1 )->Arg( 0 )->Repetitions( 3 );
+
+	//----------------------------
+	// Build (argument: threads, 0 = all)
+	//----------------------------
+
+	BENCHMARK( BM_BinaryFuse_Build )->Arg( 1 )->Arg( 0 )->Unit( ::benchmark::kMillisecond )->Repetitions( 3 );
+} // namespace nfx::hashing::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,176 @@
+/**
+ * @file BM_BloomFilter.cpp
+ * @brief Filter queries: classic k-hash Bloom filter versus the split block BloomFilter
+ * @details Builds both filters for the same keys at a 1% false positive rate, larger than the last
+ *          level cache, and times queries one at a time and, for BloomFilter, batched
+ */
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// Bloom filter benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Dataset
+	//----------------------------------------------
+
+	static constexpr std::size_t KEY_COUNT{ 8u << 20 };
+	static constexpr std::size_t PROBE_COUNT{ 1u << 16 };
+	static constexpr double FALSE_POSITIVE_RATE{ 0.01 };
+
+	/** @brief Hashes of the inserted keys */
+	static const std::vector<uint64_t>& keyHashes()
+	{
+		static const std::vector<uint64_t> result = [] {
+			const Hasher<uint64_t> hasher;
+			std::vector<uint64_t> values( KEY_COUNT );
+			for ( std::size_t i = 0; i < KEY_COUNT; ++i )
+			{
+				values[i] = hasher( static_cast<uint64_t>( i ) );
+			}
+
+			return values;
+		}();
+
+		return result;
+	}
+
+	/** @brief Random probes, half of them inserted keys */
+	static const std::vector<uint64_t>& probeHashes()
+	{
+		static const std::vector<uint64_t> result = [] {
+			const Hasher<uint64_t> hasher;
+			std::mt19937_64 rng{ 42 };
+			std::vector<uint64_t> values( PROBE_COUNT );
+			for ( auto& value : values )
+			{
+				value = hasher( static_cast<uint64_t>( rng() % ( 2 * KEY_COUNT ) ) );
+			}
+
+			return values;
+		}();
+
+		return result;
+	}
+
+	//----------------------------------------------
+	// Classic Bloom filter
+	//----------------------------------------------
+
+	/** @brief Textbook filter: k positions over the whole bit array by double hashing */
+	class ClassicBloomFilter
+	{
+	public:
+		ClassicBloomFilter( std::size_t count, double rate )
+			: m_bitCount{ static_cast<uint64_t>( std::ceil( -static_cast<double>( count ) * std::log( rate ) / ( std::log( 2.0 ) * std::log( 2.0 ) ) ) ) },
+			  m_hashCount{ static_cast<unsigned int>( std::round( -std::log2( rate ) ) ) },
+			  m_words( ( m_bitCount + 63 ) / 64, 0 )
+		{
+		}
+
+		void insert( uint64_t hash ) noexcept
+		{
+			for ( unsigned int i = 0; i < m_hashCount; ++i )
+			{
+				const uint64_t bit = position( hash, i );
+				m_words[bit / 64] |= uint64_t{ 1 } << ( bit % 64 );
+			}
+		}
+
+		bool contains( uint64_t hash ) const noexcept
+		{
+			for ( unsigned int i = 0; i < m_hashCount; ++i )
+			{
+				const uint64_t bit = position( hash, i );
+				if ( ( m_words[bit / 64] & ( uint64_t{ 1 } << ( bit % 64 ) ) ) == 0 )
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+	private:
+		uint64_t position( uint64_t hash, unsigned int i ) const noexcept
+		{
+			const uint64_t step = ( hash >> 32 ) | 1;
+
+			return fastRange<uint64_t>( hash + i * step * constants::GOLDEN_RATIO_64, m_bitCount );
+		}
+
+		uint64_t m_bitCount;
+		unsigned int m_hashCount;
+		std::vector<uint64_t> m_words;
+	};
+
+	//----------------------------------------------
+	// Query
+	//----------------------------------------------
+
+	static void BM_ClassicBloom_Contains( ::benchmark::State& state )
+	{
+		ClassicBloomFilter filter{ KEY_COUNT, FALSE_POSITIVE_RATE };
+		for ( const auto hash : keyHashes() )
+		{
+			filter.insert( hash );
+		}
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( filter.contains( probeHashes()[i++ % PROBE_COUNT] ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	static void BM_BlockedBloom_Contains( ::benchmark::State& state )
+	{
+		BloomFilter<> filter{ KEY_COUNT, FALSE_POSITIVE_RATE };
+		filter.insertHashes( keyHashes() );
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( filter.containsHash( probeHashes()[i++ % PROBE_COUNT] ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	static void BM_BlockedBloom_ContainsBatched( ::benchmark::State& state )
+	{
+		BloomFilter<> filter{ KEY_COUNT, FALSE_POSITIVE_RATE };
+		filter.insertHashes( keyHashes() );
+		auto results = std::make_unique<bool[]>( PROBE_COUNT );
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( filter.containsHashes( probeHashes(), std::span<bool>{ results.get(), PROBE_COUNT } ) );
+		}
+		state.SetItemsProcessed( state.iterations() * PROBE_COUNT );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------
+	// Query
+	//----------------------------
+
+	BENCHMARK( BM_ClassicBloom_Contains )->Repetitions( 3 );
+	BENCHMARK( BM_BlockedBloom_Contains )->Repetitions( 3 );
+	BENCHMARK( BM_BlockedBloom_ContainsBatched )->Repetitions( 3 );
+} // namespace nfx::hashing::benchmark
+
+BENCHMARK_MAIN();
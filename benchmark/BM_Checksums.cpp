@@ -0,0 +1,283 @@
+/**
+ * @file BM_Checksums.cpp
+ * @brief Benchmark buffer checksum throughput
+ * @details Compares the CRC32-C, CRC-32 (IEEE 802.3), CRC-64 and parameterized Crc<> kernels
+ *          (slicing-by-16, SSE4.2, PCLMULQDQ, VPCLMULQDQ) across buffer sizes from 64 bytes to 1 MiB
+ */
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// Checksum benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data generation
+	//----------------------------------------------
+
+	static std::vector<std::byte> generateBuffer( size_t length )
+	{
+		std::vector<std::byte> data( length );
+		for ( size_t i = 0; i < length; ++i )
+		{
+			data[i] = static_cast<std::byte>( ( i * 131 + 7 ) & 0xFF );
+		}
+
+		return data;
+	}
+
+	//----------------------------------------------
+	// CRC32-C
+	//----------------------------------------------
+
+	static void BM_Crc32c_Buffer( ::benchmark::State& state )
+	{
+		const auto data = generateBuffer( static_cast<size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( nfx::hashing::crc32c( 0xFFFFFFFF, data.data(), data.size() ) );
+		}
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_Crc32c_ByteStep( ::benchmark::State& state )
+	{
+		const auto data = generateBuffer( static_cast<size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			uint32_t crc = 0xFFFFFFFF;
+			for ( const std::byte b : data )
+			{
+				crc = nfx::hashing::crc32c( crc, static_cast<uint8_t>( b ) );
+			}
+			::benchmark::DoNotOptimize( crc );
+		}
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_Crc32c_Pages_Sequential( ::benchmark::State& state )
+	{
+		constexpr size_t pageSize = 4096;
+		const size_t pageCount = static_cast<size_t>( state.range( 0 ) );
+		const auto data = generateBuffer( pageSize * pageCount );
+		std::vector<uint32_t> out( pageCount );
+		for ( auto _ : state )
+		{
+			for ( size_t i = 0; i < pageCount; ++i )
+			{
+				out[i] = ~nfx::hashing::crc32c( 0xFFFFFFFF, data.data() + i * pageSize, pageSize );
+			}
+			::benchmark::DoNotOptimize( out.data() );
+		}
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * data.size() ) );
+	}
+
+	static void BM_Crc32c_Pages_Blocks( ::benchmark::State& state )
+	{
+		constexpr size_t pageSize = 4096;
+		const size_t pageCount = static_cast<size_t>( state.range( 0 ) );
+		const auto data = generateBuffer( pageSize * pageCount );
+		std::vector<uint32_t> out( pageCount );
+		for ( auto _ : state )
+		{
+			nfx::hashing::crc32cBlocks( data.data(), pageSize, pageCount, out.data() );
+			::benchmark::DoNotOptimize( out.data() );
+		}
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * data.size() ) );
+	}
+
+	static void BM_Crc32c_Pages_Sse42Sequential( ::benchmark::State& state )
+	{
+		constexpr size_t pageSize = 4096;
+		const size_t pageCount = static_cast<size_t>( state.range( 0 ) );
+		const auto data = generateBuffer( pageSize * pageCount );
+		std::vector<uint32_t> out( pageCount );
+		for ( auto _ : state )
+		{
+			for ( size_t i = 0; i < pageCount; ++i )
+			{
+				out[i] = ~internal::crc32cHardware( 0xFFFFFFFF, data.data() + i * pageSize, pageSize );
+			}
+			::benchmark::DoNotOptimize( out.data() );
+		}
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * data.size() ) );
+	}
+
+	static void BM_Crc32c_Pages_Sse42Interleaved( ::benchmark::State& state )
+	{
+		constexpr size_t pageSize = 4096;
+		const size_t pageCount = static_cast<size_t>( state.range( 0 ) );
+		const auto data = generateBuffer( pageSize * pageCount );
+		std::vector<uint32_t> out( pageCount );
+		for ( auto _ : state )
+		{
+			for ( size_t i = 0; i < pageCount; i += internal::CRC32C_BLOCK_LANES )
+			{
+				internal::crc32cBlocksHardware( data.data() + i * pageSize, pageSize, out.data() + i );
+			}
+			::benchmark::DoNotOptimize( out.data() );
+		}
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * data.size() ) );
+	}
+
+	//----------------------------------------------
+	// CRC-32 (IEEE 802.3)
+	//----------------------------------------------
+
+	static void BM_Crc32Ieee_Dispatch( ::benchmark::State& state )
+	{
+		const auto data = generateBuffer( static_cast<size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( nfx::hashing::crc32Ieee( constants::CRC32_IEEE_INIT, data.data(), data.size() ) );
+		}
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_Crc32Ieee_Slicing16( ::benchmark::State& state )
+	{
+		const auto data = generateBuffer( static_cast<size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( nfx::hashing::crc32IeeeSoft( constants::CRC32_IEEE_INIT, data.data(), data.size() ) );
+		}
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_Crc32Ieee_Pclmulqdq( ::benchmark::State& state )
+	{
+		if ( !internal::hasPclmulqdqSupport() )
+		{
+			state.SkipWithError( "PCLMULQDQ not supported" );
+			return;
+		}
+
+		const auto data = generateBuffer( static_cast<size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( internal::Crc32IeeeEngine::updatePclmul( constants::CRC32_IEEE_INIT, data.data(), data.size() ) );
+		}
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_Crc32Ieee_Vpclmulqdq( ::benchmark::State& state )
+	{
+		if ( !internal::hasVpclmulqdqSupport() )
+		{
+			state.SkipWithError( "VPCLMULQDQ not supported" );
+			return;
+		}
+
+		const auto data = generateBuffer( static_cast<size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( internal::Crc32IeeeEngine::updateVpclmul( constants::CRC32_IEEE_INIT, data.data(), data.size() ) );
+		}
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	//----------------------------------------------
+	// CRC-64/XZ and CRC-64/NVME
+	//----------------------------------------------
+
+	static void BM_Crc64Xz_Dispatch( ::benchmark::State& state )
+	{
+		const auto data = generateBuffer( static_cast<size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( nfx::hashing::crc64Xz( constants::CRC64_INIT, data.data(), data.size() ) );
+		}
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_Crc64Xz_Slicing16( ::benchmark::State& state )
+	{
+		const auto data = generateBuffer( static_cast<size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( nfx::hashing::crc64XzSoft( constants::CRC64_INIT, data.data(), data.size() ) );
+		}
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_Crc64Nvme_Dispatch( ::benchmark::State& state )
+	{
+		const auto data = generateBuffer( static_cast<size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( nfx::hashing::crc64Nvme( constants::CRC64_INIT, data.data(), data.size() ) );
+		}
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	//----------------------------------------------
+	// Parameterized Crc<>
+	//----------------------------------------------
+
+	static void BM_Crc16CcittFalse( ::benchmark::State& state )
+	{
+		const auto data = generateBuffer( static_cast<size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( nfx::hashing::Crc16CcittFalse::compute( data.data(), data.size() ) );
+		}
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_Crc32Bzip2( ::benchmark::State& state )
+	{
+		const auto data = generateBuffer( static_cast<size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( nfx::hashing::Crc32Bzip2::compute( data.data(), data.size() ) );
+		}
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+} // namespace nfx::hashing::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------
+// CRC32-C
+//----------------------------
+
+BENCHMARK( nfx::hashing::benchmark::BM_Crc32c_Buffer )->RangeMultiplier( 8 )->Range( 64, 1 << 20 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_Crc32c_ByteStep )->RangeMultiplier( 8 )->Range( 64, 1 << 20 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_Crc32c_Pages_Sequential )->Arg( 4 )->Arg( 64 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_Crc32c_Pages_Blocks )->Arg( 4 )->Arg( 64 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_Crc32c_Pages_Sse42Sequential )->Arg( 4 )->Arg( 64 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_Crc32c_Pages_Sse42Interleaved )->Arg( 4 )->Arg( 64 )->Repetitions( 3 );
+
+//----------------------------
+// CRC-32 (IEEE 802.3)
+//----------------------------
+
+BENCHMARK( nfx::hashing::benchmark::BM_Crc32Ieee_Dispatch )->RangeMultiplier( 8 )->Range( 64, 1 << 20 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_Crc32Ieee_Slicing16 )->RangeMultiplier( 8 )->Range( 64, 1 << 20 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_Crc32Ieee_Pclmulqdq )->RangeMultiplier( 8 )->Range( 128, 1 << 20 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_Crc32Ieee_Vpclmulqdq )->RangeMultiplier( 8 )->Range( 128, 1 << 20 )->Repetitions( 3 );
+
+//----------------------------
+// CRC-64/XZ and CRC-64/NVME
+//----------------------------
+
+BENCHMARK( nfx::hashing::benchmark::BM_Crc64Xz_Dispatch )->RangeMultiplier( 8 )->Range( 64, 1 << 20 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_Crc64Xz_Slicing16 )->RangeMultiplier( 8 )->Range( 64, 1 << 20 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_Crc64Nvme_Dispatch )->RangeMultiplier( 8 )->Range( 64, 1 << 20 )->Repetitions( 3 );
+
+//----------------------------
+// Parameterized Crc<>
+//----------------------------
+
+BENCHMARK( nfx::hashing::benchmark::BM_Crc16CcittFalse )->RangeMultiplier( 8 )->Range( 64, 1 << 20 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_Crc32Bzip2 )->RangeMultiplier( 8 )->Range( 64, 1 << 20 )->Repetitions( 3 );
+
+BENCHMARK_MAIN();
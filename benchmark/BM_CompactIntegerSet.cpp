@@ -0,0 +1,162 @@
+/**
+ * @file BM_CompactIntegerSet.cpp
+ * @brief Footprint and speed of the quotienting integer set versus full-key tables
+ * @details Fills CompactIntegerSet, FlatHashMap and std::unordered_set with 16M random 64-bit ids,
+ *          reports bytes per key, and times random membership queries
+ */
+
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// Compact integer set benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Dataset
+	//----------------------------------------------
+
+	static constexpr size_t KEY_COUNT{ 1u << 24 };
+
+	static const std::vector<uint64_t>& datasetKeys()
+	{
+		static const std::vector<uint64_t> keys = [] {
+			std::vector<uint64_t> result( KEY_COUNT );
+			std::mt19937_64 gen( 42 );
+			for ( auto& key : result )
+			{
+				key = gen();
+			}
+
+			return result;
+		}();
+
+		return keys;
+	}
+
+	//----------------------------------------------
+	// Insert (reports footprint)
+	//----------------------------------------------
+
+	static void BM_CompactIntegerSet_Insert( ::benchmark::State& state )
+	{
+		const auto& keys = datasetKeys();
+		double bytesPerKey = 0.0;
+		for ( auto _ : state )
+		{
+			CompactIntegerSet set;
+			for ( const auto key : keys )
+			{
+				set.insert( key );
+			}
+			bytesPerKey = static_cast<double>( set.memoryUsage() ) / static_cast<double>( set.size() );
+			::benchmark::DoNotOptimize( set.size() );
+		}
+		state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( keys.size() ) );
+		state.counters["bytes_per_key"] = bytesPerKey;
+	}
+
+	static void BM_FlatHashMap_Insert( ::benchmark::State& state )
+	{
+		const auto& keys = datasetKeys();
+		double bytesPerKey = 0.0;
+		for ( auto _ : state )
+		{
+			FlatHashMap<uint64_t, bool> map;
+			for ( const auto key : keys )
+			{
+				map.try_emplace( key, true );
+			}
+			// One control byte plus one slot per bucket
+			bytesPerKey = static_cast<double>( map.capacity() * ( 1 + sizeof( std::pair<const uint64_t, bool> ) ) ) / static_cast<double>( map.size() );
+			::benchmark::DoNotOptimize( map.size() );
+		}
+		state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( keys.size() ) );
+		state.counters["bytes_per_key"] = bytesPerKey;
+	}
+
+	static void BM_UnorderedSet_Insert( ::benchmark::State& state )
+	{
+		const auto& keys = datasetKeys();
+		double bytesPerKey = 0.0;
+		for ( auto _ : state )
+		{
+			std::unordered_set<uint64_t, Hasher<uint64_t>> set;
+			for ( const auto key : keys )
+			{
+				set.insert( key );
+			}
+			// Bucket pointer plus a heap node holding the next pointer, key and cached hash
+			bytesPerKey = static_cast<double>( set.bucket_count() * sizeof( void* ) + set.size() * 3 * sizeof( uint64_t ) ) / static_cast<double>( set.size() );
+			::benchmark::DoNotOptimize( set.size() );
+		}
+		state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( keys.size() ) );
+		state.counters["bytes_per_key"] = bytesPerKey;
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	static void BM_CompactIntegerSet_Contains( ::benchmark::State& state )
+	{
+		const auto& keys = datasetKeys();
+		CompactIntegerSet set{ keys.size() };
+		for ( const auto key : keys )
+		{
+			set.insert( key );
+		}
+
+		std::mt19937_64 gen( 7 );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( set.contains( keys[gen() % keys.size()] ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	static void BM_FlatHashMap_Contains( ::benchmark::State& state )
+	{
+		const auto& keys = datasetKeys();
+		FlatHashMap<uint64_t, bool> map{ keys.size() };
+		for ( const auto key : keys )
+		{
+			map.try_emplace( key, true );
+		}
+
+		std::mt19937_64 gen( 7 );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( map.contains( keys[gen() % keys.size()] ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------
+	// Insert
+	//----------------------------
+
+	BENCHMARK( BM_CompactIntegerSet_Insert )->Unit( ::benchmark::kMillisecond )->Iterations( 1 )->Repetitions( 3 );
+	BENCHMARK( BM_FlatHashMap_Insert )->Unit( ::benchmark::kMillisecond )->Iterations( 1 )->Repetitions( 3 );
+	BENCHMARK( BM_UnorderedSet_Insert )->Unit( ::benchmark::kMillisecond )->Iterations( 1 )->Repetitions( 3 );
+
+	//----------------------------
+	// Lookup
+	//----------------------------
+
+	BENCHMARK( BM_CompactIntegerSet_Contains )->Repetitions( 3 );
+	BENCHMARK( BM_FlatHashMap_Contains )->Repetitions( 3 );
+} // namespace nfx::hashing::benchmark
+
+BENCHMARK_MAIN();
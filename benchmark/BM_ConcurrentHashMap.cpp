@@ -0,0 +1,138 @@
+/**
+ * @file BM_ConcurrentHashMap.cpp
+ * @brief Multi-threaded scaling benchmark for ConcurrentHashMap
+ * @details Read-only and 90/10 read-write workloads at increasing thread counts, against a
+ *          std::unordered_map guarded by a single mutex
+ */
+
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// ConcurrentHashMap benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Shared fixtures
+	//----------------------------------------------
+
+	static constexpr uint64_t KEY_COUNT = 1 << 20;
+
+	static ConcurrentHashMap<uint64_t, uint64_t>& concurrentMap()
+	{
+		static ConcurrentHashMap<uint64_t, uint64_t> map;
+		static std::once_flag filled;
+		std::call_once( filled, [] {
+			map.reserve( KEY_COUNT );
+			for ( uint64_t key = 0; key < KEY_COUNT; ++key )
+			{
+				map.insert_or_assign( key, key );
+			}
+		} );
+
+		return map;
+	}
+
+	struct LockedUnorderedMap
+	{
+		std::mutex mutex;
+		std::unordered_map<uint64_t, uint64_t, Hasher<uint64_t>> map;
+	};
+
+	static LockedUnorderedMap& lockedMap()
+	{
+		static LockedUnorderedMap locked;
+		static std::once_flag filled;
+		std::call_once( filled, [] {
+			locked.map.reserve( KEY_COUNT );
+			for ( uint64_t key = 0; key < KEY_COUNT; ++key )
+			{
+				locked.map.emplace( key, key );
+			}
+		} );
+
+		return locked;
+	}
+
+	//----------------------------------------------
+	// Read-only
+	//----------------------------------------------
+
+	static void BM_ConcurrentHashMap_Find( ::benchmark::State& state )
+	{
+		const auto& map = concurrentMap();
+		std::mt19937_64 gen( static_cast<uint64_t>( state.thread_index() ) );
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( map.find( gen() & ( KEY_COUNT - 1 ) ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	static void BM_MutexUnorderedMap_Find( ::benchmark::State& state )
+	{
+		auto& locked = lockedMap();
+		std::mt19937_64 gen( static_cast<uint64_t>( state.thread_index() ) );
+
+		for ( auto _ : state )
+		{
+			std::lock_guard lock{ locked.mutex };
+			::benchmark::DoNotOptimize( locked.map.find( gen() & ( KEY_COUNT - 1 ) ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	//----------------------------------------------
+	// 90% reads, 10% writes
+	//----------------------------------------------
+
+	static void BM_ConcurrentHashMap_ReadMostly( ::benchmark::State& state )
+	{
+		auto& map = concurrentMap();
+		std::mt19937_64 gen( static_cast<uint64_t>( state.thread_index() ) );
+
+		for ( auto _ : state )
+		{
+			const uint64_t random = gen();
+			const uint64_t key = random & ( KEY_COUNT - 1 );
+			if ( random % 10 == 0 )
+			{
+				map.insert_or_assign( key, random );
+			}
+			else
+			{
+				::benchmark::DoNotOptimize( map.find( key ) );
+			}
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+} // namespace nfx::hashing::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------
+// Read scaling
+//----------------------------
+
+BENCHMARK( nfx::hashing::benchmark::BM_ConcurrentHashMap_Find )->ThreadRange( 1, 64 )->UseRealTime()->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_MutexUnorderedMap_Find )->ThreadRange( 1, 64 )->UseRealTime()->Repetitions( 3 );
+
+//----------------------------
+// Mixed workload
+//----------------------------
+
+BENCHMARK( nfx::hashing::benchmark::BM_ConcurrentHashMap_ReadMostly )->ThreadRange( 1, 64 )->UseRealTime()->Repetitions( 3 );
+
+BENCHMARK_MAIN();
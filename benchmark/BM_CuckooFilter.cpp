@@ -0,0 +1,156 @@
+/**
+ * @file BM_CuckooFilter.cpp
+ * @brief Cuckoo filter operations at both fingerprint widths, against the blocked BloomFilter
+ * @details Fills filters for the same keys to their planned load and times positive and negative
+ *          queries, insertion into a fresh filter, and an erase / re-insert cycle that Bloom filters
+ *          cannot offer
+ */
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// Cuckoo filter benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Dataset
+	//----------------------------------------------
+
+	static constexpr std::size_t KEY_COUNT{ 4u << 20 };
+	static constexpr std::size_t PROBE_COUNT{ 1u << 16 };
+
+	/** @brief Hashes of keys [offset, offset + count) */
+	static std::vector<uint64_t> hashes( std::size_t offset, std::size_t count )
+	{
+		const Hasher<uint64_t> hasher;
+		std::vector<uint64_t> values( count );
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			values[i] = hasher( static_cast<uint64_t>( offset + i ) );
+		}
+
+		return values;
+	}
+
+	static const std::vector<uint64_t>& keyHashes()
+	{
+		static const std::vector<uint64_t> result = hashes( 0, KEY_COUNT );
+
+		return result;
+	}
+
+	/** @brief Random inserted keys (positive) or keys never inserted (negative) */
+	static const std::vector<uint64_t>& probeHashes( bool positive )
+	{
+		static const auto make = []( bool present ) {
+			std::mt19937_64 rng{ 42 };
+			std::vector<uint64_t> values( PROBE_COUNT );
+			for ( auto& value : values )
+			{
+				const std::size_t key = rng() % KEY_COUNT;
+				value = present ? keyHashes()[key] : hashes( KEY_COUNT + key, 1 )[0];
+			}
+
+			return values;
+		};
+		static const std::vector<uint64_t> present = make( true );
+		static const std::vector<uint64_t> absent = make( false );
+
+		return positive ? present : absent;
+	}
+
+	template <typename TFilter>
+	static TFilter filledFilter()
+	{
+		TFilter filter{ KEY_COUNT };
+		for ( const auto hash : keyHashes() )
+		{
+			filter.insertHash( hash );
+		}
+
+		return filter;
+	}
+
+	//----------------------------------------------
+	// Query
+	//----------------------------------------------
+
+	template <typename TFilter>
+	static void BM_Contains( ::benchmark::State& state )
+	{
+		const auto filter = filledFilter<TFilter>();
+		const auto& probes = probeHashes( state.range( 0 ) != 0 );
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( filter.containsHash( probes[i++ % PROBE_COUNT] ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	//----------------------------------------------
+	// Modification
+	//----------------------------------------------
+
+	template <typename TFilter>
+	static void BM_Insert( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			TFilter filter{ KEY_COUNT };
+			for ( const auto hash : keyHashes() )
+			{
+				filter.insertHash( hash );
+			}
+			::benchmark::DoNotOptimize( filter.containsHash( keyHashes()[0] ) );
+		}
+		state.SetItemsProcessed( state.iterations() * KEY_COUNT );
+	}
+
+	template <typename TFilter>
+	static void BM_EraseInsert( ::benchmark::State& state )
+	{
+		auto filter = filledFilter<TFilter>();
+		const auto& probes = probeHashes( true );
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			const uint64_t hash = probes[i++ % PROBE_COUNT];
+			::benchmark::DoNotOptimize( filter.eraseHash( hash ) );
+			::benchmark::DoNotOptimize( filter.insertHash( hash ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------
+	// Query (1 = present, 0 = absent)
+	//----------------------------
+
+	BENCHMARK( BM_Contains<CuckooFilter<uint8_t>> )->Arg( 1 )->Arg( 0 )->Repetitions( 3 );
+	BENCHMARK( BM_Contains<CuckooFilter<uint16_t>> )->Arg( 1 )->Arg( 0 )->Repetitions( 3 );
+	BENCHMARK( BM_Contains<BloomFilter<>> )->Arg( 1 )->Arg( 0 )->Repetitions( 3 );
+
+	//----------------------------
+	// Modification
+	//----------------------------
+
+	BENCHMARK( BM_Insert<CuckooFilter<uint8_t>> )->Unit( ::benchmark::kMillisecond )->Repetitions( 3 );
+	BENCHMARK( BM_Insert<CuckooFilter<uint16_t>> )->Unit( ::benchmark::kMillisecond )->Repetitions( 3 );
+	BENCHMARK( BM_Insert<BloomFilter<>> )->Unit( ::benchmark::kMillisecond )->Repetitions( 3 );
+	BENCHMARK( BM_EraseInsert<CuckooFilter<uint16_t>> )->Repetitions( 3 );
+} // namespace nfx::hashing::benchmark
+
+BENCHMARK_MAIN();
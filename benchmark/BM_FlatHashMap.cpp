@@ -0,0 +1,200 @@
+/**
+ * @file BM_FlatHashMap.cpp
+ * @brief Benchmark FlatHashMap against std::unordered_map
+ * @details Both containers use the same Hasher, so the difference is the table layout:
+ *          insertion, successful and unsuccessful lookups for integer and string keys
+ */
+
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// FlatHashMap benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data generation
+	//----------------------------------------------
+
+	static std::vector<uint64_t> generateKeys( size_t count, uint64_t seed )
+	{
+		std::vector<uint64_t> keys( count );
+		std::mt19937_64 gen( seed );
+		for ( auto& key : keys )
+		{
+			key = gen();
+		}
+
+		return keys;
+	}
+
+	static std::vector<std::string> generateStringKeys( size_t count )
+	{
+		std::vector<std::string> keys;
+		keys.reserve( count );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			keys.emplace_back( "key:" + std::to_string( i * 2654435761u ) );
+		}
+
+		return keys;
+	}
+
+	using FlatMap = FlatHashMap<uint64_t, uint64_t, Hasher<uint64_t>>;
+	using StdMap = std::unordered_map<uint64_t, uint64_t, Hasher<uint64_t>>;
+	using FlatStringMap = FlatHashMap<std::string, uint64_t, Hasher<uint64_t>>;
+	using StdStringMap = std::unordered_map<std::string, uint64_t, Hasher<uint64_t>, std::equal_to<>>;
+
+	//----------------------------------------------
+	// Insertion
+	//----------------------------------------------
+
+	template <typename TMap>
+	static void insertBenchmark( ::benchmark::State& state )
+	{
+		const auto keys = generateKeys( static_cast<size_t>( state.range( 0 ) ), 42 );
+
+		for ( auto _ : state )
+		{
+			TMap map;
+			for ( const auto key : keys )
+			{
+				map[key] = key;
+			}
+			::benchmark::DoNotOptimize( map.size() );
+		}
+		state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( keys.size() ) );
+	}
+
+	static void BM_FlatHashMap_Insert( ::benchmark::State& state )
+	{
+		insertBenchmark<FlatMap>( state );
+	}
+
+	static void BM_UnorderedMap_Insert( ::benchmark::State& state )
+	{
+		insertBenchmark<StdMap>( state );
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <typename TMap>
+	static void lookupBenchmark( ::benchmark::State& state, bool hit )
+	{
+		const auto keys = generateKeys( static_cast<size_t>( state.range( 0 ) ), 42 );
+		const auto probes = hit ? keys : generateKeys( keys.size(), 7 );
+
+		TMap map;
+		map.reserve( keys.size() );
+		for ( const auto key : keys )
+		{
+			map[key] = key;
+		}
+
+		for ( auto _ : state )
+		{
+			uint64_t found = 0;
+			for ( const auto key : probes )
+			{
+				found += map.find( key ) != map.end() ? 1 : 0;
+			}
+			::benchmark::DoNotOptimize( found );
+		}
+		state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( probes.size() ) );
+	}
+
+	static void BM_FlatHashMap_LookupHit( ::benchmark::State& state )
+	{
+		lookupBenchmark<FlatMap>( state, true );
+	}
+
+	static void BM_UnorderedMap_LookupHit( ::benchmark::State& state )
+	{
+		lookupBenchmark<StdMap>( state, true );
+	}
+
+	static void BM_FlatHashMap_LookupMiss( ::benchmark::State& state )
+	{
+		lookupBenchmark<FlatMap>( state, false );
+	}
+
+	static void BM_UnorderedMap_LookupMiss( ::benchmark::State& state )
+	{
+		lookupBenchmark<StdMap>( state, false );
+	}
+
+	//----------------------------------------------
+	// String keys
+	//----------------------------------------------
+
+	template <typename TMap>
+	static void stringLookupBenchmark( ::benchmark::State& state )
+	{
+		const auto keys = generateStringKeys( static_cast<size_t>( state.range( 0 ) ) );
+
+		TMap map;
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			map[keys[i]] = i;
+		}
+
+		for ( auto _ : state )
+		{
+			uint64_t sum = 0;
+			for ( const auto& key : keys )
+			{
+				sum += map.find( key )->second;
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+		state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( keys.size() ) );
+	}
+
+	static void BM_FlatHashMap_StringLookup( ::benchmark::State& state )
+	{
+		stringLookupBenchmark<FlatStringMap>( state );
+	}
+
+	static void BM_UnorderedMap_StringLookup( ::benchmark::State& state )
+	{
+		stringLookupBenchmark<StdStringMap>( state );
+	}
+} // namespace nfx::hashing::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------
+// Insertion
+//----------------------------
+
+BENCHMARK( nfx::hashing::benchmark::BM_FlatHashMap_Insert )->Arg( 1 << 10 )->Arg( 1 << 17 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_UnorderedMap_Insert )->Arg( 1 << 10 )->Arg( 1 << 17 )->Repetitions( 3 );
+
+//----------------------------
+// Integer lookup
+//----------------------------
+
+BENCHMARK( nfx::hashing::benchmark::BM_FlatHashMap_LookupHit )->Arg( 1 << 10 )->Arg( 1 << 20 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_UnorderedMap_LookupHit )->Arg( 1 << 10 )->Arg( 1 << 20 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_FlatHashMap_LookupMiss )->Arg( 1 << 10 )->Arg( 1 << 20 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_UnorderedMap_LookupMiss )->Arg( 1 << 10 )->Arg( 1 << 20 )->Repetitions( 3 );
+
+//----------------------------
+// String lookup
+//----------------------------
+
+BENCHMARK( nfx::hashing::benchmark::BM_FlatHashMap_StringLookup )->Arg( 1 << 16 )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_UnorderedMap_StringLookup )->Arg( 1 << 16 )->Repetitions( 3 );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,122 @@
+/**
+ * @file BM_FrozenMap.cpp
+ * @brief Token dispatch cost: compile-time FrozenMap versus startup-built and linear lookups
+ * @details Classifies a stream of HTTP header names with a constexpr StringSwitch, a
+ *          std::unordered_map built at startup and a linear comparison chain
+ */
+
+#include <array>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// Frozen map benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Dataset
+	//----------------------------------------------
+
+	static constexpr std::array<std::string_view, 30> TOKENS{
+		"accept", "accept-encoding", "accept-language", "authorization", "cache-control", "connection",
+		"content-encoding", "content-length", "content-type", "cookie", "date", "etag", "expect", "host",
+		"if-match", "if-modified-since", "if-none-match", "last-modified", "location", "origin", "pragma",
+		"range", "referer", "server", "set-cookie", "transfer-encoding", "upgrade", "user-agent", "vary", "via" };
+
+	static constexpr StringSwitch<TOKENS.size()> HEADER_SWITCH{ TOKENS };
+
+	/** @brief Request stream: mostly known headers, one in eight unknown */
+	static const std::vector<std::string>& requestStream()
+	{
+		static const std::vector<std::string> stream = [] {
+			std::vector<std::string> result;
+			std::mt19937 gen( 42 );
+			for ( int i = 0; i < 4096; ++i )
+			{
+				result.emplace_back( gen() % 8 == 0 ? "x-request-id" : std::string{ TOKENS[gen() % TOKENS.size()] } );
+			}
+
+			return result;
+		}();
+
+		return stream;
+	}
+
+	//----------------------------------------------
+	// Lookups
+	//----------------------------------------------
+
+	static void BM_StringSwitch_Dispatch( ::benchmark::State& state )
+	{
+		const auto& stream = requestStream();
+		for ( auto _ : state )
+		{
+			for ( const auto& name : stream )
+			{
+				::benchmark::DoNotOptimize( HEADER_SWITCH( name ) );
+			}
+		}
+		state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( stream.size() ) );
+	}
+
+	static void BM_UnorderedMap_Dispatch( ::benchmark::State& state )
+	{
+		const auto& stream = requestStream();
+		std::unordered_map<std::string_view, size_t, Hasher<uint32_t>> map;
+		for ( size_t i = 0; i < TOKENS.size(); ++i )
+		{
+			map.emplace( TOKENS[i], i );
+		}
+
+		for ( auto _ : state )
+		{
+			for ( const auto& name : stream )
+			{
+				const auto it = map.find( name );
+				::benchmark::DoNotOptimize( it == map.end() ? TOKENS.size() : it->second );
+			}
+		}
+		state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( stream.size() ) );
+	}
+
+	static void BM_LinearChain_Dispatch( ::benchmark::State& state )
+	{
+		const auto& stream = requestStream();
+		for ( auto _ : state )
+		{
+			for ( const auto& name : stream )
+			{
+				size_t index = 0;
+				while ( index < TOKENS.size() && TOKENS[index] != name )
+				{
+					++index;
+				}
+				::benchmark::DoNotOptimize( index );
+			}
+		}
+		state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( stream.size() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------
+	// Dispatch
+	//----------------------------
+
+	BENCHMARK( BM_StringSwitch_Dispatch )->Repetitions( 3 );
+	BENCHMARK( BM_UnorderedMap_Dispatch )->Repetitions( 3 );
+	BENCHMARK( BM_LinearChain_Dispatch )->Repetitions( 3 );
+} // namespace nfx::hashing::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,147 @@
+/**
+ * @file BM_HashIndex.cpp
+ * @brief Startup and lookup cost of a memory-mapped hash index versus a rebuilt std::unordered_map
+ * @details Compares opening a prebuilt index file with reconstructing an equivalent in-memory map
+ *          from the same entries, and random lookups served from each
+ */
+
+#include <filesystem>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// Hash index benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Dataset
+	//----------------------------------------------
+
+	static constexpr size_t ENTRY_COUNT{ 1u << 22 };
+
+	static const std::vector<uint64_t>& datasetKeys()
+	{
+		static const std::vector<uint64_t> keys = [] {
+			std::vector<uint64_t> result( ENTRY_COUNT );
+			std::mt19937_64 gen( 42 );
+			for ( auto& key : result )
+			{
+				key = gen();
+			}
+
+			return result;
+		}();
+
+		return keys;
+	}
+
+	static const std::filesystem::path& datasetIndexPath()
+	{
+		static const std::filesystem::path path = std::filesystem::temp_directory_path() / "nfx_bm_hashindex.nfxidx";
+		static std::once_flag written;
+		std::call_once( written, [] {
+			const auto& keys = datasetKeys();
+			HashIndexBuilder<> builder{ keys.size() };
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				builder.add( keys[i], i );
+			}
+			builder.write( path );
+		} );
+
+		return path;
+	}
+
+	//----------------------------------------------
+	// Startup
+	//----------------------------------------------
+
+	static void BM_MappedHashIndex_Open( ::benchmark::State& state )
+	{
+		const auto& path = datasetIndexPath();
+		for ( auto _ : state )
+		{
+			MappedHashIndex<> index{ path };
+			::benchmark::DoNotOptimize( index.size() );
+		}
+	}
+
+	static void BM_UnorderedMap_Rebuild( ::benchmark::State& state )
+	{
+		const auto& keys = datasetKeys();
+		for ( auto _ : state )
+		{
+			std::unordered_map<uint64_t, uint64_t, Hasher<uint64_t>> map;
+			map.reserve( keys.size() );
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				map.emplace( keys[i], i );
+			}
+			::benchmark::DoNotOptimize( map.size() );
+		}
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	static void BM_MappedHashIndex_Find( ::benchmark::State& state )
+	{
+		const auto& keys = datasetKeys();
+		const MappedHashIndex<> index{ datasetIndexPath() };
+		std::mt19937_64 gen( 7 );
+		for ( auto _ : state )
+		{
+			const uint64_t key = keys[gen() % keys.size()];
+			::benchmark::DoNotOptimize( index.find( key ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	static void BM_UnorderedMap_Find( ::benchmark::State& state )
+	{
+		const auto& keys = datasetKeys();
+		std::unordered_map<uint64_t, uint64_t, Hasher<uint64_t>> map;
+		map.reserve( keys.size() );
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			map.emplace( keys[i], i );
+		}
+
+		std::mt19937_64 gen( 7 );
+		for ( auto _ : state )
+		{
+			const uint64_t key = keys[gen() % keys.size()];
+			::benchmark::DoNotOptimize( map.find( key ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------
+	// Startup
+	//----------------------------
+
+	BENCHMARK( BM_MappedHashIndex_Open )->Unit( ::benchmark::kMicrosecond )->Repetitions( 3 );
+	BENCHMARK( BM_UnorderedMap_Rebuild )->Unit( ::benchmark::kMillisecond )->Repetitions( 3 );
+
+	//----------------------------
+	// Lookup
+	//----------------------------
+
+	BENCHMARK( BM_MappedHashIndex_Find )->Repetitions( 3 );
+	BENCHMARK( BM_UnorderedMap_Find )->Repetitions( 3 );
+} // namespace nfx::hashing::benchmark
+
+BENCHMARK_MAIN();
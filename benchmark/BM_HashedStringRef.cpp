@@ -0,0 +1,156 @@
+/**
+ * @file BM_HashedStringRef.cpp
+ * @brief String-keyed lookup and comparison: HashedStringRef versus std::string keys
+ * @details Looks up column-style names sharing long common prefixes in FlatHashMap keyed by
+ *          std::string and by HashedStringRef, and times pairwise equality of unequal names
+ */
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// Hashed string reference benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Dataset
+	//----------------------------------------------
+
+	static constexpr std::size_t NAME_COUNT{ 1u << 16 };
+
+	/** @brief Mostly long names with a shared prefix, plus some short ones */
+	static const std::vector<std::string>& names()
+	{
+		static const std::vector<std::string> result = [] {
+			std::vector<std::string> values;
+			values.reserve( NAME_COUNT );
+			for ( std::size_t i = 0; i < NAME_COUNT; ++i )
+			{
+				values.push_back( i % 4 == 0 ? "c" + std::to_string( i ) : "warehouse.orders.line_item_" + std::to_string( i ) );
+			}
+
+			return values;
+		}();
+
+		return result;
+	}
+
+	/** @brief Probe order with heap copies of the keys, so probes never share storage */
+	static const std::vector<std::string>& probes()
+	{
+		static const std::vector<std::string> result = [] {
+			std::vector<std::string> values = names();
+			std::shuffle( values.begin(), values.end(), std::mt19937_64{ 42 } );
+
+			return values;
+		}();
+
+		return result;
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	static void BM_StringKey_Find( ::benchmark::State& state )
+	{
+		FlatHashMap<std::string, uint32_t, Hasher<>> map;
+		for ( std::size_t i = 0; i < NAME_COUNT; ++i )
+		{
+			map.try_emplace( names()[i], static_cast<uint32_t>( i ) );
+		}
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( map.find( probes()[i++ % NAME_COUNT] ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	static void BM_HashedStringRef_Find( ::benchmark::State& state )
+	{
+		FlatHashMap<HashedStringRef, uint32_t, Hasher<>, std::equal_to<>> map;
+		for ( std::size_t i = 0; i < NAME_COUNT; ++i )
+		{
+			map.try_emplace( HashedStringRef{ names()[i] }, static_cast<uint32_t>( i ) );
+		}
+		// Probes are hashed once up front, as when the key arrives already wrapped
+		std::vector<HashedStringRef> refs;
+		for ( const auto& probe : probes() )
+		{
+			refs.emplace_back( probe );
+		}
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( map.find( refs[i++ % NAME_COUNT] ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	//----------------------------------------------
+	// Equality of unequal keys
+	//----------------------------------------------
+
+	static void BM_StringKey_EqualMismatch( ::benchmark::State& state )
+	{
+		const auto& a = names();
+		const auto& b = probes();
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			const std::size_t index = i++ % NAME_COUNT;
+			::benchmark::DoNotOptimize( a[index] == b[index] );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	static void BM_HashedStringRef_EqualMismatch( ::benchmark::State& state )
+	{
+		std::vector<HashedStringRef> a;
+		std::vector<HashedStringRef> b;
+		for ( std::size_t i = 0; i < NAME_COUNT; ++i )
+		{
+			a.emplace_back( names()[i] );
+			b.emplace_back( probes()[i] );
+		}
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			const std::size_t index = i++ % NAME_COUNT;
+			::benchmark::DoNotOptimize( a[index] == b[index] );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------
+	// Lookup
+	//----------------------------
+
+	BENCHMARK( BM_StringKey_Find )->Repetitions( 3 );
+	BENCHMARK( BM_HashedStringRef_Find )->Repetitions( 3 );
+
+	//----------------------------
+	// Equality
+	//----------------------------
+
+	BENCHMARK( BM_StringKey_EqualMismatch )->Repetitions( 3 );
+	BENCHMARK( BM_HashedStringRef_EqualMismatch )->Repetitions( 3 );
+} // namespace nfx::hashing::benchmark
+
+BENCHMARK_MAIN();
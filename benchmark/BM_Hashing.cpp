@@ -1,7 +1,7 @@
 /**
  * @file BM_Hashing.cpp
  * @brief Benchmark core hash algorithms and infrastructure
- * @details Benchmarks for FNV-1a, CRC32-C, string hashing,
+ * @details Benchmarks for FNV-1a, CRC32-C, FarmHash/CityHash, string hashing,
  *          integer hashing, and hash combining performance
  */
 
@@ -436,6 +436,75 @@ namespace nfx::hashing::benchmark
 		}
 	}
 
+	//----------------------------
+	// FarmHash / CityHash
+	//----------------------------
+
+	static void BM_FarmFingerprint64_Short( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			uint64_t totalHash = 0;
+			for ( const auto& str : shortStrings )
+			{
+				totalHash += nfx::hashing::farmFingerprint64( str );
+			}
+			::benchmark::DoNotOptimize( totalHash );
+		}
+	}
+
+	static void BM_FarmFingerprint64_Medium( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			uint64_t totalHash = 0;
+			for ( const auto& str : mediumStrings )
+			{
+				totalHash += nfx::hashing::farmFingerprint64( str );
+			}
+			::benchmark::DoNotOptimize( totalHash );
+		}
+	}
+
+	static void BM_FarmFingerprint64_Long( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			uint64_t totalHash = 0;
+			for ( const auto& str : longStrings )
+			{
+				totalHash += nfx::hashing::farmFingerprint64( str );
+			}
+			::benchmark::DoNotOptimize( totalHash );
+		}
+	}
+
+	static void BM_CityHash64_Long( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			uint64_t totalHash = 0;
+			for ( const auto& str : longStrings )
+			{
+				totalHash += nfx::hashing::cityHash64( str );
+			}
+			::benchmark::DoNotOptimize( totalHash );
+		}
+	}
+
+	static void BM_CityHash128_Long( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			uint64_t totalHash = 0;
+			for ( const auto& str : longStrings )
+			{
+				totalHash += nfx::hashing::cityHash128( str ).low;
+			}
+			::benchmark::DoNotOptimize( totalHash );
+		}
+	}
+
 	//----------------------------------------------
 	// Integer hashing benchmarks
 	//----------------------------------------------
@@ -808,6 +877,16 @@ BENCHMARK( nfx::hashing::benchmark::BM_StdHash_Short )->Repetitions( 3 );
 BENCHMARK( nfx::hashing::benchmark::BM_StdHash_Medium )->Repetitions( 3 );
 BENCHMARK( nfx::hashing::benchmark::BM_StdHash_Long )->Repetitions( 3 );
 
+//----------------------------
+// FarmHash / CityHash
+//----------------------------
+
+BENCHMARK( nfx::hashing::benchmark::BM_FarmFingerprint64_Short )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_FarmFingerprint64_Medium )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_FarmFingerprint64_Long )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_CityHash64_Long )->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_CityHash128_Long )->Repetitions( 3 );
+
 //----------------------------------------------
 // Integer hashing comparisons
 //----------------------------------------------
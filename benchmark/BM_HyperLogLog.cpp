@@ -0,0 +1,171 @@
+/**
+ * @file BM_HyperLogLog.cpp
+ * @brief HyperLogLog++ insertion, merge and estimation costs
+ * @details Times per-hash against batched insertion into dense sketches and sparse insertion into
+ *          fresh ones, register merges against a plain byte-wise max loop, and the estimator
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// HyperLogLog benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Dataset
+	//----------------------------------------------
+
+	static constexpr std::size_t HASH_COUNT{ 1u << 20 };
+
+	static const std::vector<uint64_t>& keyHashes()
+	{
+		static const std::vector<uint64_t> result = [] {
+			const Hasher<uint64_t> hasher;
+			std::vector<uint64_t> values( HASH_COUNT );
+			for ( std::size_t i = 0; i < HASH_COUNT; ++i )
+			{
+				values[i] = hasher( static_cast<uint64_t>( i ) );
+			}
+
+			return values;
+		}();
+
+		return result;
+	}
+
+	/** @brief Dense sketch of @p count hashes starting at @p offset */
+	static HyperLogLog<> denseSketch( unsigned int precision, std::size_t offset )
+	{
+		HyperLogLog<> sketch{ precision };
+		sketch.add( std::span<const uint64_t>{ keyHashes() }.subspan( offset, HASH_COUNT / 2 ) );
+
+		return sketch;
+	}
+
+	//----------------------------------------------
+	// Insertion
+	//----------------------------------------------
+
+	static void BM_Add( ::benchmark::State& state )
+	{
+		auto sketch = denseSketch( static_cast<unsigned int>( state.range( 0 ) ), 0 );
+		for ( auto _ : state )
+		{
+			for ( const auto hash : keyHashes() )
+			{
+				sketch.add( hash );
+			}
+			::benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed( state.iterations() * HASH_COUNT );
+	}
+
+	static void BM_AddBatch( ::benchmark::State& state )
+	{
+		auto sketch = denseSketch( static_cast<unsigned int>( state.range( 0 ) ), 0 );
+		for ( auto _ : state )
+		{
+			sketch.add( keyHashes() );
+			::benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed( state.iterations() * HASH_COUNT );
+	}
+
+	/** @brief Fresh sketch per iteration: sparse buffering, sorting and the dense conversion */
+	static void BM_AddSparse( ::benchmark::State& state )
+	{
+		const auto count = static_cast<std::size_t>( state.range( 0 ) );
+		const std::span<const uint64_t> hashes{ keyHashes().data(), count };
+		for ( auto _ : state )
+		{
+			HyperLogLog<> sketch;
+			sketch.add( hashes );
+			::benchmark::DoNotOptimize( sketch.isSparse() );
+		}
+		state.SetItemsProcessed( state.iterations() * count );
+	}
+
+	//----------------------------------------------
+	// Merge
+	//----------------------------------------------
+
+	static void BM_Merge( ::benchmark::State& state )
+	{
+		const auto precision = static_cast<unsigned int>( state.range( 0 ) );
+		auto sketch = denseSketch( precision, 0 );
+		const auto other = denseSketch( precision, HASH_COUNT / 2 );
+		for ( auto _ : state )
+		{
+			sketch.merge( other );
+			::benchmark::ClobberMemory();
+		}
+		state.SetBytesProcessed( state.iterations() * ( std::size_t{ 1 } << precision ) );
+	}
+
+	/** @brief Baseline: byte-wise max over plain register arrays */
+	static void BM_MergeBytewise( ::benchmark::State& state )
+	{
+		const std::size_t count = std::size_t{ 1 } << state.range( 0 );
+		std::vector<uint8_t> registers( count, 3 );
+		std::vector<uint8_t> other( count, 5 );
+		for ( auto _ : state )
+		{
+			uint8_t* target = registers.data();
+			const uint8_t* source = other.data();
+			::benchmark::DoNotOptimize( target );
+			for ( std::size_t i = 0; i < count; ++i )
+			{
+				target[i] = target[i] < source[i] ? source[i] : target[i];
+			}
+			::benchmark::ClobberMemory();
+		}
+		state.SetBytesProcessed( state.iterations() * count );
+	}
+
+	//----------------------------------------------
+	// Estimation
+	//----------------------------------------------
+
+	static void BM_Estimate( ::benchmark::State& state )
+	{
+		const auto sketch = denseSketch( static_cast<unsigned int>( state.range( 0 ) ), 0 );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( sketch.estimate() );
+		}
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------
+	// Insertion (argument = precision, or hash count for sparse)
+	//----------------------------
+
+	BENCHMARK( BM_Add )->Arg( 14 )->Arg( 18 )->Unit( ::benchmark::kMillisecond )->Repetitions( 3 );
+	BENCHMARK( BM_AddBatch )->Arg( 14 )->Arg( 18 )->Unit( ::benchmark::kMillisecond )->Repetitions( 3 );
+	BENCHMARK( BM_AddSparse )->Arg( 1000 )->Arg( 4000 )->Arg( 100000 )->Repetitions( 3 );
+
+	//----------------------------
+	// Merge (argument = precision)
+	//----------------------------
+
+	BENCHMARK( BM_Merge )->Arg( 14 )->Arg( 18 )->Repetitions( 3 );
+	BENCHMARK( BM_MergeBytewise )->Arg( 14 )->Arg( 18 )->Repetitions( 3 );
+
+	//----------------------------
+	// Estimation (argument = precision)
+	//----------------------------
+
+	BENCHMARK( BM_Estimate )->Arg( 14 )->Arg( 18 )->Repetitions( 3 );
+} // namespace nfx::hashing::benchmark
+
+BENCHMARK_MAIN();
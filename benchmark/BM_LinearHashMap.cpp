@@ -0,0 +1,100 @@
+/**
+ * @file BM_LinearHashMap.cpp
+ * @brief Per-insert latency percentiles of incremental versus doubling hash tables
+ * @details Times every insertion while filling LinearHashMap, FlatHashMap and std::unordered_map
+ *          from empty and reports p50 / p99 / p99.9 / p99.99 / max latency as counters
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// Insert latency benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Latency recording
+	//----------------------------------------------
+
+	static double percentile( std::vector<double>& sorted, double fraction )
+	{
+		const auto index = static_cast<size_t>( fraction * static_cast<double>( sorted.size() - 1 ) );
+
+		return sorted[index];
+	}
+
+	template <typename TMap>
+	static void insertLatencyBenchmark( ::benchmark::State& state )
+	{
+		const auto count = static_cast<size_t>( state.range( 0 ) );
+		std::vector<uint64_t> keys( count );
+		std::mt19937_64 gen( 42 );
+		for ( auto& key : keys )
+		{
+			key = gen();
+		}
+
+		std::vector<double> latencies( count );
+		for ( auto _ : state )
+		{
+			TMap map;
+			for ( size_t i = 0; i < count; ++i )
+			{
+				const auto start = std::chrono::steady_clock::now();
+				map[keys[i]] = i;
+				const auto stop = std::chrono::steady_clock::now();
+				latencies[i] = std::chrono::duration<double, std::nano>( stop - start ).count();
+			}
+			::benchmark::DoNotOptimize( map.size() );
+		}
+
+		std::sort( latencies.begin(), latencies.end() );
+		state.counters["p50_ns"] = percentile( latencies, 0.50 );
+		state.counters["p99_ns"] = percentile( latencies, 0.99 );
+		state.counters["p99.9_ns"] = percentile( latencies, 0.999 );
+		state.counters["p99.99_ns"] = percentile( latencies, 0.9999 );
+		state.counters["max_ns"] = latencies.back();
+	}
+
+	//----------------------------------------------
+	// Tables
+	//----------------------------------------------
+
+	static void BM_LinearHashMap_InsertLatency( ::benchmark::State& state )
+	{
+		insertLatencyBenchmark<LinearHashMap<uint64_t, uint64_t>>( state );
+	}
+
+	static void BM_FlatHashMap_InsertLatency( ::benchmark::State& state )
+	{
+		insertLatencyBenchmark<FlatHashMap<uint64_t, uint64_t>>( state );
+	}
+
+	static void BM_UnorderedMap_InsertLatency( ::benchmark::State& state )
+	{
+		insertLatencyBenchmark<std::unordered_map<uint64_t, uint64_t, Hasher<uint64_t>>>( state );
+	}
+} // namespace nfx::hashing::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------
+// Fill from empty, one timed insertion at a time
+//----------------------------
+
+BENCHMARK( nfx::hashing::benchmark::BM_LinearHashMap_InsertLatency )->Arg( 1 << 22 )->Iterations( 1 )->Unit( ::benchmark::kMillisecond );
+BENCHMARK( nfx::hashing::benchmark::BM_FlatHashMap_InsertLatency )->Arg( 1 << 22 )->Iterations( 1 )->Unit( ::benchmark::kMillisecond );
+BENCHMARK( nfx::hashing::benchmark::BM_UnorderedMap_InsertLatency )->Arg( 1 << 22 )->Iterations( 1 )->Unit( ::benchmark::kMillisecond );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,129 @@
+/**
+ * @file BM_MinimalPerfectHash.cpp
+ * @brief Build throughput, space and query cost of the minimal perfect hash function
+ * @details Builds over 10M random keys at several thread counts and reports bits per key, then
+ *          compares random queries with a FlatHashMap holding the same key-to-index mapping
+ */
+
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// Minimal perfect hash benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Dataset
+	//----------------------------------------------
+
+	static constexpr size_t KEY_COUNT{ 10'000'000 };
+
+	static const std::vector<uint64_t>& datasetKeys()
+	{
+		static const std::vector<uint64_t> keys = [] {
+			std::vector<uint64_t> result( KEY_COUNT );
+			std::mt19937_64 gen( 42 );
+			for ( auto& key : result )
+			{
+				key = gen();
+			}
+
+			return result;
+		}();
+
+		return keys;
+	}
+
+	//----------------------------------------------
+	// Build
+	//----------------------------------------------
+
+	static void BM_MinimalPerfectHash_Build( ::benchmark::State& state )
+	{
+		const auto& keys = datasetKeys();
+		MinimalPerfectHash<>::BuildOptions options;
+		options.gamma = static_cast<double>( state.range( 0 ) ) / 10.0;
+		options.threadCount = static_cast<size_t>( state.range( 1 ) );
+
+		double bitsPerKey = 0.0;
+		for ( auto _ : state )
+		{
+			const auto mphf = MinimalPerfectHash<>::build( keys, options );
+			bitsPerKey = mphf.bitsPerKey();
+			::benchmark::DoNotOptimize( mphf.size() );
+		}
+		state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( keys.size() ) );
+		state.counters["bits_per_key"] = bitsPerKey;
+	}
+
+	//----------------------------------------------
+	// Query
+	//----------------------------------------------
+
+	static void BM_MinimalPerfectHash_Query( ::benchmark::State& state )
+	{
+		const auto& keys = datasetKeys();
+		static MinimalPerfectHash<> mphf;
+		static std::once_flag built;
+		std::call_once( built, [&] { mphf = MinimalPerfectHash<>::build( keys ); } );
+
+		std::mt19937_64 gen( 7 );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( mphf( keys[gen() % keys.size()] ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	static void BM_FlatHashMap_IndexQuery( ::benchmark::State& state )
+	{
+		const auto& keys = datasetKeys();
+		static FlatHashMap<uint64_t, uint32_t> map;
+		static std::once_flag built;
+		std::call_once( built, [&] {
+			map.reserve( keys.size() );
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				map.try_emplace( keys[i], static_cast<uint32_t>( i ) );
+			}
+		} );
+
+		std::mt19937_64 gen( 7 );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( map.find( keys[gen() % keys.size()] ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------
+	// Build (gamma x 10, threads)
+	//----------------------------
+
+	BENCHMARK( BM_MinimalPerfectHash_Build )
+		->ArgsProduct( { { 10, 20 }, { 1, 4 } } )
+		->Unit( ::benchmark::kMillisecond )
+		->Iterations( 1 )
+		->UseRealTime()
+		->Repetitions( 3 );
+
+	//----------------------------
+	// Query
+	//----------------------------
+
+	BENCHMARK( BM_MinimalPerfectHash_Query )->Repetitions( 3 );
+	BENCHMARK( BM_FlatHashMap_IndexQuery )->Repetitions( 3 );
+} // namespace nfx::hashing::benchmark
+
+BENCHMARK_MAIN();
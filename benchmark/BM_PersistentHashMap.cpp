@@ -0,0 +1,158 @@
+/**
+ * @file BM_PersistentHashMap.cpp
+ * @brief Versioned-map update and read cost: persistent HAMT versus copy-on-write unordered_map
+ * @details Publishes single-key updates to a map of N entries - a path copy for the HAMT, a full
+ *          copy for std::unordered_map behind an atomic shared_ptr - and times lookups through a
+ *          reader snapshot of each
+ */
+
+#include <atomic>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// Persistent hash map benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Dataset
+	//----------------------------------------------
+
+	static std::vector<uint64_t> makeKeys( std::size_t count )
+	{
+		std::vector<uint64_t> keys( count );
+		std::mt19937_64 gen( 42 );
+		for ( auto& key : keys )
+		{
+			key = gen();
+		}
+
+		return keys;
+	}
+
+	using CowMap = std::unordered_map<uint64_t, uint64_t, Hasher<uint64_t>>;
+
+	//----------------------------------------------
+	// Publish one update
+	//----------------------------------------------
+
+	static void BM_PersistentHashMap_Update( ::benchmark::State& state )
+	{
+		const auto keys = makeKeys( static_cast<std::size_t>( state.range( 0 ) ) );
+		PersistentHashMap<uint64_t, uint64_t> initial;
+		for ( const auto key : keys )
+		{
+			initial = initial.set( key, key );
+		}
+		AtomicPersistentHashMap<uint64_t, uint64_t> map{ initial };
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			const uint64_t key = keys[i++ % keys.size()];
+			map.update( [&]( const auto& current ) { return current.set( key, i ); } );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	static void BM_CopyOnWriteUnorderedMap_Update( ::benchmark::State& state )
+	{
+		const auto keys = makeKeys( static_cast<std::size_t>( state.range( 0 ) ) );
+		auto initial = std::make_shared<CowMap>();
+		for ( const auto key : keys )
+		{
+			initial->emplace( key, key );
+		}
+		std::atomic<std::shared_ptr<const CowMap>> map{ std::move( initial ) };
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			const uint64_t key = keys[i++ % keys.size()];
+			auto next = std::make_shared<CowMap>( *map.load() );
+			( *next )[key] = i;
+			map.store( std::move( next ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	//----------------------------------------------
+	// Read through a snapshot
+	//----------------------------------------------
+
+	static void BM_PersistentHashMap_SnapshotFind( ::benchmark::State& state )
+	{
+		const auto keys = makeKeys( static_cast<std::size_t>( state.range( 0 ) ) );
+		PersistentHashMap<uint64_t, uint64_t> initial;
+		for ( const auto key : keys )
+		{
+			initial = initial.set( key, key );
+		}
+		const AtomicPersistentHashMap<uint64_t, uint64_t> map{ initial };
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			const auto snapshot = map.snapshot();
+			uint64_t sum = 0;
+			for ( std::size_t j = 0; j < 64; ++j )
+			{
+				sum += *snapshot->find( keys[i++ % keys.size()] );
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+		state.SetItemsProcessed( state.iterations() * 64 );
+	}
+
+	static void BM_CopyOnWriteUnorderedMap_SnapshotFind( ::benchmark::State& state )
+	{
+		const auto keys = makeKeys( static_cast<std::size_t>( state.range( 0 ) ) );
+		auto initial = std::make_shared<CowMap>();
+		for ( const auto key : keys )
+		{
+			initial->emplace( key, key );
+		}
+		const std::atomic<std::shared_ptr<const CowMap>> map{ std::move( initial ) };
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			const auto snapshot = map.load();
+			uint64_t sum = 0;
+			for ( std::size_t j = 0; j < 64; ++j )
+			{
+				sum += snapshot->find( keys[i++ % keys.size()] )->second;
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+		state.SetItemsProcessed( state.iterations() * 64 );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------
+	// Update
+	//----------------------------
+
+	BENCHMARK( BM_PersistentHashMap_Update )->Arg( 1000 )->Arg( 100000 )->Repetitions( 3 );
+	BENCHMARK( BM_CopyOnWriteUnorderedMap_Update )->Arg( 1000 )->Arg( 100000 )->Repetitions( 3 );
+
+	//----------------------------
+	// Lookup
+	//----------------------------
+
+	BENCHMARK( BM_PersistentHashMap_SnapshotFind )->Arg( 1000 )->Arg( 100000 )->Repetitions( 3 );
+	BENCHMARK( BM_CopyOnWriteUnorderedMap_SnapshotFind )->Arg( 1000 )->Arg( 100000 )->Repetitions( 3 );
+} // namespace nfx::hashing::benchmark
+
+BENCHMARK_MAIN();
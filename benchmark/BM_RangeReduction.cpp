@@ -0,0 +1,198 @@
+/**
+ * @file BM_RangeReduction.cpp
+ * @brief Bucket index computation: modulo versus fastrange, masking versus Fibonacci hashing
+ * @details Reduces a run of 64-bit and 32-bit hashes onto a non-power-of-two range with `%` and with
+ *          fastRange(), scalar and batched, and onto a power-of-two range with a mask and with
+ *          fibonacciRange()
+ */
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// Range reduction benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Dataset
+	//----------------------------------------------
+
+	static constexpr std::size_t HASH_COUNT{ 4096 };
+
+	/** @brief Range sized for a memory budget rather than a power of 2 */
+	static constexpr uint64_t RANGE{ 1'500'007 };
+
+	/** @brief Log2 of the power-of-two range */
+	static constexpr unsigned int BITS{ 20 };
+
+	template <typename HashType>
+	static std::vector<HashType> randomHashes()
+	{
+		std::vector<HashType> values( HASH_COUNT );
+		std::mt19937_64 rng{ 42 };
+		for ( auto& value : values )
+		{
+			value = static_cast<HashType>( rng() );
+		}
+
+		return values;
+	}
+
+	//----------------------------------------------
+	// Arbitrary range
+	//----------------------------------------------
+
+	template <typename HashType>
+	static void BM_Modulo( ::benchmark::State& state )
+	{
+		const auto hashes = randomHashes<HashType>();
+		std::vector<HashType> indexes( HASH_COUNT );
+		// Opaque to the optimizer, as a runtime table size is
+		HashType range = static_cast<HashType>( RANGE );
+		::benchmark::DoNotOptimize( range );
+
+		for ( auto _ : state )
+		{
+			for ( std::size_t i = 0; i < HASH_COUNT; ++i )
+			{
+				indexes[i] = hashes[i] % range;
+			}
+			::benchmark::DoNotOptimize( indexes.data() );
+			::benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed( state.iterations() * HASH_COUNT );
+	}
+
+	template <typename HashType>
+	static void BM_FastRange( ::benchmark::State& state )
+	{
+		const auto hashes = randomHashes<HashType>();
+		std::vector<HashType> indexes( HASH_COUNT );
+		HashType range = static_cast<HashType>( RANGE );
+		::benchmark::DoNotOptimize( range );
+
+		for ( auto _ : state )
+		{
+			for ( std::size_t i = 0; i < HASH_COUNT; ++i )
+			{
+				indexes[i] = fastRange<HashType>( hashes[i], range );
+			}
+			::benchmark::DoNotOptimize( indexes.data() );
+			::benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed( state.iterations() * HASH_COUNT );
+	}
+
+	template <typename HashType>
+	static void BM_FastRangeBatched( ::benchmark::State& state )
+	{
+		const auto hashes = randomHashes<HashType>();
+		std::vector<HashType> indexes( HASH_COUNT );
+		HashType range = static_cast<HashType>( RANGE );
+		::benchmark::DoNotOptimize( range );
+
+		for ( auto _ : state )
+		{
+			fastRange( std::span<const HashType>{ hashes }, range, std::span<HashType>{ indexes } );
+			::benchmark::DoNotOptimize( indexes.data() );
+			::benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed( state.iterations() * HASH_COUNT );
+	}
+
+	//----------------------------------------------
+	// Power-of-two range
+	//----------------------------------------------
+
+	template <typename HashType>
+	static void BM_Mask( ::benchmark::State& state )
+	{
+		const auto hashes = randomHashes<HashType>();
+		std::vector<HashType> indexes( HASH_COUNT );
+		unsigned int bits = BITS;
+		::benchmark::DoNotOptimize( bits );
+
+		for ( auto _ : state )
+		{
+			const HashType mask = ( HashType{ 1 } << bits ) - 1;
+			for ( std::size_t i = 0; i < HASH_COUNT; ++i )
+			{
+				indexes[i] = hashes[i] & mask;
+			}
+			::benchmark::DoNotOptimize( indexes.data() );
+			::benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed( state.iterations() * HASH_COUNT );
+	}
+
+	template <typename HashType>
+	static void BM_Fibonacci( ::benchmark::State& state )
+	{
+		const auto hashes = randomHashes<HashType>();
+		std::vector<HashType> indexes( HASH_COUNT );
+		unsigned int bits = BITS;
+		::benchmark::DoNotOptimize( bits );
+
+		for ( auto _ : state )
+		{
+			for ( std::size_t i = 0; i < HASH_COUNT; ++i )
+			{
+				indexes[i] = fibonacciRange<HashType>( hashes[i], bits );
+			}
+			::benchmark::DoNotOptimize( indexes.data() );
+			::benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed( state.iterations() * HASH_COUNT );
+	}
+
+	template <typename HashType>
+	static void BM_FibonacciBatched( ::benchmark::State& state )
+	{
+		const auto hashes = randomHashes<HashType>();
+		std::vector<HashType> indexes( HASH_COUNT );
+		unsigned int bits = BITS;
+		::benchmark::DoNotOptimize( bits );
+
+		for ( auto _ : state )
+		{
+			fibonacciRange( std::span<const HashType>{ hashes }, bits, std::span<HashType>{ indexes } );
+			::benchmark::DoNotOptimize( indexes.data() );
+			::benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed( state.iterations() * HASH_COUNT );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------
+	// Arbitrary range
+	//----------------------------
+
+	BENCHMARK( BM_Modulo<uint64_t> )->Repetitions( 3 );
+	BENCHMARK( BM_FastRange<uint64_t> )->Repetitions( 3 );
+	BENCHMARK( BM_FastRangeBatched<uint64_t> )->Repetitions( 3 );
+	BENCHMARK( BM_Modulo<uint32_t> )->Repetitions( 3 );
+	BENCHMARK( BM_FastRange<uint32_t> )->Repetitions( 3 );
+	BENCHMARK( BM_FastRangeBatched<uint32_t> )->Repetitions( 3 );
+
+	//----------------------------
+	// Power-of-two range
+	//----------------------------
+
+	BENCHMARK( BM_Mask<uint64_t> )->Repetitions( 3 );
+	BENCHMARK( BM_Fibonacci<uint64_t> )->Repetitions( 3 );
+	BENCHMARK( BM_FibonacciBatched<uint64_t> )->Repetitions( 3 );
+	BENCHMARK( BM_Mask<uint32_t> )->Repetitions( 3 );
+	BENCHMARK( BM_Fibonacci<uint32_t> )->Repetitions( 3 );
+	BENCHMARK( BM_FibonacciBatched<uint32_t> )->Repetitions( 3 );
+} // namespace nfx::hashing::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,198 @@
+/**
+ * @file BM_SeedPolicies.cpp
+ * @brief FlatHashMap seed policies under adversarial and ordinary keys
+ * @details Inserts keys crafted so that their hashes share every bit the fixed layout uses for the
+ *          probe start, which drives FixedSeed to quadratic insertion; copies one table into another
+ *          by iteration, which is superlinear when both share a seed and linear once each table is
+ *          salted; and compares the policies on random keys to show the cost of mixing in a seed
+ */
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// Seed policy benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Datasets
+	//----------------------------------------------
+
+	/** @brief Keys whose Hasher<uint64_t> values differ only above bit 40 (crafted with unhashInteger) */
+	static std::vector<uint64_t> adversarialKeys( std::size_t count )
+	{
+		std::vector<uint64_t> keys( count );
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			keys[i] = unhashInteger<constants::FNV_OFFSET_BASIS_64>( static_cast<uint64_t>( i + 1 ) << 40 );
+		}
+
+		return keys;
+	}
+
+	static std::vector<uint64_t> randomKeys( std::size_t count )
+	{
+		std::vector<uint64_t> keys( count );
+		std::mt19937_64 gen( 42 );
+		for ( auto& key : keys )
+		{
+			key = gen();
+		}
+
+		return keys;
+	}
+
+	template <typename TSeedPolicy>
+	using Map = FlatHashMap<uint64_t, uint64_t, Hasher<uint64_t>, std::equal_to<>, TSeedPolicy>;
+
+	//----------------------------------------------
+	// Insert
+	//----------------------------------------------
+
+	template <typename TSeedPolicy>
+	static void BM_Insert( ::benchmark::State& state, std::vector<uint64_t> ( *makeKeys )( std::size_t ) )
+	{
+		const auto keys = makeKeys( static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			Map<TSeedPolicy> map;
+			for ( const auto key : keys )
+			{
+				map.try_emplace( key, key );
+			}
+			::benchmark::DoNotOptimize( map.size() );
+		}
+		state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+	}
+
+	static void BM_FixedSeed_AdversarialInsert( ::benchmark::State& state )
+	{
+		BM_Insert<policies::FixedSeed>( state, adversarialKeys );
+	}
+
+	static void BM_AdaptiveSeed_AdversarialInsert( ::benchmark::State& state )
+	{
+		BM_Insert<policies::AdaptiveSeed>( state, adversarialKeys );
+	}
+
+	static void BM_FixedSeed_RandomInsert( ::benchmark::State& state )
+	{
+		BM_Insert<policies::FixedSeed>( state, randomKeys );
+	}
+
+	static void BM_AdaptiveSeed_RandomInsert( ::benchmark::State& state )
+	{
+		BM_Insert<policies::AdaptiveSeed>( state, randomKeys );
+	}
+
+	//----------------------------------------------
+	// Cross-table insertion (regression)
+	//----------------------------------------------
+
+	/** @brief Iterates a table at 60% load and inserts every key into a fresh table of the same kind */
+	template <typename TSeedPolicy>
+	static void BM_CrossTableInsert( ::benchmark::State& state )
+	{
+		const auto count = static_cast<std::size_t>( state.range( 0 ) );
+		const auto keys = randomKeys( count );
+		Map<TSeedPolicy> source;
+		for ( const auto key : keys )
+		{
+			source.try_emplace( key, key );
+		}
+
+		for ( auto _ : state )
+		{
+			Map<TSeedPolicy> destination;
+			for ( const auto& [key, value] : source )
+			{
+				destination.try_emplace( key, value );
+			}
+			::benchmark::DoNotOptimize( destination.size() );
+		}
+		state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+	}
+
+	static void BM_FixedSeed_CrossTableInsert( ::benchmark::State& state )
+	{
+		BM_CrossTableInsert<policies::FixedSeed>( state );
+	}
+
+	static void BM_SaltedSeed_CrossTableInsert( ::benchmark::State& state )
+	{
+		BM_CrossTableInsert<policies::SaltedSeed>( state );
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <typename TSeedPolicy>
+	static void BM_Find( ::benchmark::State& state )
+	{
+		const auto keys = randomKeys( 1u << 20 );
+		Map<TSeedPolicy> map;
+		for ( const auto key : keys )
+		{
+			map.try_emplace( key, key );
+		}
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( map.find( keys[i++ & ( keys.size() - 1 )] ) );
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	static void BM_FixedSeed_Find( ::benchmark::State& state )
+	{
+		BM_Find<policies::FixedSeed>( state );
+	}
+
+	static void BM_SaltedSeed_Find( ::benchmark::State& state )
+	{
+		BM_Find<policies::SaltedSeed>( state );
+	}
+
+	static void BM_AdaptiveSeed_Find( ::benchmark::State& state )
+	{
+		BM_Find<policies::AdaptiveSeed>( state );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------
+	// Adversarial keys
+	//----------------------------
+
+	BENCHMARK( BM_FixedSeed_AdversarialInsert )->Arg( 4096 )->Arg( 16384 )->Unit( ::benchmark::kMillisecond )->Repetitions( 3 );
+	BENCHMARK( BM_AdaptiveSeed_AdversarialInsert )->Arg( 4096 )->Arg( 16384 )->Unit( ::benchmark::kMillisecond )->Repetitions( 3 );
+
+	//----------------------------
+	// Cross-table insertion
+	//----------------------------
+
+	BENCHMARK( BM_FixedSeed_CrossTableInsert )->Arg( 39321 )->Arg( 629145 )->Arg( 2516582 )->Unit( ::benchmark::kMillisecond )->Repetitions( 3 );
+	BENCHMARK( BM_SaltedSeed_CrossTableInsert )->Arg( 39321 )->Arg( 629145 )->Arg( 2516582 )->Unit( ::benchmark::kMillisecond )->Repetitions( 3 );
+
+	//----------------------------
+	// Random keys
+	//----------------------------
+
+	BENCHMARK( BM_FixedSeed_RandomInsert )->Arg( 1 << 20 )->Unit( ::benchmark::kMillisecond )->Repetitions( 3 );
+	BENCHMARK( BM_AdaptiveSeed_RandomInsert )->Arg( 1 << 20 )->Unit( ::benchmark::kMillisecond )->Repetitions( 3 );
+	BENCHMARK( BM_FixedSeed_Find )->Repetitions( 3 );
+	BENCHMARK( BM_SaltedSeed_Find )->Repetitions( 3 );
+	BENCHMARK( BM_AdaptiveSeed_Find )->Repetitions( 3 );
+} // namespace nfx::hashing::benchmark
+
+BENCHMARK_MAIN();
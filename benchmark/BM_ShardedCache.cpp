@@ -0,0 +1,147 @@
+/**
+ * @file BM_ShardedCache.cpp
+ * @brief Contention benchmark for ShardedCache
+ * @details Skewed read-mostly workload across thread counts for LruCache, ClockCache and the
+ *          conventional std::unordered_map + std::list cache behind a single mutex
+ */
+
+#include <list>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// ShardedCache benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Workload
+	//----------------------------------------------
+
+	static constexpr uint64_t CACHE_CAPACITY = 1 << 16;
+	static constexpr uint64_t KEY_SPACE = 1 << 18;
+
+	/** @brief Skewed key stream: squaring a uniform variate concentrates accesses on low keys */
+	static std::vector<uint64_t> generateAccesses( int threadIndex )
+	{
+		std::mt19937_64 gen( static_cast<uint64_t>( threadIndex ) + 1 );
+		std::uniform_real_distribution<double> uniform( 0.0, 1.0 );
+
+		std::vector<uint64_t> accesses( 1 << 20 );
+		for ( auto& key : accesses )
+		{
+			const double u = uniform( gen );
+			key = static_cast<uint64_t>( u * u * u * static_cast<double>( KEY_SPACE ) );
+		}
+
+		return accesses;
+	}
+
+	/** @brief Conventional LRU cache: one lock, one allocation per insert */
+	class MutexLruCache
+	{
+	public:
+		std::optional<uint64_t> get( uint64_t key )
+		{
+			std::lock_guard lock{ m_mutex };
+			const auto it = m_index.find( key );
+			if ( it == m_index.end() )
+			{
+				return std::nullopt;
+			}
+			m_order.splice( m_order.begin(), m_order, it->second );
+
+			return it->second->second;
+		}
+
+		void put( uint64_t key, uint64_t value )
+		{
+			std::lock_guard lock{ m_mutex };
+			if ( const auto it = m_index.find( key ); it != m_index.end() )
+			{
+				it->second->second = value;
+				m_order.splice( m_order.begin(), m_order, it->second );
+				return;
+			}
+			m_order.emplace_front( key, value );
+			m_index.emplace( key, m_order.begin() );
+			if ( m_order.size() > CACHE_CAPACITY )
+			{
+				m_index.erase( m_order.back().first );
+				m_order.pop_back();
+			}
+		}
+
+	private:
+		std::mutex m_mutex;
+		std::list<std::pair<uint64_t, uint64_t>> m_order;
+		std::unordered_map<uint64_t, std::list<std::pair<uint64_t, uint64_t>>::iterator, Hasher<uint64_t>> m_index;
+	};
+
+	template <typename TCache>
+	static void cacheBenchmark( ::benchmark::State& state, TCache& cache )
+	{
+		const auto accesses = generateAccesses( state.thread_index() );
+		size_t i = 0;
+		uint64_t hits = 0;
+
+		for ( auto _ : state )
+		{
+			const uint64_t key = accesses[i++ & ( accesses.size() - 1 )];
+			if ( const auto value = cache.get( key ) )
+			{
+				hits += *value == key ? 1 : 0;
+			}
+			else
+			{
+				cache.put( key, key );
+			}
+		}
+		state.SetItemsProcessed( state.iterations() );
+		state.counters["hit_rate"] = ::benchmark::Counter( static_cast<double>( hits ) / static_cast<double>( state.iterations() ), ::benchmark::Counter::kAvgThreads );
+	}
+
+	//----------------------------------------------
+	// Caches
+	//----------------------------------------------
+
+	static void BM_LruCache( ::benchmark::State& state )
+	{
+		static LruCache<uint64_t, uint64_t> cache{ CACHE_CAPACITY };
+		cacheBenchmark( state, cache );
+	}
+
+	static void BM_ClockCache( ::benchmark::State& state )
+	{
+		static ClockCache<uint64_t, uint64_t> cache{ CACHE_CAPACITY };
+		cacheBenchmark( state, cache );
+	}
+
+	static void BM_MutexListCache( ::benchmark::State& state )
+	{
+		static MutexLruCache cache;
+		cacheBenchmark( state, cache );
+	}
+} // namespace nfx::hashing::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------
+// Contention across thread counts
+//----------------------------
+
+BENCHMARK( nfx::hashing::benchmark::BM_LruCache )->ThreadRange( 1, 64 )->UseRealTime()->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_ClockCache )->ThreadRange( 1, 64 )->UseRealTime()->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_MutexListCache )->ThreadRange( 1, 64 )->UseRealTime()->Repetitions( 3 );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,157 @@
+/**
+ * @file BM_SharedHashTable.cpp
+ * @brief Session lookup cost: shared-memory table versus a request to a local daemon
+ * @details Looks session ids up directly in a SharedHashTable segment and, for comparison, through
+ *          a Unix socket round trip to a thread serving a std::unordered_map - the path the shared
+ *          table replaces
+ */
+
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+#if !defined( _WIN32 )
+#	include <sys/socket.h>
+#	include <unistd.h>
+#endif
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// Shared hash table benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Dataset
+	//----------------------------------------------
+
+	static constexpr std::size_t SESSION_COUNT{ 1u << 18 };
+
+	struct Session
+	{
+		uint64_t user;
+		uint64_t expiry;
+	};
+
+	static const std::vector<uint64_t>& sessionIds()
+	{
+		static const std::vector<uint64_t> ids = [] {
+			std::vector<uint64_t> result( SESSION_COUNT );
+			std::mt19937_64 gen( 42 );
+			for ( auto& id : result )
+			{
+				id = gen();
+			}
+
+			return result;
+		}();
+
+		return ids;
+	}
+
+	//----------------------------------------------
+	// Shared-memory lookup
+	//----------------------------------------------
+
+	static void BM_SharedHashTable_Find( ::benchmark::State& state )
+	{
+		using Table = SharedHashTable<uint64_t, Session>;
+		const auto& ids = sessionIds();
+#if defined( _WIN32 )
+		const std::string name = "nfx-bm-sessions";
+#else
+		const std::string name = "/nfx-bm-sessions-" + std::to_string( ::getpid() );
+#endif
+		Table::remove( name );
+		auto owner = Table::create( name, 2 * SESSION_COUNT );
+		for ( const auto id : ids )
+		{
+			owner.insert_or_assign( id, Session{ id, id + 1 } );
+		}
+		const auto worker = Table::open( name );
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			const auto session = worker.find( ids[i++ % ids.size()] );
+			::benchmark::DoNotOptimize( session );
+		}
+		state.SetItemsProcessed( state.iterations() );
+		Table::remove( name );
+	}
+
+#if !defined( _WIN32 )
+	//----------------------------------------------
+	// Socket round trip to a daemon
+	//----------------------------------------------
+
+	static void BM_SocketDaemon_Find( ::benchmark::State& state )
+	{
+		const auto& ids = sessionIds();
+		std::unordered_map<uint64_t, Session> sessions;
+		for ( const auto id : ids )
+		{
+			sessions.emplace( id, Session{ id, id + 1 } );
+		}
+
+		int sockets[2];
+		if ( ::socketpair( AF_UNIX, SOCK_STREAM, 0, sockets ) != 0 )
+		{
+			state.SkipWithError( "socketpair failed" );
+			return;
+		}
+
+		std::thread daemon{ [&] {
+			uint64_t id = 0;
+			while ( ::read( sockets[1], &id, sizeof( id ) ) == sizeof( id ) )
+			{
+				const auto it = sessions.find( id );
+				const Session reply = it != sessions.end() ? it->second : Session{};
+				if ( ::write( sockets[1], &reply, sizeof( reply ) ) != sizeof( reply ) )
+				{
+					break;
+				}
+			}
+		} };
+
+		std::size_t i = 0;
+		for ( auto _ : state )
+		{
+			const uint64_t id = ids[i++ % ids.size()];
+			Session reply{};
+			if ( ::write( sockets[0], &id, sizeof( id ) ) != sizeof( id ) || ::read( sockets[0], &reply, sizeof( reply ) ) != sizeof( reply ) )
+			{
+				state.SkipWithError( "daemon round trip failed" );
+				break;
+			}
+			::benchmark::DoNotOptimize( reply );
+		}
+		state.SetItemsProcessed( state.iterations() );
+
+		::close( sockets[0] );
+		daemon.join();
+		::close( sockets[1] );
+	}
+#endif
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	//----------------------------
+	// Lookup
+	//----------------------------
+
+	BENCHMARK( BM_SharedHashTable_Find )->Repetitions( 3 );
+#if !defined( _WIN32 )
+	BENCHMARK( BM_SocketDaemon_Find )->Repetitions( 3 );
+#endif
+} // namespace nfx::hashing::benchmark
+
+BENCHMARK_MAIN();
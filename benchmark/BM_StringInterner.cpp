@@ -0,0 +1,111 @@
+/**
+ * @file BM_StringInterner.cpp
+ * @brief Benchmark StringInterner against a mutex-guarded std::unordered_map interner
+ * @details Interns a stream of repeated metric-style names from one or more threads
+ */
+
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::benchmark
+{
+	//=====================================================================
+	// StringInterner benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data generation
+	//----------------------------------------------
+
+	static constexpr size_t DISTINCT_NAMES = 10000;
+
+	static const std::vector<std::string>& names()
+	{
+		static const std::vector<std::string> generated = [] {
+			std::vector<std::string> result;
+			result.reserve( DISTINCT_NAMES );
+			for ( size_t i = 0; i < DISTINCT_NAMES; ++i )
+			{
+				result.push_back( "service.http.requests{route=/api/v1/items/" + std::to_string( i ) + "}" );
+			}
+			return result;
+		}();
+
+		return generated;
+	}
+
+	/** @brief Conventional interner: one allocation per string, one global lock */
+	struct MutexInterner
+	{
+		uint32_t intern( std::string_view text )
+		{
+			std::lock_guard lock{ mutex };
+			const auto it = ids.find( text );
+			if ( it != ids.end() )
+			{
+				return it->second;
+			}
+			const auto id = static_cast<uint32_t>( strings.size() );
+			strings.emplace_back( text );
+			ids.emplace( std::string{ text }, id );
+
+			return id;
+		}
+
+		std::mutex mutex;
+		std::unordered_map<std::string, uint32_t, Hasher<uint64_t>, std::equal_to<>> ids;
+		std::vector<std::string> strings;
+	};
+
+	//----------------------------------------------
+	// Interning
+	//----------------------------------------------
+
+	static void BM_StringInterner_Intern( ::benchmark::State& state )
+	{
+		static StringInterner interner{ DISTINCT_NAMES };
+		const auto& input = names();
+		size_t i = static_cast<size_t>( state.thread_index() ) * 977;
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( interner.intern( input[i % DISTINCT_NAMES] ) );
+			i += 7;
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	static void BM_MutexInterner_Intern( ::benchmark::State& state )
+	{
+		static MutexInterner interner;
+		const auto& input = names();
+		size_t i = static_cast<size_t>( state.thread_index() ) * 977;
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( interner.intern( input[i % DISTINCT_NAMES] ) );
+			i += 7;
+		}
+		state.SetItemsProcessed( state.iterations() );
+	}
+} // namespace nfx::hashing::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------
+// Interning repeated names
+//----------------------------
+
+BENCHMARK( nfx::hashing::benchmark::BM_StringInterner_Intern )->ThreadRange( 1, 16 )->UseRealTime()->Repetitions( 3 );
+BENCHMARK( nfx::hashing::benchmark::BM_MutexInterner_Intern )->ThreadRange( 1, 16 )->UseRealTime()->Repetitions( 3 );
+
+BENCHMARK_MAIN();
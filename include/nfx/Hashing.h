@@ -32,5 +32,26 @@
 #pragma once
 
 #include "hashing/Algorithms.h"
+#include "hashing/BatchLookup.h"
+#include "hashing/BinaryFuseFilter.h"
+#include "hashing/BloomFilter.h"
+#include "hashing/CompactIntegerSet.h"
+#include "hashing/ConcurrentHashMap.h"
+#include "hashing/Crc.h"
+#include "hashing/CuckooFilter.h"
+#include "hashing/FlatHashMap.h"
+#include "hashing/FrozenMap.h"
 #include "hashing/Hash.h"
+#include "hashing/HashedStringRef.h"
+#include "hashing/HashIndex.h"
 #include "hashing/Hasher.h"
+#include "hashing/HyperLogLog.h"
+#include "hashing/LinearHashMap.h"
+#include "hashing/MappedFile.h"
+#include "hashing/MinimalPerfectHash.h"
+#include "hashing/PersistentHashMap.h"
+#include "hashing/RangeReduction.h"
+#include "hashing/SeedPolicies.h"
+#include "hashing/ShardedCache.h"
+#include "hashing/SharedHashTable.h"
+#include "hashing/StringInterner.h"
@@ -25,7 +25,8 @@
 /**
  * @file Algorithms.inl
  * @brief Implementation of low-level hash primitives and mixing functions
- * @details Implements Larson, fnv1a, crc32c, seedMix, and combine for use in higher-level hash APIs.
+ * @details Implements Larson, fnv1a, crc32c, FarmHash/CityHash fingerprints, seedMix, and combine
+ *          for use in higher-level hash APIs.
  */
 
 #if defined( __GNUC__ ) || defined( __clang__ )
@@ -35,8 +36,19 @@
 #	include <intrin.h>
 #	include <nmmintrin.h>
 #endif
+#include <immintrin.h>
 
 #include <array>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+// Enables instruction set extensions for a single function (runtime-dispatched kernels)
+#if defined( __GNUC__ ) || defined( __clang__ )
+#	define NFX_HASHING_TARGET( features ) __attribute__( ( target( features ) ) )
+#else
+#	define NFX_HASHING_TARGET( features )
+#endif
 
 namespace nfx::hashing
 {
@@ -47,7 +59,14 @@ namespace nfx::hashing
 	namespace internal
 	{
 		constexpr int CPUID_FEATURE_INFO_LEAF = 1;
+		constexpr int CPUID_EXTENDED_FEATURES_LEAF = 7;
+		constexpr int ECX_PCLMULQDQ_BIT = 1;
 		constexpr int ECX_SSE42_BIT = 20;
+		constexpr int ECX_OSXSAVE_BIT = 27;
+		constexpr int ECX_AVX_BIT = 28;
+		constexpr int EBX_AVX2_BIT = 5;
+		constexpr int ECX_VPCLMULQDQ_BIT = 10;
+		constexpr unsigned int XCR0_SSE_AVX_STATE = 0x6;
 
 		//----------------------------------------------
 		// SSE4.2 Detection
@@ -73,6 +92,1048 @@ namespace nfx::hashing
 
 			return s_hasSse42;
 		}
+
+		//----------------------------------------------
+		// PCLMULQDQ / AVX2 / VPCLMULQDQ Detection
+		//----------------------------------------------
+
+		struct CpuFeatures
+		{
+			bool pclmulqdq = false;
+			bool avx2 = false;
+			bool vpclmulqdq = false;
+		};
+
+		inline const CpuFeatures& cpuFeatures() noexcept
+		{
+			static const CpuFeatures s_features = []() {
+				CpuFeatures features;
+				unsigned int leaf1Ecx = 0;
+				unsigned int leaf7Ebx = 0;
+				unsigned int leaf7Ecx = 0;
+				unsigned int xcr0 = 0;
+#if defined( __GNUC__ ) || defined( __clang__ )
+				unsigned int eax, ebx, ecx, edx;
+				if ( __get_cpuid( internal::CPUID_FEATURE_INFO_LEAF, &eax, &ebx, &ecx, &edx ) )
+				{
+					leaf1Ecx = ecx;
+				}
+				if ( __get_cpuid_count( internal::CPUID_EXTENDED_FEATURES_LEAF, 0, &eax, &ebx, &ecx, &edx ) )
+				{
+					leaf7Ebx = ebx;
+					leaf7Ecx = ecx;
+				}
+				if ( leaf1Ecx & ( 1u << internal::ECX_OSXSAVE_BIT ) )
+				{
+					// XGETBV via inline assembly: the intrinsic requires -mxsave
+					unsigned int xcr0High;
+					__asm__( "xgetbv" : "=a"( xcr0 ), "=d"( xcr0High ) : "c"( 0 ) );
+				}
+#elif defined( _MSC_VER )
+				std::array<int, 4> cpuInfo{};
+				__cpuid( cpuInfo.data(), internal::CPUID_FEATURE_INFO_LEAF );
+				leaf1Ecx = static_cast<unsigned int>( cpuInfo[2] );
+				__cpuidex( cpuInfo.data(), internal::CPUID_EXTENDED_FEATURES_LEAF, 0 );
+				leaf7Ebx = static_cast<unsigned int>( cpuInfo[1] );
+				leaf7Ecx = static_cast<unsigned int>( cpuInfo[2] );
+				if ( leaf1Ecx & ( 1u << internal::ECX_OSXSAVE_BIT ) )
+				{
+					xcr0 = static_cast<unsigned int>( _xgetbv( 0 ) );
+				}
+#endif
+				// AVX state must be enabled by the OS, not just supported by the CPU
+				const bool osAvx = ( leaf1Ecx & ( 1u << internal::ECX_AVX_BIT ) ) != 0 &&
+								   ( xcr0 & internal::XCR0_SSE_AVX_STATE ) == internal::XCR0_SSE_AVX_STATE;
+
+				features.pclmulqdq = ( leaf1Ecx & ( 1u << internal::ECX_PCLMULQDQ_BIT ) ) != 0;
+				features.avx2 = osAvx && ( leaf7Ebx & ( 1u << internal::EBX_AVX2_BIT ) ) != 0;
+				features.vpclmulqdq = features.avx2 && features.pclmulqdq && ( leaf7Ecx & ( 1u << internal::ECX_VPCLMULQDQ_BIT ) ) != 0;
+
+				return features;
+			}();
+
+			return s_features;
+		}
+
+		inline bool hasPclmulqdqSupport() noexcept
+		{
+#if defined( __PCLMUL__ ) || ( defined( _MSC_VER ) && defined( __AVX2__ ) )
+			return true;
+#else
+			return cpuFeatures().pclmulqdq;
+#endif
+		}
+
+		inline bool hasAvx2Support() noexcept
+		{
+#if defined( __AVX2__ )
+			return true;
+#else
+			return cpuFeatures().avx2;
+#endif
+		}
+
+		inline bool hasVpclmulqdqSupport() noexcept
+		{
+#if defined( __VPCLMULQDQ__ ) && defined( __AVX2__ )
+			return true;
+#else
+			return cpuFeatures().vpclmulqdq;
+#endif
+		}
+
+		//----------------------------------------------
+		// CRC engines
+		//----------------------------------------------
+
+		namespace crc
+		{
+			/** @brief Reverses the low @p width bits of @p value */
+			inline constexpr uint64_t reflect( uint64_t value, int width ) noexcept
+			{
+				uint64_t result = 0;
+				for ( int i = 0; i < width; ++i )
+				{
+					result = ( result << 1 ) | ( ( value >> i ) & 1 );
+				}
+
+				return result;
+			}
+
+			inline uint64_t loadBigEndian64( const std::byte* data ) noexcept
+			{
+				uint64_t value;
+				std::memcpy( &value, data, sizeof( value ) );
+#if defined( __GNUC__ ) || defined( __clang__ )
+				return __builtin_bswap64( value );
+#elif defined( _MSC_VER )
+				return _byteswap_uint64( value );
+#endif
+			}
+
+			/** @brief Advances a 128-bit accumulator by the fold distance encoded in @p constants and adds @p next */
+			NFX_HASHING_TARGET( "pclmul,sse4.1" )
+			inline __m128i fold128( __m128i accumulator, __m128i constants, __m128i next ) noexcept
+			{
+				const __m128i low = _mm_clmulepi64_si128( accumulator, constants, 0x00 );
+				const __m128i high = _mm_clmulepi64_si128( accumulator, constants, 0x11 );
+
+				return _mm_xor_si128( _mm_xor_si128( low, high ), next );
+			}
+
+			/** @brief fold128() on both 128-bit lanes */
+			NFX_HASHING_TARGET( "vpclmulqdq,avx2,pclmul" )
+			inline __m256i fold256( __m256i accumulator, __m256i constants, __m256i next ) noexcept
+			{
+				const __m256i low = _mm256_clmulepi64_epi128( accumulator, constants, 0x00 );
+				const __m256i high = _mm256_clmulepi64_epi128( accumulator, constants, 0x11 );
+
+				return _mm256_xor_si256( _mm256_xor_si256( low, high ), next );
+			}
+
+			/*
+			 * Table-driven and carry-less multiply kernels for any reflected (LSB-first) CRC of 8 to
+			 * 64 bits. The register holds the CRC in its low Width bits; bit i of the register is the
+			 * coefficient of x^(Width-1-i). All kernels use "raw register" semantics: no initial value
+			 * or final XOR is applied, so every kernel can continue any other kernel's result.
+			 */
+			template <typename RegisterType, RegisterType Polynomial, int Width = static_cast<int>( sizeof( RegisterType ) * 8 )>
+			struct Reflected final
+			{
+				using Register = RegisterType;
+
+				static constexpr int WIDTH = Width;
+				static constexpr Register TOP_BIT = static_cast<Register>( Register{ 1 } << ( WIDTH - 1 ) );
+
+				//----------------------------
+				// Compile-time tables
+				//----------------------------
+
+				static constexpr std::array<std::array<Register, 256>, 16> makeSlicingTables() noexcept
+				{
+					std::array<std::array<Register, 256>, 16> tables{};
+					for ( uint32_t b = 0; b < 256; ++b )
+					{
+						Register crc = static_cast<Register>( b );
+						for ( int bit = 0; bit < 8; ++bit )
+						{
+							crc = static_cast<Register>( ( crc >> 1 ) ^ ( ( crc & 1 ) ? Polynomial : 0 ) );
+						}
+						tables[0][b] = crc;
+					}
+					for ( size_t k = 1; k < 16; ++k )
+					{
+						for ( uint32_t b = 0; b < 256; ++b )
+						{
+							const Register previous = tables[k - 1][b];
+							tables[k][b] = static_cast<Register>( ( previous >> 8 ) ^ tables[0][previous & 0xFF] );
+						}
+					}
+
+					return tables;
+				}
+
+				/** @brief Computes x^n mod P in the W-bit reflected representation */
+				static constexpr Register xPowModP( uint64_t n ) noexcept
+				{
+					Register value = TOP_BIT; // x^0
+					for ( uint64_t i = 0; i < n; ++i )
+					{
+						value = static_cast<Register>( ( value >> 1 ) ^ ( ( value & 1 ) ? Polynomial : 0 ) );
+					}
+
+					return value;
+				}
+
+				/** @brief x^n mod P as a 64-bit reflected operand for PCLMULQDQ (bit 63 - j holds x^j) */
+				static constexpr uint64_t foldConstant( uint64_t n ) noexcept
+				{
+					return static_cast<uint64_t>( xPowModP( n ) ) << ( 64 - WIDTH );
+				}
+
+				/** @brief Polynomial product a * b mod P (both reflected) */
+				static constexpr Register multiplyModP( Register a, Register b ) noexcept
+				{
+					Register product = 0;
+					for ( Register mask = TOP_BIT; mask != 0; mask >>= 1 )
+					{
+						if ( a & mask )
+						{
+							product ^= b;
+						}
+						b = static_cast<Register>( ( b >> 1 ) ^ ( ( b & 1 ) ? Polynomial : 0 ) );
+					}
+
+					return product;
+				}
+
+				static constexpr std::array<Register, 67> makePowerTable() noexcept
+				{
+					// powers[k] = x^(2^k) mod P; 8 * length2 needs up to 2^66
+					std::array<Register, 67> powers{};
+					powers[0] = static_cast<Register>( TOP_BIT >> 1 ); // x^1
+					for ( size_t k = 1; k < powers.size(); ++k )
+					{
+						powers[k] = multiplyModP( powers[k - 1], powers[k - 1] );
+					}
+
+					return powers;
+				}
+
+				static constexpr auto SLICING_TABLES = makeSlicingTables();
+				static constexpr auto POWER_TABLE = makePowerTable();
+
+				// Fold constants: low qword pairs with x^(D+63), high qword with x^(D-1)
+				static constexpr uint64_t FOLD_128_LOW = foldConstant( 128 + 63 );
+				static constexpr uint64_t FOLD_128_HIGH = foldConstant( 128 - 1 );
+				static constexpr uint64_t FOLD_256_LOW = foldConstant( 256 + 63 );
+				static constexpr uint64_t FOLD_256_HIGH = foldConstant( 256 - 1 );
+				static constexpr uint64_t FOLD_512_LOW = foldConstant( 512 + 63 );
+				static constexpr uint64_t FOLD_512_HIGH = foldConstant( 512 - 1 );
+				static constexpr uint64_t FOLD_1024_LOW = foldConstant( 1024 + 63 );
+				static constexpr uint64_t FOLD_1024_HIGH = foldConstant( 1024 - 1 );
+
+				/** @brief Register holding a CRC value given in reflected bit order */
+				static constexpr Register fromValue( uint64_t value ) noexcept
+				{
+					return static_cast<Register>( value );
+				}
+
+				/** @brief CRC value (reflected bit order) held in a register */
+				static constexpr uint64_t toValue( Register crc ) noexcept
+				{
+					return crc;
+				}
+
+				//----------------------------
+				// Software kernels
+				//----------------------------
+
+				static constexpr Register updateByte( Register crc, uint8_t byte ) noexcept
+				{
+					return static_cast<Register>( ( crc >> 8 ) ^ SLICING_TABLES[0][( crc ^ byte ) & 0xFF] );
+				}
+
+				static Register updateSoft( Register crc, const std::byte* data, size_t length ) noexcept
+				{
+					const auto& t = SLICING_TABLES;
+
+					// Slicing-by-16: 16 independent table lookups per 16-byte block
+					while ( length >= 16 )
+					{
+						uint64_t lo;
+						uint64_t hi;
+						std::memcpy( &lo, data, sizeof( lo ) );
+						std::memcpy( &hi, data + 8, sizeof( hi ) );
+						lo ^= static_cast<uint64_t>( crc );
+
+						crc = static_cast<Register>(
+							t[15][lo & 0xFF] ^ t[14][( lo >> 8 ) & 0xFF] ^ t[13][( lo >> 16 ) & 0xFF] ^ t[12][( lo >> 24 ) & 0xFF] ^
+							t[11][( lo >> 32 ) & 0xFF] ^ t[10][( lo >> 40 ) & 0xFF] ^ t[9][( lo >> 48 ) & 0xFF] ^ t[8][lo >> 56] ^
+							t[7][hi & 0xFF] ^ t[6][( hi >> 8 ) & 0xFF] ^ t[5][( hi >> 16 ) & 0xFF] ^ t[4][( hi >> 24 ) & 0xFF] ^
+							t[3][( hi >> 32 ) & 0xFF] ^ t[2][( hi >> 40 ) & 0xFF] ^ t[1][( hi >> 48 ) & 0xFF] ^ t[0][hi >> 56] );
+
+						data += 16;
+						length -= 16;
+					}
+					while ( length-- > 0 )
+					{
+						crc = updateByte( crc, static_cast<uint8_t>( *data++ ) );
+					}
+
+					return crc;
+				}
+
+				//----------------------------
+				// Carry-less multiply folding
+				//----------------------------
+
+				NFX_HASHING_TARGET( "pclmul,sse4.1" )
+				static Register finish128( __m128i accumulator, const std::byte* data, size_t length ) noexcept
+				{
+					const __m128i fold128Constants = _mm_set_epi64x( static_cast<long long>( FOLD_128_HIGH ), static_cast<long long>( FOLD_128_LOW ) );
+					while ( length >= 16 )
+					{
+						accumulator = fold128( accumulator, fold128Constants, _mm_loadu_si128( reinterpret_cast<const __m128i*>( data ) ) );
+						data += 16;
+						length -= 16;
+					}
+
+					// The accumulator is congruent to everything consumed so far: reduce it as 16 message bytes
+					alignas( 16 ) std::byte block[16];
+					_mm_store_si128( reinterpret_cast<__m128i*>( block ), accumulator );
+
+					return updateSoft( updateSoft( 0, block, sizeof( block ) ), data, length );
+				}
+
+				/** @brief PCLMULQDQ kernel folding 64 bytes per iteration; requires length >= 64 */
+				NFX_HASHING_TARGET( "pclmul,sse4.1" )
+				static Register updatePclmul( Register crc, const std::byte* data, size_t length ) noexcept
+				{
+					const __m128i fold512Constants = _mm_set_epi64x( static_cast<long long>( FOLD_512_HIGH ), static_cast<long long>( FOLD_512_LOW ) );
+					const __m128i fold128Constants = _mm_set_epi64x( static_cast<long long>( FOLD_128_HIGH ), static_cast<long long>( FOLD_128_LOW ) );
+					const auto* p = reinterpret_cast<const __m128i*>( data );
+
+					__m128i x0 = _mm_xor_si128( _mm_loadu_si128( p + 0 ), _mm_cvtsi64_si128( static_cast<long long>( crc ) ) );
+					__m128i x1 = _mm_loadu_si128( p + 1 );
+					__m128i x2 = _mm_loadu_si128( p + 2 );
+					__m128i x3 = _mm_loadu_si128( p + 3 );
+					p += 4;
+					length -= 64;
+
+					// Four independent accumulators hide the PCLMULQDQ latency
+					while ( length >= 64 )
+					{
+						x0 = fold128( x0, fold512Constants, _mm_loadu_si128( p + 0 ) );
+						x1 = fold128( x1, fold512Constants, _mm_loadu_si128( p + 1 ) );
+						x2 = fold128( x2, fold512Constants, _mm_loadu_si128( p + 2 ) );
+						x3 = fold128( x3, fold512Constants, _mm_loadu_si128( p + 3 ) );
+						p += 4;
+						length -= 64;
+					}
+
+					__m128i x = fold128( x0, fold128Constants, x1 );
+					x = fold128( x, fold128Constants, x2 );
+					x = fold128( x, fold128Constants, x3 );
+
+					return finish128( x, reinterpret_cast<const std::byte*>( p ), length );
+				}
+
+				/** @brief VPCLMULQDQ kernel folding 128 bytes per iteration; requires length >= 128 */
+				NFX_HASHING_TARGET( "vpclmulqdq,avx2,pclmul" )
+				static Register updateVpclmul( Register crc, const std::byte* data, size_t length ) noexcept
+				{
+					const __m256i fold1024Constants = _mm256_set_epi64x(
+						static_cast<long long>( FOLD_1024_HIGH ), static_cast<long long>( FOLD_1024_LOW ),
+						static_cast<long long>( FOLD_1024_HIGH ), static_cast<long long>( FOLD_1024_LOW ) );
+					const __m256i fold256Constants = _mm256_set_epi64x(
+						static_cast<long long>( FOLD_256_HIGH ), static_cast<long long>( FOLD_256_LOW ),
+						static_cast<long long>( FOLD_256_HIGH ), static_cast<long long>( FOLD_256_LOW ) );
+					const __m128i fold128Constants = _mm_set_epi64x( static_cast<long long>( FOLD_128_HIGH ), static_cast<long long>( FOLD_128_LOW ) );
+					const auto* p = reinterpret_cast<const __m256i*>( data );
+
+					__m256i y0 = _mm256_xor_si256( _mm256_loadu_si256( p + 0 ), _mm256_set_epi64x( 0, 0, 0, static_cast<long long>( crc ) ) );
+					__m256i y1 = _mm256_loadu_si256( p + 1 );
+					__m256i y2 = _mm256_loadu_si256( p + 2 );
+					__m256i y3 = _mm256_loadu_si256( p + 3 );
+					p += 4;
+					length -= 128;
+
+					while ( length >= 128 )
+					{
+						y0 = fold256( y0, fold1024Constants, _mm256_loadu_si256( p + 0 ) );
+						y1 = fold256( y1, fold1024Constants, _mm256_loadu_si256( p + 1 ) );
+						y2 = fold256( y2, fold1024Constants, _mm256_loadu_si256( p + 2 ) );
+						y3 = fold256( y3, fold1024Constants, _mm256_loadu_si256( p + 3 ) );
+						p += 4;
+						length -= 128;
+					}
+
+					// Reduce four 256-bit accumulators to one, then its two 128-bit lanes to one
+					__m256i y = fold256( y0, fold256Constants, y1 );
+					y = fold256( y, fold256Constants, y2 );
+					y = fold256( y, fold256Constants, y3 );
+					const __m128i x = fold128( _mm256_castsi256_si128( y ), fold128Constants, _mm256_extracti128_si256( y, 1 ) );
+
+					return finish128( x, reinterpret_cast<const std::byte*>( p ), length );
+				}
+
+				//----------------------------
+				// Dispatch
+				//----------------------------
+
+				static constexpr size_t PCLMUL_THRESHOLD = 64;
+				static constexpr size_t VPCLMUL_THRESHOLD = 256;
+
+				static Register update( Register crc, const std::byte* data, size_t length ) noexcept
+				{
+					if ( length >= VPCLMUL_THRESHOLD && hasVpclmulqdqSupport() )
+					{
+						return updateVpclmul( crc, data, length );
+					}
+					if ( length >= PCLMUL_THRESHOLD && hasPclmulqdqSupport() )
+					{
+						return updatePclmul( crc, data, length );
+					}
+
+					return updateSoft( crc, data, length );
+				}
+
+				//----------------------------
+				// Combination
+				//----------------------------
+
+				/** @brief CRC of A || B from CRC(A), CRC(B) and len(B), for finalized or zero-init CRCs */
+				static constexpr Register combine( Register crc1, Register crc2, uint64_t length2 ) noexcept
+				{
+					// crc1 * x^(8 * length2) mod P, using x^(2^k) powers for the bits of 8 * length2
+					Register shift = TOP_BIT;
+					for ( size_t k = 3; length2 != 0; length2 >>= 1, ++k )
+					{
+						if ( length2 & 1 )
+						{
+							shift = multiplyModP( POWER_TABLE[k], shift );
+						}
+					}
+
+					return static_cast<Register>( multiplyModP( shift, crc1 ) ^ crc2 );
+				}
+			};
+
+			/*
+			 * Bit-forward (MSB-first) counterpart of Reflected. The CRC is kept left-aligned in a
+			 * 64-bit register (bit 63 is the coefficient of x^(Width-1)) so one set of shifts serves
+			 * every width. The carry-less kernels byte-swap each block so that the 128-bit lane reads
+			 * as a polynomial with x^127 in its top bit, which removes the reflection bit offset.
+			 */
+			template <int Width, uint64_t Polynomial>
+			struct Forward final
+			{
+				using Register = uint64_t;
+
+				static constexpr int WIDTH = Width;
+				static constexpr int SHIFT = 64 - Width;
+				static constexpr Register POLY = Polynomial << SHIFT;
+				static constexpr Register ONE = Register{ 1 } << SHIFT; // x^0
+
+				static constexpr Register timesX( Register value ) noexcept
+				{
+					return ( value << 1 ) ^ ( ( value >> 63 ) ? POLY : 0 );
+				}
+
+				//----------------------------
+				// Compile-time tables
+				//----------------------------
+
+				static constexpr std::array<std::array<Register, 256>, 16> makeSlicingTables() noexcept
+				{
+					std::array<std::array<Register, 256>, 16> tables{};
+					for ( uint32_t b = 0; b < 256; ++b )
+					{
+						Register crc = Register{ b } << 56;
+						for ( int bit = 0; bit < 8; ++bit )
+						{
+							crc = timesX( crc );
+						}
+						tables[0][b] = crc;
+					}
+					for ( size_t k = 1; k < 16; ++k )
+					{
+						for ( uint32_t b = 0; b < 256; ++b )
+						{
+							const Register previous = tables[k - 1][b];
+							tables[k][b] = ( previous << 8 ) ^ tables[0][previous >> 56];
+						}
+					}
+
+					return tables;
+				}
+
+				/** @brief Computes x^n mod P, left-aligned */
+				static constexpr Register xPowModP( uint64_t n ) noexcept
+				{
+					Register value = ONE;
+					for ( uint64_t i = 0; i < n; ++i )
+					{
+						value = timesX( value );
+					}
+
+					return value;
+				}
+
+				/** @brief x^n mod P as a 64-bit operand for PCLMULQDQ (bit j holds x^j) */
+				static constexpr uint64_t foldConstant( uint64_t n ) noexcept
+				{
+					return xPowModP( n ) >> SHIFT;
+				}
+
+				/** @brief Polynomial product a * b mod P (both left-aligned) */
+				static constexpr Register multiplyModP( Register a, Register b ) noexcept
+				{
+					Register product = 0;
+					for ( Register mask = ONE; mask != 0; mask <<= 1 )
+					{
+						if ( a & mask )
+						{
+							product ^= b;
+						}
+						b = timesX( b );
+					}
+
+					return product;
+				}
+
+				static constexpr std::array<Register, 67> makePowerTable() noexcept
+				{
+					// powers[k] = x^(2^k) mod P; 8 * length2 needs up to 2^66
+					std::array<Register, 67> powers{};
+					powers[0] = timesX( ONE ); // x^1
+					for ( size_t k = 1; k < powers.size(); ++k )
+					{
+						powers[k] = multiplyModP( powers[k - 1], powers[k - 1] );
+					}
+
+					return powers;
+				}
+
+				static constexpr auto SLICING_TABLES = makeSlicingTables();
+				static constexpr auto POWER_TABLE = makePowerTable();
+
+				// Fold constants: high qword pairs with x^(D+64), low qword with x^D
+				static constexpr uint64_t FOLD_128_LOW = foldConstant( 128 );
+				static constexpr uint64_t FOLD_128_HIGH = foldConstant( 128 + 64 );
+				static constexpr uint64_t FOLD_256_LOW = foldConstant( 256 );
+				static constexpr uint64_t FOLD_256_HIGH = foldConstant( 256 + 64 );
+				static constexpr uint64_t FOLD_512_LOW = foldConstant( 512 );
+				static constexpr uint64_t FOLD_512_HIGH = foldConstant( 512 + 64 );
+				static constexpr uint64_t FOLD_1024_LOW = foldConstant( 1024 );
+				static constexpr uint64_t FOLD_1024_HIGH = foldConstant( 1024 + 64 );
+
+				/** @brief Register holding a CRC value given in normal bit order */
+				static constexpr Register fromValue( uint64_t value ) noexcept
+				{
+					return value << SHIFT;
+				}
+
+				/** @brief CRC value (normal bit order) held in a register */
+				static constexpr uint64_t toValue( Register crc ) noexcept
+				{
+					return crc >> SHIFT;
+				}
+
+				//----------------------------
+				// Software kernels
+				//----------------------------
+
+				static constexpr Register updateByte( Register crc, uint8_t byte ) noexcept
+				{
+					return ( crc << 8 ) ^ SLICING_TABLES[0][( crc >> 56 ) ^ byte];
+				}
+
+				static Register updateSoft( Register crc, const std::byte* data, size_t length ) noexcept
+				{
+					const auto& t = SLICING_TABLES;
+
+					while ( length >= 16 )
+					{
+						const uint64_t hi = loadBigEndian64( data ) ^ crc;
+						const uint64_t lo = loadBigEndian64( data + 8 );
+
+						crc = t[15][hi >> 56] ^ t[14][( hi >> 48 ) & 0xFF] ^ t[13][( hi >> 40 ) & 0xFF] ^ t[12][( hi >> 32 ) & 0xFF] ^
+							  t[11][( hi >> 24 ) & 0xFF] ^ t[10][( hi >> 16 ) & 0xFF] ^ t[9][( hi >> 8 ) & 0xFF] ^ t[8][hi & 0xFF] ^
+							  t[7][lo >> 56] ^ t[6][( lo >> 48 ) & 0xFF] ^ t[5][( lo >> 40 ) & 0xFF] ^ t[4][( lo >> 32 ) & 0xFF] ^
+							  t[3][( lo >> 24 ) & 0xFF] ^ t[2][( lo >> 16 ) & 0xFF] ^ t[1][( lo >> 8 ) & 0xFF] ^ t[0][lo & 0xFF];
+
+						data += 16;
+						length -= 16;
+					}
+					while ( length-- > 0 )
+					{
+						crc = updateByte( crc, static_cast<uint8_t>( *data++ ) );
+					}
+
+					return crc;
+				}
+
+				//----------------------------
+				// Carry-less multiply folding
+				//----------------------------
+
+				NFX_HASHING_TARGET( "pclmul,sse4.1" )
+				static inline __m128i load128( const std::byte* data ) noexcept
+				{
+					const __m128i byteReverse = _mm_set_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 );
+
+					return _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( data ) ), byteReverse );
+				}
+
+				NFX_HASHING_TARGET( "vpclmulqdq,avx2,pclmul" )
+				static inline __m256i load256( const std::byte* data ) noexcept
+				{
+					const __m256i byteReverse = _mm256_set_epi8(
+						0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+						0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 );
+
+					return _mm256_shuffle_epi8( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( data ) ), byteReverse );
+				}
+
+				NFX_HASHING_TARGET( "pclmul,sse4.1" )
+				static Register finish128( __m128i accumulator, const std::byte* data, size_t length ) noexcept
+				{
+					const __m128i fold128Constants = _mm_set_epi64x( static_cast<long long>( FOLD_128_HIGH ), static_cast<long long>( FOLD_128_LOW ) );
+					while ( length >= 16 )
+					{
+						accumulator = fold128( accumulator, fold128Constants, load128( data ) );
+						data += 16;
+						length -= 16;
+					}
+
+					// Back to message byte order, then reduce as 16 message bytes
+					const __m128i byteReverse = _mm_set_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 );
+					alignas( 16 ) std::byte block[16];
+					_mm_store_si128( reinterpret_cast<__m128i*>( block ), _mm_shuffle_epi8( accumulator, byteReverse ) );
+
+					return updateSoft( updateSoft( 0, block, sizeof( block ) ), data, length );
+				}
+
+				/** @brief PCLMULQDQ kernel folding 64 bytes per iteration; requires length >= 64 */
+				NFX_HASHING_TARGET( "pclmul,sse4.1" )
+				static Register updatePclmul( Register crc, const std::byte* data, size_t length ) noexcept
+				{
+					const __m128i fold512Constants = _mm_set_epi64x( static_cast<long long>( FOLD_512_HIGH ), static_cast<long long>( FOLD_512_LOW ) );
+					const __m128i fold128Constants = _mm_set_epi64x( static_cast<long long>( FOLD_128_HIGH ), static_cast<long long>( FOLD_128_LOW ) );
+
+					__m128i x0 = _mm_xor_si128( load128( data ), _mm_set_epi64x( static_cast<long long>( crc ), 0 ) );
+					__m128i x1 = load128( data + 16 );
+					__m128i x2 = load128( data + 32 );
+					__m128i x3 = load128( data + 48 );
+					data += 64;
+					length -= 64;
+
+					while ( length >= 64 )
+					{
+						x0 = fold128( x0, fold512Constants, load128( data ) );
+						x1 = fold128( x1, fold512Constants, load128( data + 16 ) );
+						x2 = fold128( x2, fold512Constants, load128( data + 32 ) );
+						x3 = fold128( x3, fold512Constants, load128( data + 48 ) );
+						data += 64;
+						length -= 64;
+					}
+
+					__m128i x = fold128( x0, fold128Constants, x1 );
+					x = fold128( x, fold128Constants, x2 );
+					x = fold128( x, fold128Constants, x3 );
+
+					return finish128( x, data, length );
+				}
+
+				/** @brief VPCLMULQDQ kernel folding 128 bytes per iteration; requires length >= 128 */
+				NFX_HASHING_TARGET( "vpclmulqdq,avx2,pclmul" )
+				static Register updateVpclmul( Register crc, const std::byte* data, size_t length ) noexcept
+				{
+					const __m256i fold1024Constants = _mm256_set_epi64x(
+						static_cast<long long>( FOLD_1024_HIGH ), static_cast<long long>( FOLD_1024_LOW ),
+						static_cast<long long>( FOLD_1024_HIGH ), static_cast<long long>( FOLD_1024_LOW ) );
+					const __m256i fold256Constants = _mm256_set_epi64x(
+						static_cast<long long>( FOLD_256_HIGH ), static_cast<long long>( FOLD_256_LOW ),
+						static_cast<long long>( FOLD_256_HIGH ), static_cast<long long>( FOLD_256_LOW ) );
+					const __m128i fold128Constants = _mm_set_epi64x( static_cast<long long>( FOLD_128_HIGH ), static_cast<long long>( FOLD_128_LOW ) );
+
+					__m256i y0 = _mm256_xor_si256( load256( data ), _mm256_set_epi64x( 0, 0, static_cast<long long>( crc ), 0 ) );
+					__m256i y1 = load256( data + 32 );
+					__m256i y2 = load256( data + 64 );
+					__m256i y3 = load256( data + 96 );
+					data += 128;
+					length -= 128;
+
+					while ( length >= 128 )
+					{
+						y0 = fold256( y0, fold1024Constants, load256( data ) );
+						y1 = fold256( y1, fold1024Constants, load256( data + 32 ) );
+						y2 = fold256( y2, fold1024Constants, load256( data + 64 ) );
+						y3 = fold256( y3, fold1024Constants, load256( data + 96 ) );
+						data += 128;
+						length -= 128;
+					}
+
+					__m256i y = fold256( y0, fold256Constants, y1 );
+					y = fold256( y, fold256Constants, y2 );
+					y = fold256( y, fold256Constants, y3 );
+					const __m128i x = fold128( _mm256_castsi256_si128( y ), fold128Constants, _mm256_extracti128_si256( y, 1 ) );
+
+					return finish128( x, data, length );
+				}
+
+				//----------------------------
+				// Dispatch
+				//----------------------------
+
+				static constexpr size_t PCLMUL_THRESHOLD = 64;
+				static constexpr size_t VPCLMUL_THRESHOLD = 256;
+
+				static Register update( Register crc, const std::byte* data, size_t length ) noexcept
+				{
+					if ( length >= VPCLMUL_THRESHOLD && hasVpclmulqdqSupport() )
+					{
+						return updateVpclmul( crc, data, length );
+					}
+					if ( length >= PCLMUL_THRESHOLD && hasPclmulqdqSupport() )
+					{
+						return updatePclmul( crc, data, length );
+					}
+
+					return updateSoft( crc, data, length );
+				}
+
+				//----------------------------
+				// Combination
+				//----------------------------
+
+				/** @brief Register of A || B from the registers of A (init 0 equivalent) and B */
+				static constexpr Register combine( Register crc1, Register crc2, uint64_t length2 ) noexcept
+				{
+					Register shift = ONE;
+					for ( size_t k = 3; length2 != 0; length2 >>= 1, ++k )
+					{
+						if ( length2 & 1 )
+						{
+							shift = multiplyModP( POWER_TABLE[k], shift );
+						}
+					}
+
+					return multiplyModP( shift, crc1 ) ^ crc2;
+				}
+			};
+
+			/** @brief Engine processing a CRC with the given width, normal-form polynomial and input reflection */
+			template <int Width, uint64_t Polynomial, bool ReflectIn>
+			struct EngineSelector;
+
+			template <int Width, uint64_t Polynomial>
+			struct EngineSelector<Width, Polynomial, true>
+			{
+				using RegisterType = std::conditional_t<( Width <= 8 ), uint8_t,
+					std::conditional_t<( Width <= 16 ), uint16_t,
+						std::conditional_t<( Width <= 32 ), uint32_t, uint64_t>>>;
+
+				using type = Reflected<RegisterType, static_cast<RegisterType>( reflect( Polynomial, Width ) ), Width>;
+			};
+
+			template <int Width, uint64_t Polynomial>
+			struct EngineSelector<Width, Polynomial, false>
+			{
+				using type = Forward<Width, Polynomial>;
+			};
+		} // namespace crc
+
+		//----------------------------------------------
+		// CRC engine instantiations
+		//----------------------------------------------
+
+		using Crc32cEngine = crc::Reflected<uint32_t, constants::CRC32C_POLYNOMIAL>;
+		using Crc32IeeeEngine = crc::Reflected<uint32_t, constants::CRC32_IEEE_POLYNOMIAL>;
+		using Crc64XzEngine = crc::Reflected<uint64_t, constants::CRC64_ECMA_POLYNOMIAL>;
+		using Crc64NvmeEngine = crc::Reflected<uint64_t, constants::CRC64_NVME_POLYNOMIAL>;
+
+		/** @brief CRC32-C over a buffer with the SSE4.2 CRC32 instruction, 8 bytes at a time */
+		NFX_HASHING_TARGET( "sse4.2" )
+		inline uint32_t crc32cHardware( uint32_t crc, const std::byte* data, size_t length ) noexcept
+		{
+			uint64_t crc64 = crc;
+			while ( length >= 8 )
+			{
+				uint64_t word;
+				std::memcpy( &word, data, sizeof( word ) );
+				crc64 = _mm_crc32_u64( crc64, word );
+				data += 8;
+				length -= 8;
+			}
+
+			crc = static_cast<uint32_t>( crc64 );
+			while ( length-- > 0 )
+			{
+				crc = _mm_crc32_u8( crc, static_cast<uint8_t>( *data++ ) );
+			}
+
+			return crc;
+		}
+
+		/** @brief Number of independent blocks interleaved by crc32cBlocksHardware() */
+		constexpr size_t CRC32C_BLOCK_LANES = 4;
+
+		/**
+		 * @brief Finalized CRC32-C of CRC32C_BLOCK_LANES blocks, stepping all lanes in lockstep
+		 * @details The CRC32 instruction has a 3-cycle latency but 1-cycle throughput, so one
+		 *          dependency chain per block keeps the unit busy.
+		 */
+		NFX_HASHING_TARGET( "sse4.2" )
+		inline void crc32cBlocksHardware( const std::byte* base, size_t blockSize, uint32_t* out ) noexcept
+		{
+			const std::byte* p0 = base;
+			const std::byte* p1 = base + blockSize;
+			const std::byte* p2 = base + 2 * blockSize;
+			const std::byte* p3 = base + 3 * blockSize;
+
+			uint64_t c0 = 0xFFFFFFFF;
+			uint64_t c1 = 0xFFFFFFFF;
+			uint64_t c2 = 0xFFFFFFFF;
+			uint64_t c3 = 0xFFFFFFFF;
+
+			size_t offset = 0;
+			for ( ; offset + 8 <= blockSize; offset += 8 )
+			{
+				uint64_t w0, w1, w2, w3;
+				std::memcpy( &w0, p0 + offset, sizeof( w0 ) );
+				std::memcpy( &w1, p1 + offset, sizeof( w1 ) );
+				std::memcpy( &w2, p2 + offset, sizeof( w2 ) );
+				std::memcpy( &w3, p3 + offset, sizeof( w3 ) );
+				c0 = _mm_crc32_u64( c0, w0 );
+				c1 = _mm_crc32_u64( c1, w1 );
+				c2 = _mm_crc32_u64( c2, w2 );
+				c3 = _mm_crc32_u64( c3, w3 );
+			}
+
+			const size_t tail = blockSize - offset;
+			out[0] = ~crc32cHardware( static_cast<uint32_t>( c0 ), p0 + offset, tail );
+			out[1] = ~crc32cHardware( static_cast<uint32_t>( c1 ), p1 + offset, tail );
+			out[2] = ~crc32cHardware( static_cast<uint32_t>( c2 ), p2 + offset, tail );
+			out[3] = ~crc32cHardware( static_cast<uint32_t>( c3 ), p3 + offset, tail );
+		}
+
+		//----------------------------------------------
+		// CityHash / FarmHash building blocks
+		//----------------------------------------------
+
+		namespace city
+		{
+			inline uint64_t fetch64( const char* p ) noexcept
+			{
+				uint64_t result;
+				std::memcpy( &result, p, sizeof( result ) );
+
+				return result;
+			}
+
+			inline uint32_t fetch32( const char* p ) noexcept
+			{
+				uint32_t result;
+				std::memcpy( &result, p, sizeof( result ) );
+
+				return result;
+			}
+
+			inline constexpr uint64_t rotate( uint64_t value, int shift ) noexcept
+			{
+				// Rotate right; shift is never 0 at any call site
+				return ( value >> shift ) | ( value << ( 64 - shift ) );
+			}
+
+			inline constexpr uint64_t shiftMix( uint64_t value ) noexcept
+			{
+				return value ^ ( value >> 47 );
+			}
+
+			inline constexpr uint64_t bswap64( uint64_t value ) noexcept
+			{
+#if defined( __GNUC__ ) || defined( __clang__ )
+				return __builtin_bswap64( value );
+#else
+				value = ( ( value & 0x00000000FFFFFFFFULL ) << 32 ) | ( value >> 32 );
+				value = ( ( value & 0x0000FFFF0000FFFFULL ) << 16 ) | ( ( value >> 16 ) & 0x0000FFFF0000FFFFULL );
+				value = ( ( value & 0x00FF00FF00FF00FFULL ) << 8 ) | ( ( value >> 8 ) & 0x00FF00FF00FF00FFULL );
+
+				return value;
+#endif
+			}
+
+			inline constexpr uint64_t hashLen16( uint64_t u, uint64_t v, uint64_t mul ) noexcept
+			{
+				// Murmur-inspired hashing
+				uint64_t a = ( u ^ v ) * mul;
+				a ^= ( a >> 47 );
+				uint64_t b = ( v ^ a ) * mul;
+				b ^= ( b >> 47 );
+				b *= mul;
+
+				return b;
+			}
+
+			inline constexpr uint64_t hashLen16( uint64_t u, uint64_t v ) noexcept
+			{
+				return hashLen16( u, v, constants::CITY_MUL );
+			}
+
+			inline uint64_t hashLen0to16( const char* s, size_t len ) noexcept
+			{
+				using namespace constants;
+
+				if ( len >= 8 )
+				{
+					uint64_t mul = CITY_K2 + len * 2;
+					uint64_t a = fetch64( s ) + CITY_K2;
+					uint64_t b = fetch64( s + len - 8 );
+					uint64_t c = rotate( b, 37 ) * mul + a;
+					uint64_t d = ( rotate( a, 25 ) + b ) * mul;
+
+					return hashLen16( c, d, mul );
+				}
+				if ( len >= 4 )
+				{
+					uint64_t mul = CITY_K2 + len * 2;
+					uint64_t a = fetch32( s );
+
+					return hashLen16( len + ( a << 3 ), fetch32( s + len - 4 ), mul );
+				}
+				if ( len > 0 )
+				{
+					uint8_t a = static_cast<uint8_t>( s[0] );
+					uint8_t b = static_cast<uint8_t>( s[len >> 1] );
+					uint8_t c = static_cast<uint8_t>( s[len - 1] );
+					uint32_t y = static_cast<uint32_t>( a ) + ( static_cast<uint32_t>( b ) << 8 );
+					uint32_t z = static_cast<uint32_t>( len ) + ( static_cast<uint32_t>( c ) << 2 );
+
+					return shiftMix( y * CITY_K2 ^ z * CITY_K0 ) * CITY_K2;
+				}
+
+				return CITY_K2;
+			}
+
+			inline uint64_t hashLen17to32( const char* s, size_t len ) noexcept
+			{
+				using namespace constants;
+
+				uint64_t mul = CITY_K2 + len * 2;
+				uint64_t a = fetch64( s ) * CITY_K1;
+				uint64_t b = fetch64( s + 8 );
+				uint64_t c = fetch64( s + len - 8 ) * mul;
+				uint64_t d = fetch64( s + len - 16 ) * CITY_K2;
+
+				return hashLen16( rotate( a + b, 43 ) + rotate( c, 30 ) + d, a + rotate( b + CITY_K2, 18 ) + c, mul );
+			}
+
+			inline constexpr std::pair<uint64_t, uint64_t> weakHashLen32WithSeeds( uint64_t w, uint64_t x, uint64_t y, uint64_t z, uint64_t a, uint64_t b ) noexcept
+			{
+				a += w;
+				b = rotate( b + a + z, 21 );
+				uint64_t c = a;
+				a += x;
+				a += y;
+				b += rotate( a, 44 );
+
+				return { a + z, b + c };
+			}
+
+			inline std::pair<uint64_t, uint64_t> weakHashLen32WithSeeds( const char* s, uint64_t a, uint64_t b ) noexcept
+			{
+				return weakHashLen32WithSeeds( fetch64( s ), fetch64( s + 8 ), fetch64( s + 16 ), fetch64( s + 24 ), a, b );
+			}
+
+			inline uint64_t cityHashLen33to64( const char* s, size_t len ) noexcept
+			{
+				using namespace constants;
+
+				uint64_t mul = CITY_K2 + len * 2;
+				uint64_t a = fetch64( s ) * CITY_K2;
+				uint64_t b = fetch64( s + 8 );
+				uint64_t c = fetch64( s + len - 24 );
+				uint64_t d = fetch64( s + len - 32 );
+				uint64_t e = fetch64( s + 16 ) * CITY_K2;
+				uint64_t f = fetch64( s + 24 ) * 9;
+				uint64_t g = fetch64( s + len - 8 );
+				uint64_t h = fetch64( s + len - 16 ) * mul;
+				uint64_t u = rotate( a + g, 43 ) + ( rotate( b, 30 ) + c ) * 9;
+				uint64_t v = ( ( a + g ) ^ d ) + f + 1;
+				uint64_t w = bswap64( ( u + v ) * mul ) + h;
+				uint64_t x = rotate( e + f, 42 ) + c;
+				uint64_t y = ( bswap64( ( v + w ) * mul ) + g ) * mul;
+				uint64_t z = e + f + c;
+				a = bswap64( ( x + z ) * mul + y ) + b;
+				b = shiftMix( ( z + a ) * mul + d + h ) * mul;
+
+				return b + x;
+			}
+
+			inline uint64_t farmHashLen33to64( const char* s, size_t len ) noexcept
+			{
+				using namespace constants;
+
+				uint64_t mul = CITY_K2 + len * 2;
+				uint64_t a = fetch64( s ) * CITY_K2;
+				uint64_t b = fetch64( s + 8 );
+				uint64_t c = fetch64( s + len - 8 ) * mul;
+				uint64_t d = fetch64( s + len - 16 ) * CITY_K2;
+				uint64_t y = rotate( a + b, 43 ) + rotate( c, 30 ) + d;
+				uint64_t z = hashLen16( y, a + rotate( b + CITY_K2, 18 ) + c, mul );
+				uint64_t e = fetch64( s + 16 ) * mul;
+				uint64_t f = fetch64( s + 24 );
+				uint64_t g = ( y + fetch64( s + len - 32 ) ) * mul;
+				uint64_t h = ( z + fetch64( s + len - 24 ) ) * mul;
+
+				return hashLen16( rotate( e + f, 43 ) + rotate( g, 30 ) + h, e + rotate( f + a, 18 ) + g, mul );
+			}
+
+			inline Hash128 cityMurmur( const char* s, size_t len, Hash128 seed ) noexcept
+			{
+				using namespace constants;
+
+				uint64_t a = seed.low;
+				uint64_t b = seed.high;
+				uint64_t c = 0;
+				uint64_t d = 0;
+
+				if ( len <= 16 )
+				{
+					a = shiftMix( a * CITY_K1 ) * CITY_K1;
+					c = b * CITY_K1 + hashLen0to16( s, len );
+					d = shiftMix( a + ( len >= 8 ? fetch64( s ) : c ) );
+				}
+				else
+				{
+					c = hashLen16( fetch64( s + len - 8 ) + CITY_K1, a );
+					d = hashLen16( b + len, c + fetch64( s + len - 16 ) );
+					a += d;
+
+					// Consumes 16-byte chunks while more than 16 bytes remain (may re-read the tail)
+					size_t remaining = len - 16;
+					do
+					{
+						a ^= shiftMix( fetch64( s ) * CITY_K1 ) * CITY_K1;
+						a *= CITY_K1;
+						b ^= a;
+						c ^= shiftMix( fetch64( s + 8 ) * CITY_K1 ) * CITY_K1;
+						c *= CITY_K1;
+						d ^= c;
+						s += 16;
+						remaining = remaining > 16 ? remaining - 16 : 0;
+					} while ( remaining > 0 );
+				}
+
+				a = hashLen16( a, c );
+				b = hashLen16( d, b );
+
+				return { a ^ b, hashLen16( b, a ) };
+			}
+		} // namespace city
 	} // namespace internal
 
 	//----------------------------------------------
@@ -127,16 +1188,435 @@ namespace nfx::hashing
 	inline constexpr uint32_t crc32cSoft( uint32_t hash, uint8_t ch ) noexcept
 	{
 		// Software implementation of CRC32-C (Castagnoli) matching SSE4.2 _mm_crc32_u8
-		// Polynomial: 0x1EDC6F41 (x^32 + x^28 + x^27 + x^26 + x^25 + x^23 + x^22 + ...)
-		constexpr uint32_t polynomial = 0x82F63B78;
-		uint32_t crc = hash ^ ch;
-		for ( int i = 0; i < 8; ++i )
+		// Polynomial: 0x1EDC6F41, reflected table generated at compile time
+		return internal::Crc32cEngine::updateByte( hash, ch );
+	}
+
+	inline uint32_t crc32c( uint32_t hash, const std::byte* data, std::size_t length ) noexcept
+	{
+		// Long buffers: carry-less folding outruns the single-stream CRC32 instruction
+		if ( length >= internal::Crc32cEngine::VPCLMUL_THRESHOLD && internal::hasVpclmulqdqSupport() )
+		{
+			return internal::Crc32cEngine::updateVpclmul( hash, data, length );
+		}
+#if defined( __SSE4_2__ ) || ( defined( _MSC_VER ) && defined( __AVX__ ) )
+		return internal::crc32cHardware( hash, data, length );
+#else
+		if ( internal::hasSse42Support() )
+		{
+			return internal::crc32cHardware( hash, data, length );
+		}
+
+		return internal::Crc32cEngine::update( hash, data, length );
+#endif
+	}
+
+	inline uint32_t crc32cSoft( uint32_t hash, const std::byte* data, std::size_t length ) noexcept
+	{
+		return internal::Crc32cEngine::updateSoft( hash, data, length );
+	}
+
+	inline void crc32cBlocks( const std::byte* base, std::size_t blockSize, std::size_t count, uint32_t* out ) noexcept
+	{
+#if !defined( __SSE4_2__ ) && !( defined( _MSC_VER ) && defined( __AVX__ ) )
+		if ( !internal::hasSse42Support() )
+		{
+			for ( size_t i = 0; i < count; ++i )
+			{
+				out[i] = ~crc32c( 0xFFFFFFFF, base + i * blockSize, blockSize );
+			}
+
+			return;
+		}
+#endif
+		// Carry-less folding of each block outruns even interleaved CRC32 instructions
+		if ( blockSize >= internal::Crc32cEngine::VPCLMUL_THRESHOLD && internal::hasVpclmulqdqSupport() )
+		{
+			for ( size_t i = 0; i < count; ++i )
+			{
+				out[i] = ~internal::Crc32cEngine::updateVpclmul( 0xFFFFFFFF, base + i * blockSize, blockSize );
+			}
+
+			return;
+		}
+
+		size_t i = 0;
+		for ( ; i + internal::CRC32C_BLOCK_LANES <= count; i += internal::CRC32C_BLOCK_LANES )
+		{
+			internal::crc32cBlocksHardware( base + i * blockSize, blockSize, out + i );
+		}
+		for ( ; i < count; ++i )
+		{
+			out[i] = ~internal::crc32cHardware( 0xFFFFFFFF, base + i * blockSize, blockSize );
+		}
+	}
+
+	inline constexpr uint32_t crc32cMask( uint32_t crc ) noexcept
+	{
+		// Rotate right by 15 bits and add a constant
+		return ( ( crc >> 15 ) | ( crc << 17 ) ) + constants::CRC32C_MASK_DELTA;
+	}
+
+	inline constexpr uint32_t crc32cUnmask( uint32_t maskedCrc ) noexcept
+	{
+		const uint32_t rotated = maskedCrc - constants::CRC32C_MASK_DELTA;
+
+		return ( rotated >> 17 ) | ( rotated << 15 );
+	}
+
+	//----------------------------------------------
+	// CRC-32 (IEEE 802.3 / zlib) checksums
+	//----------------------------------------------
+
+	inline uint32_t crc32Ieee( uint32_t hash, uint8_t ch ) noexcept
+	{
+		return internal::Crc32IeeeEngine::updateByte( hash, ch );
+	}
+
+	inline uint32_t crc32Ieee( uint32_t hash, const std::byte* data, std::size_t length ) noexcept
+	{
+		return internal::Crc32IeeeEngine::update( hash, data, length );
+	}
+
+	inline constexpr uint32_t crc32IeeeSoft( uint32_t hash, uint8_t ch ) noexcept
+	{
+		return internal::Crc32IeeeEngine::updateByte( hash, ch );
+	}
+
+	inline uint32_t crc32IeeeSoft( uint32_t hash, const std::byte* data, std::size_t length ) noexcept
+	{
+		return internal::Crc32IeeeEngine::updateSoft( hash, data, length );
+	}
+
+	inline constexpr uint32_t crc32IeeeCombine( uint32_t crc1, uint32_t crc2, uint64_t length2 ) noexcept
+	{
+		return internal::Crc32IeeeEngine::combine( crc1, crc2, length2 );
+	}
+
+	inline void Crc32IeeeState::update( const std::byte* data, std::size_t length ) noexcept
+	{
+		m_crc = crc32Ieee( m_crc, data, length );
+	}
+
+	inline void Crc32IeeeState::update( std::string_view data ) noexcept
+	{
+		update( reinterpret_cast<const std::byte*>( data.data() ), data.size() );
+	}
+
+	inline uint32_t Crc32IeeeState::value() const noexcept
+	{
+		return m_crc ^ constants::CRC32_IEEE_INIT;
+	}
+
+	inline void Crc32IeeeState::reset() noexcept
+	{
+		m_crc = constants::CRC32_IEEE_INIT;
+	}
+
+	//----------------------------------------------
+	// CRC-64/XZ (ECMA-182) checksums
+	//----------------------------------------------
+
+	inline uint64_t crc64Xz( uint64_t hash, uint8_t ch ) noexcept
+	{
+		return internal::Crc64XzEngine::updateByte( hash, ch );
+	}
+
+	inline uint64_t crc64Xz( uint64_t hash, const std::byte* data, std::size_t length ) noexcept
+	{
+		return internal::Crc64XzEngine::update( hash, data, length );
+	}
+
+	inline constexpr uint64_t crc64XzSoft( uint64_t hash, uint8_t ch ) noexcept
+	{
+		return internal::Crc64XzEngine::updateByte( hash, ch );
+	}
+
+	inline uint64_t crc64XzSoft( uint64_t hash, const std::byte* data, std::size_t length ) noexcept
+	{
+		return internal::Crc64XzEngine::updateSoft( hash, data, length );
+	}
+
+	inline constexpr uint64_t crc64XzCombine( uint64_t crc1, uint64_t crc2, uint64_t length2 ) noexcept
+	{
+		return internal::Crc64XzEngine::combine( crc1, crc2, length2 );
+	}
+
+	inline void Crc64XzState::update( const std::byte* data, std::size_t length ) noexcept
+	{
+		m_crc = crc64Xz( m_crc, data, length );
+	}
+
+	inline void Crc64XzState::update( std::string_view data ) noexcept
+	{
+		update( reinterpret_cast<const std::byte*>( data.data() ), data.size() );
+	}
+
+	inline uint64_t Crc64XzState::value() const noexcept
+	{
+		return m_crc ^ constants::CRC64_INIT;
+	}
+
+	inline void Crc64XzState::reset() noexcept
+	{
+		m_crc = constants::CRC64_INIT;
+	}
+
+	//----------------------------------------------
+	// CRC-64/NVME checksums
+	//----------------------------------------------
+
+	inline uint64_t crc64Nvme( uint64_t hash, uint8_t ch ) noexcept
+	{
+		return internal::Crc64NvmeEngine::updateByte( hash, ch );
+	}
+
+	inline uint64_t crc64Nvme( uint64_t hash, const std::byte* data, std::size_t length ) noexcept
+	{
+		return internal::Crc64NvmeEngine::update( hash, data, length );
+	}
+
+	inline constexpr uint64_t crc64NvmeSoft( uint64_t hash, uint8_t ch ) noexcept
+	{
+		return internal::Crc64NvmeEngine::updateByte( hash, ch );
+	}
+
+	inline uint64_t crc64NvmeSoft( uint64_t hash, const std::byte* data, std::size_t length ) noexcept
+	{
+		return internal::Crc64NvmeEngine::updateSoft( hash, data, length );
+	}
+
+	inline constexpr uint64_t crc64NvmeCombine( uint64_t crc1, uint64_t crc2, uint64_t length2 ) noexcept
+	{
+		return internal::Crc64NvmeEngine::combine( crc1, crc2, length2 );
+	}
+
+	inline void Crc64NvmeState::update( const std::byte* data, std::size_t length ) noexcept
+	{
+		m_crc = crc64Nvme( m_crc, data, length );
+	}
+
+	inline void Crc64NvmeState::update( std::string_view data ) noexcept
+	{
+		update( reinterpret_cast<const std::byte*>( data.data() ), data.size() );
+	}
+
+	inline uint64_t Crc64NvmeState::value() const noexcept
+	{
+		return m_crc ^ constants::CRC64_INIT;
+	}
+
+	inline void Crc64NvmeState::reset() noexcept
+	{
+		m_crc = constants::CRC64_INIT;
+	}
+
+	//----------------------------------------------
+	// Whole-buffer fingerprints
+	//----------------------------------------------
+
+	inline uint64_t farmFingerprint64( std::string_view data ) noexcept
+	{
+		using namespace constants;
+		using namespace internal::city;
+
+		const char* s = data.data();
+		const size_t len = data.size();
+
+		if ( len <= 16 )
+		{
+			return hashLen0to16( s, len );
+		}
+		if ( len <= 32 )
+		{
+			return hashLen17to32( s, len );
+		}
+		if ( len <= 64 )
+		{
+			return farmHashLen33to64( s, len );
+		}
+
+		// For inputs over 64 bytes we loop; internal state consists of 56 bytes: v, w, x, y, and z
+		constexpr uint64_t seed = 81;
+		uint64_t x = seed;
+		uint64_t y = seed * CITY_K1 + 113;
+		uint64_t z = shiftMix( y * CITY_K2 + 113 ) * CITY_K2;
+		std::pair<uint64_t, uint64_t> v{ 0, 0 };
+		std::pair<uint64_t, uint64_t> w{ 0, 0 };
+		x = x * CITY_K2 + fetch64( s );
+
+		// Loop until 1 to 64 bytes remain; the final round re-reads the last 64 bytes
+		const char* end = s + ( ( len - 1 ) / 64 ) * 64;
+		const char* last64 = end + ( ( len - 1 ) & 63 ) - 63;
+		do
+		{
+			x = rotate( x + y + v.first + fetch64( s + 8 ), 37 ) * CITY_K1;
+			y = rotate( y + v.second + fetch64( s + 48 ), 42 ) * CITY_K1;
+			x ^= w.second;
+			y += v.first + fetch64( s + 40 );
+			z = rotate( z + w.first, 33 ) * CITY_K1;
+			v = weakHashLen32WithSeeds( s, v.second * CITY_K1, x + w.first );
+			w = weakHashLen32WithSeeds( s + 32, z + w.second, y + fetch64( s + 16 ) );
+			std::swap( z, x );
+			s += 64;
+		} while ( s != end );
+
+		const uint64_t mul = CITY_K1 + ( ( z & 0xff ) << 1 );
+		s = last64;
+		w.first += ( ( len - 1 ) & 63 );
+		v.first += w.first;
+		w.first += v.first;
+		x = rotate( x + y + v.first + fetch64( s + 8 ), 37 ) * mul;
+		y = rotate( y + v.second + fetch64( s + 48 ), 42 ) * mul;
+		x ^= w.second * 9;
+		y += v.first * 9 + fetch64( s + 40 );
+		z = rotate( z + w.first, 33 ) * mul;
+		v = weakHashLen32WithSeeds( s, v.second * mul, x + w.first );
+		w = weakHashLen32WithSeeds( s + 32, z + w.second, y + fetch64( s + 16 ) );
+		std::swap( z, x );
+
+		return hashLen16( hashLen16( v.first, w.first, mul ) + shiftMix( y ) * CITY_K0 + z,
+			hashLen16( v.second, w.second, mul ) + x, mul );
+	}
+
+	inline uint64_t farmHash64WithSeed( std::string_view data, uint64_t seed ) noexcept
+	{
+		return internal::city::hashLen16( farmFingerprint64( data ) - constants::CITY_K2, seed );
+	}
+
+	inline uint64_t cityHash64( std::string_view data ) noexcept
+	{
+		using namespace constants;
+		using namespace internal::city;
+
+		const char* s = data.data();
+		size_t len = data.size();
+
+		if ( len <= 16 )
+		{
+			return hashLen0to16( s, len );
+		}
+		if ( len <= 32 )
 		{
-			crc = ( crc >> 1 ) ^ ( ( crc & 1 )
-										 ? polynomial
-										 : 0 );
+			return hashLen17to32( s, len );
 		}
-		return crc;
+		if ( len <= 64 )
+		{
+			return cityHashLen33to64( s, len );
+		}
+
+		// For inputs over 64 bytes we hash the end first, then loop with 56 bytes of state: v, w, x, y, and z
+		uint64_t x = fetch64( s + len - 40 );
+		uint64_t y = fetch64( s + len - 16 ) + fetch64( s + len - 56 );
+		uint64_t z = hashLen16( fetch64( s + len - 48 ) + len, fetch64( s + len - 24 ) );
+		std::pair<uint64_t, uint64_t> v = weakHashLen32WithSeeds( s + len - 64, len, z );
+		std::pair<uint64_t, uint64_t> w = weakHashLen32WithSeeds( s + len - 32, y + CITY_K1, x );
+		x = x * CITY_K1 + fetch64( s );
+
+		// Round len down to the nearest multiple of 64 and operate on 64-byte chunks
+		len = ( len - 1 ) & ~static_cast<size_t>( 63 );
+		do
+		{
+			x = rotate( x + y + v.first + fetch64( s + 8 ), 37 ) * CITY_K1;
+			y = rotate( y + v.second + fetch64( s + 48 ), 42 ) * CITY_K1;
+			x ^= w.second;
+			y += v.first + fetch64( s + 40 );
+			z = rotate( z + w.first, 33 ) * CITY_K1;
+			v = weakHashLen32WithSeeds( s, v.second * CITY_K1, x + w.first );
+			w = weakHashLen32WithSeeds( s + 32, z + w.second, y + fetch64( s + 16 ) );
+			std::swap( z, x );
+			s += 64;
+			len -= 64;
+		} while ( len != 0 );
+
+		return hashLen16( hashLen16( v.first, w.first ) + shiftMix( y ) * CITY_K1 + z,
+			hashLen16( v.second, w.second ) + x );
+	}
+
+	inline uint64_t cityHash64( std::string_view data, uint64_t seed ) noexcept
+	{
+		return internal::city::hashLen16( cityHash64( data ) - constants::CITY_K2, seed );
+	}
+
+	inline Hash128 cityHash128( std::string_view data, Hash128 seed ) noexcept
+	{
+		using namespace constants;
+		using namespace internal::city;
+
+		const char* s = data.data();
+		size_t len = data.size();
+
+		if ( len < 128 )
+		{
+			return cityMurmur( s, len, seed );
+		}
+
+		// Inputs of 128 bytes or more keep 56 bytes of state: v, w, x, y, and z
+		std::pair<uint64_t, uint64_t> v;
+		std::pair<uint64_t, uint64_t> w;
+		uint64_t x = seed.low;
+		uint64_t y = seed.high;
+		uint64_t z = len * CITY_K1;
+		v.first = rotate( y ^ CITY_K1, 49 ) * CITY_K1 + fetch64( s );
+		v.second = rotate( v.first, 42 ) * CITY_K1 + fetch64( s + 8 );
+		w.first = rotate( y + z, 35 ) * CITY_K1 + x;
+		w.second = rotate( x + fetch64( s + 88 ), 53 ) * CITY_K1;
+
+		// Same inner loop as cityHash64(), manually unrolled to 128-byte steps
+		do
+		{
+			for ( int half = 0; half < 2; ++half )
+			{
+				x = rotate( x + y + v.first + fetch64( s + 8 ), 37 ) * CITY_K1;
+				y = rotate( y + v.second + fetch64( s + 48 ), 42 ) * CITY_K1;
+				x ^= w.second;
+				y += v.first + fetch64( s + 40 );
+				z = rotate( z + w.first, 33 ) * CITY_K1;
+				v = weakHashLen32WithSeeds( s, v.second * CITY_K1, x + w.first );
+				w = weakHashLen32WithSeeds( s + 32, z + w.second, y + fetch64( s + 16 ) );
+				std::swap( z, x );
+				s += 64;
+			}
+			len -= 128;
+		} while ( len >= 128 );
+
+		x += rotate( v.first + z, 49 ) * CITY_K0;
+		y = y * CITY_K0 + rotate( w.second, 37 );
+		z = z * CITY_K0 + rotate( w.first, 27 );
+		w.first *= 9;
+		v.first *= CITY_K0;
+
+		// Hash up to 4 chunks of 32 bytes each from the end of the input
+		for ( size_t tailDone = 0; tailDone < len; )
+		{
+			tailDone += 32;
+			y = rotate( x + y, 42 ) * CITY_K0 + v.second;
+			w.first += fetch64( s + len - tailDone + 16 );
+			x = x * CITY_K0 + w.first;
+			z += w.second + fetch64( s + len - tailDone );
+			w.second += v.first;
+			v = weakHashLen32WithSeeds( s + len - tailDone, v.first + z, v.second );
+			v.first *= CITY_K0;
+		}
+
+		// Two different 56-byte-to-8-byte reductions produce the 16-byte result
+		x = hashLen16( x, v.first );
+		y = hashLen16( y + z, w.first );
+
+		return { hashLen16( x + v.second, w.second ) + y, hashLen16( x + w.second, y + v.second ) };
+	}
+
+	inline Hash128 cityHash128( std::string_view data ) noexcept
+	{
+		using namespace constants;
+		using internal::city::fetch64;
+
+		if ( data.size() >= 16 )
+		{
+			return cityHash128( data.substr( 16 ), Hash128{ fetch64( data.data() ), fetch64( data.data() + 8 ) + CITY_K0 } );
+		}
+
+		return cityHash128( data, Hash128{ CITY_K0, CITY_K1 } );
 	}
 
 	//----------------------------------------------
@@ -0,0 +1,101 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BatchLookup.inl
+ * @brief Implementation of the batched hash-and-prefetch lookup pipeline
+ * @details Ring of precomputed bucket indexes feeding the caller's probe
+ */
+
+#include <array>
+#include <type_traits>
+
+#include <xmmintrin.h>
+
+namespace nfx::hashing
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Prefetch helper
+		//=====================================================================
+
+		/** @brief Requests the cache line at @p address into all cache levels without blocking */
+		inline void prefetchRead( const void* address ) noexcept
+		{
+			_mm_prefetch( static_cast<const char*>( address ), _MM_HINT_T0 );
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// Batched lookup
+	//=====================================================================
+
+	template <typename THasher, typename TKey>
+	inline uint64_t bucketIndex( const THasher& hasher, const TKey& key, uint64_t bucketCount, uint64_t seed ) noexcept
+	{
+		using HashType = std::remove_cvref_t<decltype( hasher( key ) )>;
+
+		return static_cast<uint64_t>( seedMix<HashType>( static_cast<HashType>( seed ), hasher( key ), bucketCount ) );
+	}
+
+	template <std::size_t Distance, typename THasher, std::ranges::contiguous_range TKeys, typename TBucketAddress, typename TProbe>
+		requires( Distance > 0 )
+	inline void batchLookup( const TKeys& keys,
+		uint64_t bucketCount,
+		TBucketAddress&& bucketAddress,
+		TProbe&& probe,
+		uint64_t seed,
+		const THasher& hasher )
+	{
+		const auto* data = std::ranges::data( keys );
+		const std::size_t count = static_cast<std::size_t>( std::ranges::size( keys ) );
+
+		// ring[i % Distance] holds the bucket of the i-th key once it has been prefetched
+		std::array<uint64_t, Distance> ring;
+		const std::size_t warmup = count < Distance ? count : Distance;
+		for ( std::size_t i = 0; i < warmup; ++i )
+		{
+			ring[i] = bucketIndex( hasher, data[i], bucketCount, seed );
+			internal::prefetchRead( bucketAddress( ring[i] ) );
+		}
+
+		std::size_t slot = 0;
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			const uint64_t bucket = ring[slot];
+
+			const std::size_t ahead = i + Distance;
+			if ( ahead < count )
+			{
+				ring[slot] = bucketIndex( hasher, data[ahead], bucketCount, seed );
+				internal::prefetchRead( bucketAddress( ring[slot] ) );
+			}
+
+			probe( i, data[i], bucket );
+
+			slot = slot + 1 == Distance ? 0 : slot + 1;
+		}
+	}
+} // namespace nfx::hashing
@@ -0,0 +1,462 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BinaryFuseFilter.inl
+ * @brief Implementation of the binary fuse filter
+ * @details Segment sizing, slot derivation, parallel slot counting, peeling and image encoding
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include "nfx/hashing/RangeReduction.h"
+
+#include "nfx/detail/hashing/Parallel.h"
+
+namespace nfx::hashing
+{
+	namespace internal::fuse
+	{
+		//=====================================================================
+		// Image format constants
+		//=====================================================================
+
+		/** @brief "NFXFUSE1" read as a little-endian word */
+		inline constexpr uint64_t MAGIC{ 0x314553554658464EULL };
+
+		/** @brief Current format version */
+		inline constexpr uint32_t VERSION{ 1 };
+
+		/** @brief Header size in words */
+		inline constexpr uint64_t HEADER_WORDS{ 8 };
+
+		/** @brief String hashed into the header to detect hasher mismatches */
+		inline constexpr std::string_view HASHER_CHECK_INPUT{ "nfx::hashing::BinaryFuseFilter" };
+
+		//=====================================================================
+		// Layout
+		//=====================================================================
+
+		/** @brief Fingerprint array geometry for a key count */
+		struct Layout
+		{
+			uint64_t segmentLength;
+			uint64_t segmentCountLength;
+			uint64_t arrayLength;
+		};
+
+		/**
+		 * @brief Sizes the array for @p size keys as the reference implementation does
+		 * @details Segments grow with log( size ) and the array with a factor falling from about
+		 *          1.6 for small sets to 1.125, the sparsest array that still peels reliably.
+		 */
+		inline Layout layout( uint64_t size, uint64_t maxSegmentLength ) noexcept
+		{
+			const double count = static_cast<double>( size );
+			uint64_t segmentLength = size == 0 ? 4 : uint64_t{ 1 } << static_cast<int>( std::floor( std::log( count ) / std::log( 3.33 ) + 2.25 ) );
+			segmentLength = std::min( segmentLength, maxSegmentLength );
+
+			const double sizeFactor = size <= 1 ? 0.0 : std::max( 1.125, 0.875 + 0.25 * std::log( 1000000.0 ) / std::log( count ) );
+			const auto capacity = static_cast<uint64_t>( std::llround( count * sizeFactor ) );
+
+			// Three consecutive segments per key: the last two segments only hold second and third slots
+			const uint64_t segments = ( capacity + segmentLength - 1 ) / segmentLength;
+			const uint64_t segmentCount = segments <= 2 ? 1 : segments - 2;
+
+			return { segmentLength, segmentCount * segmentLength, ( segmentCount + 2 ) * segmentLength };
+		}
+
+		//=====================================================================
+		// Slot derivation
+		//=====================================================================
+
+		/** @brief Remixes a key hash with the filter seed (bijective in @p hash) */
+		inline constexpr uint64_t mix( uint64_t hash, uint64_t seed ) noexcept
+		{
+			return internal::hashInteger<uint64_t, 0>( hash + seed );
+		}
+
+		/** @brief Seed of build attempt @p attempt */
+		inline constexpr uint64_t attemptSeed( uint64_t base, uint64_t attempt ) noexcept
+		{
+			return internal::hashInteger<uint64_t, 0>( base + ( attempt + 1 ) * constants::GOLDEN_RATIO_64 );
+		}
+
+		inline constexpr uint8_t fingerprint( uint64_t mixed ) noexcept
+		{
+			return static_cast<uint8_t>( mixed ^ ( mixed >> 32 ) );
+		}
+
+		/** @brief The three slots of a remixed hash, one in each of three consecutive segments */
+		inline std::array<uint64_t, 3> slots( uint64_t mixed, uint64_t segmentLength, uint64_t segmentCountLength ) noexcept
+		{
+			const uint64_t first = fastRange<uint64_t>( mixed, segmentCountLength );
+			const uint64_t mask = segmentLength - 1;
+
+			return { first, ( first + segmentLength ) ^ ( ( mixed >> 18 ) & mask ), ( first + 2 * segmentLength ) ^ ( mixed & mask ) };
+		}
+
+		//=====================================================================
+		// Peeling
+		//=====================================================================
+
+		/*
+		 * Per slot, count holds 4 x (keys touching it) plus, in its low two bits, the XOR of the
+		 * positions (0, 1, 2) at which those keys touch it; xorHash holds the XOR of their hashes.
+		 * Once a slot is touched by a single key, xorHash is that key and the low bits say which of
+		 * its three slots this is. Additions of 4 and XORs below 4 commute, so threads may apply
+		 * them in any order.
+		 */
+
+		/** @brief Attempts to peel every hash; fills @p order / @p positions in peeling order */
+		inline bool peel( const std::vector<uint64_t>& mixed,
+			const Layout& geometry,
+			std::size_t threadCount,
+			std::vector<uint32_t>& count,
+			std::vector<uint64_t>& xorHash,
+			std::vector<uint64_t>& order,
+			std::vector<uint8_t>& positions )
+		{
+			count.assign( geometry.arrayLength, 0 );
+			xorHash.assign( geometry.arrayLength, 0 );
+
+			internal::parallel::parallelFor( threadCount, mixed.size(), [&]( std::size_t, std::size_t begin, std::size_t end ) {
+				for ( std::size_t i = begin; i < end; ++i )
+				{
+					const auto slot = slots( mixed[i], geometry.segmentLength, geometry.segmentCountLength );
+					for ( uint32_t position = 0; position < 3; ++position )
+					{
+						if ( threadCount == 1 )
+						{
+							count[slot[position]] = ( count[slot[position]] + 4 ) ^ position;
+							xorHash[slot[position]] ^= mixed[i];
+						}
+						else
+						{
+							std::atomic_ref<uint32_t>{ count[slot[position]] }.fetch_add( 4, std::memory_order_relaxed );
+							std::atomic_ref<uint32_t>{ count[slot[position]] }.fetch_xor( position, std::memory_order_relaxed );
+							std::atomic_ref<uint64_t>{ xorHash[slot[position]] }.fetch_xor( mixed[i], std::memory_order_relaxed );
+						}
+					}
+				}
+			} );
+
+			std::vector<uint64_t> alone;
+			alone.reserve( geometry.arrayLength );
+			for ( uint64_t i = 0; i < geometry.arrayLength; ++i )
+			{
+				if ( ( count[i] >> 2 ) == 1 )
+				{
+					alone.push_back( i );
+				}
+			}
+
+			order.clear();
+			positions.clear();
+			while ( !alone.empty() )
+			{
+				const uint64_t index = alone.back();
+				alone.pop_back();
+				if ( ( count[index] >> 2 ) != 1 )
+				{
+					continue;
+				}
+
+				const uint64_t hash = xorHash[index];
+				const auto found = static_cast<uint8_t>( count[index] & 3 );
+				order.push_back( hash );
+				positions.push_back( found );
+
+				// Detach the key from its two other slots
+				const auto slot = slots( hash, geometry.segmentLength, geometry.segmentCountLength );
+				for ( uint32_t step = 1; step < 3; ++step )
+				{
+					const uint32_t position = ( found + step ) % 3;
+					const uint64_t other = slot[position];
+					count[other] = ( count[other] - 4 ) ^ position;
+					xorHash[other] ^= hash;
+					if ( ( count[other] >> 2 ) == 1 )
+					{
+						alone.push_back( other );
+					}
+				}
+			}
+
+			return order.size() == mixed.size();
+		}
+	} // namespace internal::fuse
+
+	//=====================================================================
+	// BinaryFuseFilter
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename THasher>
+	template <std::ranges::random_access_range TRange>
+	BinaryFuseFilter<THasher> BinaryFuseFilter<THasher>::build( const TRange& keys, const BuildOptions& options )
+	{
+		using namespace internal::fuse;
+
+		const auto keyCount = static_cast<std::size_t>( std::ranges::size( keys ) );
+		const std::size_t threadCount = internal::parallel::threadCountFor( options.threadCount, keyCount );
+
+		const THasher hasher{};
+		std::vector<uint64_t> hashes( keyCount );
+		internal::parallel::parallelFor( threadCount, keyCount, [&]( std::size_t, std::size_t begin, std::size_t end ) {
+			const auto first = std::ranges::begin( keys );
+			for ( std::size_t i = begin; i < end; ++i )
+			{
+				hashes[i] = static_cast<uint64_t>( hasher( first[static_cast<std::ptrdiff_t>( i )] ) );
+			}
+		} );
+
+		std::vector<uint64_t> mixed( keyCount );
+		std::vector<uint32_t> count;
+		std::vector<uint64_t> xorHash;
+		std::vector<uint64_t> order;
+		std::vector<uint8_t> positions;
+		Layout geometry = layout( hashes.size(), MAX_SEGMENT_LENGTH );
+		uint64_t seed = 0;
+		bool peeled = false;
+		bool deduplicated = false;
+		for ( std::size_t attempt = 0; attempt < MAX_ATTEMPTS && !peeled; ++attempt )
+		{
+			seed = attemptSeed( options.seed, attempt );
+			internal::parallel::parallelFor( threadCount, hashes.size(), [&]( std::size_t, std::size_t begin, std::size_t end ) {
+				for ( std::size_t i = begin; i < end; ++i )
+				{
+					mixed[i] = mix( hashes[i], seed );
+				}
+			} );
+			peeled = peel( mixed, geometry, threadCount, count, xorHash, order, positions );
+
+			// Two equal hashes can never be peeled; drop duplicates once, then keep retrying
+			if ( !peeled && !deduplicated )
+			{
+				deduplicated = true;
+				std::sort( hashes.begin(), hashes.end() );
+				hashes.erase( std::unique( hashes.begin(), hashes.end() ), hashes.end() );
+				mixed.resize( hashes.size() );
+				geometry = layout( hashes.size(), MAX_SEGMENT_LENGTH );
+			}
+		}
+		if ( !peeled )
+		{
+			throw std::runtime_error{ "BinaryFuseFilter::build: no seed produced a peelable key set" };
+		}
+
+		// Assign in reverse peeling order: each key's own slot is the last of its three to be set
+		const uint64_t fingerprintWords = ( geometry.arrayLength + 7 ) / 8;
+		std::vector<uint64_t> image( HEADER_WORDS + fingerprintWords, 0 );
+		auto* fingerprints = reinterpret_cast<uint8_t*>( image.data() + HEADER_WORDS );
+		for ( std::size_t i = order.size(); i-- > 0; )
+		{
+			const auto slot = slots( order[i], geometry.segmentLength, geometry.segmentCountLength );
+			const uint8_t found = positions[i];
+			fingerprints[slot[found]] = fingerprint( order[i] ) ^ fingerprints[slot[( found + 1 ) % 3]] ^ fingerprints[slot[( found + 2 ) % 3]];
+		}
+
+		image[0] = internal::littleEndian( MAGIC );
+		image[1] = internal::littleEndian( static_cast<uint64_t>( VERSION ) | ( ( HEADER_WORDS * 8 ) << 32 ) );
+		image[2] = internal::littleEndian( hashes.size() );
+		image[3] = internal::littleEndian( seed );
+		image[4] = internal::littleEndian( geometry.segmentLength );
+		image[5] = internal::littleEndian( geometry.segmentCountLength );
+		image[6] = internal::littleEndian( geometry.arrayLength );
+		image[7] = internal::littleEndian( static_cast<uint64_t>( hasher( HASHER_CHECK_INPUT ) ) );
+
+		BinaryFuseFilter result;
+		result.m_storage = std::move( image );
+		result.attach( std::as_bytes( std::span<const uint64_t>{ result.m_storage } ) );
+
+		return result;
+	}
+
+	template <typename THasher>
+	BinaryFuseFilter<THasher>::BinaryFuseFilter( std::span<const std::byte> image )
+	{
+		attach( image );
+	}
+
+	template <typename THasher>
+	BinaryFuseFilter<THasher>::BinaryFuseFilter( MappedFile file )
+		: m_file{ std::move( file ) }
+	{
+		attach( m_file.bytes() );
+	}
+
+	template <typename THasher>
+	BinaryFuseFilter<THasher>::BinaryFuseFilter( BinaryFuseFilter&& other ) noexcept
+		: m_storage{ std::move( other.m_storage ) },
+		  m_file{ std::move( other.m_file ) },
+		  m_image{ std::exchange( other.m_image, {} ) },
+		  m_fingerprints{ std::exchange( other.m_fingerprints, nullptr ) },
+		  m_size{ std::exchange( other.m_size, 0 ) },
+		  m_seed{ std::exchange( other.m_seed, 0 ) },
+		  m_segmentLength{ std::exchange( other.m_segmentLength, 0 ) },
+		  m_segmentCountLength{ std::exchange( other.m_segmentCountLength, 0 ) }
+	{
+	}
+
+	template <typename THasher>
+	BinaryFuseFilter<THasher>& BinaryFuseFilter<THasher>::operator=( BinaryFuseFilter&& other ) noexcept
+	{
+		if ( this != &other )
+		{
+			m_storage = std::move( other.m_storage );
+			m_file = std::move( other.m_file );
+			m_image = std::exchange( other.m_image, {} );
+			m_fingerprints = std::exchange( other.m_fingerprints, nullptr );
+			m_size = std::exchange( other.m_size, 0 );
+			m_seed = std::exchange( other.m_seed, 0 );
+			m_segmentLength = std::exchange( other.m_segmentLength, 0 );
+			m_segmentCountLength = std::exchange( other.m_segmentCountLength, 0 );
+		}
+
+		return *this;
+	}
+
+	//----------------------------------------------
+	// Query
+	//----------------------------------------------
+
+	template <typename THasher>
+	template <typename TKey>
+	inline bool BinaryFuseFilter<THasher>::contains( const TKey& key ) const noexcept
+	{
+		return containsHash( static_cast<uint64_t>( m_hasher( key ) ) );
+	}
+
+	template <typename THasher>
+	inline bool BinaryFuseFilter<THasher>::containsHash( uint64_t hash ) const noexcept
+	{
+		using namespace internal::fuse;
+
+		if ( m_size == 0 )
+		{
+			return false;
+		}
+
+		const uint64_t mixed = mix( hash, m_seed );
+		const auto slot = slots( mixed, m_segmentLength, m_segmentCountLength );
+
+		return ( fingerprint( mixed ) ^ m_fingerprints[slot[0]] ^ m_fingerprints[slot[1]] ^ m_fingerprints[slot[2]] ) == 0;
+	}
+
+	template <typename THasher>
+	inline std::size_t BinaryFuseFilter<THasher>::size() const noexcept
+	{
+		return static_cast<std::size_t>( m_size );
+	}
+
+	template <typename THasher>
+	inline double BinaryFuseFilter<THasher>::bitsPerKey() const noexcept
+	{
+		return m_size == 0 ? 0.0 : static_cast<double>( m_image.size_bytes() * 8 ) / static_cast<double>( m_size );
+	}
+
+	//----------------------------------------------
+	// Serialization
+	//----------------------------------------------
+
+	template <typename THasher>
+	inline std::vector<std::byte> BinaryFuseFilter<THasher>::serialize() const
+	{
+		const auto bytes = std::as_bytes( m_image );
+
+		return { bytes.begin(), bytes.end() };
+	}
+
+	template <typename THasher>
+	inline void BinaryFuseFilter<THasher>::write( const std::filesystem::path& path ) const
+	{
+		std::ofstream file{ path, std::ios::binary | std::ios::trunc };
+		file.write( reinterpret_cast<const char*>( m_image.data() ), static_cast<std::streamsize>( m_image.size_bytes() ) );
+		file.close();
+		if ( !file )
+		{
+			throw std::runtime_error{ "BinaryFuseFilter::write: cannot write " + path.string() };
+		}
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	template <typename THasher>
+	inline void BinaryFuseFilter<THasher>::attach( std::span<const std::byte> image )
+	{
+		using namespace internal::fuse;
+		using internal::littleEndian;
+
+		if ( image.size() < HEADER_WORDS * 8 || image.size() % 8 != 0 || reinterpret_cast<std::uintptr_t>( image.data() ) % alignof( uint64_t ) != 0 )
+		{
+			throw std::runtime_error{ "BinaryFuseFilter: image is truncated or misaligned" };
+		}
+
+		const auto* words = reinterpret_cast<const uint64_t*>( image.data() );
+		const uint64_t wordCount = image.size() / 8;
+		if ( littleEndian( words[0] ) != MAGIC )
+		{
+			throw std::runtime_error{ "BinaryFuseFilter: not a binary fuse filter image" };
+		}
+		if ( littleEndian( words[1] ) != ( static_cast<uint64_t>( VERSION ) | ( ( HEADER_WORDS * 8 ) << 32 ) ) )
+		{
+			throw std::runtime_error{ "BinaryFuseFilter: unsupported format version" };
+		}
+		if ( littleEndian( words[7] ) != static_cast<uint64_t>( m_hasher( HASHER_CHECK_INPUT ) ) )
+		{
+			throw std::runtime_error{ "BinaryFuseFilter: image was built with a different hasher" };
+		}
+
+		const uint64_t size = littleEndian( words[2] );
+		const uint64_t segmentLength = littleEndian( words[4] );
+		const uint64_t segmentCountLength = littleEndian( words[5] );
+		const uint64_t arrayLength = littleEndian( words[6] );
+		if ( !std::has_single_bit( segmentLength ) || segmentLength > MAX_SEGMENT_LENGTH || segmentCountLength % segmentLength != 0 ||
+			 arrayLength != segmentCountLength + 2 * segmentLength || HEADER_WORDS + ( arrayLength + 7 ) / 8 != wordCount )
+		{
+			throw std::runtime_error{ "BinaryFuseFilter: corrupt or truncated image" };
+		}
+
+		m_image = { words, static_cast<std::size_t>( wordCount ) };
+		m_fingerprints = reinterpret_cast<const uint8_t*>( words + HEADER_WORDS );
+		m_size = size;
+		m_seed = littleEndian( words[3] );
+		m_segmentLength = segmentLength;
+		m_segmentCountLength = segmentCountLength;
+	}
+} // namespace nfx::hashing
@@ -0,0 +1,456 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BloomFilter.inl
+ * @brief Implementation of the split block Bloom filter
+ * @details Block bit masks, AVX2 and portable block kernels, sizing and image encoding
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <string_view>
+
+#include <immintrin.h>
+
+#include "nfx/hashing/Algorithms.h"
+#include "nfx/hashing/BatchLookup.h"
+
+namespace nfx::hashing
+{
+	namespace internal::bloom
+	{
+		//=====================================================================
+		// Image format constants
+		//=====================================================================
+
+		/** @brief "NFXBLOM1" read as a little-endian word */
+		inline constexpr uint64_t MAGIC{ 0x314D4F4C4258464EULL };
+
+		/** @brief Current format version */
+		inline constexpr uint32_t VERSION{ 1 };
+
+		/** @brief Header size in words */
+		inline constexpr uint64_t HEADER_WORDS{ 8 };
+
+		/** @brief String hashed into the header to detect hasher mismatches */
+		inline constexpr std::string_view HASHER_CHECK_INPUT{ "nfx::hashing::BloomFilter" };
+
+		/** @brief Hashes tested per chunk by the batched query (block indexes computed and prefetched together) */
+		inline constexpr std::size_t BATCH_CHUNK{ 64 };
+
+		//=====================================================================
+		// Block kernels
+		//=====================================================================
+
+		/** @brief Odd multipliers selecting the bit of each block word (one per word) */
+		inline constexpr std::array<uint32_t, 8> SALTS{
+			0x47B6137Bu, 0x44974D91u, 0x8824AD5Bu, 0xA2B7289Du, 0x705495C7u, 0x2DF1424Bu, 0x9EFC4947u, 0x5C6BFB31u };
+
+		/** @brief Bit of word @p word selected by @p key: the top 5 bits of key x salt */
+		inline constexpr uint32_t bitMask( uint32_t key, std::size_t word ) noexcept
+		{
+			return uint32_t{ 1 } << ( ( key * SALTS[word] ) >> 27 );
+		}
+
+		inline void insertPortable( uint32_t* block, uint32_t key ) noexcept
+		{
+			for ( std::size_t word = 0; word < SALTS.size(); ++word )
+			{
+				block[word] |= bitMask( key, word );
+			}
+		}
+
+		inline bool containsPortable( const uint32_t* block, uint32_t key ) noexcept
+		{
+			for ( std::size_t word = 0; word < SALTS.size(); ++word )
+			{
+				if ( ( block[word] & bitMask( key, word ) ) == 0 )
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		NFX_HASHING_TARGET( "avx2" )
+		inline __m256i bitMasksAvx2( uint32_t key ) noexcept
+		{
+			const __m256i salts = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( SALTS.data() ) );
+			const __m256i bits = _mm256_srli_epi32( _mm256_mullo_epi32( _mm256_set1_epi32( static_cast<int>( key ) ), salts ), 27 );
+
+			return _mm256_sllv_epi32( _mm256_set1_epi32( 1 ), bits );
+		}
+
+		NFX_HASHING_TARGET( "avx2" )
+		inline void insertAvx2( uint32_t* block, uint32_t key ) noexcept
+		{
+			auto* vector = reinterpret_cast<__m256i*>( block );
+			_mm256_store_si256( vector, _mm256_or_si256( _mm256_load_si256( vector ), bitMasksAvx2( key ) ) );
+		}
+
+		NFX_HASHING_TARGET( "avx2" )
+		inline bool containsAvx2( const uint32_t* block, uint32_t key ) noexcept
+		{
+			// testc: every mask bit is also set in the block
+			return _mm256_testc_si256( _mm256_load_si256( reinterpret_cast<const __m256i*>( block ) ), bitMasksAvx2( key ) ) != 0;
+		}
+
+		NFX_HASHING_TARGET( "avx2" )
+		inline void containsChunkAvx2( const uint32_t* blocks, const uint64_t* indexes, const uint64_t* hashes, std::size_t count, bool* results ) noexcept
+		{
+			for ( std::size_t i = 0; i < count; ++i )
+			{
+				results[i] = containsAvx2( blocks + indexes[i] * SALTS.size(), static_cast<uint32_t>( hashes[i] ) );
+			}
+		}
+
+		NFX_HASHING_TARGET( "avx2" )
+		inline void mergeAvx2( uint32_t* blocks, const uint32_t* other, std::size_t blockCount ) noexcept
+		{
+			auto* target = reinterpret_cast<__m256i*>( blocks );
+			const auto* source = reinterpret_cast<const __m256i*>( other );
+			for ( std::size_t i = 0; i < blockCount; ++i )
+			{
+				_mm256_store_si256( target + i, _mm256_or_si256( _mm256_load_si256( target + i ), _mm256_load_si256( source + i ) ) );
+			}
+		}
+
+		//=====================================================================
+		// Sizing
+		//=====================================================================
+
+		/** @brief False positive rate of one block holding @p keys keys */
+		inline double blockFalsePositiveRate( double keys ) noexcept
+		{
+			// Each key sets one of 32 bits in each of the 8 words
+			const double wordFill = 1.0 - std::pow( 31.0 / 32.0, keys );
+
+			return std::pow( wordFill, 8.0 );
+		}
+	} // namespace internal::bloom
+
+	//=====================================================================
+	// BloomFilter
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename THasher>
+	BloomFilter<THasher>::BloomFilter()
+		: m_blocks( 1 )
+	{
+	}
+
+	template <typename THasher>
+	BloomFilter<THasher>::BloomFilter( std::size_t expectedCount, double falsePositiveRate )
+	{
+		if ( !( falsePositiveRate > 0.0 && falsePositiveRate < 1.0 ) )
+		{
+			throw std::invalid_argument{ "BloomFilter: false positive rate must be in (0, 1)" };
+		}
+
+		// Smallest block count meeting the target; the rate falls monotonically as blocks are added
+		std::size_t low = 1;
+		std::size_t high = 1;
+		while ( expectedFalsePositiveRate( expectedCount, high ) > falsePositiveRate )
+		{
+			low = high + 1;
+			high *= 2;
+		}
+		while ( low < high )
+		{
+			const std::size_t middle = low + ( high - low ) / 2;
+			if ( expectedFalsePositiveRate( expectedCount, middle ) > falsePositiveRate )
+			{
+				low = middle + 1;
+			}
+			else
+			{
+				high = middle;
+			}
+		}
+
+		m_blocks.resize( high );
+	}
+
+	template <typename THasher>
+	BloomFilter<THasher>::BloomFilter( std::span<const std::byte> image )
+	{
+		using namespace internal::bloom;
+
+		const auto readWord = [&image]( std::size_t offset, std::size_t bytes ) {
+			uint64_t value = 0;
+			for ( std::size_t i = 0; i < bytes; ++i )
+			{
+				value |= static_cast<uint64_t>( image[offset + i] ) << ( 8 * i );
+			}
+
+			return value;
+		};
+
+		if ( image.size() < HEADER_WORDS * 8 )
+		{
+			throw std::runtime_error{ "BloomFilter: image is truncated" };
+		}
+		if ( readWord( 0, 8 ) != MAGIC )
+		{
+			throw std::runtime_error{ "BloomFilter: not a Bloom filter image" };
+		}
+		if ( readWord( 8, 8 ) != ( static_cast<uint64_t>( VERSION ) | ( ( HEADER_WORDS * 8 ) << 32 ) ) )
+		{
+			throw std::runtime_error{ "BloomFilter: unsupported format version" };
+		}
+
+		const uint64_t blockCount = readWord( 16, 8 );
+		if ( blockCount == 0 || blockCount != ( image.size() - HEADER_WORDS * 8 ) / BLOCK_BYTES ||
+			 ( image.size() - HEADER_WORDS * 8 ) % BLOCK_BYTES != 0 )
+		{
+			throw std::runtime_error{ "BloomFilter: corrupt or truncated block array" };
+		}
+		if ( readWord( 24, 8 ) != static_cast<uint64_t>( m_hasher( HASHER_CHECK_INPUT ) ) )
+		{
+			throw std::runtime_error{ "BloomFilter: filter was built with a different hasher" };
+		}
+
+		m_blocks.resize( static_cast<std::size_t>( blockCount ) );
+		std::size_t offset = HEADER_WORDS * 8;
+		for ( auto& block : m_blocks )
+		{
+			for ( auto& word : block.words )
+			{
+				word = static_cast<uint32_t>( readWord( offset, 4 ) );
+				offset += 4;
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Modifiers
+	//----------------------------------------------
+
+	template <typename THasher>
+	template <typename TKey>
+	inline void BloomFilter<THasher>::insert( const TKey& key ) noexcept
+	{
+		insertHash( static_cast<uint64_t>( m_hasher( key ) ) );
+	}
+
+	template <typename THasher>
+	inline void BloomFilter<THasher>::insertHash( uint64_t hash ) noexcept
+	{
+		uint32_t* block = m_blocks[blockIndex( hash )].words;
+		if ( internal::hasAvx2Support() )
+		{
+			internal::bloom::insertAvx2( block, static_cast<uint32_t>( hash ) );
+		}
+		else
+		{
+			internal::bloom::insertPortable( block, static_cast<uint32_t>( hash ) );
+		}
+	}
+
+	template <typename THasher>
+	inline void BloomFilter<THasher>::insertHashes( std::span<const uint64_t> hashes ) noexcept
+	{
+		for ( const uint64_t hash : hashes )
+		{
+			insertHash( hash );
+		}
+	}
+
+	template <typename THasher>
+	inline void BloomFilter<THasher>::merge( const BloomFilter& other )
+	{
+		if ( other.m_blocks.size() != m_blocks.size() )
+		{
+			throw std::invalid_argument{ "BloomFilter::merge: filters have different block counts" };
+		}
+
+		if ( internal::hasAvx2Support() )
+		{
+			internal::bloom::mergeAvx2( m_blocks.data()->words, other.m_blocks.data()->words, m_blocks.size() );
+			return;
+		}
+		for ( std::size_t i = 0; i < m_blocks.size(); ++i )
+		{
+			for ( std::size_t word = 0; word < BLOCK_WORDS; ++word )
+			{
+				m_blocks[i].words[word] |= other.m_blocks[i].words[word];
+			}
+		}
+	}
+
+	template <typename THasher>
+	inline void BloomFilter<THasher>::clear() noexcept
+	{
+		std::fill( m_blocks.begin(), m_blocks.end(), Block{} );
+	}
+
+	//----------------------------------------------
+	// Query
+	//----------------------------------------------
+
+	template <typename THasher>
+	template <typename TKey>
+	inline bool BloomFilter<THasher>::contains( const TKey& key ) const noexcept
+	{
+		return containsHash( static_cast<uint64_t>( m_hasher( key ) ) );
+	}
+
+	template <typename THasher>
+	inline bool BloomFilter<THasher>::containsHash( uint64_t hash ) const noexcept
+	{
+		const uint32_t* block = m_blocks[blockIndex( hash )].words;
+		if ( internal::hasAvx2Support() )
+		{
+			return internal::bloom::containsAvx2( block, static_cast<uint32_t>( hash ) );
+		}
+
+		return internal::bloom::containsPortable( block, static_cast<uint32_t>( hash ) );
+	}
+
+	template <typename THasher>
+	inline std::size_t BloomFilter<THasher>::containsHashes( std::span<const uint64_t> hashes, std::span<bool> results ) const noexcept
+	{
+		using internal::bloom::BATCH_CHUNK;
+
+		const bool avx2 = internal::hasAvx2Support();
+		std::array<uint64_t, BATCH_CHUNK> indexes;
+		std::size_t positives = 0;
+		for ( std::size_t begin = 0; begin < hashes.size(); begin += BATCH_CHUNK )
+		{
+			const std::size_t count = std::min( BATCH_CHUNK, hashes.size() - begin );
+			fastRange( hashes.subspan( begin, count ), static_cast<uint64_t>( m_blocks.size() ), std::span<uint64_t>{ indexes.data(), count } );
+			for ( std::size_t i = 0; i < count; ++i )
+			{
+				internal::prefetchRead( &m_blocks[indexes[i]] );
+			}
+
+			if ( avx2 )
+			{
+				internal::bloom::containsChunkAvx2( m_blocks.data()->words, indexes.data(), hashes.data() + begin, count, results.data() + begin );
+			}
+			else
+			{
+				for ( std::size_t i = 0; i < count; ++i )
+				{
+					results[begin + i] = internal::bloom::containsPortable( m_blocks[indexes[i]].words, static_cast<uint32_t>( hashes[begin + i] ) );
+				}
+			}
+			for ( std::size_t i = 0; i < count; ++i )
+			{
+				positives += results[begin + i];
+			}
+		}
+
+		return positives;
+	}
+
+	template <typename THasher>
+	inline std::size_t BloomFilter<THasher>::blockCount() const noexcept
+	{
+		return m_blocks.size();
+	}
+
+	template <typename THasher>
+	inline std::size_t BloomFilter<THasher>::byteSize() const noexcept
+	{
+		return m_blocks.size() * BLOCK_BYTES;
+	}
+
+	template <typename THasher>
+	inline double BloomFilter<THasher>::expectedFalsePositiveRate( std::size_t keyCount, std::size_t blockCount ) noexcept
+	{
+		if ( keyCount == 0 )
+		{
+			return 0.0;
+		}
+
+		// Sum the block rate over Poisson( lambda ) keys per block, out to where the weights vanish
+		const double lambda = static_cast<double>( keyCount ) / static_cast<double>( std::max<std::size_t>( blockCount, 1 ) );
+		const double spread = 12.0 * std::sqrt( lambda ) + 12.0;
+		const auto first = static_cast<std::size_t>( std::max( 0.0, lambda - spread ) );
+		const auto last = static_cast<std::size_t>( lambda + spread );
+		double rate = 0.0;
+		for ( std::size_t keys = first; keys <= last; ++keys )
+		{
+			const double k = static_cast<double>( keys );
+			const double weight = std::exp( k * std::log( lambda ) - lambda - std::lgamma( k + 1.0 ) );
+			rate += weight * internal::bloom::blockFalsePositiveRate( k );
+		}
+
+		return std::min( rate, 1.0 );
+	}
+
+	//----------------------------------------------
+	// Serialization
+	//----------------------------------------------
+
+	template <typename THasher>
+	inline std::vector<std::byte> BloomFilter<THasher>::serialize() const
+	{
+		using namespace internal::bloom;
+
+		std::vector<std::byte> image( HEADER_WORDS * 8 + m_blocks.size() * BLOCK_BYTES );
+		const auto writeWord = [&image]( std::size_t offset, uint64_t value, std::size_t bytes ) {
+			for ( std::size_t i = 0; i < bytes; ++i )
+			{
+				image[offset + i] = static_cast<std::byte>( value >> ( 8 * i ) );
+			}
+		};
+
+		writeWord( 0, MAGIC, 8 );
+		writeWord( 8, static_cast<uint64_t>( VERSION ) | ( ( HEADER_WORDS * 8 ) << 32 ), 8 );
+		writeWord( 16, m_blocks.size(), 8 );
+		writeWord( 24, static_cast<uint64_t>( m_hasher( HASHER_CHECK_INPUT ) ), 8 );
+
+		std::size_t offset = HEADER_WORDS * 8;
+		for ( const auto& block : m_blocks )
+		{
+			for ( const uint32_t word : block.words )
+			{
+				writeWord( offset, word, 4 );
+				offset += 4;
+			}
+		}
+
+		return image;
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	template <typename THasher>
+	inline std::size_t BloomFilter<THasher>::blockIndex( uint64_t hash ) const noexcept
+	{
+		return static_cast<std::size_t>( fastRange<uint64_t>( hash, m_blocks.size() ) );
+	}
+} // namespace nfx::hashing
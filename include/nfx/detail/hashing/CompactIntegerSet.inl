@@ -0,0 +1,302 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CompactIntegerSet.inl
+ * @brief Implementation of the quotienting integer set
+ * @details Bit-packed slot access, Robin Hood probing with backward-shift deletion and growth
+ */
+
+#include <utility>
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// CompactIntegerSet
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline CompactIntegerSet::CompactIntegerSet()
+	{
+		allocate( MIN_QUOTIENT_BITS );
+	}
+
+	inline CompactIntegerSet::CompactIntegerSet( size_type expectedSize )
+		: CompactIntegerSet{}
+	{
+		reserve( expectedSize );
+	}
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	inline CompactIntegerSet::size_type CompactIntegerSet::size() const noexcept
+	{
+		return m_size;
+	}
+
+	inline bool CompactIntegerSet::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	inline CompactIntegerSet::size_type CompactIntegerSet::capacity() const noexcept
+	{
+		return m_indexMask + 1;
+	}
+
+	inline unsigned CompactIntegerSet::slotBits() const noexcept
+	{
+		return m_slotBits;
+	}
+
+	inline CompactIntegerSet::size_type CompactIntegerSet::memoryUsage() const noexcept
+	{
+		return m_words.size() * sizeof( uint64_t );
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	inline bool CompactIntegerSet::contains( uint64_t key ) const noexcept
+	{
+		const uint64_t hash = internal::hashInteger<uint64_t, 0>( key );
+		const uint64_t remainder = hash & m_remainderMask;
+		size_type slot = static_cast<size_type>( hash >> m_remainderBits );
+		for ( uint64_t distance = 0;; ++distance, slot = ( slot + 1 ) & m_indexMask )
+		{
+			const uint64_t value = load( slot );
+			const uint64_t stored = value >> m_remainderBits;
+			// Empty (0) or an entry closer to home than we are: the key would have been placed before it
+			if ( stored <= distance )
+			{
+				return false;
+			}
+			if ( stored == distance + 1 && ( value & m_remainderMask ) == remainder )
+			{
+				return true;
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Modifiers
+	//----------------------------------------------
+
+	inline bool CompactIntegerSet::insert( uint64_t key )
+	{
+		if ( contains( key ) )
+		{
+			return false;
+		}
+		if ( ( m_size + 1 ) * 8 > capacity() * 7 )
+		{
+			rehash( m_quotientBits + 1 );
+		}
+		insertHash( internal::hashInteger<uint64_t, 0>( key ) );
+		++m_size;
+
+		return true;
+	}
+
+	inline bool CompactIntegerSet::erase( uint64_t key ) noexcept
+	{
+		const uint64_t hash = internal::hashInteger<uint64_t, 0>( key );
+		const uint64_t remainder = hash & m_remainderMask;
+		size_type slot = static_cast<size_type>( hash >> m_remainderBits );
+		for ( uint64_t distance = 0;; ++distance, slot = ( slot + 1 ) & m_indexMask )
+		{
+			const uint64_t value = load( slot );
+			const uint64_t stored = value >> m_remainderBits;
+			if ( stored <= distance )
+			{
+				return false;
+			}
+			if ( stored == distance + 1 && ( value & m_remainderMask ) == remainder )
+			{
+				break;
+			}
+		}
+
+		// Backward shift: pull displaced successors one slot closer to home
+		for ( size_type next = ( slot + 1 ) & m_indexMask;; slot = next, next = ( next + 1 ) & m_indexMask )
+		{
+			const uint64_t value = load( next );
+			if ( ( value >> m_remainderBits ) <= 1 )
+			{
+				store( slot, 0 );
+				break;
+			}
+			store( slot, value - ( uint64_t{ 1 } << m_remainderBits ) );
+		}
+		--m_size;
+
+		return true;
+	}
+
+	inline void CompactIntegerSet::clear()
+	{
+		allocate( MIN_QUOTIENT_BITS );
+		m_size = 0;
+	}
+
+	inline void CompactIntegerSet::reserve( size_type expectedSize )
+	{
+		unsigned quotientBits = m_quotientBits;
+		while ( expectedSize * 8 > ( size_type{ 1 } << quotientBits ) * 7 )
+		{
+			++quotientBits;
+		}
+		if ( quotientBits != m_quotientBits )
+		{
+			rehash( quotientBits );
+		}
+	}
+
+	//----------------------------------------------
+	// Iteration
+	//----------------------------------------------
+
+	template <typename TFunction>
+	inline void CompactIntegerSet::for_each( TFunction&& function ) const
+	{
+		for ( size_type slot = 0; slot <= m_indexMask; ++slot )
+		{
+			const uint64_t value = load( slot );
+			if ( value != 0 )
+			{
+				function( unhashInteger<0>( entryHash( slot, value ) ) );
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	inline void CompactIntegerSet::allocate( unsigned quotientBits )
+	{
+		m_quotientBits = quotientBits;
+		m_remainderBits = 64 - quotientBits;
+		m_slotBits = m_remainderBits + DISTANCE_BITS;
+		m_remainderMask = ( uint64_t{ 1 } << m_remainderBits ) - 1;
+		m_slotMask = m_slotBits == 64 ? ~uint64_t{ 0 } : ( uint64_t{ 1 } << m_slotBits ) - 1;
+		m_indexMask = ( size_type{ 1 } << quotientBits ) - 1;
+
+		// One spare word lets a slot straddling the last boundary read its upper half unconditionally
+		m_words.assign( ( ( m_indexMask + 1 ) * m_slotBits + 63 ) / 64 + 1, 0 );
+	}
+
+	inline uint64_t CompactIntegerSet::load( size_type slot ) const noexcept
+	{
+		const size_type bit = slot * m_slotBits;
+		const size_type word = bit >> 6;
+		const unsigned shift = static_cast<unsigned>( bit & 63 );
+
+		uint64_t value = m_words[word] >> shift;
+		if ( shift + m_slotBits > 64 )
+		{
+			value |= m_words[word + 1] << ( 64 - shift );
+		}
+
+		return value & m_slotMask;
+	}
+
+	inline void CompactIntegerSet::store( size_type slot, uint64_t value ) noexcept
+	{
+		const size_type bit = slot * m_slotBits;
+		const size_type word = bit >> 6;
+		const unsigned shift = static_cast<unsigned>( bit & 63 );
+
+		m_words[word] = ( m_words[word] & ~( m_slotMask << shift ) ) | ( value << shift );
+		if ( shift + m_slotBits > 64 )
+		{
+			const unsigned spill = 64 - shift;
+			m_words[word + 1] = ( m_words[word + 1] & ~( m_slotMask >> spill ) ) | ( value >> spill );
+		}
+	}
+
+	inline uint64_t CompactIntegerSet::entryHash( size_type slot, uint64_t value ) const noexcept
+	{
+		const uint64_t distance = ( value >> m_remainderBits ) - 1;
+		const uint64_t home = ( slot - distance ) & m_indexMask;
+
+		return ( home << m_remainderBits ) | ( value & m_remainderMask );
+	}
+
+	inline void CompactIntegerSet::insertHash( uint64_t hash )
+	{
+		uint64_t remainder = hash & m_remainderMask;
+		size_type slot = static_cast<size_type>( hash >> m_remainderBits );
+		for ( uint64_t distance = 0;; ++distance, slot = ( slot + 1 ) & m_indexMask )
+		{
+			if ( distance > MAX_DISTANCE )
+			{
+				// The carried entry no longer fits: grow, then place it in the larger table
+				const uint64_t carried = ( ( ( slot - distance ) & m_indexMask ) << m_remainderBits ) | remainder;
+				rehash( m_quotientBits + 1 );
+				insertHash( carried );
+
+				return;
+			}
+
+			const uint64_t value = load( slot );
+			const uint64_t stored = value >> m_remainderBits;
+			if ( stored == 0 )
+			{
+				store( slot, ( ( distance + 1 ) << m_remainderBits ) | remainder );
+
+				return;
+			}
+			if ( stored - 1 < distance )
+			{
+				// Robin Hood: take the slot from the richer entry and carry it onwards
+				store( slot, ( ( distance + 1 ) << m_remainderBits ) | remainder );
+				remainder = value & m_remainderMask;
+				distance = stored - 1;
+			}
+		}
+	}
+
+	inline void CompactIntegerSet::rehash( unsigned quotientBits )
+	{
+		CompactIntegerSet old{ std::move( *this ) };
+		allocate( quotientBits );
+
+		for ( size_type slot = 0; slot <= old.m_indexMask; ++slot )
+		{
+			const uint64_t value = old.load( slot );
+			if ( value != 0 )
+			{
+				insertHash( old.entryHash( slot, value ) );
+			}
+		}
+		m_size = old.m_size;
+	}
+} // namespace nfx::hashing
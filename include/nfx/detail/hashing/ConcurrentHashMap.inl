@@ -0,0 +1,280 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ConcurrentHashMap.inl
+ * @brief Implementation of the sharded ConcurrentHashMap
+ * @details Shard selection and per-shard locking around FlatHashMap
+ */
+
+#include <bit>
+#include <mutex>
+#include <thread>
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// ConcurrentHashMap
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::ConcurrentHashMap()
+		: ConcurrentHashMap{ defaultShardCount() }
+	{
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::ConcurrentHashMap( size_type shardCount )
+		: m_shardCount{ std::bit_ceil( shardCount == 0 ? size_type{ 1 } : shardCount ) }
+	{
+		using HashType = decltype( m_hasher( std::declval<const TKey&>() ) );
+
+		m_shards = std::make_unique<Shard[]>( m_shardCount );
+		m_shardShift = static_cast<int>( sizeof( HashType ) * 8 ) - std::countr_zero( m_shardCount );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::size_type ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::defaultShardCount() noexcept
+	{
+		const size_type threads = std::thread::hardware_concurrency();
+
+		return std::bit_ceil( 4 * ( threads == 0 ? size_type{ 1 } : threads ) );
+	}
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::size_type ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::shardCount() const noexcept
+	{
+		return m_shardCount;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::size_type ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::size() const
+	{
+		size_type total = 0;
+		for ( size_type i = 0; i < m_shardCount; ++i )
+		{
+			std::shared_lock lock{ m_shards[i].mutex };
+			total += m_shards[i].map.size();
+		}
+
+		return total;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline bool ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::empty() const
+	{
+		for ( size_type i = 0; i < m_shardCount; ++i )
+		{
+			std::shared_lock lock{ m_shards[i].mutex };
+			if ( !m_shards[i].map.empty() )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::reserve( size_type count )
+	{
+		// Hash-based sharding is not perfectly even; leave ~25% headroom per shard
+		const size_type perShard = ( count + m_shardCount - 1 ) / m_shardCount;
+		for ( size_type i = 0; i < m_shardCount; ++i )
+		{
+			std::unique_lock lock{ m_shards[i].mutex };
+			m_shards[i].map.reserve( perShard + perShard / 4 );
+		}
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline std::optional<TValue> ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::find( const TKey& key ) const
+	{
+		std::optional<TValue> result;
+		visit( key, [&result]( const TValue& value ) { result.emplace( value ); } );
+
+		return result;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TLookup>
+		requires TransparentLookup<THasher, TKeyEqual>
+	inline std::optional<TValue> ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::find( const TLookup& key ) const
+	{
+		std::optional<TValue> result;
+		visit( key, [&result]( const TValue& value ) { result.emplace( value ); } );
+
+		return result;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline bool ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::contains( const TKey& key ) const
+	{
+		const uint64_t hash = hashOf( key );
+		const Shard& shard = shardFor( hash );
+		std::shared_lock lock{ shard.mutex };
+
+		return shard.map.contains( key, hash );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TLookup>
+		requires TransparentLookup<THasher, TKeyEqual>
+	inline bool ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::contains( const TLookup& key ) const
+	{
+		const uint64_t hash = hashOf( key );
+		const Shard& shard = shardFor( hash );
+		std::shared_lock lock{ shard.mutex };
+
+		return shard.map.contains( key, hash );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TLookup, typename TVisitor>
+	inline bool ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::visit( const TLookup& key, TVisitor&& visitor ) const
+	{
+		const uint64_t hash = hashOf( key );
+		const Shard& shard = shardFor( hash );
+		std::shared_lock lock{ shard.mutex };
+
+		const auto it = shard.map.find( key, hash );
+		if ( it == shard.map.end() )
+		{
+			return false;
+		}
+		visitor( it->second );
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Modifiers
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TMapped>
+	inline bool ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::insert_or_assign( const TKey& key, TMapped&& value )
+	{
+		const uint64_t hash = hashOf( key );
+		Shard& shard = shardFor( hash );
+		std::unique_lock lock{ shard.mutex };
+
+		return shard.map.insert_or_assign( key, hash, std::forward<TMapped>( value ) ).second;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TMapped>
+	inline bool ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::insert_or_assign( TKey&& key, TMapped&& value )
+	{
+		const uint64_t hash = hashOf( key );
+		Shard& shard = shardFor( hash );
+		std::unique_lock lock{ shard.mutex };
+
+		return shard.map.insert_or_assign( std::move( key ), hash, std::forward<TMapped>( value ) ).second;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::size_type ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::erase( const TKey& key )
+	{
+		const uint64_t hash = hashOf( key );
+		Shard& shard = shardFor( hash );
+		std::unique_lock lock{ shard.mutex };
+
+		return shard.map.erase( key, hash );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TLookup>
+		requires TransparentLookup<THasher, TKeyEqual>
+	inline typename ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::size_type ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::erase( const TLookup& key )
+	{
+		const uint64_t hash = hashOf( key );
+		Shard& shard = shardFor( hash );
+		std::unique_lock lock{ shard.mutex };
+
+		return shard.map.erase( key, hash );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::clear()
+	{
+		for ( size_type i = 0; i < m_shardCount; ++i )
+		{
+			std::unique_lock lock{ m_shards[i].mutex };
+			m_shards[i].map.clear();
+		}
+	}
+
+	//----------------------------------------------
+	// Bulk traversal
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TFunction>
+	inline void ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::for_each( TFunction&& function ) const
+	{
+		for ( size_type i = 0; i < m_shardCount; ++i )
+		{
+			std::shared_lock lock{ m_shards[i].mutex };
+			for ( const auto& [key, value] : m_shards[i].map )
+			{
+				function( key, value );
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TLookup>
+	inline uint64_t ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::hashOf( const TLookup& key ) const
+	{
+		return static_cast<uint64_t>( m_hasher( key ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::Shard& ConcurrentHashMap<TKey, TValue, THasher, TKeyEqual>::shardFor( uint64_t hash ) const noexcept
+	{
+		if ( m_shardCount == 1 )
+		{
+			return m_shards[0];
+		}
+
+		return m_shards[static_cast<size_type>( hash >> m_shardShift )];
+	}
+} // namespace nfx::hashing
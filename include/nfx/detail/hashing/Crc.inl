@@ -0,0 +1,156 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Crc.inl
+ * @brief Implementation of the parameterized CRC engine
+ * @details Maps Rocksoft parameters onto the internal reflected / forward CRC engines.
+ */
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// Parameterized CRC
+	//=====================================================================
+
+	//----------------------------------------------
+	// One-shot computation
+	//----------------------------------------------
+
+	template <int Width, uint64_t Polynomial, uint64_t Init, bool ReflectIn, bool ReflectOut, uint64_t XorOut>
+		requires( Width >= 8 && Width <= 64 )
+	inline typename Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::ValueType
+	Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::compute( const std::byte* data, std::size_t length ) noexcept
+	{
+		return finalize( updateRegister( INITIAL_REGISTER, data, length ) );
+	}
+
+	template <int Width, uint64_t Polynomial, uint64_t Init, bool ReflectIn, bool ReflectOut, uint64_t XorOut>
+		requires( Width >= 8 && Width <= 64 )
+	inline constexpr typename Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::ValueType
+	Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::compute( std::string_view data ) noexcept
+	{
+		if ( std::is_constant_evaluated() )
+		{
+			Register crc = INITIAL_REGISTER;
+			for ( const char ch : data )
+			{
+				crc = Engine::updateByte( crc, static_cast<uint8_t>( ch ) );
+			}
+
+			return finalize( crc );
+		}
+
+		return compute( reinterpret_cast<const std::byte*>( data.data() ), data.size() );
+	}
+
+	template <int Width, uint64_t Polynomial, uint64_t Init, bool ReflectIn, bool ReflectOut, uint64_t XorOut>
+		requires( Width >= 8 && Width <= 64 )
+	inline constexpr typename Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::ValueType
+	Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::combine( ValueType crc1, ValueType crc2, uint64_t length2 ) noexcept
+	{
+		// reg(A || B) = reg(B) ^ (reg(A) ^ init) * x^(8 * length2)
+		return finalize( Engine::combine( unfinalize( crc1 ) ^ INITIAL_REGISTER, unfinalize( crc2 ), length2 ) );
+	}
+
+	//----------------------------------------------
+	// Incremental computation
+	//----------------------------------------------
+
+	template <int Width, uint64_t Polynomial, uint64_t Init, bool ReflectIn, bool ReflectOut, uint64_t XorOut>
+		requires( Width >= 8 && Width <= 64 )
+	inline void Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::update( const std::byte* data, std::size_t length ) noexcept
+	{
+		m_register = updateRegister( m_register, data, length );
+	}
+
+	template <int Width, uint64_t Polynomial, uint64_t Init, bool ReflectIn, bool ReflectOut, uint64_t XorOut>
+		requires( Width >= 8 && Width <= 64 )
+	inline void Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::update( std::string_view data ) noexcept
+	{
+		update( reinterpret_cast<const std::byte*>( data.data() ), data.size() );
+	}
+
+	template <int Width, uint64_t Polynomial, uint64_t Init, bool ReflectIn, bool ReflectOut, uint64_t XorOut>
+		requires( Width >= 8 && Width <= 64 )
+	inline typename Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::ValueType
+	Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::value() const noexcept
+	{
+		return finalize( m_register );
+	}
+
+	template <int Width, uint64_t Polynomial, uint64_t Init, bool ReflectIn, bool ReflectOut, uint64_t XorOut>
+		requires( Width >= 8 && Width <= 64 )
+	inline void Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::reset() noexcept
+	{
+		m_register = INITIAL_REGISTER;
+	}
+
+	//----------------------------------------------
+	// Register handling
+	//----------------------------------------------
+
+	template <int Width, uint64_t Polynomial, uint64_t Init, bool ReflectIn, bool ReflectOut, uint64_t XorOut>
+		requires( Width >= 8 && Width <= 64 )
+	inline typename Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::Register
+	Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::updateRegister( Register crc, const std::byte* data, std::size_t length ) noexcept
+	{
+		if constexpr ( IS_CRC32C )
+		{
+			return crc32c( crc, data, length );
+		}
+		else
+		{
+			return Engine::update( crc, data, length );
+		}
+	}
+
+	template <int Width, uint64_t Polynomial, uint64_t Init, bool ReflectIn, bool ReflectOut, uint64_t XorOut>
+		requires( Width >= 8 && Width <= 64 )
+	inline constexpr typename Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::ValueType
+	Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::finalize( Register crc ) noexcept
+	{
+		uint64_t value = Engine::toValue( crc );
+		if constexpr ( ReflectIn != ReflectOut )
+		{
+			value = internal::crc::reflect( value, Width );
+		}
+
+		return static_cast<ValueType>( ( value ^ XorOut ) & MASK );
+	}
+
+	template <int Width, uint64_t Polynomial, uint64_t Init, bool ReflectIn, bool ReflectOut, uint64_t XorOut>
+		requires( Width >= 8 && Width <= 64 )
+	inline constexpr typename Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::Register
+	Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>::unfinalize( ValueType crcValue ) noexcept
+	{
+		uint64_t value = ( crcValue ^ XorOut ) & MASK;
+		if constexpr ( ReflectIn != ReflectOut )
+		{
+			value = internal::crc::reflect( value, Width );
+		}
+
+		return Engine::fromValue( value );
+	}
+} // namespace nfx::hashing
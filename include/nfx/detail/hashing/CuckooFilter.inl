@@ -0,0 +1,305 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CuckooFilter.inl
+ * @brief Implementation of the cuckoo filter
+ * @details Fingerprint derivation, SSE2 two-bucket matching, eviction and victim handling
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <utility>
+
+#include <immintrin.h>
+
+#include "nfx/hashing/RangeReduction.h"
+
+namespace nfx::hashing
+{
+	namespace internal::cuckoo
+	{
+		//=====================================================================
+		// Bucket matching
+		//=====================================================================
+
+		/** @brief Loads a 4-slot bucket into the low bytes of a word */
+		template <typename TFingerprint>
+		inline uint64_t loadBucket( const TFingerprint* bucket ) noexcept
+		{
+			uint64_t word = 0;
+			std::memcpy( &word, bucket, 4 * sizeof( TFingerprint ) );
+
+			return word;
+		}
+
+		/**
+		 * @brief Tests whether either bucket holds @p fingerprint
+		 * @details Both buckets share one register; unused lanes are zero and never match because
+		 *          fingerprints are never 0.
+		 */
+		template <typename TFingerprint>
+		inline bool matchEither( const TFingerprint* first, const TFingerprint* second, TFingerprint fingerprint ) noexcept
+		{
+			const __m128i buckets = _mm_set_epi64x( static_cast<long long>( loadBucket( second ) ), static_cast<long long>( loadBucket( first ) ) );
+			if constexpr ( sizeof( TFingerprint ) == 1 )
+			{
+				return _mm_movemask_epi8( _mm_cmpeq_epi8( buckets, _mm_set1_epi8( static_cast<char>( fingerprint ) ) ) ) != 0;
+			}
+			else
+			{
+				return _mm_movemask_epi8( _mm_cmpeq_epi16( buckets, _mm_set1_epi16( static_cast<short>( fingerprint ) ) ) ) != 0;
+			}
+		}
+	} // namespace internal::cuckoo
+
+	//=====================================================================
+	// CuckooFilter
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TFingerprint, typename THasher>
+	CuckooFilter<TFingerprint, THasher>::CuckooFilter( std::size_t capacity )
+	{
+		const auto buckets = static_cast<std::size_t>( static_cast<double>( capacity ) / ( BUCKET_SLOTS * MAX_LOAD_FACTOR ) ) + 1;
+		const std::size_t bucketCount = std::bit_ceil( buckets );
+		m_slots.assign( bucketCount * BUCKET_SLOTS, 0 );
+		m_mask = bucketCount - 1;
+		m_indexBits = static_cast<unsigned int>( std::countr_zero( bucketCount ) );
+	}
+
+	//----------------------------------------------
+	// Modifiers
+	//----------------------------------------------
+
+	template <typename TFingerprint, typename THasher>
+	template <typename TKey>
+	inline bool CuckooFilter<TFingerprint, THasher>::insert( const TKey& key ) noexcept
+	{
+		return insertHash( static_cast<uint64_t>( m_hasher( key ) ) );
+	}
+
+	template <typename TFingerprint, typename THasher>
+	inline bool CuckooFilter<TFingerprint, THasher>::insertHash( uint64_t hash ) noexcept
+	{
+		if ( m_victim != 0 )
+		{
+			return false;
+		}
+
+		const TFingerprint print = fingerprint( hash );
+		const std::size_t first = static_cast<std::size_t>( hash ) & m_mask;
+		++m_size;
+		if ( tryPlace( first, print ) || tryPlace( alternateIndex( first, print ), print ) )
+		{
+			return true;
+		}
+		place( ( m_random & 1 ) != 0 ? first : alternateIndex( first, print ), print );
+
+		return true;
+	}
+
+	template <typename TFingerprint, typename THasher>
+	template <typename TKey>
+	inline bool CuckooFilter<TFingerprint, THasher>::erase( const TKey& key ) noexcept
+	{
+		return eraseHash( static_cast<uint64_t>( m_hasher( key ) ) );
+	}
+
+	template <typename TFingerprint, typename THasher>
+	inline bool CuckooFilter<TFingerprint, THasher>::eraseHash( uint64_t hash ) noexcept
+	{
+		const TFingerprint print = fingerprint( hash );
+		const std::size_t first = static_cast<std::size_t>( hash ) & m_mask;
+		const std::size_t second = alternateIndex( first, print );
+		if ( m_victim == print && ( m_victimIndex == first || m_victimIndex == second ) )
+		{
+			m_victim = 0;
+			--m_size;
+
+			return true;
+		}
+		if ( !tryRemove( first, print ) && !tryRemove( second, print ) )
+		{
+			return false;
+		}
+		--m_size;
+
+		// A slot is free again: give the parked fingerprint another chance
+		if ( m_victim != 0 )
+		{
+			const TFingerprint victim = std::exchange( m_victim, TFingerprint{ 0 } );
+			place( m_victimIndex, victim );
+		}
+
+		return true;
+	}
+
+	template <typename TFingerprint, typename THasher>
+	inline void CuckooFilter<TFingerprint, THasher>::clear() noexcept
+	{
+		std::fill( m_slots.begin(), m_slots.end(), TFingerprint{ 0 } );
+		m_size = 0;
+		m_victim = 0;
+	}
+
+	//----------------------------------------------
+	// Query
+	//----------------------------------------------
+
+	template <typename TFingerprint, typename THasher>
+	template <typename TKey>
+	inline bool CuckooFilter<TFingerprint, THasher>::contains( const TKey& key ) const noexcept
+	{
+		return containsHash( static_cast<uint64_t>( m_hasher( key ) ) );
+	}
+
+	template <typename TFingerprint, typename THasher>
+	inline bool CuckooFilter<TFingerprint, THasher>::containsHash( uint64_t hash ) const noexcept
+	{
+		const TFingerprint print = fingerprint( hash );
+		const std::size_t first = static_cast<std::size_t>( hash ) & m_mask;
+		const std::size_t second = alternateIndex( first, print );
+		if ( internal::cuckoo::matchEither( &m_slots[first * BUCKET_SLOTS], &m_slots[second * BUCKET_SLOTS], print ) )
+		{
+			return true;
+		}
+
+		return m_victim == print && ( m_victimIndex == first || m_victimIndex == second );
+	}
+
+	template <typename TFingerprint, typename THasher>
+	inline std::size_t CuckooFilter<TFingerprint, THasher>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename TFingerprint, typename THasher>
+	inline std::size_t CuckooFilter<TFingerprint, THasher>::capacity() const noexcept
+	{
+		return m_slots.size();
+	}
+
+	template <typename TFingerprint, typename THasher>
+	inline std::size_t CuckooFilter<TFingerprint, THasher>::bucketCount() const noexcept
+	{
+		return m_mask + 1;
+	}
+
+	template <typename TFingerprint, typename THasher>
+	inline double CuckooFilter<TFingerprint, THasher>::loadFactor() const noexcept
+	{
+		return static_cast<double>( m_size ) / static_cast<double>( m_slots.size() );
+	}
+
+	template <typename TFingerprint, typename THasher>
+	inline std::size_t CuckooFilter<TFingerprint, THasher>::byteSize() const noexcept
+	{
+		return m_slots.size() * sizeof( TFingerprint );
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	template <typename TFingerprint, typename THasher>
+	inline TFingerprint CuckooFilter<TFingerprint, THasher>::fingerprint( uint64_t hash ) noexcept
+	{
+		const auto print = static_cast<TFingerprint>( hash >> ( 64 - FINGERPRINT_BITS ) );
+
+		return print == 0 ? TFingerprint{ 1 } : print;
+	}
+
+	template <typename TFingerprint, typename THasher>
+	inline std::size_t CuckooFilter<TFingerprint, THasher>::alternateIndex( std::size_t index, TFingerprint fingerprint ) const noexcept
+	{
+		// XOR with a function of the fingerprint alone is an involution: alternate( alternate( i ) ) == i
+		return index ^ static_cast<std::size_t>( fibonacciRange<uint64_t>( fingerprint, m_indexBits ) );
+	}
+
+	template <typename TFingerprint, typename THasher>
+	inline bool CuckooFilter<TFingerprint, THasher>::tryPlace( std::size_t index, TFingerprint fingerprint ) noexcept
+	{
+		TFingerprint* bucket = &m_slots[index * BUCKET_SLOTS];
+		for ( std::size_t slot = 0; slot < BUCKET_SLOTS; ++slot )
+		{
+			if ( bucket[slot] == 0 )
+			{
+				bucket[slot] = fingerprint;
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	template <typename TFingerprint, typename THasher>
+	inline bool CuckooFilter<TFingerprint, THasher>::tryRemove( std::size_t index, TFingerprint fingerprint ) noexcept
+	{
+		TFingerprint* bucket = &m_slots[index * BUCKET_SLOTS];
+		for ( std::size_t slot = 0; slot < BUCKET_SLOTS; ++slot )
+		{
+			if ( bucket[slot] == fingerprint )
+			{
+				bucket[slot] = 0;
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	template <typename TFingerprint, typename THasher>
+	inline void CuckooFilter<TFingerprint, THasher>::place( std::size_t index, TFingerprint fingerprint ) noexcept
+	{
+		if ( tryPlace( index, fingerprint ) )
+		{
+			return;
+		}
+
+		for ( std::size_t kick = 0; kick < MAX_KICKS; ++kick )
+		{
+			// xorshift64: the evicted slot only needs to vary between attempts
+			m_random ^= m_random << 13;
+			m_random ^= m_random >> 7;
+			m_random ^= m_random << 17;
+
+			std::swap( fingerprint, m_slots[index * BUCKET_SLOTS + ( m_random >> 62 )] );
+			index = alternateIndex( index, fingerprint );
+			if ( tryPlace( index, fingerprint ) )
+			{
+				return;
+			}
+		}
+
+		m_victimIndex = index;
+		m_victim = fingerprint;
+	}
+} // namespace nfx::hashing
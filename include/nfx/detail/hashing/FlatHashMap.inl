@@ -0,0 +1,1049 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FlatHashMap.inl
+ * @brief Implementation of the Swiss-table FlatHashMap
+ * @details Control-byte group matching, probing, insertion, erasure and rehashing.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+
+#include <immintrin.h>
+
+#include "nfx/hashing/Algorithms.h"
+
+namespace nfx::hashing
+{
+	namespace internal::swiss
+	{
+		//=====================================================================
+		// Control bytes
+		//=====================================================================
+
+		/*
+		 * Each slot has one control byte: EMPTY and DELETED have the sign bit set, a full slot
+		 * stores the 7-bit H2 tag of its key (0..127). The control array holds WIDTH extra bytes
+		 * mirroring the first WIDTH ones, so a group load starting anywhere in the table never
+		 * needs to wrap around.
+		 */
+
+		/** @brief Control byte of a never-used slot */
+		inline constexpr int8_t EMPTY = -128;
+
+		/** @brief Control byte of an erased slot (tombstone), which keeps probe chains intact */
+		inline constexpr int8_t DELETED = -2;
+
+		//----------------------------------------------
+		// Group matching
+		//----------------------------------------------
+
+		/**
+		 * @brief Bit mask view of a group of control bytes; bit i refers to the i-th byte
+		 * @details Always 16 bytes wide (SSE2), whatever the compiler flags: the width shapes the
+		 *          control array and the probe sequence, so translation units built with and without
+		 *          AVX2 must agree on it.
+		 */
+		struct Group final
+		{
+			static constexpr size_t WIDTH = 16;
+
+			explicit Group( const int8_t* control ) noexcept
+				: m_control{ _mm_loadu_si128( reinterpret_cast<const __m128i*>( control ) ) }
+			{
+			}
+
+			[[nodiscard]] uint32_t match( int8_t tag ) const noexcept
+			{
+				return static_cast<uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_set1_epi8( tag ), m_control ) ) );
+			}
+
+			[[nodiscard]] uint32_t matchEmpty() const noexcept
+			{
+				return match( EMPTY );
+			}
+
+			[[nodiscard]] uint32_t matchEmptyOrDeleted() const noexcept
+			{
+				return static_cast<uint32_t>( _mm_movemask_epi8( m_control ) );
+			}
+
+			[[nodiscard]] uint32_t matchFull() const noexcept
+			{
+				return ~matchEmptyOrDeleted() & 0xFFFFu;
+			}
+
+			/** @brief Number of leading zero bits within the WIDTH-bit mask */
+			[[nodiscard]] static int leadingZeros( uint32_t mask ) noexcept
+			{
+				return std::countl_zero( mask ) - static_cast<int>( 32 - WIDTH );
+			}
+
+			__m128i m_control;
+		};
+
+		//----------------------------------------------
+		// Whole-table scans
+		//----------------------------------------------
+
+		/** @brief Mask of the full slots among the 32 control bytes at @p control */
+		NFX_HASHING_TARGET( "avx2" )
+		inline uint32_t matchFullAvx2( const int8_t* control ) noexcept
+		{
+			return ~static_cast<uint32_t>( _mm256_movemask_epi8( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( control ) ) ) );
+		}
+
+		/**
+		 * @brief Calls @p visit with the index of every full slot among @p capacity control bytes
+		 * @details Scans two groups per step when the CPU supports AVX2. @p capacity is zero or a
+		 *          power of two no smaller than Group::WIDTH.
+		 */
+		template <typename TVisit>
+		inline void forEachFull( const int8_t* control, size_t capacity, TVisit&& visit )
+		{
+			const bool avx2 = capacity >= 2 * Group::WIDTH && hasAvx2Support();
+			const size_t step = avx2 ? 2 * Group::WIDTH : Group::WIDTH;
+			for ( size_t base = 0; base < capacity; base += step )
+			{
+				for ( uint32_t full = avx2 ? matchFullAvx2( control + base ) : Group{ control + base }.matchFull(); full != 0; full &= full - 1 )
+				{
+					visit( base + static_cast<size_t>( std::countr_zero( full ) ) );
+				}
+			}
+		}
+
+		//----------------------------------------------
+		// Probe sequence
+		//----------------------------------------------
+
+		/** @brief Triangular probing over groups; visits every group once when capacity is a power of two */
+		struct ProbeSequence final
+		{
+			ProbeSequence( uint64_t h1, size_t mask ) noexcept
+				: m_mask{ mask },
+				  m_offset{ static_cast<size_t>( h1 ) & mask }
+			{
+			}
+
+			[[nodiscard]] size_t offset() const noexcept
+			{
+				return m_offset;
+			}
+
+			[[nodiscard]] size_t offset( size_t i ) const noexcept
+			{
+				return ( m_offset + i ) & m_mask;
+			}
+
+			void next() noexcept
+			{
+				m_index += Group::WIDTH;
+				m_offset = ( m_offset + m_index ) & m_mask;
+			}
+
+			size_t m_mask;
+			size_t m_offset;
+			size_t m_index = 0;
+		};
+
+		/** @brief Position part of a hash */
+		inline constexpr uint64_t h1( uint64_t hash ) noexcept
+		{
+			return hash >> 7;
+		}
+
+		/** @brief 7-bit tag stored in the control byte */
+		inline constexpr int8_t h2( uint64_t hash ) noexcept
+		{
+			return static_cast<int8_t>( hash & 0x7F );
+		}
+	} // namespace internal::swiss
+
+	//=====================================================================
+	// FlatHashMap
+	//=====================================================================
+
+	//----------------------------------------------
+	// Iterator
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <bool IsConst>
+	inline FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::Iterator<IsConst>::Iterator( const int8_t* control, pointer slot, const int8_t* controlEnd ) noexcept
+		: m_control{ control },
+		  m_slot{ slot },
+		  m_controlEnd{ controlEnd }
+	{
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <bool IsConst>
+	template <bool OtherConst>
+		requires( IsConst && !OtherConst )
+	FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::Iterator<IsConst>::Iterator( const Iterator<OtherConst>& other ) noexcept
+		: m_control{ other.m_control },
+		  m_slot{ other.m_slot },
+		  m_controlEnd{ other.m_controlEnd }
+	{
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <bool IsConst>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::template Iterator<IsConst>::reference FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::Iterator<IsConst>::operator*() const noexcept
+	{
+		return *m_slot;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <bool IsConst>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::template Iterator<IsConst>::pointer FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::Iterator<IsConst>::operator->() const noexcept
+	{
+		return m_slot;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <bool IsConst>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::template Iterator<IsConst>& FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::Iterator<IsConst>::operator++() noexcept
+	{
+		++m_control;
+		++m_slot;
+		skipEmpty();
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <bool IsConst>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::template Iterator<IsConst> FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::Iterator<IsConst>::operator++( int ) noexcept
+	{
+		Iterator previous = *this;
+		++*this;
+
+		return previous;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <bool IsConst>
+	inline void FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::Iterator<IsConst>::skipEmpty() noexcept
+	{
+		while ( m_control != m_controlEnd && *m_control < 0 )
+		{
+			++m_control;
+			++m_slot;
+		}
+	}
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::FlatHashMap( size_type capacity )
+	{
+		reserve( capacity );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::FlatHashMap( std::initializer_list<value_type> init )
+	{
+		reserve( init.size() );
+		for ( const auto& value : init )
+		{
+			insert( value );
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::FlatHashMap( const FlatHashMap& other )
+		: m_hasher{ other.m_hasher },
+		  m_equal{ other.m_equal }
+	{
+		reserve( other.m_size );
+		for ( const auto& value : other )
+		{
+			insert( value );
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::FlatHashMap( FlatHashMap&& other ) noexcept
+		: m_control{ std::exchange( other.m_control, nullptr ) },
+		  m_slots{ std::exchange( other.m_slots, nullptr ) },
+		  m_capacity{ std::exchange( other.m_capacity, 0 ) },
+		  m_size{ std::exchange( other.m_size, 0 ) },
+		  m_growthLeft{ std::exchange( other.m_growthLeft, 0 ) },
+		  m_hasher{ std::move( other.m_hasher ) },
+		  m_equal{ std::move( other.m_equal ) },
+		  m_seedPolicy{ std::move( other.m_seedPolicy ) }
+	{
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>& FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::operator=( const FlatHashMap& other )
+	{
+		if ( this != &other )
+		{
+			FlatHashMap copy{ other };
+			swap( copy );
+		}
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>& FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::operator=( FlatHashMap&& other ) noexcept
+	{
+		if ( this != &other )
+		{
+			destroyAll();
+			deallocate();
+			m_control = std::exchange( other.m_control, nullptr );
+			m_slots = std::exchange( other.m_slots, nullptr );
+			m_capacity = std::exchange( other.m_capacity, 0 );
+			m_size = std::exchange( other.m_size, 0 );
+			m_growthLeft = std::exchange( other.m_growthLeft, 0 );
+			m_hasher = std::move( other.m_hasher );
+			m_equal = std::move( other.m_equal );
+			m_seedPolicy = std::move( other.m_seedPolicy );
+		}
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::~FlatHashMap()
+	{
+		destroyAll();
+		deallocate();
+	}
+
+	//----------------------------------------------
+	// Iterators
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::begin() noexcept
+	{
+		iterator it{ m_control, m_slots, m_control + m_capacity };
+		it.skipEmpty();
+
+		return it;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::const_iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::begin() const noexcept
+	{
+		const_iterator it{ m_control, m_slots, m_control + m_capacity };
+		it.skipEmpty();
+
+		return it;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::const_iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::end() noexcept
+	{
+		return iterator{ m_control + m_capacity, m_slots + m_capacity, m_control + m_capacity };
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::const_iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::end() const noexcept
+	{
+		return const_iterator{ m_control + m_capacity, m_slots + m_capacity, m_control + m_capacity };
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::const_iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::cend() const noexcept
+	{
+		return end();
+	}
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline bool FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::size_type FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::size_type FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline float FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::load_factor() const noexcept
+	{
+		return m_capacity == 0 ? 0.0f : static_cast<float>( m_size ) / static_cast<float>( m_capacity );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline const TSeedPolicy& FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::seed_policy() const noexcept
+	{
+		return m_seedPolicy;
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::find( const TKey& key )
+	{
+		return iteratorAt( findIndex( key, hashOf( key ) ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::const_iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::find( const TKey& key ) const
+	{
+		return iteratorAt( findIndex( key, hashOf( key ) ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TLookup>
+		requires TransparentLookup<THasher, TKeyEqual>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::find( const TLookup& key )
+	{
+		return iteratorAt( findIndex( key, hashOf( key ) ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TLookup>
+		requires TransparentLookup<THasher, TKeyEqual>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::const_iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::find( const TLookup& key ) const
+	{
+		return iteratorAt( findIndex( key, hashOf( key ) ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline bool FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::contains( const TKey& key ) const
+	{
+		return findIndex( key, hashOf( key ) ) != m_capacity;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TLookup>
+		requires TransparentLookup<THasher, TKeyEqual>
+	inline bool FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::contains( const TLookup& key ) const
+	{
+		return findIndex( key, hashOf( key ) ) != m_capacity;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::find( const TKey& key, uint64_t hash )
+	{
+		return iteratorAt( findIndex( key, hash ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::const_iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::find( const TKey& key, uint64_t hash ) const
+	{
+		return iteratorAt( findIndex( key, hash ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TLookup>
+		requires TransparentLookup<THasher, TKeyEqual>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::find( const TLookup& key, uint64_t hash )
+	{
+		return iteratorAt( findIndex( key, hash ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TLookup>
+		requires TransparentLookup<THasher, TKeyEqual>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::const_iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::find( const TLookup& key, uint64_t hash ) const
+	{
+		return iteratorAt( findIndex( key, hash ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline bool FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::contains( const TKey& key, uint64_t hash ) const
+	{
+		return findIndex( key, hash ) != m_capacity;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TLookup>
+		requires TransparentLookup<THasher, TKeyEqual>
+	inline bool FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::contains( const TLookup& key, uint64_t hash ) const
+	{
+		return findIndex( key, hash ) != m_capacity;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline TValue& FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::at( const TKey& key )
+	{
+		const size_type index = findIndex( key, hashOf( key ) );
+		if ( index == m_capacity )
+		{
+			throw std::out_of_range{ "FlatHashMap::at: key not found" };
+		}
+
+		return m_slots[index].second;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline const TValue& FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::at( const TKey& key ) const
+	{
+		const size_type index = findIndex( key, hashOf( key ) );
+		if ( index == m_capacity )
+		{
+			throw std::out_of_range{ "FlatHashMap::at: key not found" };
+		}
+
+		return m_slots[index].second;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline TValue& FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::operator[]( const TKey& key )
+	{
+		return try_emplace( key ).first->second;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline TValue& FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::operator[]( TKey&& key )
+	{
+		return try_emplace( std::move( key ) ).first->second;
+	}
+
+	//----------------------------------------------
+	// Modifiers
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline std::pair<typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator, bool> FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::insert( const value_type& value )
+	{
+		return emplaceUnique( value.first, value.second );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline std::pair<typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator, bool> FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::insert( value_type&& value )
+	{
+		return emplaceUnique( std::move( value.first ), std::move( value.second ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TMapped>
+	inline std::pair<typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator, bool> FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::insert_or_assign( const TKey& key, TMapped&& value )
+	{
+		return insert_or_assign( key, hashOf( key ), std::forward<TMapped>( value ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TMapped>
+	inline std::pair<typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator, bool> FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::insert_or_assign( TKey&& key, TMapped&& value )
+	{
+		const uint64_t hash = hashOf( key );
+
+		return insert_or_assign( std::move( key ), hash, std::forward<TMapped>( value ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TMapped>
+	inline std::pair<typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator, bool> FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::insert_or_assign( const TKey& key, uint64_t hash, TMapped&& value )
+	{
+		const size_type existing = findIndex( key, hash );
+		if ( existing != m_capacity )
+		{
+			m_slots[existing].second = std::forward<TMapped>( value );
+
+			return { iteratorAt( existing ), false };
+		}
+
+		return { iteratorAt( insertNew( hash, key, std::forward<TMapped>( value ) ) ), true };
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TMapped>
+	inline std::pair<typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator, bool> FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::insert_or_assign( TKey&& key, uint64_t hash, TMapped&& value )
+	{
+		const size_type existing = findIndex( key, hash );
+		if ( existing != m_capacity )
+		{
+			m_slots[existing].second = std::forward<TMapped>( value );
+
+			return { iteratorAt( existing ), false };
+		}
+
+		return { iteratorAt( insertNew( hash, std::move( key ), std::forward<TMapped>( value ) ) ), true };
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename... TArgs>
+	inline std::pair<typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator, bool> FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::try_emplace( const TKey& key, TArgs&&... args )
+	{
+		return emplaceUnique( key, std::forward<TArgs>( args )... );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename... TArgs>
+	inline std::pair<typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator, bool> FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::try_emplace( TKey&& key, TArgs&&... args )
+	{
+		return emplaceUnique( std::move( key ), std::forward<TArgs>( args )... );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::size_type FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::erase( const TKey& key )
+	{
+		const size_type index = findIndex( key, hashOf( key ) );
+		if ( index == m_capacity )
+		{
+			return 0;
+		}
+		eraseAt( index );
+
+		return 1;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TLookup>
+		requires TransparentLookup<THasher, TKeyEqual>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::size_type FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::erase( const TLookup& key )
+	{
+		const size_type index = findIndex( key, hashOf( key ) );
+		if ( index == m_capacity )
+		{
+			return 0;
+		}
+		eraseAt( index );
+
+		return 1;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::size_type FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::erase( const TKey& key, uint64_t hash )
+	{
+		const size_type index = findIndex( key, hash );
+		if ( index == m_capacity )
+		{
+			return 0;
+		}
+		eraseAt( index );
+
+		return 1;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TLookup>
+		requires TransparentLookup<THasher, TKeyEqual>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::size_type FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::erase( const TLookup& key, uint64_t hash )
+	{
+		const size_type index = findIndex( key, hash );
+		if ( index == m_capacity )
+		{
+			return 0;
+		}
+		eraseAt( index );
+
+		return 1;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::erase( const_iterator position )
+	{
+		const size_type index = static_cast<size_type>( position.m_slot - m_slots );
+		eraseAt( index );
+
+		iterator next{ m_control + index + 1, m_slots + index + 1, m_control + m_capacity };
+		next.skipEmpty();
+
+		return next;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::erase( iterator position )
+	{
+		return erase( const_iterator{ position } );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline void FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::clear() noexcept
+	{
+		destroyAll();
+		if ( m_capacity != 0 )
+		{
+			std::fill_n( m_control, m_capacity + internal::swiss::Group::WIDTH, internal::swiss::EMPTY );
+		}
+		m_size = 0;
+		m_growthLeft = maxLoad( m_capacity );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline void FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::reserve( size_type count )
+	{
+		const size_type capacity = capacityFor( count );
+		if ( capacity > m_capacity )
+		{
+			resize( capacity );
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline void FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::swap( FlatHashMap& other ) noexcept
+	{
+		std::swap( m_control, other.m_control );
+		std::swap( m_slots, other.m_slots );
+		std::swap( m_capacity, other.m_capacity );
+		std::swap( m_size, other.m_size );
+		std::swap( m_growthLeft, other.m_growthLeft );
+		std::swap( m_hasher, other.m_hasher );
+		std::swap( m_equal, other.m_equal );
+		std::swap( m_seedPolicy, other.m_seedPolicy );
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TLookup>
+	inline uint64_t FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::hashOf( const TLookup& key ) const
+	{
+		return static_cast<uint64_t>( m_hasher( key ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TLookup>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::size_type FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::findIndex( const TLookup& key, uint64_t hash ) const
+	{
+		using namespace internal::swiss;
+
+		if ( m_capacity == 0 )
+		{
+			return m_capacity;
+		}
+
+		const int8_t tag = h2( hash );
+		ProbeSequence sequence{ probeStart( hash ), m_capacity - 1 };
+		while ( true )
+		{
+			const Group group{ m_control + sequence.offset() };
+			for ( uint32_t matches = group.match( tag ); matches != 0; matches &= matches - 1 )
+			{
+				const size_type index = sequence.offset( static_cast<size_t>( std::countr_zero( matches ) ) );
+				if ( m_equal( m_slots[index].first, key ) )
+				{
+					return index;
+				}
+			}
+
+			// An empty byte ends every probe chain that could contain the key
+			if ( group.matchEmpty() != 0 )
+			{
+				return m_capacity;
+			}
+			sequence.next();
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline uint64_t FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::probeStart( uint64_t hash ) const noexcept
+	{
+		if constexpr ( TSeedPolicy::MIXES_SEED )
+		{
+			return seedMix<uint64_t>( m_seedPolicy.seed(), hash, m_capacity );
+		}
+		else
+		{
+			return internal::swiss::h1( hash );
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::size_type FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::findFirstNonFull( uint64_t hash ) const noexcept
+	{
+		size_type probeGroups;
+
+		return findFirstNonFull( hash, probeGroups );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::size_type FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::findFirstNonFull( uint64_t hash, size_type& probeGroups ) const noexcept
+	{
+		using namespace internal::swiss;
+
+		ProbeSequence sequence{ probeStart( hash ), m_capacity - 1 };
+		while ( true )
+		{
+			const uint32_t available = Group{ m_control + sequence.offset() }.matchEmptyOrDeleted();
+			if ( available != 0 )
+			{
+				probeGroups = sequence.m_index / Group::WIDTH;
+
+				return sequence.offset( static_cast<size_t>( std::countr_zero( available ) ) );
+			}
+			sequence.next();
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TKeyArg, typename... TArgs>
+	inline std::pair<typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator, bool> FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::emplaceUnique( TKeyArg&& key, TArgs&&... args )
+	{
+		const uint64_t hash = hashOf( key );
+		const size_type existing = findIndex( key, hash );
+		if ( existing != m_capacity )
+		{
+			return { iteratorAt( existing ), false };
+		}
+
+		return { iteratorAt( insertNew( hash, std::forward<TKeyArg>( key ), std::forward<TArgs>( args )... ) ), true };
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	template <typename TKeyArg, typename... TArgs>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::size_type FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::insertNew( uint64_t hash, TKeyArg&& key, TArgs&&... args )
+	{
+		size_type probeGroups = 0;
+		size_type index = m_capacity == 0 ? 0 : findFirstNonFull( hash, probeGroups );
+		if ( m_capacity == 0 || ( m_growthLeft == 0 && m_control[index] != internal::swiss::DELETED ) )
+		{
+			// Drop tombstones in place when they make up most of the load, grow otherwise
+			const bool mostlyTombstones = m_capacity != 0 && m_size * 2 <= maxLoad( m_capacity );
+			resize( mostlyTombstones ? m_capacity : std::max( capacityFor( m_size + 1 ), m_capacity * 2 ) );
+			index = findFirstNonFull( hash, probeGroups );
+		}
+		if ( m_seedPolicy.recordInsert( probeGroups ) )
+		{
+			// Pathological probe lengths: rehash at the same capacity under a new seed
+			const TSeedPolicy previous = m_seedPolicy;
+			m_seedPolicy.reseed();
+			try
+			{
+				resize( m_capacity );
+			}
+			catch ( ... )
+			{
+				// The slots are still laid out under the previous seed
+				m_seedPolicy = previous;
+				throw;
+			}
+			index = findFirstNonFull( hash );
+		}
+
+		// Construct before publishing the control byte so a throwing constructor leaves the map unchanged
+		::new ( static_cast<void*>( m_slots + index ) ) value_type(
+			std::piecewise_construct,
+			std::forward_as_tuple( std::forward<TKeyArg>( key ) ),
+			std::forward_as_tuple( std::forward<TArgs>( args )... ) );
+
+		m_growthLeft -= m_control[index] == internal::swiss::EMPTY ? 1 : 0;
+		setControl( index, internal::swiss::h2( hash ) );
+		++m_size;
+
+		return index;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline void FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::setControl( size_type index, int8_t control ) noexcept
+	{
+		m_control[index] = control;
+		if ( index < internal::swiss::Group::WIDTH )
+		{
+			m_control[m_capacity + index] = control;
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline void FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::eraseAt( size_type index ) noexcept
+	{
+		using namespace internal::swiss;
+
+		std::destroy_at( m_slots + index );
+		--m_size;
+
+		// The slot can become EMPTY again only if no probe window ever saw it inside a full group
+		const size_type indexBefore = ( index - Group::WIDTH ) & ( m_capacity - 1 );
+		const uint32_t emptyAfter = Group{ m_control + index }.matchEmpty();
+		const uint32_t emptyBefore = Group{ m_control + indexBefore }.matchEmpty();
+		const bool wasNeverFull = emptyBefore != 0 && emptyAfter != 0 &&
+								  static_cast<size_t>( std::countr_zero( emptyAfter ) + Group::leadingZeros( emptyBefore ) ) < Group::WIDTH;
+
+		setControl( index, wasNeverFull ? EMPTY : DELETED );
+		m_growthLeft += wasNeverFull ? 1 : 0;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline void FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::resize( size_type newCapacity )
+	{
+		using namespace internal::swiss;
+
+		constexpr bool nothrowHash = std::is_nothrow_invocable_v<const THasher&, const TKey&>;
+
+		int8_t* const oldControl = m_control;
+		value_type* const oldSlots = m_slots;
+		const size_type oldCapacity = m_capacity;
+		const size_type oldGrowthLeft = m_growthLeft;
+		const TSeedPolicy oldSeedPolicy = m_seedPolicy;
+
+		// A hasher that may throw runs over every key before anything is transferred
+		std::unique_ptr<uint64_t[]> hashes;
+		if constexpr ( !nothrowHash )
+		{
+			hashes = std::make_unique_for_overwrite<uint64_t[]>( oldCapacity );
+			forEachFull( oldControl, oldCapacity, [&]( size_type i ) { hashes[i] = hashOf( oldSlots[i].first ); } );
+		}
+
+		auto* newSlots = std::allocator<value_type>{}.allocate( newCapacity );
+		int8_t* newControl;
+		try
+		{
+			newControl = new int8_t[newCapacity + Group::WIDTH];
+		}
+		catch ( ... )
+		{
+			std::allocator<value_type>{}.deallocate( newSlots, newCapacity );
+			throw;
+		}
+		std::fill_n( newControl, newCapacity + Group::WIDTH, EMPTY );
+
+		m_control = newControl;
+		m_slots = newSlots;
+		m_capacity = newCapacity;
+		m_growthLeft = maxLoad( newCapacity ) - m_size;
+		m_seedPolicy.onResize( newCapacity );
+
+		// Elements are moved only if that cannot throw, copied otherwise, so the old storage stays
+		// intact until every element has been transferred
+		try
+		{
+			forEachFull( oldControl, oldCapacity, [&]( size_type i ) {
+				uint64_t hash;
+				if constexpr ( nothrowHash )
+				{
+					hash = hashOf( oldSlots[i].first );
+				}
+				else
+				{
+					hash = hashes[i];
+				}
+				const size_type index = findFirstNonFull( hash );
+				::new ( static_cast<void*>( m_slots + index ) ) value_type( std::move_if_noexcept( oldSlots[i] ) );
+				setControl( index, h2( hash ) );
+			} );
+		}
+		catch ( ... )
+		{
+			destroyAll();
+			std::allocator<value_type>{}.deallocate( newSlots, newCapacity );
+			delete[] newControl;
+
+			m_control = oldControl;
+			m_slots = oldSlots;
+			m_capacity = oldCapacity;
+			m_growthLeft = oldGrowthLeft;
+			m_seedPolicy = oldSeedPolicy;
+			throw;
+		}
+
+		if ( oldCapacity != 0 )
+		{
+			if constexpr ( !std::is_trivially_destructible_v<value_type> )
+			{
+				forEachFull( oldControl, oldCapacity, [&]( size_type i ) { std::destroy_at( oldSlots + i ); } );
+			}
+			std::allocator<value_type>{}.deallocate( oldSlots, oldCapacity );
+			delete[] oldControl;
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline void FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::destroyAll() noexcept
+	{
+		if constexpr ( !std::is_trivially_destructible_v<value_type> )
+		{
+			internal::swiss::forEachFull( m_control, m_capacity, [this]( size_type i ) { std::destroy_at( m_slots + i ); } );
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline void FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::deallocate() noexcept
+	{
+		if ( m_capacity != 0 )
+		{
+			std::allocator<value_type>{}.deallocate( m_slots, m_capacity );
+			delete[] m_control;
+		}
+		m_control = nullptr;
+		m_slots = nullptr;
+		m_capacity = 0;
+		m_size = 0;
+		m_growthLeft = 0;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iteratorAt( size_type index ) noexcept
+	{
+		return iterator{ m_control + index, m_slots + index, m_control + m_capacity };
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::const_iterator FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::iteratorAt( size_type index ) const noexcept
+	{
+		return const_iterator{ m_control + index, m_slots + index, m_control + m_capacity };
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::size_type FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::capacityFor( size_type count ) noexcept
+	{
+		if ( count == 0 )
+		{
+			return 0;
+		}
+
+		size_type capacity = internal::swiss::Group::WIDTH;
+		while ( maxLoad( capacity ) < count )
+		{
+			capacity *= 2;
+		}
+
+		return capacity;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TSeedPolicy>
+	inline typename FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::size_type FlatHashMap<TKey, TValue, THasher, TKeyEqual, TSeedPolicy>::maxLoad( size_type capacity ) noexcept
+	{
+		return capacity - capacity / 8;
+	}
+} // namespace nfx::hashing
@@ -0,0 +1,300 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FrozenMap.inl
+ * @brief Implementation of the compile-time perfect-hash map and string switch
+ * @details Constexpr hash-and-displace construction and single-probe lookup
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+namespace nfx::hashing
+{
+	namespace internal::frozen
+	{
+		//=====================================================================
+		// Key hashing
+		//=====================================================================
+
+		/** @brief Hashes @p key from @p seed, identically in constant and run-time evaluation */
+		template <typename Policy>
+		inline constexpr uint32_t hashKey( uint32_t seed, std::string_view key ) noexcept
+		{
+			if constexpr ( std::is_same_v<Policy, policies::Fnv1a> )
+			{
+				for ( const char ch : key )
+				{
+					seed = fnv1a<uint32_t>( seed, static_cast<uint8_t>( ch ) );
+				}
+
+				return seed;
+			}
+			else
+			{
+				if ( std::is_constant_evaluated() )
+				{
+					for ( const char ch : key )
+					{
+						seed = crc32cSoft( seed, static_cast<uint8_t>( ch ) );
+					}
+
+					return seed;
+				}
+
+				return crc32c( seed, reinterpret_cast<const std::byte*>( key.data() ), key.size() );
+			}
+		}
+	} // namespace internal::frozen
+
+	//=====================================================================
+	// FrozenMap
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TValue, std::size_t N, typename Policy>
+	constexpr FrozenMap<TValue, N, Policy>::FrozenMap( const std::array<value_type, N>& entries )
+	{
+		for ( uint32_t attempt = 0; attempt < MAX_SEED_ATTEMPTS; ++attempt )
+		{
+			if ( tryBuild( entries, constants::FNV_OFFSET_BASIS_32 ^ ( attempt * constants::GOLDEN_RATIO_32 ) ) )
+			{
+				return;
+			}
+		}
+
+		throw std::invalid_argument{ "FrozenMap: no collision-free hash seed found" };
+	}
+
+	template <typename TValue, typename Policy, std::size_t N>
+	constexpr FrozenMap<TValue, N, Policy> makeFrozenMap( const std::pair<std::string_view, TValue> ( &entries )[N] )
+	{
+		return FrozenMap<TValue, N, Policy>{ std::to_array( entries ) };
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <typename TValue, std::size_t N, typename Policy>
+	constexpr const TValue* FrozenMap<TValue, N, Policy>::find( std::string_view key ) const noexcept
+	{
+		if constexpr ( N == 0 )
+		{
+			return nullptr;
+		}
+		else
+		{
+			const uint32_t hash = internal::frozen::hashKey<Policy>( m_seed, key );
+			const auto& slot = m_slots[seedMix<uint32_t>( m_pilots[hash & ( BUCKET_COUNT - 1 )], hash, SLOT_COUNT )];
+
+			return slot.first == key ? &slot.second : nullptr;
+		}
+	}
+
+	template <typename TValue, std::size_t N, typename Policy>
+	constexpr bool FrozenMap<TValue, N, Policy>::contains( std::string_view key ) const noexcept
+	{
+		return find( key ) != nullptr;
+	}
+
+	template <typename TValue, std::size_t N, typename Policy>
+	constexpr const TValue& FrozenMap<TValue, N, Policy>::at( std::string_view key ) const
+	{
+		if ( const TValue* value = find( key ) )
+		{
+			return *value;
+		}
+
+		throw std::out_of_range{ "FrozenMap::at: key not found" };
+	}
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	template <typename TValue, std::size_t N, typename Policy>
+	constexpr typename FrozenMap<TValue, N, Policy>::size_type FrozenMap<TValue, N, Policy>::size() noexcept
+	{
+		return N;
+	}
+
+	template <typename TValue, std::size_t N, typename Policy>
+	constexpr uint32_t FrozenMap<TValue, N, Policy>::seed() const noexcept
+	{
+		return m_seed;
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	template <typename TValue, std::size_t N, typename Policy>
+	constexpr bool FrozenMap<TValue, N, Policy>::tryBuild( const std::array<value_type, N>& entries, uint32_t seed )
+	{
+		if constexpr ( N == 0 )
+		{
+			m_seed = seed;
+
+			return true;
+		}
+		else
+		{
+			std::array<uint32_t, N> hashes{};
+			std::array<std::size_t, N> order{};
+			std::array<std::size_t, BUCKET_COUNT> bucketSizes{};
+			for ( std::size_t i = 0; i < N; ++i )
+			{
+				hashes[i] = internal::frozen::hashKey<Policy>( seed, entries[i].first );
+				order[i] = i;
+				++bucketSizes[hashes[i] & ( BUCKET_COUNT - 1 )];
+			}
+
+			// Group keys by bucket, largest buckets first: they are hardest to place
+			std::sort( order.begin(), order.end(), [&]( std::size_t a, std::size_t b ) {
+				const std::size_t bucketA = hashes[a] & ( BUCKET_COUNT - 1 );
+				const std::size_t bucketB = hashes[b] & ( BUCKET_COUNT - 1 );
+				if ( bucketSizes[bucketA] != bucketSizes[bucketB] )
+				{
+					return bucketSizes[bucketA] > bucketSizes[bucketB];
+				}
+
+				return bucketA < bucketB;
+			} );
+
+			std::array<bool, SLOT_COUNT> taken{};
+			std::array<std::size_t, N> slotOf{};
+			std::array<uint16_t, BUCKET_COUNT> pilots{};
+			for ( std::size_t first = 0; first < N; )
+			{
+				const std::size_t bucket = hashes[order[first]] & ( BUCKET_COUNT - 1 );
+				const std::size_t last = first + bucketSizes[bucket];
+				for ( std::size_t i = first; i < last; ++i )
+				{
+					for ( std::size_t j = first; j < i; ++j )
+					{
+						if ( hashes[order[i]] == hashes[order[j]] )
+						{
+							if ( entries[order[i]].first == entries[order[j]].first )
+							{
+								throw std::invalid_argument{ "FrozenMap: duplicate key" };
+							}
+
+							return false;
+						}
+					}
+				}
+
+				bool placed = false;
+				for ( uint32_t pilot = 0; pilot <= 0xFFFF && !placed; ++pilot )
+				{
+					placed = true;
+					for ( std::size_t i = first; i < last && placed; ++i )
+					{
+						const std::size_t slot = seedMix<uint32_t>( pilot, hashes[order[i]], SLOT_COUNT );
+						placed = !taken[slot];
+						for ( std::size_t j = first; j < i && placed; ++j )
+						{
+							placed = slotOf[order[j]] != slot;
+						}
+						slotOf[order[i]] = slot;
+					}
+					if ( placed )
+					{
+						pilots[bucket] = static_cast<uint16_t>( pilot );
+						for ( std::size_t i = first; i < last; ++i )
+						{
+							taken[slotOf[order[i]]] = true;
+						}
+					}
+				}
+				if ( !placed )
+				{
+					return false;
+				}
+				first = last;
+			}
+
+			for ( auto& slot : m_slots )
+			{
+				slot = entries[0];
+			}
+			for ( std::size_t i = 0; i < N; ++i )
+			{
+				m_slots[slotOf[i]] = entries[i];
+			}
+			m_pilots = pilots;
+			m_seed = seed;
+
+			return true;
+		}
+	}
+
+	//=====================================================================
+	// StringSwitch
+	//=====================================================================
+
+	template <std::size_t N, typename Policy>
+	constexpr StringSwitch<N, Policy>::StringSwitch( const std::array<std::string_view, N>& tokens )
+		: m_map{ indexed( tokens ) }
+	{
+	}
+
+	template <typename Policy, std::size_t N>
+	constexpr StringSwitch<N, Policy> makeStringSwitch( const std::string_view ( &tokens )[N] )
+	{
+		return StringSwitch<N, Policy>{ std::to_array( tokens ) };
+	}
+
+	template <std::size_t N, typename Policy>
+	constexpr std::size_t StringSwitch<N, Policy>::operator()( std::string_view token ) const noexcept
+	{
+		const std::size_t* index = m_map.find( token );
+
+		return index != nullptr ? *index : NO_MATCH;
+	}
+
+	template <std::size_t N, typename Policy>
+	consteval std::size_t StringSwitch<N, Policy>::caseOf( std::string_view token ) const
+	{
+		return m_map.at( token );
+	}
+
+	template <std::size_t N, typename Policy>
+	constexpr std::array<std::pair<std::string_view, std::size_t>, N> StringSwitch<N, Policy>::indexed( const std::array<std::string_view, N>& tokens )
+	{
+		std::array<std::pair<std::string_view, std::size_t>, N> entries{};
+		for ( std::size_t i = 0; i < N; ++i )
+		{
+			entries[i] = { tokens[i], i };
+		}
+
+		return entries;
+	}
+} // namespace nfx::hashing
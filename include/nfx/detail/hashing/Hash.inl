@@ -39,4 +39,14 @@ namespace nfx::hashing
 	{
 		return Hasher<HashType, Seed>{}( value );
 	}
+
+	//=====================================================================
+	// Integer hash inversion
+	//=====================================================================
+
+	template <uint64_t Seed>
+	inline constexpr uint64_t unhashInteger( uint64_t hash ) noexcept
+	{
+		return internal::unhashInteger<Seed>( hash );
+	}
 } // namespace nfx::hashing
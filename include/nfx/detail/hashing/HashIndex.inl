@@ -0,0 +1,292 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file HashIndex.inl
+ * @brief Implementation of the hash index builder, view and memory-mapped reader
+ * @details File layout encoding, linear-probing placement and platform file mapping
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace nfx::hashing
+{
+	namespace internal::hashindex
+	{
+		//=====================================================================
+		// File format constants
+		//=====================================================================
+
+		/** @brief "NFXHIDX1" read as a little-endian word */
+		inline constexpr uint64_t MAGIC{ 0x315844494858464EULL };
+
+		/** @brief Current format version */
+		inline constexpr uint32_t VERSION{ 1 };
+
+		/** @brief Header size in bytes; also the offset of the slot array */
+		inline constexpr uint64_t HEADER_SIZE{ 64 };
+
+		/** @brief Words per slot: stored hash, value */
+		inline constexpr uint64_t SLOT_WORDS{ 2 };
+
+		/** @brief Minimum number of slots */
+		inline constexpr uint64_t MIN_SLOTS{ 16 };
+
+		/** @brief String hashed into the header to detect hasher mismatches */
+		inline constexpr std::string_view HASHER_CHECK_INPUT{ "nfx::hashing::HashIndex" };
+
+		//----------------------------------------------
+		// Encoding helpers
+		//----------------------------------------------
+
+		/** @brief Hash as stored in a slot; 0 is reserved for empty slots */
+		inline constexpr uint64_t storedHash( uint64_t hash ) noexcept
+		{
+			return hash == 0 ? 1 : hash;
+		}
+	} // namespace internal::hashindex
+
+	//=====================================================================
+	// HashIndexBuilder
+	//=====================================================================
+
+	template <typename THasher>
+	HashIndexBuilder<THasher>::HashIndexBuilder( std::size_t expectedEntries )
+	{
+		m_entries.reserve( expectedEntries );
+	}
+
+	template <typename THasher>
+	template <typename TKey>
+	inline void HashIndexBuilder<THasher>::add( const TKey& key, uint64_t value )
+	{
+		m_entries.emplace_back( internal::hashindex::storedHash( static_cast<uint64_t>( m_hasher( key ) ) ), value );
+	}
+
+	template <typename THasher>
+	inline std::size_t HashIndexBuilder<THasher>::size() const noexcept
+	{
+		return m_entries.size();
+	}
+
+	template <typename THasher>
+	inline std::vector<std::byte> HashIndexBuilder<THasher>::build() const
+	{
+		using namespace internal::hashindex;
+
+		const uint64_t slotCount = std::bit_ceil( std::max<uint64_t>( MIN_SLOTS, 2 * static_cast<uint64_t>( m_entries.size() ) ) );
+		const uint64_t mask = slotCount - 1;
+
+		std::vector<uint64_t> words( HEADER_SIZE / 8 + slotCount * SLOT_WORDS, 0 );
+		words[0] = internal::littleEndian( MAGIC );
+		words[1] = internal::littleEndian( static_cast<uint64_t>( VERSION ) | ( HEADER_SIZE << 32 ) );
+		words[2] = internal::littleEndian( slotCount );
+		words[3] = internal::littleEndian( static_cast<uint64_t>( m_entries.size() ) );
+		words[4] = internal::littleEndian( static_cast<uint64_t>( m_hasher( HASHER_CHECK_INPUT ) ) );
+		words[5] = internal::littleEndian( HEADER_SIZE );
+
+		uint64_t* slots = words.data() + HEADER_SIZE / 8;
+		for ( const auto& [hash, value] : m_entries )
+		{
+			uint64_t slot = hash & mask;
+			while ( slots[slot * SLOT_WORDS] != 0 )
+			{
+				if ( slots[slot * SLOT_WORDS] == internal::littleEndian( hash ) )
+				{
+					throw std::invalid_argument{ "HashIndexBuilder::build: duplicate key or 64-bit hash collision" };
+				}
+				slot = ( slot + 1 ) & mask;
+			}
+			slots[slot * SLOT_WORDS] = internal::littleEndian( hash );
+			slots[slot * SLOT_WORDS + 1] = internal::littleEndian( value );
+		}
+
+		std::vector<std::byte> image( words.size() * sizeof( uint64_t ) );
+		std::memcpy( image.data(), words.data(), image.size() );
+
+		return image;
+	}
+
+	template <typename THasher>
+	inline void HashIndexBuilder<THasher>::write( const std::filesystem::path& path ) const
+	{
+		const auto image = build();
+
+		std::ofstream file{ path, std::ios::binary | std::ios::trunc };
+		file.write( reinterpret_cast<const char*>( image.data() ), static_cast<std::streamsize>( image.size() ) );
+		file.close();
+		if ( !file )
+		{
+			throw std::runtime_error{ "HashIndexBuilder::write: cannot write " + path.string() };
+		}
+	}
+
+	//=====================================================================
+	// HashIndexView
+	//=====================================================================
+
+	template <typename THasher>
+	HashIndexView<THasher>::HashIndexView( std::span<const std::byte> image )
+	{
+		using namespace internal::hashindex;
+
+		if ( image.size() < HEADER_SIZE || reinterpret_cast<std::uintptr_t>( image.data() ) % alignof( uint64_t ) != 0 )
+		{
+			throw std::runtime_error{ "HashIndexView: image is truncated or misaligned" };
+		}
+
+		const auto* header = reinterpret_cast<const uint64_t*>( image.data() );
+		if ( internal::littleEndian( header[0] ) != MAGIC )
+		{
+			throw std::runtime_error{ "HashIndexView: not a hash index" };
+		}
+		if ( internal::littleEndian( header[1] ) != ( static_cast<uint64_t>( VERSION ) | ( HEADER_SIZE << 32 ) ) )
+		{
+			throw std::runtime_error{ "HashIndexView: unsupported format version" };
+		}
+
+		const uint64_t slotCount = internal::littleEndian( header[2] );
+		const uint64_t slotsOffset = internal::littleEndian( header[5] );
+		if ( !std::has_single_bit( slotCount ) || slotsOffset != HEADER_SIZE ||
+			 slotCount > ( image.size() - HEADER_SIZE ) / ( SLOT_WORDS * sizeof( uint64_t ) ) )
+		{
+			throw std::runtime_error{ "HashIndexView: corrupt or truncated slot table" };
+		}
+		if ( internal::littleEndian( header[4] ) != static_cast<uint64_t>( m_hasher( HASHER_CHECK_INPUT ) ) )
+		{
+			throw std::runtime_error{ "HashIndexView: index was built with a different hasher" };
+		}
+
+		m_slots = header + slotsOffset / sizeof( uint64_t );
+		m_mask = slotCount - 1;
+		m_size = internal::littleEndian( header[3] );
+	}
+
+	template <typename THasher>
+	template <typename TKey>
+	inline std::optional<uint64_t> HashIndexView<THasher>::find( const TKey& key ) const
+	{
+		using namespace internal::hashindex;
+
+		if ( m_slots == nullptr )
+		{
+			return std::nullopt;
+		}
+
+		const uint64_t hash = storedHash( static_cast<uint64_t>( m_hasher( key ) ) );
+		for ( uint64_t slot = hash & m_mask;; slot = ( slot + 1 ) & m_mask )
+		{
+			const uint64_t stored = internal::littleEndian( m_slots[slot * SLOT_WORDS] );
+			if ( stored == hash )
+			{
+				return internal::littleEndian( m_slots[slot * SLOT_WORDS + 1] );
+			}
+			if ( stored == 0 )
+			{
+				return std::nullopt;
+			}
+		}
+	}
+
+	template <typename THasher>
+	template <typename TKey>
+	inline bool HashIndexView<THasher>::contains( const TKey& key ) const
+	{
+		return find( key ).has_value();
+	}
+
+	template <typename THasher>
+	inline std::size_t HashIndexView<THasher>::size() const noexcept
+	{
+		return static_cast<std::size_t>( m_size );
+	}
+
+	template <typename THasher>
+	inline std::size_t HashIndexView<THasher>::slotCount() const noexcept
+	{
+		return m_slots == nullptr ? 0 : static_cast<std::size_t>( m_mask + 1 );
+	}
+
+	//=====================================================================
+	// MappedHashIndex
+	//=====================================================================
+
+	template <typename THasher>
+	MappedHashIndex<THasher>::MappedHashIndex( const std::filesystem::path& path )
+		: m_file{ path },
+		  m_view{ m_file.bytes() }
+	{
+	}
+
+	template <typename THasher>
+	MappedHashIndex<THasher>::MappedHashIndex( MappedHashIndex&& other ) noexcept
+		: m_file{ std::move( other.m_file ) },
+		  m_view{ std::exchange( other.m_view, HashIndexView<THasher>{} ) }
+	{
+	}
+
+	template <typename THasher>
+	MappedHashIndex<THasher>& MappedHashIndex<THasher>::operator=( MappedHashIndex&& other ) noexcept
+	{
+		if ( this != &other )
+		{
+			m_file = std::move( other.m_file );
+			m_view = std::exchange( other.m_view, HashIndexView<THasher>{} );
+		}
+
+		return *this;
+	}
+
+	template <typename THasher>
+	template <typename TKey>
+	inline std::optional<uint64_t> MappedHashIndex<THasher>::find( const TKey& key ) const
+	{
+		return m_view.find( key );
+	}
+
+	template <typename THasher>
+	template <typename TKey>
+	inline bool MappedHashIndex<THasher>::contains( const TKey& key ) const
+	{
+		return m_view.contains( key );
+	}
+
+	template <typename THasher>
+	inline std::size_t MappedHashIndex<THasher>::size() const noexcept
+	{
+		return m_view.size();
+	}
+
+	template <typename THasher>
+	inline const HashIndexView<THasher>& MappedHashIndex<THasher>::view() const noexcept
+	{
+		return m_view;
+	}
+} // namespace nfx::hashing
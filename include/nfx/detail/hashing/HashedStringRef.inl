@@ -0,0 +1,163 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file HashedStringRef.inl
+ * @brief Implementation of the compact hashed string reference
+ * @details Construction, inline / pointer access, short-circuit equality, and the Hasher overload
+ *          that reuses the cached hash
+ */
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// HashedStringRef
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline HashedStringRef::HashedStringRef( std::string_view text )
+	{
+		if ( text.size() > std::numeric_limits<uint32_t>::max() )
+		{
+			throw std::length_error{ "HashedStringRef: string longer than 2^32 - 1 bytes" };
+		}
+
+		m_length = static_cast<uint32_t>( text.size() );
+		if ( text.size() <= INLINE_CAPACITY )
+		{
+			if ( !text.empty() )
+			{
+				std::memcpy( m_bytes, text.data(), text.size() );
+			}
+
+			return;
+		}
+
+		const uint32_t hash = Hasher<>{}( text );
+		const char* characters = text.data();
+		std::memcpy( m_bytes, &hash, sizeof( hash ) );
+		std::memcpy( m_bytes + sizeof( hash ), &characters, sizeof( characters ) );
+	}
+
+	//----------------------------------------------
+	// Access
+	//----------------------------------------------
+
+	inline std::size_t HashedStringRef::size() const noexcept
+	{
+		return m_length;
+	}
+
+	inline bool HashedStringRef::empty() const noexcept
+	{
+		return m_length == 0;
+	}
+
+	inline bool HashedStringRef::isInline() const noexcept
+	{
+		return m_length <= INLINE_CAPACITY;
+	}
+
+	inline const char* HashedStringRef::data() const noexcept
+	{
+		return isInline() ? m_bytes : pointer();
+	}
+
+	inline std::string_view HashedStringRef::view() const noexcept
+	{
+		return { data(), m_length };
+	}
+
+	inline uint32_t HashedStringRef::hash() const noexcept
+	{
+		return isInline() ? Hasher<>{}( std::string_view{ m_bytes, m_length } ) : headWord();
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	inline uint32_t HashedStringRef::headWord() const noexcept
+	{
+		uint32_t word;
+		std::memcpy( &word, m_bytes, sizeof( word ) );
+
+		return word;
+	}
+
+	inline const char* HashedStringRef::pointer() const noexcept
+	{
+		const char* characters;
+		std::memcpy( &characters, m_bytes + sizeof( uint32_t ), sizeof( characters ) );
+
+		return characters;
+	}
+
+	inline bool HashedStringRef::equals( const HashedStringRef& other ) const noexcept
+	{
+		// Length plus prefix (short) or hash (long) settles almost every mismatch
+		if ( m_length != other.m_length || headWord() != other.headWord() )
+		{
+			return false;
+		}
+		if ( isInline() )
+		{
+			return std::memcmp( m_bytes + sizeof( uint32_t ), other.m_bytes + sizeof( uint32_t ), INLINE_CAPACITY - sizeof( uint32_t ) ) == 0;
+		}
+
+		const char* lhs = pointer();
+		const char* rhs = other.pointer();
+
+		return lhs == rhs || std::memcmp( lhs, rhs, m_length ) == 0;
+	}
+
+	//=====================================================================
+	// Hasher overload
+	//=====================================================================
+
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
+	inline HashType Hasher<HashType, Seed, Policy>::operator()( const HashedStringRef& key ) const noexcept
+	{
+		if constexpr ( std::is_same_v<Hasher, Hasher<>> )
+		{
+			return key.hash();
+		}
+		else if constexpr ( std::is_same_v<HashType, uint64_t> && std::is_same_v<Policy, policies::Crc32c> )
+		{
+			// Widen the cached 32-bit hash; the length keeps equal-hash strings of different sizes apart
+			return internal::hashInteger<uint64_t, Seed>( ( static_cast<uint64_t>( key.hash() ) << 32 ) | ( key.size() & 0xFFFFFFFFu ) );
+		}
+		else
+		{
+			return ( *this )( key.view() );
+		}
+	}
+} // namespace nfx::hashing
@@ -25,8 +25,9 @@
 /**
  * @file Hasher.inl
  * @brief Implementation of STL-compatible Hasher functor and overloads
- * @details Implements Hasher<HashType, Seed> for strings, integers, floats, pointers, enums,
- *          pairs, tuples, arrays, and custom types, using the appropriate hash primitives.
+ * @details Implements the string hashing policies and Hasher<HashType, Seed, Policy> for strings,
+ *          integers, floats, pointers, enums, pairs, tuples, arrays, and custom types, using the
+ *          appropriate hash primitives.
  */
 
 #include <cmath>
@@ -35,7 +36,7 @@
 namespace nfx::hashing
 {
 	//=====================================================================
-	// General-purpose STL-compatible hash functor
+	// Hashing implementation details
 	//=====================================================================
 
 	namespace internal
@@ -150,37 +151,148 @@ namespace nfx::hashing
 				return static_cast<HashType>( x );
 			}
 		}
+
+		static_assert( constants::WANG_MULTIPLIER_64_C1 * constants::WANG_MULTIPLIER_64_C1_INVERSE == 1 );
+		static_assert( constants::WANG_MULTIPLIER_64_C2 * constants::WANG_MULTIPLIER_64_C2_INVERSE == 1 );
+
+		/**
+		 * @brief Inverts the 64-bit hashInteger mixer
+		 * @details Undoes each step in reverse order: an xor-shift by s is inverted by xoring in
+		 *          the shifts by s, 2s, 3s, ... below 64, a multiplication by its inverse modulo 2^64.
+		 */
+		template <uint64_t Seed>
+		inline constexpr uint64_t unhashInteger( uint64_t hash ) noexcept
+		{
+			if ( hash == 0 )
+			{
+				return 0;
+			}
+
+			uint64_t x = hash;
+			x = x ^ ( x >> 31 ) ^ ( x >> 62 );
+			x *= constants::WANG_MULTIPLIER_64_C2_INVERSE;
+			x = x ^ ( x >> 27 ) ^ ( x >> 54 );
+			x *= constants::WANG_MULTIPLIER_64_C1_INVERSE;
+			x = x ^ ( x >> 30 ) ^ ( x >> 60 );
+
+			return x ^ Seed;
+		}
 	} // namespace internal
 
+	//=====================================================================
+	// String hashing policies
+	//=====================================================================
+
+	namespace policies
+	{
+		template <Hash32or64 HashType, HashType Seed>
+		inline HashType Crc32c::hash( std::string_view key ) noexcept
+		{
+			return internal::hashStringView<HashType, Seed>( key );
+		}
+
+		template <Hash32or64 HashType, HashType Seed>
+		inline HashType Fnv1a::hash( std::string_view key ) noexcept
+		{
+			if ( key.empty() )
+			{
+				return 0;
+			}
+
+			HashType hashValue = Seed;
+			for ( char ch : key )
+			{
+				hashValue = fnv1a<HashType>( hashValue, static_cast<uint8_t>( ch ) );
+			}
+
+			return hashValue;
+		}
+
+		template <Hash32or64 HashType, HashType Seed>
+		inline HashType Larson::hash( std::string_view key ) noexcept
+		{
+			if ( key.empty() )
+			{
+				return 0;
+			}
+
+			HashType hashValue = Seed;
+			for ( char ch : key )
+			{
+				hashValue = larson<HashType>( hashValue, static_cast<uint8_t>( ch ) );
+			}
+
+			return hashValue;
+		}
+
+		template <Hash32or64 HashType, HashType Seed>
+		inline HashType FarmHash::hash( std::string_view key ) noexcept
+		{
+			const uint64_t hashValue = ( Seed == 0 )
+										   ? farmFingerprint64( key )
+										   : farmHash64WithSeed( key, static_cast<uint64_t>( Seed ) );
+
+			if constexpr ( sizeof( HashType ) == 4 )
+			{
+				return static_cast<HashType>( hashValue ^ ( hashValue >> 32 ) );
+			}
+			else
+			{
+				return hashValue;
+			}
+		}
+
+		template <Hash32or64 HashType, HashType Seed>
+		inline HashType CityHash::hash( std::string_view key ) noexcept
+		{
+			const uint64_t hashValue = ( Seed == 0 )
+										   ? cityHash64( key )
+										   : cityHash64( key, static_cast<uint64_t>( Seed ) );
+
+			if constexpr ( sizeof( HashType ) == 4 )
+			{
+				return static_cast<HashType>( hashValue ^ ( hashValue >> 32 ) );
+			}
+			else
+			{
+				return hashValue;
+			}
+		}
+	} // namespace policies
+
+	//=====================================================================
+	// General-purpose STL-compatible hash functor
+	//=====================================================================
+
 	//----------------------------------------------
 	// String type overloads
 	//----------------------------------------------
 
-	template <Hash32or64 HashType, HashType Seed>
-	inline HashType Hasher<HashType, Seed>::operator()( std::string_view key ) const noexcept
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
+	inline HashType Hasher<HashType, Seed, Policy>::operator()( std::string_view key ) const noexcept
 	{
-		return internal::hashStringView<HashType, Seed>( key );
+		return Policy::template hash<HashType, Seed>( key );
 	}
 
-	template <Hash32or64 HashType, HashType Seed>
-	inline HashType Hasher<HashType, Seed>::operator()( const std::string& key ) const noexcept
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
+	inline HashType Hasher<HashType, Seed, Policy>::operator()( const std::string& key ) const noexcept
 	{
-		return internal::hashStringView<HashType, Seed>( key );
+		return Policy::template hash<HashType, Seed>( key );
 	}
 
-	template <Hash32or64 HashType, HashType Seed>
-	inline HashType Hasher<HashType, Seed>::operator()( const char* key ) const noexcept
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
+	inline HashType Hasher<HashType, Seed, Policy>::operator()( const char* key ) const noexcept
 	{
-		return internal::hashStringView<HashType, Seed>( key );
+		return Policy::template hash<HashType, Seed>( key );
 	}
 
 	//----------------------------------------------
 	// Integer type overloads
 	//----------------------------------------------
 
-	template <Hash32or64 HashType, HashType Seed>
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
 	template <typename TKey>
-	inline std::enable_if_t<std::is_integral_v<TKey>, HashType> Hasher<HashType, Seed>::operator()( const TKey& key ) const noexcept
+	inline std::enable_if_t<std::is_integral_v<TKey>, HashType> Hasher<HashType, Seed, Policy>::operator()( const TKey& key ) const noexcept
 	{
 		// Delegate to hashInteger with the same seed
 		// This ensures consistent behavior between hash<T>, Hasher<>, and hashInteger
@@ -191,9 +303,9 @@ namespace nfx::hashing
 	// Floating-point type overloads
 	//----------------------------------------------
 
-	template <Hash32or64 HashType, HashType Seed>
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
 	template <typename T>
-	inline std::enable_if_t<std::is_floating_point_v<T>, HashType> Hasher<HashType, Seed>::operator()( T value ) const noexcept
+	inline std::enable_if_t<std::is_floating_point_v<T>, HashType> Hasher<HashType, Seed, Policy>::operator()( T value ) const noexcept
 	{
 		// Normalize: +0.0 and -0.0 should hash the same
 		if ( value == 0.0 )
@@ -235,9 +347,9 @@ namespace nfx::hashing
 	// Pointer type overloads
 	//----------------------------------------------
 
-	template <Hash32or64 HashType, HashType Seed>
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
 	template <typename T>
-	inline std::enable_if_t<std::is_pointer_v<T> && !std::is_same_v<T, const char*> && !std::is_same_v<T, char*>, HashType> Hasher<HashType, Seed>::operator()( T ptr ) const noexcept
+	inline std::enable_if_t<std::is_pointer_v<T> && !std::is_same_v<T, const char*> && !std::is_same_v<T, char*>, HashType> Hasher<HashType, Seed, Policy>::operator()( T ptr ) const noexcept
 	{
 		// Hash the address as an integer - seed XOR is handled inside hashInteger
 		// When hashing 64-bit pointer with 32-bit seed, hashInteger handles the cast (line 129)
@@ -249,9 +361,9 @@ namespace nfx::hashing
 	// Enum type overloads
 	//----------------------------------------------
 
-	template <Hash32or64 HashType, HashType Seed>
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
 	template <typename TKey>
-	inline std::enable_if_t<std::is_enum_v<TKey>, HashType> Hasher<HashType, Seed>::operator()( const TKey& key ) const noexcept
+	inline std::enable_if_t<std::is_enum_v<TKey>, HashType> Hasher<HashType, Seed, Policy>::operator()( const TKey& key ) const noexcept
 	{
 		// Hash enum by converting to underlying integral type
 		using UnderlyingType = std::underlying_type_t<TKey>;
@@ -263,9 +375,9 @@ namespace nfx::hashing
 	// std::array type overloads
 	//----------------------------------------------
 
-	template <Hash32or64 HashType, HashType Seed>
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
 	template <typename T, size_t N>
-	inline HashType Hasher<HashType, Seed>::operator()( const std::array<T, N>& arr ) const noexcept
+	inline HashType Hasher<HashType, Seed, Policy>::operator()( const std::array<T, N>& arr ) const noexcept
 	{
 		// Note: Empty arrays (N=0) will return Seed unchanged (not 0)
 		// This differs from empty std::vector which returns 0 after combining size
@@ -281,9 +393,9 @@ namespace nfx::hashing
 	// std::optional type overloads
 	//----------------------------------------------
 
-	template <Hash32or64 HashType, HashType Seed>
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
 	template <typename T>
-	inline HashType Hasher<HashType, Seed>::operator()( const std::optional<T>& opt ) const noexcept
+	inline HashType Hasher<HashType, Seed, Policy>::operator()( const std::optional<T>& opt ) const noexcept
 	{
 		if ( opt.has_value() )
 		{
@@ -301,9 +413,9 @@ namespace nfx::hashing
 	// std::pair type overloads
 	//----------------------------------------------
 
-	template <Hash32or64 HashType, HashType Seed>
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
 	template <typename T1, typename T2>
-	inline HashType Hasher<HashType, Seed>::operator()( const std::pair<T1, T2>& p ) const noexcept
+	inline HashType Hasher<HashType, Seed, Policy>::operator()( const std::pair<T1, T2>& p ) const noexcept
 	{
 		HashType h1 = ( *this )( p.first );
 		HashType h2 = ( *this )( p.second );
@@ -315,9 +427,9 @@ namespace nfx::hashing
 	// std::span type overloads
 	//----------------------------------------------
 
-	template <Hash32or64 HashType, HashType Seed>
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
 	template <typename T, std::size_t Extent>
-	inline HashType Hasher<HashType, Seed>::operator()( std::span<T, Extent> sp ) const noexcept
+	inline HashType Hasher<HashType, Seed, Policy>::operator()( std::span<T, Extent> sp ) const noexcept
 	{
 		// Note: Empty spans will return Seed unchanged
 		HashType result = Seed;
@@ -333,9 +445,9 @@ namespace nfx::hashing
 	// std::tuple type overloads
 	//----------------------------------------------
 
-	template <Hash32or64 HashType, HashType Seed>
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
 	template <typename... Ts>
-	inline HashType Hasher<HashType, Seed>::operator()( const std::tuple<Ts...>& t ) const noexcept
+	inline HashType Hasher<HashType, Seed, Policy>::operator()( const std::tuple<Ts...>& t ) const noexcept
 	{
 		auto hash = [this, &t]<size_t... Is>( std::index_sequence<Is...> ) {
 			HashType result = Seed;
@@ -351,9 +463,9 @@ namespace nfx::hashing
 	// std::variant type overloads
 	//----------------------------------------------
 
-	template <Hash32or64 HashType, HashType Seed>
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
 	template <typename... Ts>
-	inline HashType Hasher<HashType, Seed>::operator()( const std::variant<Ts...>& var ) const noexcept
+	inline HashType Hasher<HashType, Seed, Policy>::operator()( const std::variant<Ts...>& var ) const noexcept
 	{
 		// Hash the index to distinguish different alternatives
 		HashType indexHash = ( *this )( var.index() );
@@ -372,9 +484,9 @@ namespace nfx::hashing
 	// std::vector type overloads
 	//----------------------------------------------
 
-	template <Hash32or64 HashType, HashType Seed>
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
 	template <typename T>
-	inline HashType Hasher<HashType, Seed>::operator()( const std::vector<T>& vec ) const noexcept
+	inline HashType Hasher<HashType, Seed, Policy>::operator()( const std::vector<T>& vec ) const noexcept
 	{
 		// Include size in hash to distinguish empty from non-empty vectors
 		HashType result = combine( Seed, ( *this )( vec.size() ) );
@@ -390,7 +502,7 @@ namespace nfx::hashing
 	// Custom type fallback
 	//----------------------------------------------
 
-	template <Hash32or64 HashType, HashType Seed>
+	template <Hash32or64 HashType, HashType Seed, StringHashPolicy Policy>
 	template <typename TKey>
 	inline std::enable_if_t<!std::is_same_v<std::decay_t<TKey>, std::string_view> &&
 								!std::is_same_v<std::decay_t<TKey>, std::string> &&
@@ -408,7 +520,7 @@ namespace nfx::hashing
 								!is_std_vector<TKey>::value,
 
 		HashType>
-	Hasher<HashType, Seed>::operator()( const TKey& key ) const noexcept
+	Hasher<HashType, Seed, Policy>::operator()( const TKey& key ) const noexcept
 	{
 		if constexpr ( std::same_as<HashType, uint32_t> )
 		{
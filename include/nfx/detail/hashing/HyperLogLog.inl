@@ -0,0 +1,573 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file HyperLogLog.inl
+ * @brief Implementation of the HyperLogLog++ sketch
+ * @details Rank encoding, sparse list maintenance, Ertl's estimator, AVX2 merge and image encoding
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
+#include <immintrin.h>
+
+#include "nfx/hashing/Algorithms.h"
+
+namespace nfx::hashing
+{
+	namespace internal::hll
+	{
+		//=====================================================================
+		// Image format constants
+		//=====================================================================
+
+		/** @brief "NFXHLL01" read as a little-endian word */
+		inline constexpr uint64_t MAGIC{ 0x31304C4C4858464EULL };
+
+		/** @brief Current format version */
+		inline constexpr uint32_t VERSION{ 1 };
+
+		/** @brief Header size in bytes */
+		inline constexpr uint64_t HEADER_BYTES{ 32 };
+
+		/** @brief String hashed into the header to detect hasher mismatches */
+		inline constexpr std::string_view HASHER_CHECK_INPUT{ "nfx::hashing::HyperLogLog" };
+
+		/** @brief Bits of a sparse entry holding the rank; the index sits above them */
+		inline constexpr unsigned int RANK_BITS{ 6 };
+
+		/** @brief Sparse insertions buffered before they are sorted into the list */
+		inline constexpr std::size_t MIN_PENDING{ 64 };
+
+		//=====================================================================
+		// Rank encoding
+		//=====================================================================
+
+		/** @brief Rank (leading zeros + 1) of the bits of @p hash below the top @p precision, at most 65 - precision */
+		inline constexpr uint8_t rank( uint64_t hash, unsigned int precision ) noexcept
+		{
+			// The guard bit caps the count when every remaining bit is zero
+			return static_cast<uint8_t>( std::countl_zero( ( hash << precision ) | ( uint64_t{ 1 } << ( precision - 1 ) ) ) + 1 );
+		}
+
+		/** @brief Sparse entry of @p hash: 25-bit index << RANK_BITS | rank at precision 25 */
+		inline constexpr uint32_t sparseEntry( uint64_t hash, unsigned int sparsePrecision ) noexcept
+		{
+			return static_cast<uint32_t>( ( hash >> ( 64 - sparsePrecision ) ) << RANK_BITS ) | rank( hash, sparsePrecision );
+		}
+
+		/**
+		 * @brief Dense register and rank of a sparse entry at @p precision
+		 * @details The index bits below the dense index are the leading bits of the dense rank's
+		 *          input; if they are all zero the rank continues into the stored sparse rank.
+		 */
+		inline constexpr std::pair<std::size_t, uint8_t> denseFromSparse( uint32_t entry, unsigned int precision, unsigned int sparsePrecision ) noexcept
+		{
+			const uint32_t index = entry >> RANK_BITS;
+			const unsigned int extraBits = sparsePrecision - precision;
+			const uint32_t extra = index & ( ( uint32_t{ 1 } << extraBits ) - 1 );
+			const auto rankValue = extra != 0 ? static_cast<uint8_t>( std::countl_zero( extra ) - ( 32 - extraBits ) + 1 )
+											  : static_cast<uint8_t>( extraBits + ( entry & ( ( 1u << RANK_BITS ) - 1 ) ) );
+
+			return { static_cast<std::size_t>( index >> extraBits ), rankValue };
+		}
+
+		/**
+		 * @brief Merges unsorted @p pending into the sorted list @p entries, keeping the highest rank of each index
+		 * @details Only the pending batch is sorted; it is then merged into the list in linear time.
+		 */
+		inline void mergeSparse( std::vector<uint32_t>& entries, std::vector<uint32_t>& pending )
+		{
+			std::sort( pending.begin(), pending.end() );
+			const auto middle = static_cast<std::ptrdiff_t>( entries.size() );
+			entries.insert( entries.end(), pending.begin(), pending.end() );
+			std::inplace_merge( entries.begin(), entries.begin() + middle, entries.end() );
+
+			// Entries of one index are adjacent and ordered by rank: keep the last of each run
+			std::size_t out = 0;
+			for ( std::size_t i = 0; i < entries.size(); ++i )
+			{
+				if ( i + 1 == entries.size() || ( entries[i] >> RANK_BITS ) != ( entries[i + 1] >> RANK_BITS ) )
+				{
+					entries[out++] = entries[i];
+				}
+			}
+			entries.resize( out );
+		}
+
+		//=====================================================================
+		// Estimation
+		//=====================================================================
+
+		/** @brief sigma( x ) = x + sum_k x^( 2^k ) 2^( k - 1 ), Ertl (2017) */
+		inline double sigma( double x ) noexcept
+		{
+			if ( x == 1.0 )
+			{
+				return std::numeric_limits<double>::infinity();
+			}
+
+			double weight = 1.0;
+			double result = x;
+			double previous;
+			do
+			{
+				x *= x;
+				previous = result;
+				result += x * weight;
+				weight += weight;
+			} while ( result != previous );
+
+			return result;
+		}
+
+		/** @brief tau( x ) = ( 1 - x - sum_k ( 1 - x^( 2^-k ) )^2 2^-k ) / 3, Ertl (2017) */
+		inline double tau( double x ) noexcept
+		{
+			if ( x == 0.0 || x == 1.0 )
+			{
+				return 0.0;
+			}
+
+			double weight = 1.0;
+			double result = 1.0 - x;
+			double previous;
+			do
+			{
+				x = std::sqrt( x );
+				previous = result;
+				weight *= 0.5;
+				result -= ( 1.0 - x ) * ( 1.0 - x ) * weight;
+			} while ( result != previous );
+
+			return result / 3.0;
+		}
+
+		//=====================================================================
+		// Merge kernels
+		//=====================================================================
+
+		NFX_HASHING_TARGET( "avx2" )
+		inline std::size_t mergeAvx2( uint8_t* registers, const uint8_t* other, std::size_t count ) noexcept
+		{
+			std::size_t i = 0;
+			for ( ; i + 32 <= count; i += 32 )
+			{
+				auto* target = reinterpret_cast<__m256i*>( registers + i );
+				const __m256i source = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( other + i ) );
+				_mm256_storeu_si256( target, _mm256_max_epu8( _mm256_loadu_si256( target ), source ) );
+			}
+
+			return i;
+		}
+	} // namespace internal::hll
+
+	//=====================================================================
+	// HyperLogLog
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename THasher>
+	HyperLogLog<THasher>::HyperLogLog( unsigned int precision )
+		: m_precision{ precision }
+	{
+		if ( precision < MIN_PRECISION || precision > MAX_PRECISION )
+		{
+			throw std::invalid_argument{ "HyperLogLog: precision must be in [4, 18]" };
+		}
+	}
+
+	template <typename THasher>
+	HyperLogLog<THasher>::HyperLogLog( std::span<const std::byte> image )
+		: m_precision{ DEFAULT_PRECISION }
+	{
+		using namespace internal::hll;
+
+		const auto readWord = [&image]( std::size_t offset ) {
+			uint64_t value = 0;
+			for ( std::size_t i = 0; i < 8; ++i )
+			{
+				value |= static_cast<uint64_t>( image[offset + i] ) << ( 8 * i );
+			}
+
+			return value;
+		};
+
+		if ( image.size() < HEADER_BYTES )
+		{
+			throw std::runtime_error{ "HyperLogLog: image is truncated" };
+		}
+		if ( readWord( 0 ) != MAGIC )
+		{
+			throw std::runtime_error{ "HyperLogLog: not a HyperLogLog image" };
+		}
+		if ( readWord( 8 ) != ( static_cast<uint64_t>( VERSION ) | ( HEADER_BYTES << 32 ) ) )
+		{
+			throw std::runtime_error{ "HyperLogLog: unsupported format version" };
+		}
+		if ( readWord( 24 ) != static_cast<uint64_t>( m_hasher( HASHER_CHECK_INPUT ) ) )
+		{
+			throw std::runtime_error{ "HyperLogLog: sketch was built with a different hasher" };
+		}
+
+		const uint64_t layout = readWord( 16 );
+		const auto precision = static_cast<unsigned int>( layout & 0xFF );
+		const uint64_t dense = ( layout >> 8 ) & 0xFF;
+		const uint64_t entryCount = layout >> 32;
+		if ( precision < MIN_PRECISION || precision > MAX_PRECISION || dense > 1 || ( layout & 0xFFFF0000u ) != 0 )
+		{
+			throw std::runtime_error{ "HyperLogLog: corrupt header" };
+		}
+		m_precision = precision;
+
+		const std::size_t registerCount = std::size_t{ 1 } << precision;
+		const auto payload = image.subspan( HEADER_BYTES );
+		if ( dense != 0 )
+		{
+			// Four 6-bit registers per 3 bytes
+			if ( entryCount != 0 || payload.size() != registerCount / 4 * 3 )
+			{
+				throw std::runtime_error{ "HyperLogLog: corrupt or truncated registers" };
+			}
+			m_registers.resize( registerCount );
+			for ( std::size_t group = 0; group < registerCount / 4; ++group )
+			{
+				const uint32_t packed = static_cast<uint32_t>( payload[3 * group] ) | ( static_cast<uint32_t>( payload[3 * group + 1] ) << 8 ) |
+										( static_cast<uint32_t>( payload[3 * group + 2] ) << 16 );
+				for ( std::size_t i = 0; i < 4; ++i )
+				{
+					const auto value = static_cast<uint8_t>( ( packed >> ( 6 * i ) ) & 0x3F );
+					if ( value > 65 - precision )
+					{
+						throw std::runtime_error{ "HyperLogLog: corrupt or truncated registers" };
+					}
+					m_registers[4 * group + i] = value;
+				}
+			}
+
+			return;
+		}
+
+		// Sparse: LEB128 deltas of strictly increasing entries with distinct indexes
+		std::size_t offset = 0;
+		uint64_t entry = 0;
+		m_sparse.reserve( static_cast<std::size_t>( std::min<uint64_t>( entryCount, payload.size() ) ) );
+		for ( uint64_t i = 0; i < entryCount; ++i )
+		{
+			uint64_t delta = 0;
+			for ( unsigned int shift = 0;; shift += 7 )
+			{
+				if ( offset == payload.size() || shift > 28 )
+				{
+					throw std::runtime_error{ "HyperLogLog: corrupt or truncated sparse list" };
+				}
+				const auto byte = static_cast<uint64_t>( payload[offset++] );
+				delta |= ( byte & 0x7F ) << shift;
+				if ( ( byte & 0x80 ) == 0 )
+				{
+					break;
+				}
+			}
+
+			const uint64_t previous = entry;
+			entry += delta;
+			const uint64_t rankValue = entry & ( ( 1u << RANK_BITS ) - 1 );
+			if ( entry >= ( uint64_t{ 1 } << ( SPARSE_PRECISION + RANK_BITS ) ) || rankValue == 0 || rankValue > 65 - SPARSE_PRECISION ||
+				 ( i != 0 && ( entry >> RANK_BITS ) <= ( previous >> RANK_BITS ) ) )
+			{
+				throw std::runtime_error{ "HyperLogLog: corrupt or truncated sparse list" };
+			}
+			m_sparse.push_back( static_cast<uint32_t>( entry ) );
+		}
+		if ( offset != payload.size() )
+		{
+			throw std::runtime_error{ "HyperLogLog: corrupt or truncated sparse list" };
+		}
+		if ( m_sparse.size() * sizeof( uint32_t ) > registerCount )
+		{
+			toDense();
+		}
+	}
+
+	//----------------------------------------------
+	// Modifiers
+	//----------------------------------------------
+
+	template <typename THasher>
+	template <typename TKey>
+	inline void HyperLogLog<THasher>::insert( const TKey& key )
+	{
+		add( static_cast<uint64_t>( m_hasher( key ) ) );
+	}
+
+	template <typename THasher>
+	inline void HyperLogLog<THasher>::add( uint64_t hash )
+	{
+		using namespace internal::hll;
+
+		if ( !m_registers.empty() )
+		{
+			uint8_t& value = m_registers[hash >> ( 64 - m_precision )];
+			value = std::max( value, rank( hash, m_precision ) );
+
+			return;
+		}
+
+		m_pending.push_back( sparseEntry( hash, SPARSE_PRECISION ) );
+		if ( m_pending.size() >= std::max( MIN_PENDING, m_sparse.size() / 4 ) )
+		{
+			flush();
+		}
+	}
+
+	template <typename THasher>
+	inline void HyperLogLog<THasher>::add( std::span<const uint64_t> hashes )
+	{
+		using namespace internal::hll;
+
+		std::size_t i = 0;
+		for ( ; i < hashes.size() && m_registers.empty(); ++i )
+		{
+			add( hashes[i] );
+		}
+
+		const unsigned int shift = 64 - m_precision;
+		uint8_t* registers = m_registers.data();
+		for ( ; i < hashes.size(); ++i )
+		{
+			uint8_t& value = registers[hashes[i] >> shift];
+			value = std::max( value, rank( hashes[i], m_precision ) );
+		}
+	}
+
+	template <typename THasher>
+	inline void HyperLogLog<THasher>::merge( const HyperLogLog& other )
+	{
+		using namespace internal::hll;
+
+		if ( other.m_precision != m_precision )
+		{
+			throw std::invalid_argument{ "HyperLogLog::merge: sketches have different precisions" };
+		}
+
+		if ( other.m_registers.empty() )
+		{
+			const auto entries = other.sparseEntries();
+			if ( m_registers.empty() )
+			{
+				m_pending.insert( m_pending.end(), entries.begin(), entries.end() );
+				flush();
+
+				return;
+			}
+			for ( const uint32_t entry : entries )
+			{
+				const auto [index, rankValue] = denseFromSparse( entry, m_precision, SPARSE_PRECISION );
+				m_registers[index] = std::max( m_registers[index], rankValue );
+			}
+
+			return;
+		}
+
+		if ( m_registers.empty() )
+		{
+			toDense();
+		}
+		std::size_t i = 0;
+		if ( internal::hasAvx2Support() )
+		{
+			i = mergeAvx2( m_registers.data(), other.m_registers.data(), m_registers.size() );
+		}
+		for ( ; i < m_registers.size(); ++i )
+		{
+			m_registers[i] = std::max( m_registers[i], other.m_registers[i] );
+		}
+	}
+
+	template <typename THasher>
+	inline void HyperLogLog<THasher>::clear() noexcept
+	{
+		m_registers = {};
+		m_sparse.clear();
+		m_pending.clear();
+	}
+
+	//----------------------------------------------
+	// Query
+	//----------------------------------------------
+
+	template <typename THasher>
+	inline double HyperLogLog<THasher>::estimate() const
+	{
+		using namespace internal::hll;
+
+		if ( m_registers.empty() )
+		{
+			// Linear counting over the 2^25 sparse buckets
+			const double buckets = static_cast<double>( uint64_t{ 1 } << SPARSE_PRECISION );
+			const auto occupied = static_cast<double>( sparseEntries().size() );
+
+			return buckets * std::log( buckets / ( buckets - occupied ) );
+		}
+
+		// Ertl's improved estimator over the register histogram
+		const unsigned int maxRank = 65 - m_precision;
+		std::vector<uint64_t> histogram( maxRank + 1, 0 );
+		for ( const uint8_t value : m_registers )
+		{
+			++histogram[value];
+		}
+
+		const auto registerCount = static_cast<double>( m_registers.size() );
+		double sum = registerCount * tau( ( registerCount - static_cast<double>( histogram[maxRank] ) ) / registerCount );
+		for ( unsigned int k = maxRank - 1; k >= 1; --k )
+		{
+			sum += static_cast<double>( histogram[k] );
+			sum *= 0.5;
+		}
+		sum += registerCount * sigma( static_cast<double>( histogram[0] ) / registerCount );
+
+		return registerCount * registerCount / ( 2.0 * std::log( 2.0 ) * sum );
+	}
+
+	template <typename THasher>
+	inline unsigned int HyperLogLog<THasher>::precision() const noexcept
+	{
+		return m_precision;
+	}
+
+	template <typename THasher>
+	inline bool HyperLogLog<THasher>::isSparse() const noexcept
+	{
+		return m_registers.empty();
+	}
+
+	//----------------------------------------------
+	// Serialization
+	//----------------------------------------------
+
+	template <typename THasher>
+	inline std::vector<std::byte> HyperLogLog<THasher>::serialize() const
+	{
+		using namespace internal::hll;
+
+		std::vector<std::byte> image;
+		const auto writeWord = [&image]( uint64_t value ) {
+			for ( std::size_t i = 0; i < 8; ++i )
+			{
+				image.push_back( static_cast<std::byte>( value >> ( 8 * i ) ) );
+			}
+		};
+
+		const auto entries = m_registers.empty() ? sparseEntries() : std::vector<uint32_t>{};
+		writeWord( MAGIC );
+		writeWord( static_cast<uint64_t>( VERSION ) | ( HEADER_BYTES << 32 ) );
+		writeWord( m_precision | ( static_cast<uint64_t>( !m_registers.empty() ) << 8 ) | ( static_cast<uint64_t>( entries.size() ) << 32 ) );
+		writeWord( static_cast<uint64_t>( m_hasher( HASHER_CHECK_INPUT ) ) );
+
+		if ( !m_registers.empty() )
+		{
+			image.reserve( HEADER_BYTES + m_registers.size() / 4 * 3 );
+			for ( std::size_t group = 0; group < m_registers.size(); group += 4 )
+			{
+				const uint32_t packed = m_registers[group] | ( m_registers[group + 1] << 6 ) | ( m_registers[group + 2] << 12 ) | ( m_registers[group + 3] << 18 );
+				image.push_back( static_cast<std::byte>( packed ) );
+				image.push_back( static_cast<std::byte>( packed >> 8 ) );
+				image.push_back( static_cast<std::byte>( packed >> 16 ) );
+			}
+
+			return image;
+		}
+
+		uint32_t previous = 0;
+		for ( const uint32_t entry : entries )
+		{
+			uint32_t delta = entry - previous;
+			previous = entry;
+			while ( delta >= 0x80 )
+			{
+				image.push_back( static_cast<std::byte>( ( delta & 0x7F ) | 0x80 ) );
+				delta >>= 7;
+			}
+			image.push_back( static_cast<std::byte>( delta ) );
+		}
+
+		return image;
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	template <typename THasher>
+	inline void HyperLogLog<THasher>::flush()
+	{
+		internal::hll::mergeSparse( m_sparse, m_pending );
+		m_pending.clear();
+
+		// One byte per register against four per entry: dense is smaller past 2^precision / 4 entries
+		if ( m_sparse.size() * sizeof( uint32_t ) > ( std::size_t{ 1 } << m_precision ) )
+		{
+			toDense();
+		}
+	}
+
+	template <typename THasher>
+	inline void HyperLogLog<THasher>::toDense()
+	{
+		using namespace internal::hll;
+
+		m_registers.assign( std::size_t{ 1 } << m_precision, 0 );
+		for ( const uint32_t entry : sparseEntries() )
+		{
+			const auto [index, rankValue] = denseFromSparse( entry, m_precision, SPARSE_PRECISION );
+			m_registers[index] = std::max( m_registers[index], rankValue );
+		}
+		m_sparse = {};
+		m_pending = {};
+	}
+
+	template <typename THasher>
+	inline std::vector<uint32_t> HyperLogLog<THasher>::sparseEntries() const
+	{
+		if ( m_pending.empty() )
+		{
+			return m_sparse;
+		}
+
+		std::vector<uint32_t> entries = m_sparse;
+		std::vector<uint32_t> pending = m_pending;
+		internal::hll::mergeSparse( entries, pending );
+
+		return entries;
+	}
+} // namespace nfx::hashing
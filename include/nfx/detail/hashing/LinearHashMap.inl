@@ -0,0 +1,559 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file LinearHashMap.inl
+ * @brief Implementation of the linear-hashing LinearHashMap
+ * @details Bucket addressing, segment directory, incremental splits and chain maintenance
+ */
+
+#include <stdexcept>
+#include <tuple>
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// LinearHashMap
+	//=====================================================================
+
+	//----------------------------------------------
+	// Iterator
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <bool IsConst>
+	inline LinearHashMap<TKey, TValue, THasher, TKeyEqual>::Iterator<IsConst>::Iterator( map_pointer map, size_type bucket, Node* node ) noexcept
+		: m_map{ map },
+		  m_bucket{ bucket },
+		  m_node{ node }
+	{
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <bool IsConst>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::template Iterator<IsConst>::reference LinearHashMap<TKey, TValue, THasher, TKeyEqual>::Iterator<IsConst>::operator*() const noexcept
+	{
+		return m_node->value;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <bool IsConst>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::template Iterator<IsConst>::pointer LinearHashMap<TKey, TValue, THasher, TKeyEqual>::Iterator<IsConst>::operator->() const noexcept
+	{
+		return &m_node->value;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <bool IsConst>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::template Iterator<IsConst>& LinearHashMap<TKey, TValue, THasher, TKeyEqual>::Iterator<IsConst>::operator++() noexcept
+	{
+		m_node = m_node->next;
+		skipEmpty();
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <bool IsConst>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::template Iterator<IsConst> LinearHashMap<TKey, TValue, THasher, TKeyEqual>::Iterator<IsConst>::operator++( int ) noexcept
+	{
+		Iterator previous = *this;
+		++*this;
+
+		return previous;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <bool IsConst>
+	inline void LinearHashMap<TKey, TValue, THasher, TKeyEqual>::Iterator<IsConst>::skipEmpty() noexcept
+	{
+		const size_type buckets = m_map->bucket_count();
+		while ( m_node == nullptr && ++m_bucket < buckets )
+		{
+			m_node = m_map->head( m_bucket );
+		}
+	}
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	LinearHashMap<TKey, TValue, THasher, TKeyEqual>::LinearHashMap( std::initializer_list<value_type> init )
+	{
+		for ( const auto& value : init )
+		{
+			try_emplace( value.first, value.second );
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	LinearHashMap<TKey, TValue, THasher, TKeyEqual>::LinearHashMap( const LinearHashMap& other )
+		: m_hasher{ other.m_hasher },
+		  m_equal{ other.m_equal }
+	{
+		for ( const auto& [key, value] : other )
+		{
+			try_emplace( key, value );
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	LinearHashMap<TKey, TValue, THasher, TKeyEqual>::LinearHashMap( LinearHashMap&& other ) noexcept
+		: m_segments{ std::move( other.m_segments ) },
+		  m_roundBuckets{ std::exchange( other.m_roundBuckets, INITIAL_BUCKETS ) },
+		  m_split{ std::exchange( other.m_split, 0 ) },
+		  m_size{ std::exchange( other.m_size, 0 ) },
+		  m_hasher{ std::move( other.m_hasher ) },
+		  m_equal{ std::move( other.m_equal ) }
+	{
+		other.m_segments.clear();
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	LinearHashMap<TKey, TValue, THasher, TKeyEqual>& LinearHashMap<TKey, TValue, THasher, TKeyEqual>::operator=( const LinearHashMap& other )
+	{
+		if ( this != &other )
+		{
+			LinearHashMap copy{ other };
+			swap( copy );
+		}
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	LinearHashMap<TKey, TValue, THasher, TKeyEqual>& LinearHashMap<TKey, TValue, THasher, TKeyEqual>::operator=( LinearHashMap&& other ) noexcept
+	{
+		if ( this != &other )
+		{
+			LinearHashMap moved{ std::move( other ) };
+			swap( moved );
+		}
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	LinearHashMap<TKey, TValue, THasher, TKeyEqual>::~LinearHashMap()
+	{
+		destroyAll();
+	}
+
+	//----------------------------------------------
+	// Iterators
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::iterator LinearHashMap<TKey, TValue, THasher, TKeyEqual>::begin() noexcept
+	{
+		if ( m_size == 0 )
+		{
+			return end();
+		}
+		iterator it{ this, 0, head( 0 ) };
+		it.skipEmpty();
+
+		return it;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::const_iterator LinearHashMap<TKey, TValue, THasher, TKeyEqual>::begin() const noexcept
+	{
+		if ( m_size == 0 )
+		{
+			return end();
+		}
+		const_iterator it{ this, 0, head( 0 ) };
+		it.skipEmpty();
+
+		return it;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::const_iterator LinearHashMap<TKey, TValue, THasher, TKeyEqual>::cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::iterator LinearHashMap<TKey, TValue, THasher, TKeyEqual>::end() noexcept
+	{
+		return iterator{ this, bucket_count(), nullptr };
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::const_iterator LinearHashMap<TKey, TValue, THasher, TKeyEqual>::end() const noexcept
+	{
+		return const_iterator{ this, bucket_count(), nullptr };
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::const_iterator LinearHashMap<TKey, TValue, THasher, TKeyEqual>::cend() const noexcept
+	{
+		return end();
+	}
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline bool LinearHashMap<TKey, TValue, THasher, TKeyEqual>::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::size_type LinearHashMap<TKey, TValue, THasher, TKeyEqual>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::size_type LinearHashMap<TKey, TValue, THasher, TKeyEqual>::bucket_count() const noexcept
+	{
+		return m_roundBuckets + m_split;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline float LinearHashMap<TKey, TValue, THasher, TKeyEqual>::load_factor() const noexcept
+	{
+		return static_cast<float>( m_size ) / static_cast<float>( bucket_count() );
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::iterator LinearHashMap<TKey, TValue, THasher, TKeyEqual>::find( const TKey& key )
+	{
+		const uint64_t hash = hashOf( key );
+		Node* node = findNode( key, hash );
+
+		return node ? iterator{ this, bucketOf( hash ), node } : end();
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::const_iterator LinearHashMap<TKey, TValue, THasher, TKeyEqual>::find( const TKey& key ) const
+	{
+		const uint64_t hash = hashOf( key );
+		Node* node = findNode( key, hash );
+
+		return node ? const_iterator{ this, bucketOf( hash ), node } : end();
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TLookup>
+		requires TransparentLookup<THasher, TKeyEqual>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::iterator LinearHashMap<TKey, TValue, THasher, TKeyEqual>::find( const TLookup& key )
+	{
+		const uint64_t hash = hashOf( key );
+		Node* node = findNode( key, hash );
+
+		return node ? iterator{ this, bucketOf( hash ), node } : end();
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TLookup>
+		requires TransparentLookup<THasher, TKeyEqual>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::const_iterator LinearHashMap<TKey, TValue, THasher, TKeyEqual>::find( const TLookup& key ) const
+	{
+		const uint64_t hash = hashOf( key );
+		Node* node = findNode( key, hash );
+
+		return node ? const_iterator{ this, bucketOf( hash ), node } : end();
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline bool LinearHashMap<TKey, TValue, THasher, TKeyEqual>::contains( const TKey& key ) const
+	{
+		return findNode( key, hashOf( key ) ) != nullptr;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TLookup>
+		requires TransparentLookup<THasher, TKeyEqual>
+	inline bool LinearHashMap<TKey, TValue, THasher, TKeyEqual>::contains( const TLookup& key ) const
+	{
+		return findNode( key, hashOf( key ) ) != nullptr;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline TValue& LinearHashMap<TKey, TValue, THasher, TKeyEqual>::at( const TKey& key )
+	{
+		Node* node = findNode( key, hashOf( key ) );
+		if ( node == nullptr )
+		{
+			throw std::out_of_range{ "LinearHashMap::at: key not found" };
+		}
+
+		return node->value.second;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline const TValue& LinearHashMap<TKey, TValue, THasher, TKeyEqual>::at( const TKey& key ) const
+	{
+		const Node* node = findNode( key, hashOf( key ) );
+		if ( node == nullptr )
+		{
+			throw std::out_of_range{ "LinearHashMap::at: key not found" };
+		}
+
+		return node->value.second;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline TValue& LinearHashMap<TKey, TValue, THasher, TKeyEqual>::operator[]( const TKey& key )
+	{
+		return try_emplace( key ).first->second;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline TValue& LinearHashMap<TKey, TValue, THasher, TKeyEqual>::operator[]( TKey&& key )
+	{
+		return try_emplace( std::move( key ) ).first->second;
+	}
+
+	//----------------------------------------------
+	// Modifiers
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TMapped>
+	inline std::pair<typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::iterator, bool> LinearHashMap<TKey, TValue, THasher, TKeyEqual>::insert_or_assign( const TKey& key, TMapped&& value )
+	{
+		auto result = emplaceUnique( key, std::forward<TMapped>( value ) );
+		if ( !result.second )
+		{
+			result.first->second = std::forward<TMapped>( value );
+		}
+
+		return result;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TMapped>
+	inline std::pair<typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::iterator, bool> LinearHashMap<TKey, TValue, THasher, TKeyEqual>::insert_or_assign( TKey&& key, TMapped&& value )
+	{
+		auto result = emplaceUnique( std::move( key ), std::forward<TMapped>( value ) );
+		if ( !result.second )
+		{
+			result.first->second = std::forward<TMapped>( value );
+		}
+
+		return result;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename... TArgs>
+	inline std::pair<typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::iterator, bool> LinearHashMap<TKey, TValue, THasher, TKeyEqual>::try_emplace( const TKey& key, TArgs&&... args )
+	{
+		return emplaceUnique( key, std::forward<TArgs>( args )... );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename... TArgs>
+	inline std::pair<typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::iterator, bool> LinearHashMap<TKey, TValue, THasher, TKeyEqual>::try_emplace( TKey&& key, TArgs&&... args )
+	{
+		return emplaceUnique( std::move( key ), std::forward<TArgs>( args )... );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::size_type LinearHashMap<TKey, TValue, THasher, TKeyEqual>::erase( const TKey& key )
+	{
+		if ( m_size == 0 )
+		{
+			return 0;
+		}
+
+		const uint64_t hash = hashOf( key );
+		for ( Node** link = &head( bucketOf( hash ) ); *link != nullptr; link = &( *link )->next )
+		{
+			Node* node = *link;
+			if ( node->hash == hash && m_equal( node->value.first, key ) )
+			{
+				*link = node->next;
+				delete node;
+				--m_size;
+
+				return 1;
+			}
+		}
+
+		return 0;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void LinearHashMap<TKey, TValue, THasher, TKeyEqual>::clear() noexcept
+	{
+		destroyAll();
+		m_segments.clear();
+		m_roundBuckets = INITIAL_BUCKETS;
+		m_split = 0;
+		m_size = 0;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void LinearHashMap<TKey, TValue, THasher, TKeyEqual>::swap( LinearHashMap& other ) noexcept
+	{
+		std::swap( m_segments, other.m_segments );
+		std::swap( m_roundBuckets, other.m_roundBuckets );
+		std::swap( m_split, other.m_split );
+		std::swap( m_size, other.m_size );
+		std::swap( m_hasher, other.m_hasher );
+		std::swap( m_equal, other.m_equal );
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TLookup>
+	inline uint64_t LinearHashMap<TKey, TValue, THasher, TKeyEqual>::hashOf( const TLookup& key ) const
+	{
+		return static_cast<uint64_t>( m_hasher( key ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::size_type LinearHashMap<TKey, TValue, THasher, TKeyEqual>::bucketOf( uint64_t hash ) const noexcept
+	{
+		// Buckets below the split pointer were already divided this round and use one more hash bit
+		size_type bucket = static_cast<size_type>( hash & ( m_roundBuckets - 1 ) );
+		if ( bucket < m_split )
+		{
+			bucket = static_cast<size_type>( hash & ( 2 * m_roundBuckets - 1 ) );
+		}
+
+		return bucket;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::Node*& LinearHashMap<TKey, TValue, THasher, TKeyEqual>::head( size_type bucket ) const noexcept
+	{
+		return m_segments[bucket / SEGMENT_SIZE][bucket % SEGMENT_SIZE];
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TLookup>
+	inline typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::Node* LinearHashMap<TKey, TValue, THasher, TKeyEqual>::findNode( const TLookup& key, uint64_t hash ) const
+	{
+		if ( m_size == 0 )
+		{
+			return nullptr;
+		}
+
+		for ( Node* node = head( bucketOf( hash ) ); node != nullptr; node = node->next )
+		{
+			if ( node->hash == hash && m_equal( node->value.first, key ) )
+			{
+				return node;
+			}
+		}
+
+		return nullptr;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TKeyArg, typename... TArgs>
+	inline std::pair<typename LinearHashMap<TKey, TValue, THasher, TKeyEqual>::iterator, bool> LinearHashMap<TKey, TValue, THasher, TKeyEqual>::emplaceUnique( TKeyArg&& key, TArgs&&... args )
+	{
+		const uint64_t hash = hashOf( key );
+		if ( Node* existing = findNode( key, hash ) )
+		{
+			return { iterator{ this, bucketOf( hash ), existing }, false };
+		}
+
+		if ( m_segments.empty() )
+		{
+			m_segments.push_back( std::make_unique<Node*[]>( SEGMENT_SIZE ) );
+		}
+
+		// Split before linking so the new node lands in its final bucket
+		if ( static_cast<float>( m_size + 1 ) > max_load_factor() * static_cast<float>( bucket_count() ) )
+		{
+			splitOne();
+		}
+
+		Node* node = new Node{ value_type( std::piecewise_construct,
+									 std::forward_as_tuple( std::forward<TKeyArg>( key ) ),
+									 std::forward_as_tuple( std::forward<TArgs>( args )... ) ),
+			hash,
+			nullptr };
+
+		const size_type bucket = bucketOf( hash );
+		Node*& first = head( bucket );
+		node->next = first;
+		first = node;
+		++m_size;
+
+		return { iterator{ this, bucket, node }, true };
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void LinearHashMap<TKey, TValue, THasher, TKeyEqual>::splitOne()
+	{
+		const size_type target = m_roundBuckets + m_split;
+		if ( target / SEGMENT_SIZE == m_segments.size() )
+		{
+			m_segments.push_back( std::make_unique<Node*[]>( SEGMENT_SIZE ) );
+		}
+
+		// Relink the split bucket's chain into itself and its image, keyed on the next hash bit
+		Node* node = std::exchange( head( m_split ), nullptr );
+		Node*& low = head( m_split );
+		Node*& high = head( target );
+		while ( node != nullptr )
+		{
+			Node* next = node->next;
+			Node*& destination = ( node->hash & m_roundBuckets ) ? high : low;
+			node->next = destination;
+			destination = node;
+			node = next;
+		}
+
+		if ( ++m_split == m_roundBuckets )
+		{
+			m_roundBuckets *= 2;
+			m_split = 0;
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void LinearHashMap<TKey, TValue, THasher, TKeyEqual>::destroyAll() noexcept
+	{
+		for ( size_type bucket = 0; bucket < m_segments.size() * SEGMENT_SIZE; ++bucket )
+		{
+			for ( Node* node = head( bucket ); node != nullptr; )
+			{
+				Node* next = node->next;
+				delete node;
+				node = next;
+			}
+			head( bucket ) = nullptr;
+		}
+	}
+} // namespace nfx::hashing
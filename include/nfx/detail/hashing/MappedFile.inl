@@ -0,0 +1,181 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file MappedFile.inl
+ * @brief Implementation of the read-only file mapping
+ * @details Platform mapping calls and the little-endian word helper shared by on-disk formats
+ */
+
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined( _WIN32 )
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace nfx::hashing
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Byte order
+		//=====================================================================
+
+		/** @brief Converts a 64-bit word between host and little-endian byte order (its own inverse) */
+		inline constexpr uint64_t littleEndian( uint64_t value ) noexcept
+		{
+			if constexpr ( std::endian::native == std::endian::little )
+			{
+				return value;
+			}
+			else
+			{
+				uint64_t swapped = 0;
+				for ( int i = 0; i < 8; ++i )
+				{
+					swapped = ( swapped << 8 ) | ( ( value >> ( i * 8 ) ) & 0xFF );
+				}
+
+				return swapped;
+			}
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// MappedFile
+	//=====================================================================
+
+	inline MappedFile::MappedFile( const std::filesystem::path& path )
+	{
+#if defined( _WIN32 )
+		HANDLE file = ::CreateFileW( path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr );
+		if ( file == INVALID_HANDLE_VALUE )
+		{
+			throw std::runtime_error{ "MappedFile: cannot open " + path.string() };
+		}
+
+		LARGE_INTEGER length{};
+		::GetFileSizeEx( file, &length );
+		HANDLE mapping = length.QuadPart > 0 ? ::CreateFileMappingW( file, nullptr, PAGE_READONLY, 0, 0, nullptr ) : nullptr;
+		::CloseHandle( file );
+		if ( mapping == nullptr )
+		{
+			throw std::runtime_error{ "MappedFile: cannot map " + path.string() };
+		}
+
+		const void* data = ::MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+		::CloseHandle( mapping );
+		if ( data == nullptr )
+		{
+			throw std::runtime_error{ "MappedFile: cannot map " + path.string() };
+		}
+		m_length = static_cast<std::size_t>( length.QuadPart );
+#else
+		const int file = ::open( path.c_str(), O_RDONLY | O_CLOEXEC );
+		if ( file < 0 )
+		{
+			throw std::runtime_error{ "MappedFile: cannot open " + path.string() };
+		}
+
+		struct stat status{};
+		void* data = MAP_FAILED;
+		if ( ::fstat( file, &status ) == 0 && status.st_size > 0 )
+		{
+			data = ::mmap( nullptr, static_cast<std::size_t>( status.st_size ), PROT_READ, MAP_SHARED, file, 0 );
+		}
+		::close( file );
+		if ( data == MAP_FAILED )
+		{
+			throw std::runtime_error{ "MappedFile: cannot map " + path.string() };
+		}
+
+		// Index lookups touch pages at random; read-ahead would only waste page cache
+		::madvise( data, static_cast<std::size_t>( status.st_size ), MADV_RANDOM );
+		m_length = static_cast<std::size_t>( status.st_size );
+#endif
+		m_data = static_cast<const std::byte*>( data );
+	}
+
+	inline MappedFile::MappedFile( MappedFile&& other ) noexcept
+		: m_data{ std::exchange( other.m_data, nullptr ) },
+		  m_length{ std::exchange( other.m_length, 0 ) }
+	{
+	}
+
+	inline MappedFile& MappedFile::operator=( MappedFile&& other ) noexcept
+	{
+		if ( this != &other )
+		{
+			unmap();
+			m_data = std::exchange( other.m_data, nullptr );
+			m_length = std::exchange( other.m_length, 0 );
+		}
+
+		return *this;
+	}
+
+	inline MappedFile::~MappedFile()
+	{
+		unmap();
+	}
+
+	inline std::span<const std::byte> MappedFile::bytes() const noexcept
+	{
+		return { m_data, m_length };
+	}
+
+	inline std::size_t MappedFile::size() const noexcept
+	{
+		return m_length;
+	}
+
+	inline void MappedFile::unmap() noexcept
+	{
+		if ( m_data != nullptr )
+		{
+#if defined( _WIN32 )
+			::UnmapViewOfFile( m_data );
+#else
+			::munmap( const_cast<std::byte*>( m_data ), m_length );
+#endif
+			m_data = nullptr;
+			m_length = 0;
+		}
+	}
+} // namespace nfx::hashing
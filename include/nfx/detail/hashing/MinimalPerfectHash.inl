@@ -0,0 +1,424 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file MinimalPerfectHash.inl
+ * @brief Implementation of the BBHash-style minimal perfect hash function
+ * @details Parallel level construction, image layout and validation, and rank-based queries
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include "nfx/detail/hashing/Parallel.h"
+
+namespace nfx::hashing
+{
+	namespace internal::mphf
+	{
+		//=====================================================================
+		// Image format constants
+		//=====================================================================
+
+		/** @brief "NFXMPHF1" read as a little-endian word */
+		inline constexpr uint64_t MAGIC{ 0x314648504D58464EULL };
+
+		/** @brief Current format version */
+		inline constexpr uint32_t VERSION{ 1 };
+
+		/** @brief Header size in words */
+		inline constexpr uint64_t HEADER_WORDS{ 8 };
+
+		/** @brief String hashed into the header to detect hasher mismatches */
+		inline constexpr std::string_view HASHER_CHECK_INPUT{ "nfx::hashing::MinimalPerfectHash" };
+
+		//=====================================================================
+		// Level hashing
+		//=====================================================================
+
+		/** @brief Remixes a key hash for @p level (bijective in @p hash) */
+		inline constexpr uint64_t levelHash( uint64_t hash, uint64_t level ) noexcept
+		{
+			return internal::hashInteger<uint64_t, 0>( hash ^ ( ( level + 1 ) * constants::GOLDEN_RATIO_64 ) );
+		}
+	} // namespace internal::mphf
+
+	//=====================================================================
+	// MinimalPerfectHash
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename THasher>
+	template <std::ranges::random_access_range TRange>
+	MinimalPerfectHash<THasher> MinimalPerfectHash<THasher>::build( const TRange& keys, const BuildOptions& options )
+	{
+		using namespace internal::mphf;
+		using internal::parallel::parallelFor;
+
+		if ( !( options.gamma >= 1.0 ) )
+		{
+			throw std::invalid_argument{ "MinimalPerfectHash::build: gamma must be at least 1" };
+		}
+
+		const auto keyCount = static_cast<std::size_t>( std::ranges::size( keys ) );
+		const std::size_t threadCount = internal::parallel::threadCountFor( options.threadCount, keyCount );
+
+		const THasher hasher{};
+		std::vector<uint64_t> hashes( keyCount );
+		parallelFor( threadCount, keyCount, [&]( std::size_t, std::size_t begin, std::size_t end ) {
+			const auto first = std::ranges::begin( keys );
+			for ( std::size_t i = begin; i < end; ++i )
+			{
+				hashes[i] = static_cast<uint64_t>( hasher( first[static_cast<std::ptrdiff_t>( i )] ) );
+			}
+		} );
+
+		std::vector<uint64_t> levels;
+		std::vector<uint64_t> bits;
+		std::vector<uint64_t> seen;
+		std::vector<uint64_t> collided;
+		std::vector<std::size_t> kept( threadCount );
+		std::vector<std::size_t> chunkBegin( threadCount );
+
+		std::size_t remaining = keyCount;
+		for ( uint64_t level = 0; remaining > 0 && level < MAX_LEVELS; ++level )
+		{
+			const auto target = static_cast<uint64_t>( std::ceil( options.gamma * static_cast<double>( remaining ) ) );
+			const uint64_t wordCount = std::max<uint64_t>( 1, ( target + 63 ) / 64 );
+			const uint64_t bitCount = wordCount * 64;
+			seen.assign( wordCount, 0 );
+			collided.assign( wordCount, 0 );
+
+			// Pass 1: mark occupied positions, and positions claimed more than once
+			parallelFor( threadCount, remaining, [&]( std::size_t, std::size_t begin, std::size_t end ) {
+				for ( std::size_t i = begin; i < end; ++i )
+				{
+					const uint64_t position = fastRange<uint64_t>( levelHash( hashes[i], level ), bitCount );
+					const uint64_t mask = uint64_t{ 1 } << ( position & 63 );
+					if ( std::atomic_ref<uint64_t>{ seen[position >> 6] }.fetch_or( mask, std::memory_order_relaxed ) & mask )
+					{
+						std::atomic_ref<uint64_t>{ collided[position >> 6] }.fetch_or( mask, std::memory_order_relaxed );
+					}
+				}
+			} );
+
+			levels.push_back( bits.size() );
+			levels.push_back( bitCount );
+			for ( uint64_t w = 0; w < wordCount; ++w )
+			{
+				bits.push_back( seen[w] & ~collided[w] );
+			}
+
+			// Pass 2: keep only colliding keys for the next level, compacting each chunk in place
+			parallelFor( threadCount, remaining, [&]( std::size_t chunk, std::size_t begin, std::size_t end ) {
+				std::size_t out = begin;
+				for ( std::size_t i = begin; i < end; ++i )
+				{
+					const uint64_t position = fastRange<uint64_t>( levelHash( hashes[i], level ), bitCount );
+					if ( ( collided[position >> 6] >> ( position & 63 ) ) & 1 )
+					{
+						hashes[out++] = hashes[i];
+					}
+				}
+				chunkBegin[chunk] = begin;
+				kept[chunk] = out - begin;
+			} );
+
+			std::size_t next = kept[0];
+			for ( std::size_t t = 1; t < threadCount; ++t )
+			{
+				std::memmove( hashes.data() + next, hashes.data() + chunkBegin[t], kept[t] * sizeof( uint64_t ) );
+				next += kept[t];
+			}
+			remaining = next;
+		}
+
+		hashes.resize( remaining );
+		std::sort( hashes.begin(), hashes.end() );
+		if ( std::adjacent_find( hashes.begin(), hashes.end() ) != hashes.end() )
+		{
+			throw std::invalid_argument{ "MinimalPerfectHash::build: duplicate key or 64-bit hash collision" };
+		}
+
+		// Lay out the image
+		const uint64_t levelCount = levels.size() / 2;
+		const uint64_t rankCount = ( bits.size() + RANK_BLOCK_WORDS - 1 ) / RANK_BLOCK_WORDS;
+		std::vector<uint64_t> image;
+		image.reserve( HEADER_WORDS + levels.size() + bits.size() + rankCount + hashes.size() );
+		image.push_back( MAGIC );
+		image.push_back( static_cast<uint64_t>( VERSION ) | ( ( HEADER_WORDS * 8 ) << 32 ) );
+		image.push_back( keyCount );
+		image.push_back( levelCount );
+		image.push_back( static_cast<uint64_t>( hasher( HASHER_CHECK_INPUT ) ) );
+		image.push_back( hashes.size() );
+		image.push_back( bits.size() );
+		image.push_back( 0 );
+		image.insert( image.end(), levels.begin(), levels.end() );
+		image.insert( image.end(), bits.begin(), bits.end() );
+
+		uint64_t ranked = 0;
+		for ( std::size_t w = 0; w < bits.size(); ++w )
+		{
+			if ( w % RANK_BLOCK_WORDS == 0 )
+			{
+				image.push_back( ranked );
+			}
+			ranked += static_cast<uint64_t>( std::popcount( bits[w] ) );
+		}
+		image.insert( image.end(), hashes.begin(), hashes.end() );
+
+		for ( auto& word : image )
+		{
+			word = internal::littleEndian( word );
+		}
+
+		MinimalPerfectHash result;
+		result.m_storage = std::move( image );
+		result.attach( std::as_bytes( std::span<const uint64_t>{ result.m_storage } ) );
+
+		return result;
+	}
+
+	template <typename THasher>
+	MinimalPerfectHash<THasher>::MinimalPerfectHash( std::span<const std::byte> image )
+	{
+		attach( image );
+	}
+
+	template <typename THasher>
+	MinimalPerfectHash<THasher>::MinimalPerfectHash( MappedFile file )
+		: m_file{ std::move( file ) }
+	{
+		attach( m_file.bytes() );
+	}
+
+	template <typename THasher>
+	MinimalPerfectHash<THasher>::MinimalPerfectHash( MinimalPerfectHash&& other ) noexcept
+		: m_storage{ std::move( other.m_storage ) },
+		  m_file{ std::move( other.m_file ) },
+		  m_image{ std::exchange( other.m_image, {} ) },
+		  m_levels{ std::exchange( other.m_levels, nullptr ) },
+		  m_bits{ std::exchange( other.m_bits, nullptr ) },
+		  m_ranks{ std::exchange( other.m_ranks, nullptr ) },
+		  m_fallback{ std::exchange( other.m_fallback, nullptr ) },
+		  m_size{ std::exchange( other.m_size, 0 ) },
+		  m_levelCount{ std::exchange( other.m_levelCount, 0 ) },
+		  m_fallbackCount{ std::exchange( other.m_fallbackCount, 0 ) }
+	{
+	}
+
+	template <typename THasher>
+	MinimalPerfectHash<THasher>& MinimalPerfectHash<THasher>::operator=( MinimalPerfectHash&& other ) noexcept
+	{
+		if ( this != &other )
+		{
+			m_storage = std::move( other.m_storage );
+			m_file = std::move( other.m_file );
+			m_image = std::exchange( other.m_image, {} );
+			m_levels = std::exchange( other.m_levels, nullptr );
+			m_bits = std::exchange( other.m_bits, nullptr );
+			m_ranks = std::exchange( other.m_ranks, nullptr );
+			m_fallback = std::exchange( other.m_fallback, nullptr );
+			m_size = std::exchange( other.m_size, 0 );
+			m_levelCount = std::exchange( other.m_levelCount, 0 );
+			m_fallbackCount = std::exchange( other.m_fallbackCount, 0 );
+		}
+
+		return *this;
+	}
+
+	//----------------------------------------------
+	// Query
+	//----------------------------------------------
+
+	template <typename THasher>
+	template <typename TKey>
+	inline uint64_t MinimalPerfectHash<THasher>::operator()( const TKey& key ) const noexcept
+	{
+		using internal::littleEndian;
+
+		const auto hash = static_cast<uint64_t>( m_hasher( key ) );
+		for ( uint64_t level = 0; level < m_levelCount; ++level )
+		{
+			const uint64_t firstWord = littleEndian( m_levels[2 * level] );
+			const uint64_t position = fastRange<uint64_t>( internal::mphf::levelHash( hash, level ), littleEndian( m_levels[2 * level + 1] ) );
+			const uint64_t word = firstWord + ( position >> 6 );
+			if ( ( littleEndian( m_bits[word] ) >> ( position & 63 ) ) & 1 )
+			{
+				return rank( word, position & 63 );
+			}
+		}
+
+		// Binary search of the sorted fallback hashes
+		uint64_t low = 0;
+		uint64_t high = m_fallbackCount;
+		while ( low < high )
+		{
+			const uint64_t middle = low + ( high - low ) / 2;
+			if ( littleEndian( m_fallback[middle] ) < hash )
+			{
+				low = middle + 1;
+			}
+			else
+			{
+				high = middle;
+			}
+		}
+		if ( low < m_fallbackCount && littleEndian( m_fallback[low] ) == hash )
+		{
+			return m_size - m_fallbackCount + low;
+		}
+
+		return m_size;
+	}
+
+	template <typename THasher>
+	inline std::size_t MinimalPerfectHash<THasher>::size() const noexcept
+	{
+		return static_cast<std::size_t>( m_size );
+	}
+
+	template <typename THasher>
+	inline std::size_t MinimalPerfectHash<THasher>::levelCount() const noexcept
+	{
+		return static_cast<std::size_t>( m_levelCount );
+	}
+
+	template <typename THasher>
+	inline double MinimalPerfectHash<THasher>::bitsPerKey() const noexcept
+	{
+		return m_size == 0 ? 0.0 : static_cast<double>( m_image.size_bytes() * 8 ) / static_cast<double>( m_size );
+	}
+
+	//----------------------------------------------
+	// Serialization
+	//----------------------------------------------
+
+	template <typename THasher>
+	inline std::vector<std::byte> MinimalPerfectHash<THasher>::serialize() const
+	{
+		const auto bytes = std::as_bytes( m_image );
+
+		return { bytes.begin(), bytes.end() };
+	}
+
+	template <typename THasher>
+	inline void MinimalPerfectHash<THasher>::write( const std::filesystem::path& path ) const
+	{
+		std::ofstream file{ path, std::ios::binary | std::ios::trunc };
+		file.write( reinterpret_cast<const char*>( m_image.data() ), static_cast<std::streamsize>( m_image.size_bytes() ) );
+		file.close();
+		if ( !file )
+		{
+			throw std::runtime_error{ "MinimalPerfectHash::write: cannot write " + path.string() };
+		}
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	template <typename THasher>
+	inline void MinimalPerfectHash<THasher>::attach( std::span<const std::byte> image )
+	{
+		using namespace internal::mphf;
+		using internal::littleEndian;
+
+		if ( image.size() < HEADER_WORDS * 8 || image.size() % 8 != 0 || reinterpret_cast<std::uintptr_t>( image.data() ) % alignof( uint64_t ) != 0 )
+		{
+			throw std::runtime_error{ "MinimalPerfectHash: image is truncated or misaligned" };
+		}
+
+		const auto* words = reinterpret_cast<const uint64_t*>( image.data() );
+		const uint64_t wordCount = image.size() / 8;
+		if ( littleEndian( words[0] ) != MAGIC )
+		{
+			throw std::runtime_error{ "MinimalPerfectHash: not a minimal perfect hash image" };
+		}
+		if ( littleEndian( words[1] ) != ( static_cast<uint64_t>( VERSION ) | ( ( HEADER_WORDS * 8 ) << 32 ) ) )
+		{
+			throw std::runtime_error{ "MinimalPerfectHash: unsupported format version" };
+		}
+		if ( littleEndian( words[4] ) != static_cast<uint64_t>( m_hasher( HASHER_CHECK_INPUT ) ) )
+		{
+			throw std::runtime_error{ "MinimalPerfectHash: image was built with a different hasher" };
+		}
+
+		const uint64_t size = littleEndian( words[2] );
+		const uint64_t levelCount = littleEndian( words[3] );
+		const uint64_t fallbackCount = littleEndian( words[5] );
+		const uint64_t bitWords = littleEndian( words[6] );
+		const uint64_t rankCount = ( bitWords + RANK_BLOCK_WORDS - 1 ) / RANK_BLOCK_WORDS;
+		if ( levelCount > MAX_LEVELS || fallbackCount > size || bitWords > wordCount ||
+			 HEADER_WORDS + 2 * levelCount + bitWords + rankCount + fallbackCount != wordCount )
+		{
+			throw std::runtime_error{ "MinimalPerfectHash: corrupt or truncated image" };
+		}
+
+		const uint64_t* levels = words + HEADER_WORDS;
+		for ( uint64_t level = 0; level < levelCount; ++level )
+		{
+			const uint64_t firstWord = littleEndian( levels[2 * level] );
+			const uint64_t bitCount = littleEndian( levels[2 * level + 1] );
+			if ( bitCount == 0 || bitCount % 64 != 0 || firstWord > bitWords || bitCount / 64 > bitWords - firstWord )
+			{
+				throw std::runtime_error{ "MinimalPerfectHash: corrupt level table" };
+			}
+		}
+
+		m_image = { words, static_cast<std::size_t>( wordCount ) };
+		m_levels = levels;
+		m_bits = m_levels + 2 * levelCount;
+		m_ranks = m_bits + bitWords;
+		m_fallback = m_ranks + rankCount;
+		m_size = size;
+		m_levelCount = levelCount;
+		m_fallbackCount = fallbackCount;
+	}
+
+	template <typename THasher>
+	inline uint64_t MinimalPerfectHash<THasher>::rank( uint64_t word, uint64_t bit ) const noexcept
+	{
+		using internal::littleEndian;
+
+		const uint64_t block = word / RANK_BLOCK_WORDS;
+		uint64_t result = littleEndian( m_ranks[block] );
+		for ( uint64_t w = block * RANK_BLOCK_WORDS; w < word; ++w )
+		{
+			result += static_cast<uint64_t>( std::popcount( littleEndian( m_bits[w] ) ) );
+		}
+
+		return result + static_cast<uint64_t>( std::popcount( littleEndian( m_bits[word] ) & ( ( uint64_t{ 1 } << bit ) - 1 ) ) );
+	}
+} // namespace nfx::hashing
@@ -0,0 +1,88 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Parallel.h
+ * @brief Fork-join helpers shared by the parallel static-structure builders
+ * @details Thread-count selection and a contiguous-chunk parallelFor, used by MinimalPerfectHash
+ *          and BinaryFuseFilter
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace nfx::hashing::internal::parallel
+{
+	//=====================================================================
+	// Thread count
+	//=====================================================================
+
+	/** @brief Minimum items per build thread; below this, spawning costs more than it saves */
+	inline constexpr std::size_t MIN_ITEMS_PER_THREAD{ 65536 };
+
+	/**
+	 * @brief Number of threads to build over @p itemCount items with
+	 * @param[in] requested Requested thread count; 0 uses std::thread::hardware_concurrency()
+	 * @param[in] itemCount Number of items to split
+	 * @return At least 1, at most @p requested, and no more than one per MIN_ITEMS_PER_THREAD items
+	 */
+	inline std::size_t threadCountFor( std::size_t requested, std::size_t itemCount ) noexcept
+	{
+		const std::size_t available = requested != 0 ? requested : std::max( 1u, std::thread::hardware_concurrency() );
+
+		return std::clamp<std::size_t>( itemCount / MIN_ITEMS_PER_THREAD, 1, available );
+	}
+
+	//=====================================================================
+	// Parallel execution
+	//=====================================================================
+
+	/**
+	 * @brief Splits [0, count) into @p threadCount contiguous chunks and runs them concurrently
+	 * @details Calls function( chunk, begin, end ); chunk t always covers [t * ceil(count / threads), ...).
+	 */
+	template <typename TFunction>
+	inline void parallelFor( std::size_t threadCount, std::size_t count, const TFunction& function )
+	{
+		const std::size_t chunk = ( count + threadCount - 1 ) / threadCount;
+		std::vector<std::thread> workers;
+		workers.reserve( threadCount - 1 );
+		for ( std::size_t t = 1; t < threadCount; ++t )
+		{
+			const std::size_t begin = std::min( count, t * chunk );
+			const std::size_t end = std::min( count, begin + chunk );
+			workers.emplace_back( [&function, t, begin, end] { function( t, begin, end ); } );
+		}
+		function( 0, 0, std::min( count, chunk ) );
+
+		for ( auto& worker : workers )
+		{
+			worker.join();
+		}
+	}
+} // namespace nfx::hashing::internal::parallel
@@ -0,0 +1,535 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file PersistentHashMap.inl
+ * @brief Implementation of the persistent HAMT and its atomic snapshot root
+ * @details Path-copying insertion and canonical erasure over CHAMP nodes, and version slots with
+ *          split acquisition / release counting
+ */
+
+#include <bit>
+#include <stdexcept>
+#include <thread>
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// PersistentHashMap
+	//=====================================================================
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::size_type PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline bool PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline const TValue* PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::find( const TKey& key ) const
+	{
+		const auto hash = static_cast<uint64_t>( m_hasher( key ) );
+		const Node* node = m_root.get();
+		for ( unsigned shift = 0; node != nullptr; shift += BITS_PER_LEVEL )
+		{
+			if ( shift >= 64 )
+			{
+				for ( const auto& entry : node->entries )
+				{
+					if ( entry.hash == hash && m_keyEqual( entry.value.first, key ) )
+					{
+						return &entry.value.second;
+					}
+				}
+
+				return nullptr;
+			}
+
+			const uint32_t bit = fragmentBit( hash, shift );
+			if ( node->entryMap & bit )
+			{
+				const Entry& entry = node->entries[indexOf( node->entryMap, bit )];
+
+				return entry.hash == hash && m_keyEqual( entry.value.first, key ) ? &entry.value.second : nullptr;
+			}
+			if ( !( node->childMap & bit ) )
+			{
+				return nullptr;
+			}
+			node = node->children[indexOf( node->childMap, bit )].get();
+		}
+
+		return nullptr;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline bool PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::contains( const TKey& key ) const
+	{
+		return find( key ) != nullptr;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline const TValue& PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::at( const TKey& key ) const
+	{
+		if ( const TValue* value = find( key ) )
+		{
+			return *value;
+		}
+
+		throw std::out_of_range{ "PersistentHashMap::at: key not found" };
+	}
+
+	//----------------------------------------------
+	// Updates
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline PersistentHashMap<TKey, TValue, THasher, TKeyEqual> PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::set( TKey key, TValue value ) const
+	{
+		const auto hash = static_cast<uint64_t>( m_hasher( key ) );
+		Entry entry{ hash, value_type{ std::move( key ), std::move( value ) } };
+
+		PersistentHashMap result{ *this };
+		bool added = false;
+		if ( m_root == nullptr )
+		{
+			auto root = std::make_shared<Node>();
+			root->entryMap = fragmentBit( hash, 0 );
+			root->entries.push_back( std::move( entry ) );
+			result.m_root = std::move( root );
+			added = true;
+		}
+		else
+		{
+			result.m_root = setIn( m_root, std::move( entry ), 0, added );
+		}
+		result.m_size += added ? 1 : 0;
+
+		return result;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline PersistentHashMap<TKey, TValue, THasher, TKeyEqual> PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::erase( const TKey& key ) const
+	{
+		if ( m_root == nullptr )
+		{
+			return *this;
+		}
+
+		bool removed = false;
+		NodePtr root = eraseFrom( m_root, static_cast<uint64_t>( m_hasher( key ) ), key, 0, removed );
+		if ( !removed )
+		{
+			return *this;
+		}
+
+		PersistentHashMap result{ *this };
+		result.m_root = ( root->entries.empty() && root->children.empty() ) ? nullptr : std::move( root );
+		--result.m_size;
+
+		return result;
+	}
+
+	//----------------------------------------------
+	// Iteration
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TFunction>
+	inline void PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::for_each( TFunction&& function ) const
+	{
+		if ( m_root != nullptr )
+		{
+			visit( *m_root, function );
+		}
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline uint32_t PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::fragmentBit( uint64_t hash, unsigned shift ) noexcept
+	{
+		return uint32_t{ 1 } << ( ( hash >> shift ) & ( ( 1u << BITS_PER_LEVEL ) - 1 ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline std::size_t PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::indexOf( uint32_t map, uint32_t bit ) noexcept
+	{
+		return static_cast<std::size_t>( std::popcount( map & ( bit - 1 ) ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::NodePtr PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::mergeEntries( Entry first, Entry second, unsigned shift )
+	{
+		auto node = std::make_shared<Node>();
+		if ( shift >= 64 )
+		{
+			node->entries.push_back( std::move( first ) );
+			node->entries.push_back( std::move( second ) );
+
+			return node;
+		}
+
+		const uint32_t firstBit = fragmentBit( first.hash, shift );
+		const uint32_t secondBit = fragmentBit( second.hash, shift );
+		if ( firstBit == secondBit )
+		{
+			node->childMap = firstBit;
+			node->children.push_back( mergeEntries( std::move( first ), std::move( second ), shift + BITS_PER_LEVEL ) );
+
+			return node;
+		}
+
+		node->entryMap = firstBit | secondBit;
+		if ( firstBit < secondBit )
+		{
+			node->entries.push_back( std::move( first ) );
+			node->entries.push_back( std::move( second ) );
+		}
+		else
+		{
+			node->entries.push_back( std::move( second ) );
+			node->entries.push_back( std::move( first ) );
+		}
+
+		return node;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::NodePtr PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::setIn( const NodePtr& node, Entry&& entry, unsigned shift, bool& added ) const
+	{
+		auto copy = std::make_shared<Node>( *node );
+		if ( shift >= 64 )
+		{
+			for ( auto& existing : copy->entries )
+			{
+				if ( existing.hash == entry.hash && m_keyEqual( existing.value.first, entry.value.first ) )
+				{
+					existing.value.second = std::move( entry.value.second );
+
+					return copy;
+				}
+			}
+			copy->entries.push_back( std::move( entry ) );
+			added = true;
+
+			return copy;
+		}
+
+		const uint32_t bit = fragmentBit( entry.hash, shift );
+		if ( node->entryMap & bit )
+		{
+			const std::size_t index = indexOf( node->entryMap, bit );
+			Entry& existing = copy->entries[index];
+			if ( existing.hash == entry.hash && m_keyEqual( existing.value.first, entry.value.first ) )
+			{
+				existing.value.second = std::move( entry.value.second );
+
+				return copy;
+			}
+
+			// Two keys share this fragment: push both down into a new child
+			NodePtr child = mergeEntries( std::move( existing ), std::move( entry ), shift + BITS_PER_LEVEL );
+			copy->entries.erase( copy->entries.begin() + static_cast<std::ptrdiff_t>( index ) );
+			copy->entryMap &= ~bit;
+			copy->childMap |= bit;
+			copy->children.insert( copy->children.begin() + static_cast<std::ptrdiff_t>( indexOf( copy->childMap, bit ) ), std::move( child ) );
+			added = true;
+		}
+		else if ( node->childMap & bit )
+		{
+			const std::size_t index = indexOf( node->childMap, bit );
+			copy->children[index] = setIn( node->children[index], std::move( entry ), shift + BITS_PER_LEVEL, added );
+		}
+		else
+		{
+			copy->entryMap |= bit;
+			copy->entries.insert( copy->entries.begin() + static_cast<std::ptrdiff_t>( indexOf( copy->entryMap, bit ) ), std::move( entry ) );
+			added = true;
+		}
+
+		return copy;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::NodePtr PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::eraseFrom( const NodePtr& node, uint64_t hash, const TKey& key, unsigned shift, bool& removed ) const
+	{
+		if ( shift >= 64 )
+		{
+			for ( std::size_t i = 0; i < node->entries.size(); ++i )
+			{
+				if ( node->entries[i].hash == hash && m_keyEqual( node->entries[i].value.first, key ) )
+				{
+					auto copy = std::make_shared<Node>( *node );
+					copy->entries.erase( copy->entries.begin() + static_cast<std::ptrdiff_t>( i ) );
+					removed = true;
+
+					return copy;
+				}
+			}
+
+			return node;
+		}
+
+		const uint32_t bit = fragmentBit( hash, shift );
+		if ( node->entryMap & bit )
+		{
+			const std::size_t index = indexOf( node->entryMap, bit );
+			if ( node->entries[index].hash != hash || !m_keyEqual( node->entries[index].value.first, key ) )
+			{
+				return node;
+			}
+
+			auto copy = std::make_shared<Node>( *node );
+			copy->entries.erase( copy->entries.begin() + static_cast<std::ptrdiff_t>( index ) );
+			copy->entryMap &= ~bit;
+			removed = true;
+
+			return copy;
+		}
+		if ( !( node->childMap & bit ) )
+		{
+			return node;
+		}
+
+		const std::size_t index = indexOf( node->childMap, bit );
+		NodePtr child = eraseFrom( node->children[index], hash, key, shift + BITS_PER_LEVEL, removed );
+		if ( !removed )
+		{
+			return node;
+		}
+
+		auto copy = std::make_shared<Node>( *node );
+		if ( child->children.empty() && child->entries.size() == 1 )
+		{
+			// Canonical form: a child holding a single entry is inlined into its parent
+			copy->children.erase( copy->children.begin() + static_cast<std::ptrdiff_t>( index ) );
+			copy->childMap &= ~bit;
+			copy->entryMap |= bit;
+			copy->entries.insert( copy->entries.begin() + static_cast<std::ptrdiff_t>( indexOf( copy->entryMap, bit ) ), child->entries.front() );
+		}
+		else
+		{
+			copy->children[index] = std::move( child );
+		}
+
+		return copy;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TFunction>
+	inline void PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::visit( const Node& node, TFunction& function )
+	{
+		for ( const auto& entry : node.entries )
+		{
+			function( entry.value.first, entry.value.second );
+		}
+		for ( const auto& child : node.children )
+		{
+			visit( *child, function );
+		}
+	}
+
+	//=====================================================================
+	// AtomicPersistentHashMap
+	//=====================================================================
+
+	//----------------------------------------------
+	// Snapshot
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::Snapshot::Snapshot( Version* version ) noexcept
+		: m_version{ version }
+	{
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::Snapshot::Snapshot( Snapshot&& other ) noexcept
+		: m_version{ std::exchange( other.m_version, nullptr ) }
+	{
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::Snapshot& AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::Snapshot::operator=( Snapshot&& other ) noexcept
+	{
+		if ( this != &other )
+		{
+			release();
+			m_version = std::exchange( other.m_version, nullptr );
+		}
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::Snapshot::~Snapshot()
+	{
+		release();
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline const typename AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::map_type& AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::Snapshot::operator*() const noexcept
+	{
+		return m_version->map;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline const typename AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::map_type* AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::Snapshot::operator->() const noexcept
+	{
+		return &m_version->map;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::Snapshot::release() noexcept
+	{
+		if ( m_version != nullptr )
+		{
+			m_version->released.fetch_add( 1, std::memory_order_release );
+			m_version = nullptr;
+		}
+	}
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::AtomicPersistentHashMap()
+		: AtomicPersistentHashMap{ map_type{} }
+	{
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::AtomicPersistentHashMap( map_type initial )
+	{
+		m_versions[0].map = std::move( initial );
+		m_versions[0].inUse = true;
+	}
+
+	//----------------------------------------------
+	// Readers
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::Snapshot AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::snapshot() const noexcept
+	{
+		const uint64_t root = m_root.fetch_add( 1, std::memory_order_acquire );
+
+		return Snapshot{ &m_versions[root >> SLOT_SHIFT] };
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::map_type AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::load() const
+	{
+		const Snapshot current = snapshot();
+
+		return *current;
+	}
+
+	//----------------------------------------------
+	// Writers
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::publish( map_type map )
+	{
+		std::lock_guard lock{ m_writerMutex };
+		publishLocked( std::move( map ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	template <typename TFunction>
+	inline void AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::update( TFunction&& function )
+	{
+		std::lock_guard lock{ m_writerMutex };
+		// Only writers change the current slot, so it can be read here without a snapshot
+		const map_type& current = m_versions[m_root.load( std::memory_order_relaxed ) >> SLOT_SHIFT].map;
+		publishLocked( function( current ) );
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::reclaim() noexcept
+	{
+		for ( auto& version : m_versions )
+		{
+			if ( version.retired && version.released.load( std::memory_order_acquire ) == version.acquired )
+			{
+				version.map = map_type{};
+				version.released.store( 0, std::memory_order_relaxed );
+				version.acquired = 0;
+				version.retired = false;
+				version.inUse = false;
+			}
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void AtomicPersistentHashMap<TKey, TValue, THasher, TKeyEqual>::publishLocked( map_type&& map )
+	{
+		std::size_t slot = MAX_VERSIONS;
+		for ( ;; )
+		{
+			reclaim();
+			for ( std::size_t i = 0; i < MAX_VERSIONS && slot == MAX_VERSIONS; ++i )
+			{
+				slot = m_versions[i].inUse ? MAX_VERSIONS : i;
+			}
+			if ( slot != MAX_VERSIONS )
+			{
+				break;
+			}
+			// Every slot is held by a snapshot: wait for readers to let go
+			std::this_thread::yield();
+		}
+
+		m_versions[slot].map = std::move( map );
+		m_versions[slot].inUse = true;
+
+		const uint64_t previous = m_root.exchange( static_cast<uint64_t>( slot ) << SLOT_SHIFT, std::memory_order_acq_rel );
+		Version& retired = m_versions[previous >> SLOT_SHIFT];
+		retired.acquired = previous & COUNT_MASK;
+		retired.retired = true;
+		reclaim();
+	}
+} // namespace nfx::hashing
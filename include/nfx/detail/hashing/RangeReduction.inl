@@ -0,0 +1,252 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file RangeReduction.inl
+ * @brief Implementation of fastrange and Fibonacci range reduction
+ * @details Portable multiply-high, scalar reductions and runtime-dispatched AVX2 batch kernels
+ */
+
+#include <cstddef>
+#include <type_traits>
+
+#include <immintrin.h>
+
+#include "nfx/hashing/Algorithms.h"
+
+namespace nfx::hashing
+{
+	namespace internal::range
+	{
+		//=====================================================================
+		// Multiply-high
+		//=====================================================================
+
+		/** @brief High 64 bits of the 128-bit product @p a * @p b */
+		inline constexpr uint64_t mulHigh64( uint64_t a, uint64_t b ) noexcept
+		{
+#if defined( _MSC_VER ) && !defined( __clang__ )
+			if ( !std::is_constant_evaluated() )
+			{
+				return __umulh( a, b );
+			}
+
+			const uint64_t low = ( a & 0xFFFFFFFFu ) * ( b & 0xFFFFFFFFu );
+			const uint64_t cross1 = ( a >> 32 ) * ( b & 0xFFFFFFFFu );
+			const uint64_t cross2 = ( a & 0xFFFFFFFFu ) * ( b >> 32 );
+			const uint64_t middle = ( low >> 32 ) + ( cross1 & 0xFFFFFFFFu ) + ( cross2 & 0xFFFFFFFFu );
+
+			return ( a >> 32 ) * ( b >> 32 ) + ( cross1 >> 32 ) + ( cross2 >> 32 ) + ( middle >> 32 );
+#else
+			return static_cast<uint64_t>( ( static_cast<unsigned __int128>( a ) * b ) >> 64 );
+#endif
+		}
+
+		//=====================================================================
+		// AVX2 kernels
+		//=====================================================================
+
+		/*
+		 * Each kernel handles the largest multiple of its lane count and returns how many hashes it
+		 * reduced; the caller finishes the tail with the scalar function. Loads precede stores
+		 * within an iteration, so the output may alias the input.
+		 */
+
+		NFX_HASHING_TARGET( "avx2" )
+		inline std::size_t fastRangeAvx2( const uint32_t* hashes, std::size_t count, uint32_t range, uint32_t* indexes ) noexcept
+		{
+			const __m256i multiplier = _mm256_set1_epi64x( static_cast<long long>( range ) );
+			std::size_t i = 0;
+			for ( ; i + 8 <= count; i += 8 )
+			{
+				const __m256i x = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( hashes + i ) );
+
+				// Even lanes: the 64-bit products' high halves move down; odd lanes already sit high
+				const __m256i even = _mm256_srli_epi64( _mm256_mul_epu32( x, multiplier ), 32 );
+				const __m256i odd = _mm256_mul_epu32( _mm256_srli_epi64( x, 32 ), multiplier );
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( indexes + i ), _mm256_blend_epi32( even, odd, 0xAA ) );
+			}
+
+			return i;
+		}
+
+		NFX_HASHING_TARGET( "avx2" )
+		inline std::size_t fastRangeAvx2( const uint64_t* hashes, std::size_t count, uint64_t range, uint64_t* indexes ) noexcept
+		{
+			const __m256i lowMask = _mm256_set1_epi64x( 0xFFFFFFFF );
+			const __m256i rangeLow = _mm256_set1_epi64x( static_cast<long long>( range & 0xFFFFFFFFu ) );
+			const __m256i rangeHigh = _mm256_set1_epi64x( static_cast<long long>( range >> 32 ) );
+			std::size_t i = 0;
+			for ( ; i + 4 <= count; i += 4 )
+			{
+				const __m256i x = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( hashes + i ) );
+				const __m256i xHigh = _mm256_srli_epi64( x, 32 );
+
+				// Schoolbook 64 x 64 -> high 64 from four 32 x 32 -> 64 products
+				const __m256i low = _mm256_mul_epu32( x, rangeLow );
+				const __m256i cross1 = _mm256_mul_epu32( xHigh, rangeLow );
+				const __m256i cross2 = _mm256_mul_epu32( x, rangeHigh );
+				const __m256i high = _mm256_mul_epu32( xHigh, rangeHigh );
+				const __m256i middle = _mm256_add_epi64( _mm256_add_epi64( _mm256_srli_epi64( low, 32 ), _mm256_and_si256( cross1, lowMask ) ),
+					_mm256_and_si256( cross2, lowMask ) );
+				const __m256i result = _mm256_add_epi64( _mm256_add_epi64( high, _mm256_srli_epi64( middle, 32 ) ),
+					_mm256_add_epi64( _mm256_srli_epi64( cross1, 32 ), _mm256_srli_epi64( cross2, 32 ) ) );
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( indexes + i ), result );
+			}
+
+			return i;
+		}
+
+		NFX_HASHING_TARGET( "avx2" )
+		inline std::size_t fibonacciRangeAvx2( const uint32_t* hashes, std::size_t count, unsigned int bits, uint32_t* indexes ) noexcept
+		{
+			const __m256i multiplier = _mm256_set1_epi32( static_cast<int>( constants::GOLDEN_RATIO_32 ) );
+			const __m128i shift = _mm_cvtsi32_si128( static_cast<int>( 32 - bits ) ); // 32 clears the lane
+			std::size_t i = 0;
+			for ( ; i + 8 <= count; i += 8 )
+			{
+				const __m256i x = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( hashes + i ) );
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( indexes + i ), _mm256_srl_epi32( _mm256_mullo_epi32( x, multiplier ), shift ) );
+			}
+
+			return i;
+		}
+
+		NFX_HASHING_TARGET( "avx2" )
+		inline std::size_t fibonacciRangeAvx2( const uint64_t* hashes, std::size_t count, unsigned int bits, uint64_t* indexes ) noexcept
+		{
+			const __m256i multiplierLow = _mm256_set1_epi64x( static_cast<long long>( constants::GOLDEN_RATIO_64 & 0xFFFFFFFFu ) );
+			const __m256i multiplierHigh = _mm256_set1_epi64x( static_cast<long long>( constants::GOLDEN_RATIO_64 >> 32 ) );
+			const __m128i shift = _mm_cvtsi32_si128( static_cast<int>( 64 - bits ) ); // 64 clears the lane
+			std::size_t i = 0;
+			for ( ; i + 4 <= count; i += 4 )
+			{
+				const __m256i x = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( hashes + i ) );
+
+				// Low 64 bits of x * phi: the high x high product only reaches bit 64 and above
+				const __m256i cross = _mm256_add_epi64( _mm256_mul_epu32( _mm256_srli_epi64( x, 32 ), multiplierLow ),
+					_mm256_mul_epu32( x, multiplierHigh ) );
+				const __m256i product = _mm256_add_epi64( _mm256_mul_epu32( x, multiplierLow ), _mm256_slli_epi64( cross, 32 ) );
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( indexes + i ), _mm256_srl_epi64( product, shift ) );
+			}
+
+			return i;
+		}
+	} // namespace internal::range
+
+	//=====================================================================
+	// Range reduction
+	//=====================================================================
+
+	//----------------------------------------------
+	// Scalar
+	//----------------------------------------------
+
+	template <Hash32or64 HashType>
+	inline constexpr HashType fastRange( HashType hash, HashType range ) noexcept
+	{
+		if constexpr ( sizeof( HashType ) == 4 ) // 32-bit
+		{
+			return static_cast<HashType>( ( static_cast<uint64_t>( hash ) * range ) >> 32 );
+		}
+		else // 64-bit
+		{
+			return internal::range::mulHigh64( hash, range );
+		}
+	}
+
+	template <Hash32or64 HashType>
+	inline constexpr HashType fibonacciRange( HashType hash, unsigned int bits ) noexcept
+	{
+		if constexpr ( sizeof( HashType ) == 4 ) // 32-bit
+		{
+			const uint32_t product = hash * constants::GOLDEN_RATIO_32;
+
+			// Split shift: shifting by the full width is undefined, and bits == 0 must yield 0
+			return static_cast<HashType>( ( product >> 1 ) >> ( 31 - bits ) );
+		}
+		else // 64-bit
+		{
+			const uint64_t product = hash * constants::GOLDEN_RATIO_64;
+
+			return static_cast<HashType>( ( product >> 1 ) >> ( 63 - bits ) );
+		}
+	}
+
+	//----------------------------------------------
+	// Batched
+	//----------------------------------------------
+
+	inline void fastRange( std::span<const uint32_t> hashes, uint32_t range, std::span<uint32_t> indexes ) noexcept
+	{
+		std::size_t i = 0;
+		if ( internal::hasAvx2Support() )
+		{
+			i = internal::range::fastRangeAvx2( hashes.data(), hashes.size(), range, indexes.data() );
+		}
+		for ( ; i < hashes.size(); ++i )
+		{
+			indexes[i] = fastRange<uint32_t>( hashes[i], range );
+		}
+	}
+
+	inline void fastRange( std::span<const uint64_t> hashes, uint64_t range, std::span<uint64_t> indexes ) noexcept
+	{
+		std::size_t i = 0;
+		if ( internal::hasAvx2Support() )
+		{
+			i = internal::range::fastRangeAvx2( hashes.data(), hashes.size(), range, indexes.data() );
+		}
+		for ( ; i < hashes.size(); ++i )
+		{
+			indexes[i] = fastRange<uint64_t>( hashes[i], range );
+		}
+	}
+
+	inline void fibonacciRange( std::span<const uint32_t> hashes, unsigned int bits, std::span<uint32_t> indexes ) noexcept
+	{
+		std::size_t i = 0;
+		if ( internal::hasAvx2Support() )
+		{
+			i = internal::range::fibonacciRangeAvx2( hashes.data(), hashes.size(), bits, indexes.data() );
+		}
+		for ( ; i < hashes.size(); ++i )
+		{
+			indexes[i] = fibonacciRange<uint32_t>( hashes[i], bits );
+		}
+	}
+
+	inline void fibonacciRange( std::span<const uint64_t> hashes, unsigned int bits, std::span<uint64_t> indexes ) noexcept
+	{
+		std::size_t i = 0;
+		if ( internal::hasAvx2Support() )
+		{
+			i = internal::range::fibonacciRangeAvx2( hashes.data(), hashes.size(), bits, indexes.data() );
+		}
+		for ( ; i < hashes.size(); ++i )
+		{
+			indexes[i] = fibonacciRange<uint64_t>( hashes[i], bits );
+		}
+	}
+} // namespace nfx::hashing
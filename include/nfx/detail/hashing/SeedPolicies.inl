@@ -0,0 +1,172 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file SeedPolicies.inl
+ * @brief Implementation of the table seed policies
+ * @details Process entropy and per-instance salts, probe-length windows, reseeding with backoff
+ *          and the reseed counter
+ */
+
+#include <chrono>
+#include <random>
+
+#include "nfx/hashing/Hasher.h"
+
+namespace nfx::hashing
+{
+	namespace internal::seeding
+	{
+		//=====================================================================
+		// Process state
+		//=====================================================================
+
+		/** @brief Random value fixed for the lifetime of the process */
+		inline uint64_t processEntropy() noexcept
+		{
+			static const uint64_t entropy = [] {
+				uint64_t value = static_cast<uint64_t>( std::chrono::steady_clock::now().time_since_epoch().count() );
+				try
+				{
+					std::random_device device;
+					value ^= ( static_cast<uint64_t>( device() ) << 32 ) | device();
+				}
+				catch ( ... )
+				{
+					// No entropy source: the clock alone still differs between runs
+				}
+
+				return hashInteger<uint64_t, constants::FNV_OFFSET_BASIS_64>( value | 1 );
+			}();
+
+			return entropy;
+		}
+
+		/** @brief Reseeds performed by AdaptiveSeed tables in this process */
+		inline std::atomic<uint64_t> adaptiveReseeds{ 0 };
+	} // namespace internal::seeding
+
+	//=====================================================================
+	// Per-instance salt
+	//=====================================================================
+
+	inline uint64_t saltedSeed( const void* instance ) noexcept
+	{
+		return internal::hashInteger<uint64_t, constants::FNV_OFFSET_BASIS_64>(
+			internal::seeding::processEntropy() ^ static_cast<uint64_t>( reinterpret_cast<std::uintptr_t>( instance ) ) );
+	}
+
+	namespace policies
+	{
+		//=====================================================================
+		// SaltedSeed
+		//=====================================================================
+
+		inline SaltedSeed::SaltedSeed() noexcept
+			: m_seed{ saltedSeed( this ) }
+		{
+		}
+
+		inline uint64_t SaltedSeed::seed() const noexcept
+		{
+			return m_seed;
+		}
+
+		//=====================================================================
+		// AdaptiveSeed
+		//=====================================================================
+
+		//----------------------------------------------
+		// Table interface
+		//----------------------------------------------
+
+		inline uint64_t AdaptiveSeed::seed() const noexcept
+		{
+			return m_seed;
+		}
+
+		inline bool AdaptiveSeed::recordInsert( std::size_t probeGroups ) noexcept
+		{
+			m_probeGroups += probeGroups;
+			m_maxProbeGroups = probeGroups > m_maxProbeGroups ? probeGroups : m_maxProbeGroups;
+			if ( ++m_inserts < m_window )
+			{
+				return false;
+			}
+
+			const bool pathological = m_maxProbeGroups > MAX_PROBE_GROUPS || m_probeGroups > m_inserts * MAX_AVERAGE_PROBE_GROUPS;
+			m_inserts = 0;
+			m_probeGroups = 0;
+			m_maxProbeGroups = 0;
+
+			return pathological;
+		}
+
+		inline void AdaptiveSeed::reseed() noexcept
+		{
+			// Unpredictable from outside the process, different for every table and every reseed
+			m_seed = internal::hashInteger<uint64_t, constants::FNV_OFFSET_BASIS_64>(
+				m_seed ^ internal::seeding::processEntropy() ^ ( reinterpret_cast<std::uintptr_t>( this ) + ( m_reseeds + 1 ) * constants::GOLDEN_RATIO_64 ) );
+			++m_reseeds;
+			m_window *= 2;
+			internal::seeding::adaptiveReseeds.fetch_add( 1, std::memory_order_relaxed );
+		}
+
+		inline void AdaptiveSeed::onResize( std::size_t capacity ) noexcept
+		{
+			if ( capacity > m_capacity )
+			{
+				m_window = INITIAL_WINDOW;
+			}
+			m_capacity = capacity;
+			m_inserts = 0;
+			m_probeGroups = 0;
+			m_maxProbeGroups = 0;
+		}
+
+		//----------------------------------------------
+		// Statistics
+		//----------------------------------------------
+
+		inline uint64_t AdaptiveSeed::reseedCount() const noexcept
+		{
+			return m_reseeds;
+		}
+
+		inline std::size_t AdaptiveSeed::maxProbeGroups() const noexcept
+		{
+			return m_maxProbeGroups;
+		}
+
+		inline double AdaptiveSeed::averageProbeGroups() const noexcept
+		{
+			return m_inserts == 0 ? 0.0 : static_cast<double>( m_probeGroups ) / static_cast<double>( m_inserts );
+		}
+
+		inline uint64_t AdaptiveSeed::totalReseeds() noexcept
+		{
+			return internal::seeding::adaptiveReseeds.load( std::memory_order_relaxed );
+		}
+	} // namespace policies
+} // namespace nfx::hashing
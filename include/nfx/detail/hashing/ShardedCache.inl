@@ -0,0 +1,408 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ShardedCache.inl
+ * @brief Implementation of the sharded LRU / CLOCK cache
+ * @details Node pool, intrusive recency list, eviction and per-shard locking
+ */
+
+#include <algorithm>
+#include <bit>
+#include <mutex>
+#include <new>
+#include <thread>
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// ShardedCache
+	//=====================================================================
+
+	//----------------------------------------------
+	// Node pool
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::NodePool::~NodePool()
+	{
+		for ( Node* slab : m_slabs )
+		{
+			std::allocator<Node>{}.deallocate( slab, SLAB_NODES );
+		}
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	template <typename TKeyArg>
+	inline typename ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::Node* ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::NodePool::create( TKeyArg&& key, TValue&& value, uint64_t hash, size_type weight )
+	{
+		void* memory;
+		if ( m_free != nullptr )
+		{
+			memory = m_free;
+			m_free = m_free->next;
+		}
+		else
+		{
+			if ( m_slabUsed == SLAB_NODES )
+			{
+				m_slabs.push_back( std::allocator<Node>{}.allocate( SLAB_NODES ) );
+				m_slabUsed = 0;
+			}
+			memory = m_slabs.back() + m_slabUsed++;
+		}
+
+		try
+		{
+			return ::new ( memory ) Node{ { nullptr, nullptr }, std::forward<TKeyArg>( key ), std::move( value ), hash, weight, false };
+		}
+		catch ( ... )
+		{
+			m_free = ::new ( memory ) FreeNode{ m_free };
+			throw;
+		}
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline void ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::NodePool::destroy( Node* node ) noexcept
+	{
+		std::destroy_at( node );
+		m_free = ::new ( static_cast<void*>( node ) ) FreeNode{ m_free };
+	}
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::ShardedCache( size_type capacity, size_type shardCount )
+		: m_capacity{ capacity }
+	{
+		using HashType = decltype( m_hasher( std::declval<const TKey&>() ) );
+
+		if ( shardCount == 0 )
+		{
+			// Small caches get fewer shards rather than shards too small to hold a useful working set
+			const size_type threads = std::thread::hardware_concurrency();
+			shardCount = std::min( 4 * ( threads == 0 ? size_type{ 1 } : threads ), std::max( capacity / MIN_AUTO_SHARD_WEIGHT, size_type{ 1 } ) );
+		}
+		m_shardCount = std::bit_ceil( shardCount );
+		if ( m_shardCount > capacity )
+		{
+			// Every shard must be able to hold at least one unit of weight
+			m_shardCount = capacity == 0 ? 1 : std::bit_floor( capacity );
+		}
+		m_shards = std::make_unique<Shard[]>( m_shardCount );
+		m_shardShift = static_cast<int>( sizeof( HashType ) * 8 ) - std::countr_zero( m_shardCount );
+
+		// The remainder goes one unit each to the first shards, so the budgets add up to capacity
+		for ( size_type i = 0; i < m_shardCount; ++i )
+		{
+			m_shards[i].capacity = capacity / m_shardCount + ( i < capacity % m_shardCount ? 1 : 0 );
+		}
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::~ShardedCache()
+	{
+		clear();
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline std::optional<TValue> ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::get( const TKey& key )
+	{
+		return getFrom( key, hashOf( key ) );
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	template <typename TLookup>
+		requires TransparentLookup<THasher, TKeyEqual>
+	inline std::optional<TValue> ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::get( const TLookup& key )
+	{
+		return getFrom( key, hashOf( key ) );
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline bool ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::contains( const TKey& key ) const
+	{
+		const uint64_t hash = hashOf( key );
+		const Shard& shard = shardFor( hash );
+		std::shared_lock lock{ shard.mutex };
+
+		return shard.index.contains( key, hash );
+	}
+
+	//----------------------------------------------
+	// Modifiers
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline bool ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::put( const TKey& key, TValue value, size_type weight )
+	{
+		const uint64_t hash = hashOf( key );
+		Shard& shard = shardFor( hash );
+		std::unique_lock lock{ shard.mutex };
+
+		if ( weight > shard.capacity )
+		{
+			if ( const auto it = shard.index.find( key, hash ); it != shard.index.end() )
+			{
+				removeNode( shard, it->first );
+			}
+
+			return false;
+		}
+
+		if ( const auto it = shard.index.find( key, hash ); it != shard.index.end() )
+		{
+			Node* node = it->first;
+			node->value = std::move( value );
+			shard.weight = shard.weight - node->weight + weight;
+			node->weight = weight;
+			unlink( node );
+			pushFront( shard, node );
+		}
+		else
+		{
+			Node* node = shard.pool.create( key, std::move( value ), hash, weight );
+			try
+			{
+				// NodeHash reads the hash stored in the node
+				shard.index.try_emplace( node );
+			}
+			catch ( ... )
+			{
+				shard.pool.destroy( node );
+				throw;
+			}
+			pushFront( shard, node );
+			shard.weight += weight;
+		}
+
+		while ( shard.weight > shard.capacity )
+		{
+			evictOne( shard );
+		}
+
+		return true;
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline bool ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::erase( const TKey& key )
+	{
+		const uint64_t hash = hashOf( key );
+		Shard& shard = shardFor( hash );
+		std::unique_lock lock{ shard.mutex };
+
+		const auto it = shard.index.find( key, hash );
+		if ( it == shard.index.end() )
+		{
+			return false;
+		}
+		removeNode( shard, it->first );
+
+		return true;
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline void ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::clear()
+	{
+		for ( size_type i = 0; i < m_shardCount; ++i )
+		{
+			Shard& shard = m_shards[i];
+			std::unique_lock lock{ shard.mutex };
+			for ( Link* link = shard.head.next; link != &shard.head; )
+			{
+				Link* next = link->next;
+				shard.pool.destroy( static_cast<Node*>( link ) );
+				link = next;
+			}
+			shard.head.prev = shard.head.next = &shard.head;
+			shard.index.clear();
+			shard.weight = 0;
+		}
+	}
+
+	//----------------------------------------------
+	// Statistics
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline typename ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::size_type ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::size() const
+	{
+		size_type total = 0;
+		for ( size_type i = 0; i < m_shardCount; ++i )
+		{
+			std::shared_lock lock{ m_shards[i].mutex };
+			total += m_shards[i].index.size();
+		}
+
+		return total;
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline typename ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::size_type ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::weight() const
+	{
+		size_type total = 0;
+		for ( size_type i = 0; i < m_shardCount; ++i )
+		{
+			std::shared_lock lock{ m_shards[i].mutex };
+			total += m_shards[i].weight;
+		}
+
+		return total;
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline typename ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::size_type ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline typename ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::size_type ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::shardCount() const noexcept
+	{
+		return m_shardCount;
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline uint64_t ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::evictions() const noexcept
+	{
+		return m_evictions.load( std::memory_order_relaxed );
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	template <typename TLookup>
+	inline uint64_t ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::hashOf( const TLookup& key ) const
+	{
+		return static_cast<uint64_t>( m_hasher( key ) );
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline typename ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::Shard& ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::shardFor( uint64_t hash ) const noexcept
+	{
+		if ( m_shardCount == 1 )
+		{
+			return m_shards[0];
+		}
+
+		return m_shards[static_cast<size_type>( hash >> m_shardShift )];
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	template <typename TLookup>
+	inline std::optional<TValue> ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::getFrom( const TLookup& key, uint64_t hash )
+	{
+		Shard& shard = shardFor( hash );
+
+		if constexpr ( Policy == EvictionPolicy::Clock )
+		{
+			std::shared_lock lock{ shard.mutex };
+
+			const auto it = shard.index.find( key, hash );
+			if ( it == shard.index.end() )
+			{
+				return std::nullopt;
+			}
+
+			// Test before setting so hot entries do not keep dirtying a shared cache line
+			Node* node = it->first;
+			if ( !node->referenced.load( std::memory_order_relaxed ) )
+			{
+				node->referenced.store( true, std::memory_order_relaxed );
+			}
+
+			return node->value;
+		}
+		else
+		{
+			std::unique_lock lock{ shard.mutex };
+
+			const auto it = shard.index.find( key, hash );
+			if ( it == shard.index.end() )
+			{
+				return std::nullopt;
+			}
+
+			Node* node = it->first;
+			unlink( node );
+			pushFront( shard, node );
+
+			return node->value;
+		}
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline void ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::unlink( Link* node ) noexcept
+	{
+		node->prev->next = node->next;
+		node->next->prev = node->prev;
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline void ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::pushFront( Shard& shard, Link* node ) noexcept
+	{
+		node->prev = &shard.head;
+		node->next = shard.head.next;
+		shard.head.next->prev = node;
+		shard.head.next = node;
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline void ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::evictOne( Shard& shard )
+	{
+		Node* victim = static_cast<Node*>( shard.head.prev );
+		if constexpr ( Policy == EvictionPolicy::Clock )
+		{
+			// Second chance: referenced entries go back to the front with their bit cleared
+			while ( victim->referenced.load( std::memory_order_relaxed ) )
+			{
+				victim->referenced.store( false, std::memory_order_relaxed );
+				unlink( victim );
+				pushFront( shard, victim );
+				victim = static_cast<Node*>( shard.head.prev );
+			}
+		}
+
+		removeNode( shard, victim );
+		m_evictions.fetch_add( 1, std::memory_order_relaxed );
+	}
+
+	template <typename TKey, typename TValue, EvictionPolicy Policy, typename THasher, typename TKeyEqual>
+	inline void ShardedCache<TKey, TValue, Policy, THasher, TKeyEqual>::removeNode( Shard& shard, Node* node )
+	{
+		shard.index.erase( node, node->hash );
+		unlink( node );
+		shard.weight -= node->weight;
+		shard.pool.destroy( node );
+	}
+} // namespace nfx::hashing
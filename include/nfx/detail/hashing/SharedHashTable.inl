@@ -0,0 +1,758 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file SharedHashTable.inl
+ * @brief Implementation of the shared-memory hash table
+ * @details Segment creation and mapping, header validation, seqlock bucket copies and the
+ *          serialized writer paths
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined( _WIN32 )
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	include <windows.h>
+#else
+#	include <cerrno>
+#	include <fcntl.h>
+#	include <signal.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace nfx::hashing
+{
+	namespace internal::sharedtable
+	{
+		//=====================================================================
+		// Format constants
+		//=====================================================================
+
+		inline constexpr uint64_t MAGIC{ 0x31544D485358464EULL }; // "NFXSHMT1"
+		inline constexpr uint64_t VERSION{ 2 };
+
+		/** @brief Failed lock attempts between checks of whether the lock owner is still alive */
+		inline constexpr std::size_t OWNER_CHECK_INTERVAL{ 64 };
+
+		/** @brief Retries a reader spends on a bucket whose sequence stays odd before giving up on it */
+		inline constexpr std::size_t READ_RETRY_LIMIT{ std::size_t{ 1 } << 18 };
+
+		enum HeaderWord : std::size_t
+		{
+			Magic = 0,
+			Version = 1,
+			BucketCount = 2,
+			Sizes = 3,
+			HasherCheck = 4,
+			EntryCount = 5,
+			WriterLock = 6,
+			Tombstones = 7,
+			Epoch = 8
+		};
+
+		static_assert( std::atomic_ref<uint64_t>::is_always_lock_free, "shared-memory words must be lock-free to be shared between processes" );
+
+		/** @brief Atomic view of a word in the shared region */
+		inline std::atomic_ref<uint64_t> word( uint64_t* words, std::size_t index ) noexcept
+		{
+			return std::atomic_ref<uint64_t>{ words[index] };
+		}
+
+		/** @brief Identifier of the calling process, stored in the writer lock word (never 0) */
+		inline uint64_t currentProcess() noexcept
+		{
+#if defined( _WIN32 )
+			return static_cast<uint64_t>( ::GetCurrentProcessId() );
+#else
+			return static_cast<uint64_t>( ::getpid() );
+#endif
+		}
+
+		/** @brief Whether the process @p id has exited; errs towards "alive" when it cannot tell */
+		inline bool processExited( uint64_t id ) noexcept
+		{
+#if defined( _WIN32 )
+			HANDLE process = ::OpenProcess( SYNCHRONIZE, FALSE, static_cast<DWORD>( id ) );
+			if ( process == nullptr )
+			{
+				return ::GetLastError() == ERROR_INVALID_PARAMETER;
+			}
+			const bool exited = ::WaitForSingleObject( process, 0 ) == WAIT_OBJECT_0;
+			::CloseHandle( process );
+
+			return exited;
+#else
+			return ::kill( static_cast<pid_t>( id ), 0 ) == -1 && errno == ESRCH;
+#endif
+		}
+
+#if !defined( _WIN32 )
+		/** @brief Maps @p length bytes of the shared-memory descriptor @p fd read-write */
+		inline uint64_t* mapShared( int fd, std::size_t length )
+		{
+			void* data = ::mmap( nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+			::close( fd );
+
+			return data == MAP_FAILED ? nullptr : static_cast<uint64_t*>( data );
+		}
+#else
+		/** @brief Converts a segment name to the wide string Windows expects */
+		inline std::wstring wideName( const std::string& name )
+		{
+			return std::wstring( name.begin(), name.end() );
+		}
+#endif
+	} // namespace internal::sharedtable
+
+	//=====================================================================
+	// SharedHashTable
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline std::size_t SharedHashTable<TKey, TValue, THasher, TKeyEqual>::requiredBytes( std::size_t capacity ) noexcept
+	{
+		return HEADER_BYTES + std::bit_ceil( std::max<std::size_t>( capacity, 8 ) ) * BUCKET_WORDS * 8;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	SharedHashTable<TKey, TValue, THasher, TKeyEqual> SharedHashTable<TKey, TValue, THasher, TKeyEqual>::initialize( std::span<std::byte> region, std::size_t capacity )
+	{
+		using namespace internal::sharedtable;
+
+		if ( region.size() < requiredBytes( capacity ) || reinterpret_cast<std::uintptr_t>( region.data() ) % 8 != 0 )
+		{
+			throw std::invalid_argument{ "SharedHashTable: region too small or not 8-byte aligned" };
+		}
+
+		const std::size_t bucketCount = std::bit_ceil( std::max<std::size_t>( capacity, 8 ) );
+		auto* words = reinterpret_cast<uint64_t*>( region.data() );
+		std::memset( region.data(), 0, requiredBytes( capacity ) );
+		words[Version] = VERSION | ( uint64_t{ HEADER_BYTES } << 32 );
+		words[BucketCount] = bucketCount;
+		words[Sizes] = sizeof( TKey ) | ( uint64_t{ sizeof( TValue ) } << 32 );
+		words[HasherCheck] = hasherCheck();
+		word( words, Magic ).store( MAGIC, std::memory_order_release );
+
+		return SharedHashTable{ words, region.size(), false };
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	SharedHashTable<TKey, TValue, THasher, TKeyEqual> SharedHashTable<TKey, TValue, THasher, TKeyEqual>::attach( std::span<std::byte> region )
+	{
+		using namespace internal::sharedtable;
+
+		auto* words = reinterpret_cast<uint64_t*>( region.data() );
+		if ( region.size() < HEADER_BYTES || reinterpret_cast<std::uintptr_t>( region.data() ) % 8 != 0 ||
+			 word( words, Magic ).load( std::memory_order_acquire ) != MAGIC )
+		{
+			throw std::runtime_error{ "SharedHashTable: region does not hold an initialized table" };
+		}
+		if ( words[Version] != ( VERSION | ( uint64_t{ HEADER_BYTES } << 32 ) ) ||
+			 words[Sizes] != ( sizeof( TKey ) | ( uint64_t{ sizeof( TValue ) } << 32 ) ) )
+		{
+			throw std::runtime_error{ "SharedHashTable: table was created with a different version or key / value types" };
+		}
+		if ( words[HasherCheck] != hasherCheck() )
+		{
+			throw std::runtime_error{ "SharedHashTable: table was created with a different hasher" };
+		}
+
+		const uint64_t bucketCount = words[BucketCount];
+		if ( !std::has_single_bit( bucketCount ) || region.size() < HEADER_BYTES + bucketCount * BUCKET_WORDS * 8 )
+		{
+			throw std::runtime_error{ "SharedHashTable: region is smaller than its bucket array" };
+		}
+
+		return SharedHashTable{ words, region.size(), false };
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	SharedHashTable<TKey, TValue, THasher, TKeyEqual> SharedHashTable<TKey, TValue, THasher, TKeyEqual>::create( const std::string& name, std::size_t capacity )
+	{
+		const std::size_t length = requiredBytes( capacity );
+#if defined( _WIN32 )
+		HANDLE mapping = ::CreateFileMappingW( INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+			static_cast<DWORD>( static_cast<uint64_t>( length ) >> 32 ), static_cast<DWORD>( length ),
+			internal::sharedtable::wideName( name ).c_str() );
+		if ( mapping == nullptr || ::GetLastError() == ERROR_ALREADY_EXISTS )
+		{
+			if ( mapping != nullptr )
+			{
+				::CloseHandle( mapping );
+			}
+			throw std::runtime_error{ "SharedHashTable: cannot create " + name };
+		}
+
+		// The mapping object lives on while any view of it does
+		void* data = ::MapViewOfFile( mapping, FILE_MAP_ALL_ACCESS, 0, 0, length );
+		::CloseHandle( mapping );
+		auto* words = static_cast<uint64_t*>( data );
+#else
+		const int fd = ::shm_open( name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600 );
+		if ( fd < 0 )
+		{
+			throw std::runtime_error{ "SharedHashTable: cannot create " + name };
+		}
+		if ( ::ftruncate( fd, static_cast<off_t>( length ) ) != 0 )
+		{
+			::close( fd );
+			::shm_unlink( name.c_str() );
+			throw std::runtime_error{ "SharedHashTable: cannot size " + name };
+		}
+		uint64_t* words = internal::sharedtable::mapShared( fd, length );
+#endif
+		if ( words == nullptr )
+		{
+			remove( name );
+			throw std::runtime_error{ "SharedHashTable: cannot map " + name };
+		}
+
+		SharedHashTable table = initialize( { reinterpret_cast<std::byte*>( words ), length }, capacity );
+		table.m_owned = true;
+
+		return table;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	SharedHashTable<TKey, TValue, THasher, TKeyEqual> SharedHashTable<TKey, TValue, THasher, TKeyEqual>::open( const std::string& name )
+	{
+#if defined( _WIN32 )
+		HANDLE mapping = ::OpenFileMappingW( FILE_MAP_ALL_ACCESS, FALSE, internal::sharedtable::wideName( name ).c_str() );
+		if ( mapping == nullptr )
+		{
+			throw std::runtime_error{ "SharedHashTable: cannot open " + name };
+		}
+
+		void* data = ::MapViewOfFile( mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0 );
+		::CloseHandle( mapping );
+		MEMORY_BASIC_INFORMATION info{};
+		if ( data == nullptr || ::VirtualQuery( data, &info, sizeof( info ) ) == 0 )
+		{
+			throw std::runtime_error{ "SharedHashTable: cannot map " + name };
+		}
+		auto* words = static_cast<uint64_t*>( data );
+		const std::size_t length = info.RegionSize;
+#else
+		const int fd = ::shm_open( name.c_str(), O_RDWR, 0 );
+		if ( fd < 0 )
+		{
+			throw std::runtime_error{ "SharedHashTable: cannot open " + name };
+		}
+
+		struct stat status{};
+		if ( ::fstat( fd, &status ) != 0 || status.st_size < static_cast<off_t>( HEADER_BYTES ) )
+		{
+			::close( fd );
+			throw std::runtime_error{ "SharedHashTable: " + name + " is not a table" };
+		}
+		const auto length = static_cast<std::size_t>( status.st_size );
+		uint64_t* words = internal::sharedtable::mapShared( fd, length );
+		if ( words == nullptr )
+		{
+			throw std::runtime_error{ "SharedHashTable: cannot map " + name };
+		}
+#endif
+		// Adopt the mapping first so a failed validation unmaps it
+		SharedHashTable owner{ words, length, true };
+		SharedHashTable table = attach( { reinterpret_cast<std::byte*>( words ), length } );
+		table.m_owned = std::exchange( owner.m_owned, false );
+
+		return table;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	bool SharedHashTable<TKey, TValue, THasher, TKeyEqual>::remove( const std::string& name ) noexcept
+	{
+#if defined( _WIN32 )
+		( void )name;
+
+		return true;
+#else
+		return ::shm_unlink( name.c_str() ) == 0;
+#endif
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	SharedHashTable<TKey, TValue, THasher, TKeyEqual>::SharedHashTable( uint64_t* words, std::size_t length, bool owned ) noexcept
+		: m_words{ words },
+		  m_length{ length },
+		  m_mask{ static_cast<std::size_t>( words[internal::sharedtable::BucketCount] ) - 1 },
+		  m_owned{ owned }
+	{
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	SharedHashTable<TKey, TValue, THasher, TKeyEqual>::SharedHashTable( SharedHashTable&& other ) noexcept
+		: m_words{ std::exchange( other.m_words, nullptr ) },
+		  m_length{ std::exchange( other.m_length, 0 ) },
+		  m_mask{ std::exchange( other.m_mask, 0 ) },
+		  m_owned{ std::exchange( other.m_owned, false ) }
+	{
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	SharedHashTable<TKey, TValue, THasher, TKeyEqual>& SharedHashTable<TKey, TValue, THasher, TKeyEqual>::operator=( SharedHashTable&& other ) noexcept
+	{
+		if ( this != &other )
+		{
+			unmap();
+			m_words = std::exchange( other.m_words, nullptr );
+			m_length = std::exchange( other.m_length, 0 );
+			m_mask = std::exchange( other.m_mask, 0 );
+			m_owned = std::exchange( other.m_owned, false );
+		}
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	SharedHashTable<TKey, TValue, THasher, TKeyEqual>::~SharedHashTable()
+	{
+		unmap();
+	}
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename SharedHashTable<TKey, TValue, THasher, TKeyEqual>::size_type SharedHashTable<TKey, TValue, THasher, TKeyEqual>::size() const noexcept
+	{
+		return static_cast<size_type>( internal::sharedtable::word( m_words, internal::sharedtable::EntryCount ).load( std::memory_order_relaxed ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline bool SharedHashTable<TKey, TValue, THasher, TKeyEqual>::empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline typename SharedHashTable<TKey, TValue, THasher, TKeyEqual>::size_type SharedHashTable<TKey, TValue, THasher, TKeyEqual>::capacity() const noexcept
+	{
+		return m_mask + 1;
+	}
+
+	//----------------------------------------------
+	// Lookup (lock-free)
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline std::optional<TValue> SharedHashTable<TKey, TValue, THasher, TKeyEqual>::find( const TKey& key ) const
+	{
+		using namespace internal::sharedtable;
+
+		const std::size_t home = static_cast<std::size_t>( m_hasher( key ) ) & m_mask;
+		auto epoch = word( m_words, Epoch );
+		for ( std::size_t attempt = 0; attempt < READ_RETRY_LIMIT; ++attempt )
+		{
+			// Compaction moves entries between buckets; a probe that overlapped one is repeated
+			const uint64_t before = epoch.load( std::memory_order_acquire );
+			if ( before & 1 )
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			std::optional<TValue> result;
+			std::size_t index = home;
+			for ( std::size_t probe = 0; probe <= m_mask; ++probe, index = ( index + 1 ) & m_mask )
+			{
+				const std::optional<BucketCopy> copy = readBucket( index );
+				if ( !copy || copy->state == BucketState::Empty )
+				{
+					// A bucket stuck mid-update (its writer died) ends the probe as a miss
+					break;
+				}
+				if ( copy->state == BucketState::Full && m_keyEqual( copy->key, key ) )
+				{
+					result = copy->value;
+					break;
+				}
+			}
+
+			std::atomic_thread_fence( std::memory_order_acquire );
+			if ( epoch.load( std::memory_order_relaxed ) == before )
+			{
+				return result;
+			}
+		}
+
+		return std::nullopt;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline bool SharedHashTable<TKey, TValue, THasher, TKeyEqual>::contains( const TKey& key ) const
+	{
+		return find( key ).has_value();
+	}
+
+	//----------------------------------------------
+	// Modifiers
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline bool SharedHashTable<TKey, TValue, THasher, TKeyEqual>::insert_or_assign( const TKey& key, const TValue& value )
+	{
+		using namespace internal::sharedtable;
+
+		// Hash before locking: a throwing hasher must not leave the shared lock word set
+		std::size_t index = static_cast<std::size_t>( m_hasher( key ) ) & m_mask;
+		const WriterGuard guard{ *this };
+		// Writers are serialized, so plain reads of the buckets are consistent here
+		std::size_t reusable = capacity();
+		for ( std::size_t probe = 0; probe <= m_mask; ++probe, index = ( index + 1 ) & m_mask )
+		{
+			const std::optional<BucketCopy> copy = readBucket( index );
+			if ( !copy )
+			{
+				// Left mid-update by a dead writer: never reuse it
+				continue;
+			}
+			if ( copy->state == BucketState::Full && m_keyEqual( copy->key, key ) )
+			{
+				writeBucket( index, BucketState::Full, nullptr, &value );
+
+				return false;
+			}
+			if ( copy->state == BucketState::Tombstone && reusable == capacity() )
+			{
+				reusable = index;
+			}
+			if ( copy->state == BucketState::Empty )
+			{
+				break;
+			}
+		}
+
+		const std::optional<BucketCopy> last = readBucket( index );
+		const bool haveEmpty = last && last->state == BucketState::Empty;
+		if ( reusable == capacity() && !haveEmpty )
+		{
+			throw std::length_error{ "SharedHashTable: table is full" };
+		}
+		if ( reusable != capacity() )
+		{
+			index = reusable;
+			word( m_words, Tombstones ).fetch_sub( 1, std::memory_order_relaxed );
+		}
+		writeBucket( index, BucketState::Full, &key, &value );
+		word( m_words, EntryCount ).fetch_add( 1, std::memory_order_relaxed );
+		compactIfNeeded();
+
+		return true;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline bool SharedHashTable<TKey, TValue, THasher, TKeyEqual>::erase( const TKey& key )
+	{
+		using namespace internal::sharedtable;
+
+		std::size_t index = static_cast<std::size_t>( m_hasher( key ) ) & m_mask;
+		const WriterGuard guard{ *this };
+		for ( std::size_t probe = 0; probe <= m_mask; ++probe, index = ( index + 1 ) & m_mask )
+		{
+			const std::optional<BucketCopy> copy = readBucket( index );
+			if ( !copy )
+			{
+				continue;
+			}
+			if ( copy->state == BucketState::Empty )
+			{
+				break;
+			}
+			if ( copy->state == BucketState::Full && m_keyEqual( copy->key, key ) )
+			{
+				writeBucket( index, BucketState::Tombstone, nullptr, nullptr );
+				word( m_words, EntryCount ).fetch_sub( 1, std::memory_order_relaxed );
+				word( m_words, Tombstones ).fetch_add( 1, std::memory_order_relaxed );
+				compactIfNeeded();
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline uint64_t SharedHashTable<TKey, TValue, THasher, TKeyEqual>::hasherCheck()
+	{
+		// Hash a fixed, valid key: differs between hashers, seeds and policies. Integer hashes map
+		// zero to zero whatever the seed, so integer keys use a non-zero value instead
+		const TKey key = [] {
+			if constexpr ( std::is_integral_v<TKey> && !std::is_same_v<TKey, bool> )
+			{
+				return static_cast<TKey>( 0x5A );
+			}
+			else
+			{
+				return TKey{};
+			}
+		}();
+
+		return static_cast<uint64_t>( THasher{}( key ) );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline uint64_t* SharedHashTable<TKey, TValue, THasher, TKeyEqual>::bucket( std::size_t index ) const noexcept
+	{
+		return m_words + HEADER_WORDS + index * BUCKET_WORDS;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline std::optional<typename SharedHashTable<TKey, TValue, THasher, TKeyEqual>::BucketCopy> SharedHashTable<TKey, TValue, THasher, TKeyEqual>::readBucket( std::size_t index ) const noexcept
+	{
+		using namespace internal::sharedtable;
+
+		uint64_t* words = bucket( index );
+		uint64_t payload[BUCKET_WORDS - 1];
+		for ( std::size_t attempt = 0;; ++attempt )
+		{
+			if ( attempt == READ_RETRY_LIMIT )
+			{
+				return std::nullopt;
+			}
+			const uint64_t before = word( words, 0 ).load( std::memory_order_acquire );
+			if ( before & 1 )
+			{
+				std::this_thread::yield();
+				continue;
+			}
+			for ( std::size_t i = 1; i < BUCKET_WORDS; ++i )
+			{
+				payload[i - 1] = word( words, i ).load( std::memory_order_relaxed );
+			}
+			std::atomic_thread_fence( std::memory_order_acquire );
+			if ( word( words, 0 ).load( std::memory_order_relaxed ) == before )
+			{
+				break;
+			}
+		}
+
+		BucketCopy copy{ static_cast<BucketState>( payload[0] ), TKey{}, TValue{} };
+		std::memcpy( &copy.key, payload + 1, sizeof( TKey ) );
+		std::memcpy( &copy.value, payload + 1 + KEY_WORDS, sizeof( TValue ) );
+
+		return copy;
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void SharedHashTable<TKey, TValue, THasher, TKeyEqual>::writeBucket( std::size_t index, BucketState state, const TKey* key, const TValue* value ) noexcept
+	{
+		using internal::sharedtable::word;
+
+		uint64_t* words = bucket( index );
+		auto sequence = word( words, 0 );
+		const uint64_t start = sequence.load( std::memory_order_relaxed );
+		sequence.store( start + 1, std::memory_order_relaxed );
+		std::atomic_thread_fence( std::memory_order_release );
+
+		word( words, 1 ).store( static_cast<uint64_t>( state ), std::memory_order_relaxed );
+		const auto storeWords = [&]( std::size_t first, const void* source, std::size_t bytes ) {
+			uint64_t staged[( sizeof( TKey ) > sizeof( TValue ) ? sizeof( TKey ) : sizeof( TValue ) ) / 8 + 1]{};
+			std::memcpy( staged, source, bytes );
+			for ( std::size_t i = 0; i < ( bytes + 7 ) / 8; ++i )
+			{
+				word( words, first + i ).store( staged[i], std::memory_order_relaxed );
+			}
+		};
+		if ( key != nullptr )
+		{
+			storeWords( 2, key, sizeof( TKey ) );
+		}
+		if ( value != nullptr )
+		{
+			storeWords( 2 + KEY_WORDS, value, sizeof( TValue ) );
+		}
+
+		sequence.store( start + 2, std::memory_order_release );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void SharedHashTable<TKey, TValue, THasher, TKeyEqual>::compactIfNeeded() noexcept
+	{
+		using namespace internal::sharedtable;
+
+		// Rebuild once full buckets and tombstones fill 7/8 of the table and tombstones alone exceed
+		// 1/16 of it: misses stay short, and each rebuild is paid for by capacity / 16 erasures
+		const std::size_t tombstones = static_cast<std::size_t>( word( m_words, Tombstones ).load( std::memory_order_relaxed ) );
+		if ( tombstones * 16 < capacity() || ( size() + tombstones ) * 8 < capacity() * 7 )
+		{
+			return;
+		}
+
+		// Collect entries and their hashes first: an allocation failure or a throwing hasher leaves
+		// the table untouched, merely still holding its tombstones
+		std::vector<std::pair<std::size_t, BucketCopy>> live;
+		try
+		{
+			live.reserve( size() );
+			for ( std::size_t index = 0; index <= m_mask; ++index )
+			{
+				const std::optional<BucketCopy> copy = readBucket( index );
+				if ( !copy )
+				{
+					// A bucket left mid-update by a dead writer cannot be moved safely
+					return;
+				}
+				if ( copy->state == BucketState::Full )
+				{
+					live.emplace_back( static_cast<std::size_t>( m_hasher( copy->key ) ) & m_mask, *copy );
+				}
+			}
+		}
+		catch ( ... )
+		{
+			return;
+		}
+
+		// Odd epoch: readers retry any probe that overlaps the rebuild
+		auto epoch = word( m_words, Epoch );
+		const uint64_t start = epoch.load( std::memory_order_relaxed );
+		epoch.store( start + 1, std::memory_order_relaxed );
+		std::atomic_thread_fence( std::memory_order_release );
+
+		for ( std::size_t index = 0; index <= m_mask; ++index )
+		{
+			writeBucket( index, BucketState::Empty, nullptr, nullptr );
+		}
+		for ( const auto& [home, copy] : live )
+		{
+			std::size_t index = home;
+			while ( readBucket( index )->state != BucketState::Empty )
+			{
+				index = ( index + 1 ) & m_mask;
+			}
+			writeBucket( index, BucketState::Full, &copy.key, &copy.value );
+		}
+		word( m_words, Tombstones ).store( 0, std::memory_order_relaxed );
+
+		epoch.store( start + 2, std::memory_order_release );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void SharedHashTable<TKey, TValue, THasher, TKeyEqual>::lockWriters() noexcept
+	{
+		using namespace internal::sharedtable;
+
+		// The lock word holds the owner's process id, so a waiter can take over from a dead owner
+		const uint64_t self = currentProcess();
+		auto lock = word( m_words, WriterLock );
+		for ( std::size_t attempt = 1;; ++attempt )
+		{
+			uint64_t owner = 0;
+			if ( lock.compare_exchange_weak( owner, self, std::memory_order_acquire, std::memory_order_relaxed ) )
+			{
+				return;
+			}
+			if ( owner != 0 && owner != self && attempt % OWNER_CHECK_INTERVAL == 0 && processExited( owner ) &&
+				 lock.compare_exchange_strong( owner, self, std::memory_order_acquire, std::memory_order_relaxed ) )
+			{
+				recoverFromDeadWriter();
+				return;
+			}
+			std::this_thread::yield();
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void SharedHashTable<TKey, TValue, THasher, TKeyEqual>::recoverFromDeadWriter() noexcept
+	{
+		using namespace internal::sharedtable;
+
+		// The dead writer may have stopped inside a bucket: its contents may be torn, so drop it
+		std::size_t entries = 0;
+		std::size_t tombstones = 0;
+		for ( std::size_t index = 0; index <= m_mask; ++index )
+		{
+			uint64_t* words = bucket( index );
+			auto sequence = word( words, 0 );
+			const uint64_t current = sequence.load( std::memory_order_relaxed );
+			if ( current & 1 )
+			{
+				word( words, 1 ).store( static_cast<uint64_t>( BucketState::Tombstone ), std::memory_order_relaxed );
+				sequence.store( current + 1, std::memory_order_release );
+			}
+
+			const auto state = static_cast<BucketState>( word( words, 1 ).load( std::memory_order_relaxed ) );
+			entries += state == BucketState::Full;
+			tombstones += state == BucketState::Tombstone;
+		}
+
+		// ... or between a bucket write and its counter update, or in the middle of a compaction
+		word( m_words, EntryCount ).store( entries, std::memory_order_relaxed );
+		word( m_words, Tombstones ).store( tombstones, std::memory_order_relaxed );
+		auto epoch = word( m_words, Epoch );
+		const uint64_t current = epoch.load( std::memory_order_relaxed );
+		if ( current & 1 )
+		{
+			epoch.store( current + 1, std::memory_order_release );
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void SharedHashTable<TKey, TValue, THasher, TKeyEqual>::unlockWriters() noexcept
+	{
+		internal::sharedtable::word( m_words, internal::sharedtable::WriterLock ).store( 0, std::memory_order_release );
+	}
+
+	template <typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	inline void SharedHashTable<TKey, TValue, THasher, TKeyEqual>::unmap() noexcept
+	{
+		if ( m_words != nullptr && m_owned )
+		{
+#if defined( _WIN32 )
+			::UnmapViewOfFile( m_words );
+#else
+			::munmap( m_words, m_length );
+#endif
+		}
+		m_words = nullptr;
+		m_length = 0;
+		m_owned = false;
+	}
+} // namespace nfx::hashing
@@ -0,0 +1,302 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file StringInterner.inl
+ * @brief Implementation of the StringInterner
+ * @details CAS-published open-addressed index, chunked bump-pointer arena and id table
+ */
+
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#include <immintrin.h>
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// StringInterner
+	//=====================================================================
+
+	/*
+	 * Id assignment happens after the record wins its index slot, so ids stay dense even when two
+	 * threads race to insert the same string: the loser's arena bytes are wasted, not an id.
+	 * m_reserved bounds the number of records that can win a slot, which keeps every id below
+	 * m_capacity and the index at most half full.
+	 *
+	 * The price is that a probe can meet a record whose id is not stored yet; publishedId() spins
+	 * until it is. Reserving the id before the CAS would avoid the wait but leave a gap in the ids
+	 * whenever the CAS loses.
+	 */
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline StringInterner::StringInterner( uint32_t capacity )
+		: m_capacity{ capacity },
+		  m_indexMask{ std::bit_ceil( std::size_t{ capacity } * 2 + 1 ) - 1 },
+		  m_index{ std::make_unique<std::atomic<Record*>[]>( m_indexMask + 1 ) },
+		  m_records{ std::make_unique<std::atomic<const Record*>[]>( capacity == 0 ? 1 : capacity ) },
+		  m_chunks{ std::make_unique<std::atomic<char*>[]>( MAX_CHUNKS ) }
+	{
+	}
+
+	inline StringInterner::~StringInterner()
+	{
+		for ( std::size_t i = 0; i < MAX_CHUNKS; ++i )
+		{
+			delete[] m_chunks[i].load( std::memory_order_relaxed );
+		}
+
+		for ( LargeBlock* block = m_largeBlocks.load( std::memory_order_relaxed ); block != nullptr; )
+		{
+			LargeBlock* next = block->next;
+			::operator delete( block, std::align_val_t{ alignof( Record ) } );
+			block = next;
+		}
+	}
+
+	//----------------------------------------------
+	// Interning
+	//----------------------------------------------
+
+	inline uint32_t StringInterner::intern( std::string_view text )
+	{
+		const uint64_t hash = m_hasher( text );
+		bool inserted = false;
+
+		while ( true )
+		{
+			// Fast path: the string is usually already interned, so probe before building a record
+			if ( const Record* existing = probe( text, hash, nullptr, inserted ) )
+			{
+				return publishedId( existing );
+			}
+
+			if ( m_reserved.fetch_add( 1, std::memory_order_relaxed ) < m_capacity )
+			{
+				break;
+			}
+			m_reserved.fetch_sub( 1, std::memory_order_relaxed );
+
+			// Reservations held by racing inserts of one string are released by all but the winner, so
+			// only a table whose ids are all assigned is really full. Every assigned id belongs to a
+			// record already in the index, which may be this very string inserted since the first probe.
+			if ( m_nextId.load( std::memory_order_acquire ) >= m_capacity )
+			{
+				if ( const Record* existing = probe( text, hash, nullptr, inserted ) )
+				{
+					return publishedId( existing );
+				}
+				throw std::length_error{ "StringInterner::intern: capacity exhausted" };
+			}
+			_mm_pause();
+		}
+
+		Record* candidate;
+		try
+		{
+			candidate = makeRecord( text, hash );
+		}
+		catch ( ... )
+		{
+			// Arena or large-block allocation failed: give the reserved slot back
+			m_reserved.fetch_sub( 1, std::memory_order_relaxed );
+			throw;
+		}
+		const Record* record = probe( text, hash, candidate, inserted );
+		if ( !inserted )
+		{
+			// Another thread interned the same string first; release the reservation
+			m_reserved.fetch_sub( 1, std::memory_order_relaxed );
+
+			return publishedId( record );
+		}
+
+		const uint32_t id = m_nextId.fetch_add( 1, std::memory_order_relaxed );
+		m_records[id].store( candidate, std::memory_order_release );
+		candidate->id.store( id, std::memory_order_release );
+
+		return id;
+	}
+
+	inline uint32_t StringInterner::find( std::string_view text ) const noexcept
+	{
+		const uint64_t hash = m_hasher( text );
+		for ( std::size_t slot = hash & m_indexMask;; slot = ( slot + 1 ) & m_indexMask )
+		{
+			const Record* record = m_index[slot].load( std::memory_order_acquire );
+			if ( record == nullptr )
+			{
+				return INVALID_ID;
+			}
+			if ( matches( record, text, hash ) )
+			{
+				return publishedId( record );
+			}
+		}
+	}
+
+	inline std::string_view StringInterner::view( uint32_t id ) const noexcept
+	{
+		assert( id < size() && "StringInterner::view: id was not returned by intern() or find()" );
+		const Record* record = m_records[id].load( std::memory_order_acquire );
+
+		return { record->data(), record->length };
+	}
+
+	//----------------------------------------------
+	// Statistics
+	//----------------------------------------------
+
+	inline uint32_t StringInterner::size() const noexcept
+	{
+		return m_nextId.load( std::memory_order_acquire );
+	}
+
+	inline uint32_t StringInterner::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	inline std::size_t StringInterner::arenaBytes() const noexcept
+	{
+		return m_arenaOffset.load( std::memory_order_relaxed ) + m_largeBytes.load( std::memory_order_relaxed );
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	inline const StringInterner::Record* StringInterner::probe( std::string_view text, uint64_t hash, Record* candidate, bool& inserted ) noexcept
+	{
+		for ( std::size_t slot = hash & m_indexMask;; slot = ( slot + 1 ) & m_indexMask )
+		{
+			Record* record = m_index[slot].load( std::memory_order_acquire );
+			if ( record == nullptr )
+			{
+				if ( candidate == nullptr )
+				{
+					return nullptr;
+				}
+
+				// On failure record receives the winner, which is compared below like any other entry
+				if ( m_index[slot].compare_exchange_strong( record, candidate, std::memory_order_acq_rel, std::memory_order_acquire ) )
+				{
+					inserted = true;
+
+					return candidate;
+				}
+			}
+			if ( matches( record, text, hash ) )
+			{
+				return record;
+			}
+		}
+	}
+
+	inline StringInterner::Record* StringInterner::makeRecord( std::string_view text, uint64_t hash )
+	{
+		void* memory = allocate( sizeof( Record ) + text.size() );
+		auto* record = ::new ( memory ) Record{ hash, INVALID_ID, static_cast<uint32_t>( text.size() ) };
+		if ( !text.empty() )
+		{
+			std::memcpy( reinterpret_cast<char*>( record + 1 ), text.data(), text.size() );
+		}
+
+		return record;
+	}
+
+	inline void* StringInterner::allocate( std::size_t bytes )
+	{
+		const std::size_t size = ( bytes + alignof( Record ) - 1 ) & ~( alignof( Record ) - 1 );
+
+		if ( size > ARENA_CHUNK_SIZE / 4 )
+		{
+			// Large strings would waste most of a chunk; give them their own block on a lock-free list
+			void* memory = ::operator new( sizeof( LargeBlock ) + size, std::align_val_t{ alignof( Record ) } );
+			auto* block = ::new ( memory ) LargeBlock{ m_largeBlocks.load( std::memory_order_relaxed ) };
+			while ( !m_largeBlocks.compare_exchange_weak( block->next, block, std::memory_order_release, std::memory_order_relaxed ) )
+			{
+			}
+			m_largeBytes.fetch_add( size, std::memory_order_relaxed );
+
+			return block + 1;
+		}
+
+		while ( true )
+		{
+			const std::size_t offset = m_arenaOffset.fetch_add( size, std::memory_order_relaxed );
+			const std::size_t chunk = offset / ARENA_CHUNK_SIZE;
+			const std::size_t within = offset % ARENA_CHUNK_SIZE;
+			if ( chunk >= MAX_CHUNKS )
+			{
+				throw std::length_error{ "StringInterner::intern: arena exhausted" };
+			}
+			if ( within + size > ARENA_CHUNK_SIZE )
+			{
+				// Straddles a chunk boundary: abandon the tail and bump again into the next chunk
+				continue;
+			}
+
+			char* base = m_chunks[chunk].load( std::memory_order_acquire );
+			if ( base == nullptr )
+			{
+				char* fresh = new char[ARENA_CHUNK_SIZE];
+				if ( m_chunks[chunk].compare_exchange_strong( base, fresh, std::memory_order_acq_rel, std::memory_order_acquire ) )
+				{
+					base = fresh;
+				}
+				else
+				{
+					delete[] fresh;
+				}
+			}
+
+			return base + within;
+		}
+	}
+
+	inline bool StringInterner::matches( const Record* record, std::string_view text, uint64_t hash ) noexcept
+	{
+		return record->hash == hash && record->length == text.size() &&
+			   ( text.empty() || std::memcmp( record->data(), text.data(), text.size() ) == 0 );
+	}
+
+	inline uint32_t StringInterner::publishedId( const Record* record ) noexcept
+	{
+		uint32_t id = record->id.load( std::memory_order_acquire );
+		while ( id == INVALID_ID )
+		{
+			_mm_pause();
+			id = record->id.load( std::memory_order_acquire );
+		}
+
+		return id;
+	}
+} // namespace nfx::hashing
@@ -26,18 +26,44 @@
  * @file Algorithms.h
  * @brief Low-level hash algorithm primitives and mixing functions
  * @details Provides core hash building blocks including Larson, FNV-1a, CRC32-C,
- *          seed mixing, and hash combination operations for use across hash implementations
+ *          CRC-32 (IEEE) and CRC-64 (XZ / NVMe) checksums, FarmHash/CityHash fingerprints, seed mixing, and hash combination operations
+ *          for use across hash implementations
  */
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <string_view>
 
 #include "Concepts.h"
 #include "Constants.h"
 
 namespace nfx::hashing
 {
+	//=====================================================================
+	// Hash value types
+	//=====================================================================
+
+	/**
+	 * @brief 128-bit hash value split into two 64-bit halves
+	 * @details Layout matches CityHash's `uint128` (first = low 64 bits, second = high 64 bits).
+	 */
+	struct Hash128 final
+	{
+		/** @brief Low 64 bits of the hash value. */
+		uint64_t low;
+
+		/** @brief High 64 bits of the hash value. */
+		uint64_t high;
+
+		/**
+		 * @brief Compares two 128-bit hash values for equality
+		 * @return true if both halves are equal
+		 */
+		[[nodiscard]] friend constexpr bool operator==( const Hash128&, const Hash128& ) noexcept = default;
+	};
+
 	//=====================================================================
 	// Low - level hash building blocks
 	//=====================================================================
@@ -97,7 +123,7 @@ namespace nfx::hashing
 	 * @param[in] hash The current hash value.
 	 * @param[in] ch The character (byte) to incorporate into the hash.
 	 * @return The updated hash value.
-	 * @details Pure software implementation using reflected polynomial (0x82F63B78).
+	 * @details Pure software implementation using reflected polynomial constants::CRC32C_POLYNOMIAL.
 	 *          Produces identical results to SSE4.2 hardware instructions.
 	 *          Useful for testing, benchmarking, or when hardware acceleration is unavailable.
 	 * @see https://en.wikipedia.org/wiki/Cyclic_redundancy_check
@@ -105,6 +131,402 @@ namespace nfx::hashing
 	 */
 	[[nodiscard]] inline constexpr uint32_t crc32cSoft( uint32_t hash, uint8_t ch ) noexcept;
 
+	/**
+	 * @brief Computes the CRC32-C of a buffer with runtime hardware acceleration
+	 * @param[in] hash The current CRC register value.
+	 * @param[in] data Bytes to incorporate.
+	 * @param[in] length Number of bytes.
+	 * @return The updated CRC register value, identical to feeding each byte to crc32c().
+	 * @details Buffers of 256 bytes or more are folded with VPCLMULQDQ when available; otherwise
+	 *          the SSE4.2 CRC32 instruction consumes 8 bytes per step, falling back to
+	 *          crc32cSoft() on CPUs without SSE4.2.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint32_t crc32c( uint32_t hash, const std::byte* data, std::size_t length ) noexcept;
+
+	/**
+	 * @brief Software implementation of CRC32-C over a buffer
+	 * @param[in] hash The current CRC register value.
+	 * @param[in] data Bytes to incorporate.
+	 * @param[in] length Number of bytes.
+	 * @return The updated CRC register value.
+	 * @details Slicing-by-16 using compile-time generated tables.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint32_t crc32cSoft( uint32_t hash, const std::byte* data, std::size_t length ) noexcept;
+
+	/**
+	 * @brief Computes the CRC32-C of consecutive fixed-size blocks
+	 * @param[in] base Start of the first block; block i starts at `base + i * blockSize`
+	 * @param[in] blockSize Size of every block in bytes
+	 * @param[in] count Number of blocks
+	 * @param[out] out Receives `count` finalized checksums, `out[i] == ~crc32c( 0xFFFFFFFF, block i, blockSize )`
+	 * @details Processes four blocks in interleaved lanes so the latency of the SSE4.2 CRC32
+	 *          instruction is hidden behind independent work. Blocks of 256 bytes or more are
+	 *          folded with VPCLMULQDQ instead when available, which is faster still. Falls back
+	 *          to crc32c() per block on CPUs without SSE4.2.
+	 */
+	inline void crc32cBlocks( const std::byte* base, std::size_t blockSize, std::size_t count, uint32_t* out ) noexcept;
+
+	/**
+	 * @brief Masks a CRC32-C for storage next to the data it covers (LevelDB / RocksDB / Snappy framing)
+	 * @param[in] crc Finalized CRC32-C
+	 * @return Masked checksum
+	 * @details Computing the CRC of a string that contains embedded CRCs is problematic, so
+	 *          stored checksums are rotated and offset by constants::CRC32C_MASK_DELTA.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr uint32_t crc32cMask( uint32_t crc ) noexcept;
+
+	/**
+	 * @brief Recovers the CRC32-C from a value produced by crc32cMask()
+	 * @param[in] maskedCrc Masked checksum
+	 * @return Finalized CRC32-C
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr uint32_t crc32cUnmask( uint32_t maskedCrc ) noexcept;
+
+	//----------------------------------------------
+	// CRC-32 (IEEE 802.3 / zlib) checksums
+	//----------------------------------------------
+
+	/**
+	 * @brief Computes one step of the CRC-32 (IEEE 802.3) checksum
+	 * @param[in] hash The current CRC register value.
+	 * @param[in] ch The byte to incorporate.
+	 * @return The updated CRC register value.
+	 * @details Operates on the raw register like crc32c(): start from
+	 *          constants::CRC32_IEEE_INIT and complement the final value to obtain the
+	 *          zlib / PNG / Ethernet checksum.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint32_t crc32Ieee( uint32_t hash, uint8_t ch ) noexcept;
+
+	/**
+	 * @brief Computes the CRC-32 (IEEE 802.3) of a buffer with runtime hardware acceleration
+	 * @param[in] hash The current CRC register value.
+	 * @param[in] data Bytes to incorporate.
+	 * @param[in] length Number of bytes.
+	 * @return The updated CRC register value.
+	 * @details Buffers of 256 bytes or more are folded with VPCLMULQDQ (AVX2) when available,
+	 *          buffers of 64 bytes or more with PCLMULQDQ; everything else, and CPUs without
+	 *          carry-less multiply, uses crc32IeeeSoft(). All paths produce identical results.
+	 *          No compiler flags are required: the SIMD kernels are compiled per function and
+	 *          selected at runtime, unless the target already guarantees the instructions.
+	 * @see https://www.intel.com/content/dam/www/public/us/en/documents/white-papers/fast-crc-computation-generic-polynomials-pclmulqdq-paper.pdf
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint32_t crc32Ieee( uint32_t hash, const std::byte* data, std::size_t length ) noexcept;
+
+	/**
+	 * @brief Software implementation of one CRC-32 (IEEE 802.3) step
+	 * @param[in] hash The current CRC register value.
+	 * @param[in] ch The byte to incorporate.
+	 * @return The updated CRC register value.
+	 * @details Table-driven, reflected polynomial (0xEDB88320). Usable in constant expressions.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr uint32_t crc32IeeeSoft( uint32_t hash, uint8_t ch ) noexcept;
+
+	/**
+	 * @brief Software implementation of CRC-32 (IEEE 802.3) over a buffer
+	 * @param[in] hash The current CRC register value.
+	 * @param[in] data Bytes to incorporate.
+	 * @param[in] length Number of bytes.
+	 * @return The updated CRC register value.
+	 * @details Slicing-by-16: sixteen independent table lookups per 16-byte block.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint32_t crc32IeeeSoft( uint32_t hash, const std::byte* data, std::size_t length ) noexcept;
+
+	/**
+	 * @brief Combines the CRC-32 (IEEE 802.3) checksums of two adjacent buffers
+	 * @param[in] crc1 Finalized checksum of the first buffer.
+	 * @param[in] crc2 Finalized checksum of the second buffer.
+	 * @param[in] length2 Length in bytes of the second buffer.
+	 * @return Finalized checksum of the concatenation, equal to zlib's `crc32_combine()`.
+	 * @details Runs in O(log length2) using precomputed powers of x modulo the polynomial,
+	 *          so checksums of independently processed chunks can be merged.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr uint32_t crc32IeeeCombine( uint32_t crc1, uint32_t crc2, uint64_t length2 ) noexcept;
+
+	/**
+	 * @brief Incremental CRC-32 (IEEE 802.3) computation
+	 * @details Accumulates arbitrarily split input and yields the finalized (zlib-compatible)
+	 *          checksum. Each update() dispatches to the fastest available kernel.
+	 */
+	class Crc32IeeeState final
+	{
+	public:
+		/**
+		 * @brief Incorporates a buffer into the checksum
+		 * @param[in] data Bytes to incorporate.
+		 * @param[in] length Number of bytes.
+		 */
+		inline void update( const std::byte* data, std::size_t length ) noexcept;
+
+		/**
+		 * @brief Incorporates the bytes of a string into the checksum
+		 * @param[in] data Bytes to incorporate.
+		 */
+		inline void update( std::string_view data ) noexcept;
+
+		/**
+		 * @brief Returns the finalized checksum of all bytes seen so far
+		 * @return CRC-32 value, identical to zlib's `crc32()`
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline uint32_t value() const noexcept;
+
+		/** @brief Restarts the computation as if no bytes had been seen. */
+		inline void reset() noexcept;
+
+	private:
+		uint32_t m_crc{ constants::CRC32_IEEE_INIT };
+	};
+
+	//----------------------------------------------
+	// CRC-64/XZ (ECMA-182) checksums
+	//----------------------------------------------
+
+	/**
+	 * @brief Computes one step of the CRC-64/XZ (ECMA-182) checksum
+	 * @param[in] hash The current CRC register value.
+	 * @param[in] ch The byte to incorporate.
+	 * @return The updated CRC register value.
+	 * @details Raw register like crc32Ieee(): start from constants::CRC64_INIT and complement
+	 *          the final value. The check value of "123456789" is 0x995DC9BBDF1939FA.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint64_t crc64Xz( uint64_t hash, uint8_t ch ) noexcept;
+
+	/**
+	 * @brief Computes the CRC-64/XZ (ECMA-182) of a buffer with runtime hardware acceleration
+	 * @param[in] hash The current CRC register value.
+	 * @param[in] data Bytes to incorporate.
+	 * @param[in] length Number of bytes.
+	 * @return The updated CRC register value.
+	 * @details Uses the same VPCLMULQDQ / PCLMULQDQ / slicing-by-16 dispatch as crc32Ieee().
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint64_t crc64Xz( uint64_t hash, const std::byte* data, std::size_t length ) noexcept;
+
+	/**
+	 * @brief Software implementation of one CRC-64/XZ (ECMA-182) step
+	 * @param[in] hash The current CRC register value.
+	 * @param[in] ch The byte to incorporate.
+	 * @return The updated CRC register value.
+	 * @details Table-driven, reflected polynomial (0xC96C5795D7870F42). Usable in constant expressions.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr uint64_t crc64XzSoft( uint64_t hash, uint8_t ch ) noexcept;
+
+	/**
+	 * @brief Software implementation of CRC-64/XZ (ECMA-182) over a buffer
+	 * @param[in] hash The current CRC register value.
+	 * @param[in] data Bytes to incorporate.
+	 * @param[in] length Number of bytes.
+	 * @return The updated CRC register value.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint64_t crc64XzSoft( uint64_t hash, const std::byte* data, std::size_t length ) noexcept;
+
+	/**
+	 * @brief Combines the CRC-64/XZ (ECMA-182) checksums of two adjacent buffers
+	 * @param[in] crc1 Finalized checksum of the first buffer.
+	 * @param[in] crc2 Finalized checksum of the second buffer.
+	 * @param[in] length2 Length in bytes of the second buffer.
+	 * @return Finalized checksum of the concatenation, equal to liblzma's chained `lzma_crc64()`.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr uint64_t crc64XzCombine( uint64_t crc1, uint64_t crc2, uint64_t length2 ) noexcept;
+
+	/**
+	 * @brief Incremental CRC-64/XZ (ECMA-182) computation
+	 * @details Accumulates arbitrarily split input and yields the finalized checksum.
+	 */
+	class Crc64XzState final
+	{
+	public:
+		/**
+		 * @brief Incorporates a buffer into the checksum
+		 * @param[in] data Bytes to incorporate.
+		 * @param[in] length Number of bytes.
+		 */
+		inline void update( const std::byte* data, std::size_t length ) noexcept;
+
+		/**
+		 * @brief Incorporates the bytes of a string into the checksum
+		 * @param[in] data Bytes to incorporate.
+		 */
+		inline void update( std::string_view data ) noexcept;
+
+		/**
+		 * @brief Returns the finalized checksum of all bytes seen so far
+		 * @return CRC-64/XZ (ECMA-182) value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline uint64_t value() const noexcept;
+
+		/** @brief Restarts the computation as if no bytes had been seen. */
+		inline void reset() noexcept;
+
+	private:
+		uint64_t m_crc{ constants::CRC64_INIT };
+	};
+
+	//----------------------------------------------
+	// CRC-64/NVME checksums
+	//----------------------------------------------
+
+	/**
+	 * @brief Computes one step of the CRC-64/NVME checksum
+	 * @param[in] hash The current CRC register value.
+	 * @param[in] ch The byte to incorporate.
+	 * @return The updated CRC register value.
+	 * @details Raw register like crc32Ieee(): start from constants::CRC64_INIT and complement
+	 *          the final value. The check value of "123456789" is 0xAE8B14860A799888.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint64_t crc64Nvme( uint64_t hash, uint8_t ch ) noexcept;
+
+	/**
+	 * @brief Computes the CRC-64/NVME of a buffer with runtime hardware acceleration
+	 * @param[in] hash The current CRC register value.
+	 * @param[in] data Bytes to incorporate.
+	 * @param[in] length Number of bytes.
+	 * @return The updated CRC register value.
+	 * @details Uses the same VPCLMULQDQ / PCLMULQDQ / slicing-by-16 dispatch as crc32Ieee().
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint64_t crc64Nvme( uint64_t hash, const std::byte* data, std::size_t length ) noexcept;
+
+	/**
+	 * @brief Software implementation of one CRC-64/NVME step
+	 * @param[in] hash The current CRC register value.
+	 * @param[in] ch The byte to incorporate.
+	 * @return The updated CRC register value.
+	 * @details Table-driven, reflected polynomial (0x9A6C9329AC4BC9B5). Usable in constant expressions.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr uint64_t crc64NvmeSoft( uint64_t hash, uint8_t ch ) noexcept;
+
+	/**
+	 * @brief Software implementation of CRC-64/NVME over a buffer
+	 * @param[in] hash The current CRC register value.
+	 * @param[in] data Bytes to incorporate.
+	 * @param[in] length Number of bytes.
+	 * @return The updated CRC register value.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint64_t crc64NvmeSoft( uint64_t hash, const std::byte* data, std::size_t length ) noexcept;
+
+	/**
+	 * @brief Combines the CRC-64/NVME checksums of two adjacent buffers
+	 * @param[in] crc1 Finalized checksum of the first buffer.
+	 * @param[in] crc2 Finalized checksum of the second buffer.
+	 * @param[in] length2 Length in bytes of the second buffer.
+	 * @return Finalized checksum of the concatenation.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr uint64_t crc64NvmeCombine( uint64_t crc1, uint64_t crc2, uint64_t length2 ) noexcept;
+
+	/**
+	 * @brief Incremental CRC-64/NVME computation
+	 * @details Accumulates arbitrarily split input and yields the finalized checksum.
+	 */
+	class Crc64NvmeState final
+	{
+	public:
+		/**
+		 * @brief Incorporates a buffer into the checksum
+		 * @param[in] data Bytes to incorporate.
+		 * @param[in] length Number of bytes.
+		 */
+		inline void update( const std::byte* data, std::size_t length ) noexcept;
+
+		/**
+		 * @brief Incorporates the bytes of a string into the checksum
+		 * @param[in] data Bytes to incorporate.
+		 */
+		inline void update( std::string_view data ) noexcept;
+
+		/**
+		 * @brief Returns the finalized checksum of all bytes seen so far
+		 * @return CRC-64/NVME value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline uint64_t value() const noexcept;
+
+		/** @brief Restarts the computation as if no bytes had been seen. */
+		inline void reset() noexcept;
+
+	private:
+		uint64_t m_crc{ constants::CRC64_INIT };
+	};
+
+	//----------------------------------------------
+	// Whole-buffer fingerprints
+	//----------------------------------------------
+
+	/**
+	 * @brief Computes the FarmHash 64-bit fingerprint of a byte sequence
+	 * @param[in] data Bytes to fingerprint
+	 * @return 64-bit fingerprint, bit-exact with `util::Fingerprint64()` from Google FarmHash
+	 * @details Implements `farmhashna::Hash64`, the portable variant FarmHash guarantees to be stable
+	 *          across platforms and releases. This is the function behind BigQuery's `FARM_FINGERPRINT`
+	 *          (which reinterprets the result as a signed INT64) and Guava's `farmHashFingerprint64()`.
+	 * @see https://github.com/google/farmhash
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint64_t farmFingerprint64( std::string_view data ) noexcept;
+
+	/**
+	 * @brief Computes the seeded FarmHash 64-bit hash of a byte sequence
+	 * @param[in] data Bytes to hash
+	 * @param[in] seed Seed mixed into the fingerprint
+	 * @return 64-bit hash, bit-exact with `farmhashna::Hash64WithSeed()`
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint64_t farmHash64WithSeed( std::string_view data, uint64_t seed ) noexcept;
+
+	/**
+	 * @brief Computes the CityHash64 (v1.1) hash of a byte sequence
+	 * @param[in] data Bytes to hash
+	 * @return 64-bit hash, bit-exact with `CityHash64()` from Google CityHash 1.1
+	 * @see https://github.com/google/cityhash
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint64_t cityHash64( std::string_view data ) noexcept;
+
+	/**
+	 * @brief Computes the seeded CityHash64 (v1.1) hash of a byte sequence
+	 * @param[in] data Bytes to hash
+	 * @param[in] seed Seed mixed into the hash
+	 * @return 64-bit hash, bit-exact with `CityHash64WithSeed()` from Google CityHash 1.1
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint64_t cityHash64( std::string_view data, uint64_t seed ) noexcept;
+
+	/**
+	 * @brief Computes the CityHash128 (v1.1) hash of a byte sequence
+	 * @param[in] data Bytes to hash
+	 * @return 128-bit hash, bit-exact with `CityHash128()` from Google CityHash 1.1
+	 *         and `util::Fingerprint128()` from Google FarmHash
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline Hash128 cityHash128( std::string_view data ) noexcept;
+
+	/**
+	 * @brief Computes the seeded CityHash128 (v1.1) hash of a byte sequence
+	 * @param[in] data Bytes to hash
+	 * @param[in] seed 128-bit seed mixed into the hash
+	 * @return 128-bit hash, bit-exact with `CityHash128WithSeed()` from Google CityHash 1.1
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline Hash128 cityHash128( std::string_view data, Hash128 seed ) noexcept;
+
 	//----------------------------------------------
 	// Seed and bit mixing
 	//----------------------------------------------
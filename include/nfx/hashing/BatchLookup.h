@@ -0,0 +1,97 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BatchLookup.h
+ * @brief Batched hash-and-prefetch lookup pipeline for open-addressing tables
+ * @details Declares batchLookup(), which hashes a run of keys with a Hasher, maps them to bucket
+ *          indexes with seedMix, prefetches each bucket a fixed distance ahead and then invokes the
+ *          caller's probe, so that cache misses of consecutive keys overlap instead of serializing
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+
+#include "Constants.h"
+#include "Hasher.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// Batched lookup
+	//=====================================================================
+
+	/**
+	 * @brief Maps a key to its bucket in a power-of-two table the same way batchLookup() does
+	 * @tparam THasher Hash functor producing uint32_t or uint64_t
+	 * @tparam TKey Key type accepted by @p hasher
+	 * @param[in] hasher Hash functor
+	 * @param[in] key Key to place
+	 * @param[in] bucketCount Number of buckets - must be a power of 2
+	 * @param[in] seed Per-table seed mixed into the hash
+	 * @return Bucket index in [0, bucketCount - 1]
+	 * @details Tables filled through this function can be probed with batchLookup() using the same
+	 *          hasher, bucket count and seed.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <typename THasher, typename TKey>
+	[[nodiscard]] inline uint64_t bucketIndex( const THasher& hasher, const TKey& key, uint64_t bucketCount, uint64_t seed = 0 ) noexcept;
+
+	/**
+	 * @brief Probes a table for a run of keys with software prefetching (group prefetching / AMAC)
+	 * @tparam Distance Number of keys whose buckets are prefetched ahead of the probe
+	 * @tparam THasher Hash functor producing uint32_t or uint64_t
+	 * @tparam TKeys Contiguous range of keys (std::vector, std::span, std::array, ...)
+	 * @tparam TBucketAddress Callable `( uint64_t bucket ) -> const void*` returning the address to prefetch
+	 * @tparam TProbe Callable `( std::size_t position, const Key& key, uint64_t bucket )`
+	 * @param[in] keys Keys to look up
+	 * @param[in] bucketCount Number of buckets - must be a power of 2
+	 * @param[in] bucketAddress Returns the memory the probe will touch first for a bucket
+	 * @param[in] probe Called once per key, in input order, with its position and home bucket
+	 * @param[in] seed Per-table seed mixed into every hash
+	 * @param[in] hasher Hash functor instance
+	 * @details For key i the pipeline computes the bucket of key i + Distance and prefetches it before
+	 *          probing key i, so up to Distance misses are in flight at once. The probe itself is free
+	 *          to walk further slots (linear probing, chaining, group matching); only its first cache
+	 *          line is prefetched. Tables that fit in cache gain little, tables larger than the last
+	 *          level cache gain the most.
+	 */
+	template <std::size_t Distance = constants::BATCH_PREFETCH_DISTANCE,
+		typename THasher = Hasher<uint64_t>,
+		std::ranges::contiguous_range TKeys,
+		typename TBucketAddress,
+		typename TProbe>
+		requires( Distance > 0 )
+	inline void batchLookup( const TKeys& keys,
+		uint64_t bucketCount,
+		TBucketAddress&& bucketAddress,
+		TProbe&& probe,
+		uint64_t seed = 0,
+		const THasher& hasher = {} );
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/BatchLookup.inl"
@@ -0,0 +1,209 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BinaryFuseFilter.h
+ * @brief Binary fuse filter for immutable key sets: parallel builder and memory-mappable image
+ * @details Declares BinaryFuseFilter, a static approximate-membership filter storing one 8-bit
+ *          fingerprint slot per 1.125 keys or less, answered with three memory accesses, and
+ *          serialized as a little-endian image that can be queried in place from a mapped file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include "Hasher.h"
+#include "MappedFile.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// BinaryFuseFilter
+	//=====================================================================
+
+	/**
+	 * @brief 3-wise binary fuse filter with 8-bit fingerprints (Graf and Lemire)
+	 * @tparam THasher Stable 64-bit hash functor, evaluated once per key
+	 *
+	 * @details Each key hash, remixed with the filter seed, selects three fingerprint slots in
+	 *          consecutive segments of the array and an 8-bit fingerprint; the build solves for slot
+	 *          values whose XOR equals every key's fingerprint, so a query XORs three bytes and
+	 *          compares. Keys that were not inserted match with probability 1/256 (about 0.4%), at
+	 *          about 9 bits per key for large sets.
+	 *
+	 *          Construction peels the key hypergraph: slots touched by a single key are resolved
+	 *          last-in first-out. When peeling stalls the build retries with the next seed of a
+	 *          deterministic sequence, up to MAX_ATTEMPTS times. Key hashing and the per-seed slot
+	 *          counting run on all build threads; the counts combine with atomic add and XOR, so the
+	 *          image is identical whatever the thread count. Duplicate keys are dropped.
+	 *
+	 *          Image layout (64-bit little-endian words):
+	 *          - header: magic "NFXFUSE1", version | header size << 32, key count, seed, segment
+	 *            length, segment count x segment length, array length, hasher check
+	 *          - array length fingerprint bytes, padded to a whole word
+	 *
+	 * Usage:
+	 * @code
+	 * auto filter = BinaryFuseFilter<>::build( urls );
+	 * filter.contains( "https://example.com" ); // true for every url, ~0.4% for others
+	 * filter.write( "urls.fuse" );
+	 * BinaryFuseFilter<> mapped{ MappedFile{ "urls.fuse" } };
+	 * @endcode
+	 */
+	template <typename THasher = Hasher<uint64_t>>
+	class BinaryFuseFilter final
+	{
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Seeds tried before the build gives up */
+		static constexpr std::size_t MAX_ATTEMPTS{ 100 };
+
+		/** @brief Largest segment length, in slots */
+		static constexpr uint64_t MAX_SEGMENT_LENGTH{ 262144 };
+
+		/** @brief Build parameters */
+		struct BuildOptions
+		{
+			/** @brief Build threads; 0 uses std::thread::hardware_concurrency() */
+			std::size_t threadCount = 0;
+
+			/** @brief Start of the seed sequence; the same keys and seed always give the same image */
+			uint64_t seed = 0;
+		};
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Creates an empty filter */
+		BinaryFuseFilter() = default;
+
+		/**
+		 * @brief Builds the filter for @p keys
+		 * @param[in] keys Random-access range of keys accepted by THasher; duplicates are allowed
+		 * @param[in] options Thread count and seed
+		 * @return Filter containing every key
+		 * @throws std::runtime_error if no seed of the sequence can be peeled
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <std::ranges::random_access_range TRange>
+		[[nodiscard]] static BinaryFuseFilter build( const TRange& keys, const BuildOptions& options = {} );
+
+		/**
+		 * @brief Views a serialized image without copying it
+		 * @param[in] image Bytes produced by serialize(); must outlive the filter and be 8-byte aligned
+		 * @throws std::runtime_error if the image is malformed, truncated or built with a different hasher
+		 */
+		explicit BinaryFuseFilter( std::span<const std::byte> image );
+
+		/**
+		 * @brief Takes ownership of a mapped image file
+		 * @param[in] file Mapping of a file written by write()
+		 * @throws std::runtime_error as the image constructor
+		 */
+		explicit BinaryFuseFilter( MappedFile file );
+
+		BinaryFuseFilter( const BinaryFuseFilter& ) = delete;
+		BinaryFuseFilter& operator=( const BinaryFuseFilter& ) = delete;
+
+		BinaryFuseFilter( BinaryFuseFilter&& other ) noexcept;
+		BinaryFuseFilter& operator=( BinaryFuseFilter&& other ) noexcept;
+
+		~BinaryFuseFilter() = default;
+
+		//----------------------------------------------
+		// Query
+		//----------------------------------------------
+
+		/**
+		 * @brief Tests whether @p key may be in the set
+		 * @return true for every build key; true with probability about 1/256 for any other key
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <typename TKey>
+		[[nodiscard]] inline bool contains( const TKey& key ) const noexcept;
+
+		/**
+		 * @brief Tests a key by its THasher hash
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool containsHash( uint64_t hash ) const noexcept;
+
+		/** @brief Number of distinct keys */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		/** @brief Size of the serialized image in bits per key */
+		[[nodiscard]] inline double bitsPerKey() const noexcept;
+
+		//----------------------------------------------
+		// Serialization
+		//----------------------------------------------
+
+		/**
+		 * @brief Copies the image
+		 * @return Bytes accepted by the image constructor
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::vector<std::byte> serialize() const;
+
+		/**
+		 * @brief Writes the image to @p path
+		 * @throws std::runtime_error if the file cannot be written
+		 */
+		inline void write( const std::filesystem::path& path ) const;
+
+	private:
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		/** @brief Validates @p image and points the query fields into it */
+		inline void attach( std::span<const std::byte> image );
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		std::vector<uint64_t> m_storage;
+		MappedFile m_file;
+		std::span<const uint64_t> m_image;
+		const uint8_t* m_fingerprints = nullptr;
+		uint64_t m_size = 0;
+		uint64_t m_seed = 0;
+		uint64_t m_segmentLength = 0;
+		uint64_t m_segmentCountLength = 0;
+		[[no_unique_address]] THasher m_hasher{};
+	};
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/BinaryFuseFilter.inl"
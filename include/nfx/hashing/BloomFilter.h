@@ -0,0 +1,219 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BloomFilter.h
+ * @brief Cache-line-blocked (split block) Bloom filter with AVX2 probing
+ * @details Declares BloomFilter, which confines every key to one 32-byte block and sets one bit in
+ *          each of the block's eight 32-bit words, so that an insertion or query touches a single
+ *          cache line and, with AVX2, a single vector register.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Hasher.h"
+#include "RangeReduction.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// BloomFilter
+	//=====================================================================
+
+	/**
+	 * @brief Split block Bloom filter keyed by a single 64-bit hash
+	 * @tparam THasher Stable 64-bit hash functor, evaluated once per key
+	 *
+	 * @details A classic Bloom filter derives k positions across the whole bit array and pays up to
+	 *          k cache misses per query. Here the hash picks one 256-bit block with fastRange() on its
+	 *          full width, and its low 32 bits, multiplied by eight odd salts, pick one bit in each of
+	 *          the block's eight words. With AVX2 the eight bit masks are built with one multiply and
+	 *          one variable shift, set with one OR and tested with one VPTEST.
+	 *
+	 *          Blocks are 32-byte aligned and never straddle a cache line. The false positive rate is
+	 *          slightly above that of a classic filter of the same size (blocks fill unevenly), which
+	 *          the sizing constructor accounts for.
+	 *
+	 *          Image layout (little-endian):
+	 *          - header, 8 words: magic "NFXBLOM1", version | header size << 32, block count,
+	 *            hasher check, reserved
+	 *          - block count x 8 32-bit words
+	 *
+	 * Usage:
+	 * @code
+	 * BloomFilter<> filter{ 1'000'000, 0.01 };
+	 * filter.insert( "apple" );
+	 * if ( filter.contains( "apple" ) ) { ... } // no false negatives, ~1% false positives
+	 * @endcode
+	 */
+	template <typename THasher = Hasher<uint64_t>>
+	class BloomFilter final
+	{
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief 32-bit words per block; one bit is set in each */
+		static constexpr std::size_t BLOCK_WORDS{ 8 };
+
+		/** @brief Bytes per block */
+		static constexpr std::size_t BLOCK_BYTES{ BLOCK_WORDS * sizeof( uint32_t ) };
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Creates a filter of one block */
+		BloomFilter();
+
+		/**
+		 * @brief Creates a filter sized for @p expectedCount keys
+		 * @param[in] expectedCount Number of keys the filter will hold
+		 * @param[in] falsePositiveRate Target false positive rate at @p expectedCount keys, in (0, 1)
+		 * @throws std::invalid_argument if @p falsePositiveRate is outside (0, 1)
+		 */
+		explicit BloomFilter( std::size_t expectedCount, double falsePositiveRate = 0.01 );
+
+		/**
+		 * @brief Restores a filter from a serialized image
+		 * @param[in] image Bytes produced by serialize(); copied, so it need not outlive the filter
+		 * @throws std::runtime_error if the image is malformed, truncated or built with a different hasher
+		 */
+		explicit BloomFilter( std::span<const std::byte> image );
+
+		BloomFilter( const BloomFilter& ) = default;
+		BloomFilter( BloomFilter&& ) noexcept = default;
+		BloomFilter& operator=( const BloomFilter& ) = default;
+		BloomFilter& operator=( BloomFilter&& ) noexcept = default;
+		~BloomFilter() = default;
+
+		//----------------------------------------------
+		// Modifiers
+		//----------------------------------------------
+
+		/** @brief Adds @p key */
+		template <typename TKey>
+		inline void insert( const TKey& key ) noexcept;
+
+		/** @brief Adds a key by its THasher hash */
+		inline void insertHash( uint64_t hash ) noexcept;
+
+		/** @brief Adds a run of keys by their THasher hashes */
+		inline void insertHashes( std::span<const uint64_t> hashes ) noexcept;
+
+		/**
+		 * @brief Adds every key of @p other (bitwise OR of the blocks)
+		 * @param[in] other Filter with the same block count and hasher
+		 * @throws std::invalid_argument if the block counts differ
+		 */
+		inline void merge( const BloomFilter& other );
+
+		/** @brief Removes every key */
+		inline void clear() noexcept;
+
+		//----------------------------------------------
+		// Query
+		//----------------------------------------------
+
+		/**
+		 * @brief Tests whether @p key may have been inserted
+		 * @return false if @p key was never inserted; true if it was, or for a false positive
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <typename TKey>
+		[[nodiscard]] inline bool contains( const TKey& key ) const noexcept;
+
+		/**
+		 * @brief Tests a key by its THasher hash
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool containsHash( uint64_t hash ) const noexcept;
+
+		/**
+		 * @brief Tests a run of keys by their THasher hashes
+		 * @param[in] hashes Hashes to test
+		 * @param[out] results Receives containsHash() of each hash - must hold at least hashes.size() elements
+		 * @return Number of hashes that tested positive
+		 * @details Computes the block indexes of a chunk of hashes at once and prefetches their
+		 *          blocks before testing them, so the misses of a chunk overlap.
+		 */
+		inline std::size_t containsHashes( std::span<const uint64_t> hashes, std::span<bool> results ) const noexcept;
+
+		/** @brief Number of 32-byte blocks */
+		[[nodiscard]] inline std::size_t blockCount() const noexcept;
+
+		/** @brief Size of the bit array in bytes */
+		[[nodiscard]] inline std::size_t byteSize() const noexcept;
+
+		/**
+		 * @brief Expected false positive rate of a filter of @p blockCount blocks holding @p keyCount keys
+		 * @details Averages the rate of a block over the Poisson distribution of keys per block.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static inline double expectedFalsePositiveRate( std::size_t keyCount, std::size_t blockCount ) noexcept;
+
+		//----------------------------------------------
+		// Serialization
+		//----------------------------------------------
+
+		/**
+		 * @brief Copies the filter into a portable image
+		 * @return Bytes accepted by the image constructor
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::vector<std::byte> serialize() const;
+
+	private:
+		//----------------------------------------------
+		// Block
+		//----------------------------------------------
+
+		struct alignas( BLOCK_BYTES ) Block
+		{
+			uint32_t words[BLOCK_WORDS];
+		};
+
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		/** @brief Block selected by @p hash */
+		[[nodiscard]] inline std::size_t blockIndex( uint64_t hash ) const noexcept;
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		std::vector<Block> m_blocks;
+		[[no_unique_address]] THasher m_hasher{};
+	};
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/BloomFilter.inl"
@@ -0,0 +1,205 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CompactIntegerSet.h
+ * @brief Quotienting hash set of 64-bit integers that stores hash remainders, not keys
+ * @details Declares CompactIntegerSet. Keys are mixed with the invertible 64-bit integer hash; the
+ *          high bits of the hash select the home slot and only the low bits are stored, packed at
+ *          bit granularity. Keys are recovered with unhashInteger() when iterating.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Hash.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// CompactIntegerSet
+	//=====================================================================
+
+	/**
+	 * @brief Set of 64-bit integers in (72 - q) bits per slot for a table of 2^q slots
+	 *
+	 * @details The key's hash h = hash<uint64_t, uint64_t, 0>( key ) is a bijection of the key.
+	 *          Its top q bits are the home slot (the quotient) and the remaining 64 - q bits are
+	 *          stored, together with an 8-bit probe distance, in a slot of a bit-packed array. A
+	 *          slot therefore identifies h exactly, and unhashInteger<0>( h ) gives back the key.
+	 *
+	 *          Collisions are resolved with Robin Hood linear probing: lookups stop as soon as they
+	 *          pass an entry closer to its home, erase shifts the following entries back, and the
+	 *          table doubles past 7/8 load or when a probe distance would not fit in 8 bits. Each
+	 *          doubling moves one bit from every remainder into the quotient, so slots get
+	 *          narrower as the set grows - at 2^31 slots a slot is 41 bits instead of 64.
+	 *
+	 * Usage:
+	 * @code
+	 * CompactIntegerSet visited;
+	 * visited.reserve( 1'000'000'000 );
+	 * if ( visited.insert( id ) ) { ... first visit ... }
+	 * @endcode
+	 */
+	class CompactIntegerSet final
+	{
+	public:
+		//----------------------------------------------
+		// Type definitions
+		//----------------------------------------------
+
+		using key_type = uint64_t;
+		using value_type = uint64_t;
+		using size_type = std::size_t;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Bits per slot holding probe distance + 1 (0 marks an empty slot) */
+		static constexpr unsigned DISTANCE_BITS{ 8 };
+
+		/** @brief Smallest table: 2^8 slots, keeping slots within one 64-bit word */
+		static constexpr unsigned MIN_QUOTIENT_BITS{ 8 };
+
+		/** @brief Longest probe distance a slot can record */
+		static constexpr uint64_t MAX_DISTANCE{ ( uint64_t{ 1 } << DISTANCE_BITS ) - 2 };
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Creates an empty set with 2^MIN_QUOTIENT_BITS slots */
+		CompactIntegerSet();
+
+		/**
+		 * @brief Creates an empty set sized for @p expectedSize keys
+		 * @param[in] expectedSize Number of keys to hold without growing
+		 */
+		explicit CompactIntegerSet( size_type expectedSize );
+
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/** @brief Number of keys */
+		[[nodiscard]] inline size_type size() const noexcept;
+
+		/** @brief Whether the set is empty */
+		[[nodiscard]] inline bool empty() const noexcept;
+
+		/** @brief Number of slots (2^q) */
+		[[nodiscard]] inline size_type capacity() const noexcept;
+
+		/** @brief Width of one slot in bits (64 - q remainder bits plus DISTANCE_BITS) */
+		[[nodiscard]] inline unsigned slotBits() const noexcept;
+
+		/** @brief Bytes held by the slot array */
+		[[nodiscard]] inline size_type memoryUsage() const noexcept;
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/** @brief Whether @p key is present */
+		[[nodiscard]] inline bool contains( uint64_t key ) const noexcept;
+
+		//----------------------------------------------
+		// Modifiers
+		//----------------------------------------------
+
+		/**
+		 * @brief Inserts @p key
+		 * @return true if the key was not present
+		 */
+		inline bool insert( uint64_t key );
+
+		/**
+		 * @brief Removes @p key
+		 * @return true if the key was present
+		 */
+		inline bool erase( uint64_t key ) noexcept;
+
+		/** @brief Removes all keys and shrinks to the minimum table */
+		inline void clear();
+
+		/**
+		 * @brief Grows the table so that @p expectedSize keys fit without rehashing
+		 * @param[in] expectedSize Number of keys
+		 */
+		inline void reserve( size_type expectedSize );
+
+		//----------------------------------------------
+		// Iteration
+		//----------------------------------------------
+
+		/**
+		 * @brief Calls @p function with every key, in unspecified order
+		 * @param[in] function Callable taking a uint64_t
+		 */
+		template <typename TFunction>
+		inline void for_each( TFunction&& function ) const;
+
+	private:
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		/** @brief Sets up an empty table of 2^quotientBits slots */
+		inline void allocate( unsigned quotientBits );
+
+		/** @brief Reads the packed slot @p slot */
+		[[nodiscard]] inline uint64_t load( size_type slot ) const noexcept;
+
+		/** @brief Writes @p value into the packed slot @p slot */
+		inline void store( size_type slot, uint64_t value ) noexcept;
+
+		/** @brief Full hash of the entry @p value stored in @p slot */
+		[[nodiscard]] inline uint64_t entryHash( size_type slot, uint64_t value ) const noexcept;
+
+		/** @brief Inserts a hash known to be absent */
+		inline void insertHash( uint64_t hash );
+
+		/** @brief Moves every entry into a table of 2^quotientBits slots */
+		inline void rehash( unsigned quotientBits );
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		std::vector<uint64_t> m_words;
+		size_type m_size = 0;
+		unsigned m_quotientBits = 0;
+		unsigned m_remainderBits = 0;
+		unsigned m_slotBits = 0;
+		uint64_t m_remainderMask = 0;
+		uint64_t m_slotMask = 0;
+		size_type m_indexMask = 0;
+	};
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/CompactIntegerSet.inl"
@@ -25,12 +25,15 @@
 /**
  * @file Concepts.h
  * @brief C++20 concepts and type traits for nfx-hashing library
- * @details Declares Hash32or64 concept and related type constraints for hash function templates.
+ * @details Declares Hash32or64, StringHashPolicy and TransparentLookup concepts and related type constraints
+ *          for hash function templates.
  */
 
 #pragma once
 
 #include <concepts>
+#include <cstdint>
+#include <string_view>
 
 namespace nfx::hashing
 {
@@ -44,4 +47,25 @@ namespace nfx::hashing
 	 */
 	template <typename T>
 	concept Hash32or64 = std::same_as<T, uint32_t> || std::same_as<T, uint64_t>;
+
+	/**
+	 * @brief Concept for string hashing policies accepted by Hasher
+	 * @details A policy exposes a static `hash<HashType, Seed>( std::string_view )` template
+	 *          producing both 32-bit and 64-bit hash values.
+	 */
+	template <typename P>
+	concept StringHashPolicy = requires( std::string_view key ) {
+		{ P::template hash<uint32_t, uint32_t{ 0 }>( key ) } -> std::same_as<uint32_t>;
+		{ P::template hash<uint64_t, uint64_t{ 0 }>( key ) } -> std::same_as<uint64_t>;
+	};
+
+	/**
+	 * @brief Concept for hasher / key-equality pairs that both opt into heterogeneous lookup
+	 * @details Satisfied when both types expose `is_transparent`, as Hasher and std::equal_to<> do.
+	 */
+	template <typename THasher, typename TKeyEqual>
+	concept TransparentLookup = requires {
+		typename THasher::is_transparent;
+		typename TKeyEqual::is_transparent;
+	};
 } // namespace nfx::hashing
@@ -0,0 +1,241 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ConcurrentHashMap.h
+ * @brief Sharded, lock-striped concurrent hash map built on Hasher and FlatHashMap
+ * @details Declares ConcurrentHashMap, which routes each key to a shard chosen from the high bits
+ *          of its Hasher output; every shard is a FlatHashMap behind its own reader-writer lock.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+
+#include "Concepts.h"
+#include "FlatHashMap.h"
+#include "Hasher.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// ConcurrentHashMap
+	//=====================================================================
+
+	/**
+	 * @brief Thread-safe hash map sharded by the high bits of the key hash
+	 * @tparam TKey Key type
+	 * @tparam TValue Mapped type; returned by copy from find()
+	 * @tparam THasher Hash functor; the top bits select the shard, the rest drive the shard's table
+	 * @tparam TKeyEqual Key equality predicate
+	 *
+	 * @details The shard count is a power of two fixed at construction. Each shard occupies its own
+	 *          cache lines and pairs a std::shared_mutex with a FlatHashMap, so readers of a shard
+	 *          proceed in parallel and writers only serialize with operations on the same shard.
+	 *          Because the shard index uses the high hash bits while FlatHashMap probes with the
+	 *          low bits, sharding does not degrade the distribution inside a shard, and each key is
+	 *          hashed once: the same value selects the shard and is passed on to the shard's table.
+	 *
+	 *          - Shard tables are allocated by the first thread that inserts into them, so with the
+	 *            default first-touch page placement their memory lands on that thread's NUMA node.
+	 *          - No reference into the map escapes a lock: find() returns a copy, visit() runs a
+	 *            callback under the shard's shared lock.
+	 *          - for_each() locks one shard at a time; it observes every element present for the
+	 *            whole call but is not an atomic snapshot of the map.
+	 *
+	 * Usage:
+	 * @code
+	 * ConcurrentHashMap<std::string, int> cache;
+	 * cache.insert_or_assign( "alpha", 1 );               // any thread
+	 * if ( auto value = cache.find( "alpha" ) ) { ... }   // any thread
+	 * @endcode
+	 */
+	template <typename TKey, typename TValue, typename THasher = Hasher<uint64_t>, typename TKeyEqual = std::equal_to<>>
+	class ConcurrentHashMap final
+	{
+	public:
+		//----------------------------------------------
+		// Type definitions
+		//----------------------------------------------
+
+		using key_type = TKey;
+		using mapped_type = TValue;
+		using value_type = std::pair<TKey, TValue>;
+		using size_type = std::size_t;
+		using hasher = THasher;
+		using key_equal = TKeyEqual;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Creates a map with defaultShardCount() shards */
+		ConcurrentHashMap();
+
+		/**
+		 * @brief Creates a map with at least @p shardCount shards
+		 * @param[in] shardCount Requested shard count, rounded up to a power of two (minimum 1)
+		 */
+		explicit ConcurrentHashMap( size_type shardCount );
+
+		ConcurrentHashMap( const ConcurrentHashMap& ) = delete;
+		ConcurrentHashMap( ConcurrentHashMap&& ) = delete;
+		ConcurrentHashMap& operator=( const ConcurrentHashMap& ) = delete;
+		ConcurrentHashMap& operator=( ConcurrentHashMap&& ) = delete;
+
+		~ConcurrentHashMap() = default;
+
+		/**
+		 * @brief Default shard count: four shards per hardware thread, rounded up to a power of two
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static size_type defaultShardCount() noexcept;
+
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/** @brief Number of shards */
+		[[nodiscard]] inline size_type shardCount() const noexcept;
+
+		/** @brief Total number of elements, summed shard by shard (not an atomic snapshot) */
+		[[nodiscard]] inline size_type size() const;
+
+		/** @brief Whether every shard is empty */
+		[[nodiscard]] inline bool empty() const;
+
+		/**
+		 * @brief Reserves room for @p count elements spread evenly over the shards
+		 * @param[in] count Expected total number of elements
+		 */
+		inline void reserve( size_type count );
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Copies the value mapped to @p key
+		 * @return The value, or std::nullopt if the key is absent
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::optional<TValue> find( const TKey& key ) const;
+
+		/** @brief Heterogeneous find(), enabled when THasher and TKeyEqual are transparent */
+		template <typename TLookup>
+			requires TransparentLookup<THasher, TKeyEqual>
+		[[nodiscard]] inline std::optional<TValue> find( const TLookup& key ) const;
+
+		/** @brief Whether @p key is present */
+		[[nodiscard]] inline bool contains( const TKey& key ) const;
+
+		template <typename TLookup>
+			requires TransparentLookup<THasher, TKeyEqual>
+		[[nodiscard]] inline bool contains( const TLookup& key ) const;
+
+		/**
+		 * @brief Invokes @p visitor with the value mapped to @p key while holding the shard's shared lock
+		 * @param[in] key Key to look up
+		 * @param[in] visitor Callable `( const TValue& )`; must not access this map
+		 * @return Whether the key was found
+		 */
+		template <typename TLookup, typename TVisitor>
+		inline bool visit( const TLookup& key, TVisitor&& visitor ) const;
+
+		//----------------------------------------------
+		// Modifiers
+		//----------------------------------------------
+
+		/**
+		 * @brief Inserts @p key or overwrites its value
+		 * @return true if the key was inserted, false if an existing value was assigned
+		 */
+		template <typename TMapped>
+		inline bool insert_or_assign( const TKey& key, TMapped&& value );
+
+		template <typename TMapped>
+		inline bool insert_or_assign( TKey&& key, TMapped&& value );
+
+		/**
+		 * @brief Removes @p key
+		 * @return Number of elements removed (0 or 1)
+		 */
+		inline size_type erase( const TKey& key );
+
+		template <typename TLookup>
+			requires TransparentLookup<THasher, TKeyEqual>
+		inline size_type erase( const TLookup& key );
+
+		/** @brief Removes all elements, keeping each shard's capacity */
+		inline void clear();
+
+		//----------------------------------------------
+		// Bulk traversal
+		//----------------------------------------------
+
+		/**
+		 * @brief Invokes @p function for every element, one shard at a time under its shared lock
+		 * @param[in] function Callable `( const TKey&, const TValue& )`; must not access this map
+		 */
+		template <typename TFunction>
+		inline void for_each( TFunction&& function ) const;
+
+	private:
+		//----------------------------------------------
+		// Shard
+		//----------------------------------------------
+
+		struct alignas( 64 ) Shard // One cache line apart: no false sharing between shard locks
+		{
+			mutable std::shared_mutex mutex;
+			FlatHashMap<TKey, TValue, THasher, TKeyEqual> map;
+		};
+
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		/** @brief Hashes @p key once; the value picks the shard and is handed to the shard's table */
+		template <typename TLookup>
+		[[nodiscard]] inline uint64_t hashOf( const TLookup& key ) const;
+
+		[[nodiscard]] inline Shard& shardFor( uint64_t hash ) const noexcept;
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		std::unique_ptr<Shard[]> m_shards;
+		size_type m_shardCount;
+		int m_shardShift;
+		[[no_unique_address]] THasher m_hasher{};
+	};
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/ConcurrentHashMap.inl"
@@ -26,11 +26,13 @@
  * @file Constants.h
  * @brief Mathematical constants for hash algorithms
  * @details Defines FNV-1a primes, integer hashing multipliers (Knuth/Wang),
- *          hash combining constants (golden ratio, MurmurHash3), and seed mixing parameters
+ *          hash combining constants (golden ratio, MurmurHash3), CityHash/FarmHash
+ *          multipliers, CRC polynomials, seed mixing and batched lookup parameters
  */
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace nfx::hashing::constants
@@ -55,6 +57,47 @@ namespace nfx::hashing::constants
 	/** @brief FNV-1a 64-bit prime constant. */
 	inline constexpr uint64_t FNV_PRIME_64{ 0x00000100000001B3ULL };
 
+	//----------------------------------------------
+	// CityHash / FarmHash constants
+	//----------------------------------------------
+
+	/** @brief CityHash/FarmHash first 64-bit prime multiplier (k0). */
+	inline constexpr uint64_t CITY_K0{ 0xc3a5c85c97cb3127ULL };
+
+	/** @brief CityHash/FarmHash second 64-bit prime multiplier (k1). */
+	inline constexpr uint64_t CITY_K1{ 0xb492b66fbe98f273ULL };
+
+	/** @brief CityHash/FarmHash third 64-bit prime multiplier (k2), also the hash of the empty input. */
+	inline constexpr uint64_t CITY_K2{ 0x9ae16a3b2f90404fULL };
+
+	/** @brief CityHash/FarmHash Murmur-inspired 128-to-64 bit reduction multiplier. */
+	inline constexpr uint64_t CITY_MUL{ 0x9ddfea08eb382d69ULL };
+
+	//----------------------------------------------
+	// CRC polynomials (reflected form)
+	//----------------------------------------------
+
+	/** @brief CRC-32C (Castagnoli) polynomial 0x1EDC6F41 in reflected form, as used by SSE4.2. */
+	inline constexpr uint32_t CRC32C_POLYNOMIAL{ 0x82F63B78 };
+
+	/** @brief Offset added by the LevelDB / RocksDB / Snappy CRC32-C masking scheme. */
+	inline constexpr uint32_t CRC32C_MASK_DELTA{ 0xA282EAD8 };
+
+	/** @brief CRC-32 (IEEE 802.3 / zlib) polynomial 0x04C11DB7 in reflected form. */
+	inline constexpr uint32_t CRC32_IEEE_POLYNOMIAL{ 0xEDB88320 };
+
+	/** @brief CRC-32 initial register value and final XOR mask (IEEE 802.3 / zlib). */
+	inline constexpr uint32_t CRC32_IEEE_INIT{ 0xFFFFFFFF };
+
+	/** @brief CRC-64 ECMA-182 polynomial 0x42F0E1EBA9EA3693 in reflected form (CRC-64/XZ). */
+	inline constexpr uint64_t CRC64_ECMA_POLYNOMIAL{ 0xC96C5795D7870F42ULL };
+
+	/** @brief CRC-64 NVMe polynomial 0xAD93D23594C93659 in reflected form (CRC-64/NVME). */
+	inline constexpr uint64_t CRC64_NVME_POLYNOMIAL{ 0x9A6C9329AC4BC9B5ULL };
+
+	/** @brief CRC-64 initial register value and final XOR mask (XZ and NVMe). */
+	inline constexpr uint64_t CRC64_INIT{ 0xFFFFFFFFFFFFFFFFULL };
+
 	//----------------------------------------------
 	// Integer hashing constants
 	//----------------------------------------------
@@ -68,6 +111,12 @@ namespace nfx::hashing::constants
 	/** @brief Wang's second multiplicative constant for 64-bit integer hashing. */
 	inline constexpr uint64_t WANG_MULTIPLIER_64_C2{ 0x94d049bb133111ebull };
 
+	/** @brief Multiplicative inverse of WANG_MULTIPLIER_64_C1 modulo 2^64, used by unhashInteger. */
+	inline constexpr uint64_t WANG_MULTIPLIER_64_C1_INVERSE{ 0x96de1b173f119089ull };
+
+	/** @brief Multiplicative inverse of WANG_MULTIPLIER_64_C2 modulo 2^64, used by unhashInteger. */
+	inline constexpr uint64_t WANG_MULTIPLIER_64_C2_INVERSE{ 0x319642b2d24d8ec3ull };
+
 	//----------------------------------------------
 	// Hash combining constants
 	//----------------------------------------------
@@ -90,4 +139,11 @@ namespace nfx::hashing::constants
 
 	/** @brief Multiplicative constant for seed mixing. */
 	inline constexpr uint64_t SEED_MIX_MULTIPLIER_64{ 0x2545F4914F6CDD1DUL };
+
+	//----------------------------------------------
+	// Batched lookup constants
+	//----------------------------------------------
+
+	/** @brief Default number of keys a batched lookup prefetches ahead of the probe (about one DRAM latency). */
+	inline constexpr std::size_t BATCH_PREFETCH_DISTANCE{ 16 };
 } // namespace nfx::hashing::constants
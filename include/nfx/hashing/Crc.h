@@ -0,0 +1,226 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Crc.h
+ * @brief Compile-time parameterized CRC engine
+ * @details Declares Crc<Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut>, which accepts
+ *          any Rocksoft-model CRC of 8 to 64 bits and generates its slicing tables and carry-less
+ *          multiply fold constants at compile time, together with aliases for common variants.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#include "Algorithms.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// Parameterized CRC
+	//=====================================================================
+
+	/**
+	 * @brief CRC defined by the Rocksoft model parameters
+	 * @tparam Width Register width in bits (8 to 64)
+	 * @tparam Polynomial Generator polynomial in normal (MSB-first) form, without the x^Width term
+	 * @tparam Init Initial register value, in normal form
+	 * @tparam ReflectIn Whether input bytes are processed least significant bit first
+	 * @tparam ReflectOut Whether the final register is bit-reversed before the final XOR
+	 * @tparam XorOut Value XORed into the result
+	 * @details Parameters map one-to-one to the CRC catalogue entries
+	 *          (https://reveng.sourceforge.io/crc-catalogue/). Each instantiation gets a
+	 *          slicing-by-16 software kernel and PCLMULQDQ / VPCLMULQDQ folding kernels selected at
+	 *          runtime. Parameter sets with a dedicated implementation reuse it: CRC-32C uses the
+	 *          SSE4.2 CRC32 instruction through crc32c(), and the CRC-32 / CRC-64 variants share
+	 *          their tables with crc32Ieee(), crc64Xz() and crc64Nvme().
+	 *
+	 * Usage:
+	 * @code
+	 * auto crc = Crc16Kermit::compute( "123456789" ); // 0x2189
+	 *
+	 * Crc32Iscsi state;                                // same as crc32c()
+	 * state.update( header );
+	 * state.update( payload );
+	 * auto checksum = state.value();
+	 * @endcode
+	 */
+	template <int Width, uint64_t Polynomial, uint64_t Init, bool ReflectIn, bool ReflectOut, uint64_t XorOut>
+		requires( Width >= 8 && Width <= 64 )
+	class Crc final
+	{
+	public:
+		//----------------------------------------------
+		// Type definitions
+		//----------------------------------------------
+
+		/** @brief Smallest unsigned integer holding a Width-bit CRC value */
+		using ValueType = std::conditional_t<( Width <= 8 ), uint8_t,
+			std::conditional_t<( Width <= 16 ), uint16_t,
+				std::conditional_t<( Width <= 32 ), uint32_t, uint64_t>>>;
+
+		//----------------------------------------------
+		// Parameters
+		//----------------------------------------------
+
+		/** @brief Register width in bits. */
+		static constexpr int WIDTH = Width;
+
+		/** @brief Mask of the Width low bits. */
+		static constexpr uint64_t MASK = Width == 64 ? ~uint64_t{ 0 } : ( uint64_t{ 1 } << Width ) - 1;
+
+		//----------------------------------------------
+		// One-shot computation
+		//----------------------------------------------
+
+		/**
+		 * @brief Computes the CRC of a buffer
+		 * @param[in] data Bytes to checksum
+		 * @param[in] length Number of bytes
+		 * @return Finalized CRC value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static inline ValueType compute( const std::byte* data, std::size_t length ) noexcept;
+
+		/**
+		 * @brief Computes the CRC of a string
+		 * @param[in] data Bytes to checksum
+		 * @return Finalized CRC value
+		 * @details Usable in constant expressions, where it runs the table-driven bytewise kernel.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static inline constexpr ValueType compute( std::string_view data ) noexcept;
+
+		/**
+		 * @brief Combines the CRCs of two adjacent buffers
+		 * @param[in] crc1 Finalized CRC of the first buffer
+		 * @param[in] crc2 Finalized CRC of the second buffer
+		 * @param[in] length2 Length in bytes of the second buffer
+		 * @return Finalized CRC of the concatenation
+		 * @details Runs in O(log length2); valid for every parameter set.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static inline constexpr ValueType combine( ValueType crc1, ValueType crc2, uint64_t length2 ) noexcept;
+
+		//----------------------------------------------
+		// Incremental computation
+		//----------------------------------------------
+
+		/**
+		 * @brief Incorporates a buffer into the running CRC
+		 * @param[in] data Bytes to incorporate
+		 * @param[in] length Number of bytes
+		 */
+		inline void update( const std::byte* data, std::size_t length ) noexcept;
+
+		/**
+		 * @brief Incorporates the bytes of a string into the running CRC
+		 * @param[in] data Bytes to incorporate
+		 */
+		inline void update( std::string_view data ) noexcept;
+
+		/**
+		 * @brief Returns the finalized CRC of all bytes seen so far
+		 * @return Finalized CRC value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline ValueType value() const noexcept;
+
+		/** @brief Restarts the computation as if no bytes had been seen. */
+		inline void reset() noexcept;
+
+	private:
+		using Engine = typename internal::crc::EngineSelector<Width, Polynomial, ReflectIn>::type;
+		using Register = typename Engine::Register;
+
+		/** @brief Whether the hardware CRC32-C path applies (same register update regardless of Init/XorOut) */
+		static constexpr bool IS_CRC32C = Width == 32 && Polynomial == 0x1EDC6F41 && ReflectIn;
+
+		static constexpr Register INITIAL_REGISTER = Engine::fromValue( ReflectIn ? internal::crc::reflect( Init & MASK, Width ) : Init & MASK );
+
+		static inline Register updateRegister( Register crc, const std::byte* data, std::size_t length ) noexcept;
+		static inline constexpr ValueType finalize( Register crc ) noexcept;
+		static inline constexpr Register unfinalize( ValueType value ) noexcept;
+
+		Register m_register{ INITIAL_REGISTER };
+	};
+
+	//=====================================================================
+	// Catalogued CRC variants
+	//=====================================================================
+
+	/** @brief CRC-8/SMBUS. */
+	using Crc8Smbus = Crc<8, 0x07, 0x00, false, false, 0x00>;
+
+	/** @brief CRC-8/MAXIM-DOW (1-Wire). */
+	using Crc8MaximDow = Crc<8, 0x31, 0x00, true, true, 0x00>;
+
+	/** @brief CRC-16/ARC (LHA, IBM). */
+	using Crc16Arc = Crc<16, 0x8005, 0x0000, true, true, 0x0000>;
+
+	/** @brief CRC-16/KERMIT (CCITT, reflected). */
+	using Crc16Kermit = Crc<16, 0x1021, 0x0000, true, true, 0x0000>;
+
+	/** @brief CRC-16/IBM-SDLC (X-25, HDLC). */
+	using Crc16IbmSdlc = Crc<16, 0x1021, 0xFFFF, true, true, 0xFFFF>;
+
+	/** @brief CRC-16/XMODEM. */
+	using Crc16Xmodem = Crc<16, 0x1021, 0x0000, false, false, 0x0000>;
+
+	/** @brief CRC-16/IBM-3740, commonly called CRC-16/CCITT-FALSE. */
+	using Crc16CcittFalse = Crc<16, 0x1021, 0xFFFF, false, false, 0x0000>;
+
+	/** @brief CRC-24/OPENPGP. */
+	using Crc24OpenPgp = Crc<24, 0x864CFB, 0xB704CE, false, false, 0x000000>;
+
+	/** @brief CRC-32/ISO-HDLC (IEEE 802.3, zlib, PNG); same result as crc32Ieee(). */
+	using Crc32IsoHdlc = Crc<32, 0x04C11DB7, 0xFFFFFFFF, true, true, 0xFFFFFFFF>;
+
+	/** @brief CRC-32/ISCSI (CRC-32C, Castagnoli); uses the SSE4.2 CRC32 instruction. */
+	using Crc32Iscsi = Crc<32, 0x1EDC6F41, 0xFFFFFFFF, true, true, 0xFFFFFFFF>;
+
+	/** @brief CRC-32/BZIP2 (AAL5). */
+	using Crc32Bzip2 = Crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF>;
+
+	/** @brief CRC-32/MPEG-2. */
+	using Crc32Mpeg2 = Crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0x00000000>;
+
+	/** @brief CRC-64/ECMA-182 (bit-forward). */
+	using Crc64Ecma182 = Crc<64, 0x42F0E1EBA9EA3693, 0, false, false, 0>;
+
+	/** @brief CRC-64/GO-ISO. */
+	using Crc64GoIso = Crc<64, 0x000000000000001B, ~uint64_t{ 0 }, true, true, ~uint64_t{ 0 }>;
+
+	/** @brief CRC-64/XZ; same result as crc64Xz(). */
+	using Crc64Xz = Crc<64, 0x42F0E1EBA9EA3693, ~uint64_t{ 0 }, true, true, ~uint64_t{ 0 }>;
+
+	/** @brief CRC-64/NVME; same result as crc64Nvme(). */
+	using Crc64Nvme = Crc<64, 0xAD93D23594C93659, ~uint64_t{ 0 }, true, true, ~uint64_t{ 0 }>;
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/Crc.inl"
@@ -0,0 +1,214 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CuckooFilter.h
+ * @brief Cuckoo filter: approximate set membership with deletion and compact fingerprints
+ * @details Declares CuckooFilter, which stores an 8- or 16-bit fingerprint of each key in one of
+ *          two 4-slot buckets chosen by partial-key cuckoo hashing, and tests both buckets with a
+ *          single SSE2 comparison.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "Hasher.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// CuckooFilter
+	//=====================================================================
+
+	/**
+	 * @brief Bucketed (4-way) cuckoo filter keyed by a single 64-bit hash
+	 * @tparam TFingerprint Fingerprint storage - uint8_t (about 3% false positives) or uint16_t
+	 *         (about 0.01%)
+	 * @tparam THasher 64-bit hash functor, evaluated once per key
+	 *
+	 * @details The top bits of the hash form the fingerprint (0 is reserved for empty slots and
+	 *          remapped to 1) and the low bits the first bucket i1. The second bucket is
+	 *          i2 = i1 ^ fibonacciRange( fingerprint ), computed from the fingerprint alone, so a
+	 *          stored fingerprint can move between its two buckets without the key. A full pair of
+	 *          buckets evicts a random resident to its alternate bucket, up to MAX_KICKS times.
+	 *
+	 *          A lookup loads both buckets (8 or 16 bytes) into one SSE2 register and compares every
+	 *          slot against the fingerprint at once, so it costs at most two cache misses and no
+	 *          branches per slot.
+	 *
+	 *          The bucket count is a power of 2 (required for the XOR alternate index) sized so that
+	 *          the requested capacity fits below 95% load. When an eviction chain runs out, its last
+	 *          fingerprint is kept in a one-entry victim slot; the filter still answers correctly but
+	 *          further insertions fail until an erase frees room.
+	 *
+	 *          Erasing a key that was never inserted may remove another key's fingerprint and cause
+	 *          a false negative; inserting a key twice stores it twice and needs two erases.
+	 *
+	 * Usage:
+	 * @code
+	 * CuckooFilter<uint16_t> filter{ 1'000'000 };
+	 * filter.insert( "apple" );
+	 * filter.contains( "apple" ); // true
+	 * filter.erase( "apple" );
+	 * @endcode
+	 */
+	template <typename TFingerprint = uint16_t, typename THasher = Hasher<uint64_t>>
+	class CuckooFilter final
+	{
+		static_assert( std::is_same_v<TFingerprint, uint8_t> || std::is_same_v<TFingerprint, uint16_t>,
+			"CuckooFilter fingerprints are uint8_t or uint16_t" );
+
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Slots per bucket */
+		static constexpr std::size_t BUCKET_SLOTS{ 4 };
+
+		/** @brief Bits per fingerprint */
+		static constexpr unsigned int FINGERPRINT_BITS{ 8 * sizeof( TFingerprint ) };
+
+		/** @brief Evictions attempted before an insertion parks its last fingerprint in the victim slot */
+		static constexpr std::size_t MAX_KICKS{ 500 };
+
+		/** @brief Load factor the sizing constructor plans for */
+		static constexpr double MAX_LOAD_FACTOR{ 0.95 };
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Creates a filter for about @p capacity keys
+		 * @param[in] capacity Number of keys the filter should accept
+		 */
+		explicit CuckooFilter( std::size_t capacity = 1024 );
+
+		CuckooFilter( const CuckooFilter& ) = default;
+		CuckooFilter( CuckooFilter&& ) noexcept = default;
+		CuckooFilter& operator=( const CuckooFilter& ) = default;
+		CuckooFilter& operator=( CuckooFilter&& ) noexcept = default;
+		~CuckooFilter() = default;
+
+		//----------------------------------------------
+		// Modifiers
+		//----------------------------------------------
+
+		/**
+		 * @brief Adds @p key
+		 * @return false if the filter is full (the victim slot is taken); the filter is unchanged
+		 */
+		template <typename TKey>
+		inline bool insert( const TKey& key ) noexcept;
+
+		/** @brief Adds a key by its THasher hash; see insert() */
+		inline bool insertHash( uint64_t hash ) noexcept;
+
+		/**
+		 * @brief Removes one copy of @p key
+		 * @return true if a matching fingerprint was found and removed
+		 */
+		template <typename TKey>
+		inline bool erase( const TKey& key ) noexcept;
+
+		/** @brief Removes a key by its THasher hash; see erase() */
+		inline bool eraseHash( uint64_t hash ) noexcept;
+
+		/** @brief Removes every key */
+		inline void clear() noexcept;
+
+		//----------------------------------------------
+		// Query
+		//----------------------------------------------
+
+		/**
+		 * @brief Tests whether @p key may be in the filter
+		 * @return false if @p key is not in the filter; true if it is, or for a false positive
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <typename TKey>
+		[[nodiscard]] inline bool contains( const TKey& key ) const noexcept;
+
+		/**
+		 * @brief Tests a key by its THasher hash
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool containsHash( uint64_t hash ) const noexcept;
+
+		/** @brief Number of stored fingerprints */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		/** @brief Number of slots */
+		[[nodiscard]] inline std::size_t capacity() const noexcept;
+
+		/** @brief Number of buckets (a power of 2) */
+		[[nodiscard]] inline std::size_t bucketCount() const noexcept;
+
+		/** @brief size() / capacity() */
+		[[nodiscard]] inline double loadFactor() const noexcept;
+
+		/** @brief Size of the fingerprint table in bytes */
+		[[nodiscard]] inline std::size_t byteSize() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		/** @brief Fingerprint of @p hash: its top FINGERPRINT_BITS bits, never 0 */
+		[[nodiscard]] static inline TFingerprint fingerprint( uint64_t hash ) noexcept;
+
+		/** @brief The other bucket of a fingerprint stored in bucket @p index */
+		[[nodiscard]] inline std::size_t alternateIndex( std::size_t index, TFingerprint fingerprint ) const noexcept;
+
+		/** @brief Stores @p fingerprint in a free slot of bucket @p index */
+		inline bool tryPlace( std::size_t index, TFingerprint fingerprint ) noexcept;
+
+		/** @brief Removes one @p fingerprint from bucket @p index */
+		inline bool tryRemove( std::size_t index, TFingerprint fingerprint ) noexcept;
+
+		/** @brief Places @p fingerprint, evicting residents as needed; parks the leftover in the victim slot */
+		inline void place( std::size_t index, TFingerprint fingerprint ) noexcept;
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		std::vector<TFingerprint> m_slots;
+		std::size_t m_mask = 0;
+		unsigned int m_indexBits = 0;
+		std::size_t m_size = 0;
+		uint64_t m_random = constants::GOLDEN_RATIO_64;
+		std::size_t m_victimIndex = 0;
+		TFingerprint m_victim = 0;
+		[[no_unique_address]] THasher m_hasher{};
+	};
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/CuckooFilter.inl"
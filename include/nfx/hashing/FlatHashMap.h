@@ -0,0 +1,403 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FlatHashMap.h
+ * @brief Open-addressing Swiss-table hash map built on Hasher
+ * @details Declares FlatHashMap, a flat (inline storage) hash map that probes 16 or 32 control
+ *          bytes per SIMD instruction and splits one Hasher call into a probe position (H1) and
+ *          a 7-bit tag (H2).
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "Concepts.h"
+#include "Hasher.h"
+#include "SeedPolicies.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// FlatHashMap
+	//=====================================================================
+
+	/**
+	 * @brief Swiss-table hash map with inline storage and SIMD group probing
+	 * @tparam TKey Key type
+	 * @tparam TValue Mapped type
+	 * @tparam THasher Hash functor; its result is split into H1 (probe position) and H2 (7-bit tag)
+	 * @tparam TKeyEqual Key equality predicate
+	 * @tparam TSeedPolicy Table seed policy (see SeedPolicies.h); FixedSeed takes H1 straight from
+	 *                     the hash, SaltedSeed mixes in a per-instance seed, AdaptiveSeed mixes in a
+	 *                     seed it replaces when probes grow long
+	 *
+	 * @details Elements live in one contiguous slot array next to an array of one-byte control
+	 *          words (empty, deleted, or the H2 tag of a full slot). A lookup compares the tag
+	 *          against a whole group of 16 control bytes with one SSE2 comparison and only touches
+	 *          slots whose tag matches. Whole-table scans (rehash, clear) take 32 control bytes per
+	 *          step when the CPU supports AVX2, detected at run time.
+	 *
+	 *          - The maximum load factor is 7/8; reserve() sizes the table once so that the
+	 *            reserved number of insertions never rehashes.
+	 *          - Heterogeneous find / contains / erase are enabled when THasher and TKeyEqual
+	 *            both define `is_transparent` (the defaults do), e.g. std::string_view lookups in
+	 *            a std::string-keyed map.
+	 *          - Unlike std::unordered_map, insertion and rehashing invalidate iterators and
+	 *            references; erase invalidates only the erased element.
+	 *          - A rehash moves elements only if their move constructor is noexcept and copies
+	 *            them otherwise; if it throws, the map is left as it was.
+	 *          - value_type is `std::pair<TKey, TValue>`; the key must not be modified through an
+	 *            iterator.
+	 *
+	 * Usage:
+	 * @code
+	 * FlatHashMap<std::string, int> map;
+	 * map.reserve( 1000 );
+	 * map.insert_or_assign( "alpha", 1 );
+	 * if ( auto it = map.find( std::string_view{ "alpha" } ); it != map.end() ) { ... }
+	 * @endcode
+	 */
+	template <typename TKey, typename TValue, typename THasher = Hasher<uint64_t>, typename TKeyEqual = std::equal_to<>, typename TSeedPolicy = policies::FixedSeed>
+	class FlatHashMap final
+	{
+	public:
+		//----------------------------------------------
+		// Type definitions
+		//----------------------------------------------
+
+		using key_type = TKey;
+		using mapped_type = TValue;
+		using value_type = std::pair<TKey, TValue>;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using hasher = THasher;
+		using key_equal = TKeyEqual;
+		using seed_policy_type = TSeedPolicy;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+
+		/**
+		 * @brief Forward iterator over full slots
+		 * @tparam IsConst Whether the iterator yields const references
+		 */
+		template <bool IsConst>
+		class Iterator final
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = FlatHashMap::value_type;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+			using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+			Iterator() noexcept = default;
+
+			/** @brief Converts a mutable iterator into a const iterator */
+			template <bool OtherConst>
+				requires( IsConst && !OtherConst )
+			Iterator( const Iterator<OtherConst>& other ) noexcept;
+
+			[[nodiscard]] inline reference operator*() const noexcept;
+			[[nodiscard]] inline pointer operator->() const noexcept;
+			inline Iterator& operator++() noexcept;
+			inline Iterator operator++( int ) noexcept;
+
+			template <bool OtherConst>
+			[[nodiscard]] bool operator==( const Iterator<OtherConst>& other ) const noexcept
+			{
+				return m_slot == other.m_slot;
+			}
+
+		private:
+			friend class FlatHashMap;
+			template <bool>
+			friend class Iterator;
+
+			inline Iterator( const int8_t* control, pointer slot, const int8_t* controlEnd ) noexcept;
+			inline void skipEmpty() noexcept;
+
+			const int8_t* m_control = nullptr;
+			pointer m_slot = nullptr;
+			const int8_t* m_controlEnd = nullptr;
+		};
+
+		using iterator = Iterator<false>;
+		using const_iterator = Iterator<true>;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Creates an empty map without allocating */
+		FlatHashMap() noexcept = default;
+
+		/**
+		 * @brief Creates an empty map able to hold @p capacity elements without rehashing
+		 * @param[in] capacity Number of elements to reserve space for
+		 */
+		explicit FlatHashMap( size_type capacity );
+
+		/**
+		 * @brief Creates a map from a list of key/value pairs (later duplicates are ignored)
+		 * @param[in] init Elements to insert
+		 */
+		FlatHashMap( std::initializer_list<value_type> init );
+
+		FlatHashMap( const FlatHashMap& other );
+		FlatHashMap( FlatHashMap&& other ) noexcept;
+		FlatHashMap& operator=( const FlatHashMap& other );
+		FlatHashMap& operator=( FlatHashMap&& other ) noexcept;
+		~FlatHashMap();
+
+		//----------------------------------------------
+		// Iterators
+		//----------------------------------------------
+
+		[[nodiscard]] inline iterator begin() noexcept;
+		[[nodiscard]] inline const_iterator begin() const noexcept;
+		[[nodiscard]] inline const_iterator cbegin() const noexcept;
+		[[nodiscard]] inline iterator end() noexcept;
+		[[nodiscard]] inline const_iterator end() const noexcept;
+		[[nodiscard]] inline const_iterator cend() const noexcept;
+
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/** @brief Returns true if the map holds no elements */
+		[[nodiscard]] inline bool empty() const noexcept;
+
+		/** @brief Returns the number of elements */
+		[[nodiscard]] inline size_type size() const noexcept;
+
+		/** @brief Returns the number of slots (a power of two, or 0 before the first insertion) */
+		[[nodiscard]] inline size_type capacity() const noexcept;
+
+		/** @brief Returns size() / capacity() */
+		[[nodiscard]] inline float load_factor() const noexcept;
+
+		/** @brief Returns the maximum load factor (7/8) */
+		[[nodiscard]] static constexpr float max_load_factor() noexcept { return 0.875f; }
+
+		/** @brief Returns the seed policy (its seed and, for AdaptiveSeed, probe statistics) */
+		[[nodiscard]] inline const TSeedPolicy& seed_policy() const noexcept;
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Finds the element with the given key
+		 * @param[in] key Key to look up
+		 * @return Iterator to the element, or end() if absent
+		 */
+		[[nodiscard]] inline iterator find( const TKey& key );
+		[[nodiscard]] inline const_iterator find( const TKey& key ) const;
+
+		/**
+		 * @brief Finds the element whose key compares equal to @p key without constructing a TKey
+		 * @param[in] key Heterogeneous key (e.g. std::string_view for std::string keys)
+		 * @return Iterator to the element, or end() if absent
+		 */
+		template <typename TLookup>
+			requires TransparentLookup<THasher, TKeyEqual>
+		[[nodiscard]] inline iterator find( const TLookup& key );
+
+		template <typename TLookup>
+			requires TransparentLookup<THasher, TKeyEqual>
+		[[nodiscard]] inline const_iterator find( const TLookup& key ) const;
+
+		/** @brief Returns true if an element with the given key exists */
+		[[nodiscard]] inline bool contains( const TKey& key ) const;
+
+		template <typename TLookup>
+			requires TransparentLookup<THasher, TKeyEqual>
+		[[nodiscard]] inline bool contains( const TLookup& key ) const;
+
+		/**
+		 * @brief find() with a hash the caller already computed
+		 * @param[in] key Key to look up
+		 * @param[in] hash Must equal `static_cast<uint64_t>( THasher{}( key ) )`
+		 * @return Iterator to the element, or end() if absent
+		 * @details Lets a wrapper that hashes the key for its own purposes (e.g. shard selection)
+		 *          reuse that hash instead of hashing the key a second time.
+		 */
+		[[nodiscard]] inline iterator find( const TKey& key, uint64_t hash );
+		[[nodiscard]] inline const_iterator find( const TKey& key, uint64_t hash ) const;
+
+		template <typename TLookup>
+			requires TransparentLookup<THasher, TKeyEqual>
+		[[nodiscard]] inline iterator find( const TLookup& key, uint64_t hash );
+
+		template <typename TLookup>
+			requires TransparentLookup<THasher, TKeyEqual>
+		[[nodiscard]] inline const_iterator find( const TLookup& key, uint64_t hash ) const;
+
+		/** @brief contains() with a precomputed hash, as for find( key, hash ) */
+		[[nodiscard]] inline bool contains( const TKey& key, uint64_t hash ) const;
+
+		template <typename TLookup>
+			requires TransparentLookup<THasher, TKeyEqual>
+		[[nodiscard]] inline bool contains( const TLookup& key, uint64_t hash ) const;
+
+		/**
+		 * @brief Returns the value mapped to @p key
+		 * @throws std::out_of_range if the key is absent
+		 */
+		[[nodiscard]] inline TValue& at( const TKey& key );
+		[[nodiscard]] inline const TValue& at( const TKey& key ) const;
+
+		/** @brief Returns the value mapped to @p key, default-constructing it if absent */
+		inline TValue& operator[]( const TKey& key );
+		inline TValue& operator[]( TKey&& key );
+
+		//----------------------------------------------
+		// Modifiers
+		//----------------------------------------------
+
+		/**
+		 * @brief Inserts a copy of @p value if its key is absent
+		 * @return Iterator to the element with the key, and whether insertion took place
+		 */
+		inline std::pair<iterator, bool> insert( const value_type& value );
+		inline std::pair<iterator, bool> insert( value_type&& value );
+
+		/**
+		 * @brief Inserts @p value under @p key, or assigns it if the key exists
+		 * @return Iterator to the element, and whether insertion took place
+		 */
+		template <typename TMapped>
+		inline std::pair<iterator, bool> insert_or_assign( const TKey& key, TMapped&& value );
+
+		template <typename TMapped>
+		inline std::pair<iterator, bool> insert_or_assign( TKey&& key, TMapped&& value );
+
+		/** @brief insert_or_assign() with a precomputed hash, as for find( key, hash ) */
+		template <typename TMapped>
+		inline std::pair<iterator, bool> insert_or_assign( const TKey& key, uint64_t hash, TMapped&& value );
+
+		template <typename TMapped>
+		inline std::pair<iterator, bool> insert_or_assign( TKey&& key, uint64_t hash, TMapped&& value );
+
+		/**
+		 * @brief Constructs the mapped value in place from @p args if the key is absent
+		 * @return Iterator to the element, and whether insertion took place
+		 */
+		template <typename... TArgs>
+		inline std::pair<iterator, bool> try_emplace( const TKey& key, TArgs&&... args );
+
+		template <typename... TArgs>
+		inline std::pair<iterator, bool> try_emplace( TKey&& key, TArgs&&... args );
+
+		/**
+		 * @brief Removes the element with the given key
+		 * @return Number of elements removed (0 or 1)
+		 */
+		inline size_type erase( const TKey& key );
+
+		template <typename TLookup>
+			requires TransparentLookup<THasher, TKeyEqual>
+		inline size_type erase( const TLookup& key );
+
+		/** @brief erase() with a precomputed hash, as for find( key, hash ) */
+		inline size_type erase( const TKey& key, uint64_t hash );
+
+		template <typename TLookup>
+			requires TransparentLookup<THasher, TKeyEqual>
+		inline size_type erase( const TLookup& key, uint64_t hash );
+
+		/**
+		 * @brief Removes the element at @p position
+		 * @return Iterator to the next element
+		 */
+		inline iterator erase( const_iterator position );
+
+		/** @copydoc erase(const_iterator) */
+		inline iterator erase( iterator position );
+
+		/** @brief Removes all elements, keeping the allocated capacity */
+		inline void clear() noexcept;
+
+		/**
+		 * @brief Ensures @p count elements fit without rehashing
+		 * @param[in] count Number of elements
+		 */
+		inline void reserve( size_type count );
+
+		/** @brief Exchanges the contents of two maps */
+		inline void swap( FlatHashMap& other ) noexcept;
+
+	private:
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		template <typename TLookup>
+		[[nodiscard]] inline uint64_t hashOf( const TLookup& key ) const;
+
+		template <typename TLookup>
+		[[nodiscard]] inline size_type findIndex( const TLookup& key, uint64_t hash ) const;
+
+		[[nodiscard]] inline uint64_t probeStart( uint64_t hash ) const noexcept;
+		[[nodiscard]] inline size_type findFirstNonFull( uint64_t hash ) const noexcept;
+		[[nodiscard]] inline size_type findFirstNonFull( uint64_t hash, size_type& probeGroups ) const noexcept;
+
+		template <typename TKeyArg, typename... TArgs>
+		inline std::pair<iterator, bool> emplaceUnique( TKeyArg&& key, TArgs&&... args );
+
+		template <typename TKeyArg, typename... TArgs>
+		inline size_type insertNew( uint64_t hash, TKeyArg&& key, TArgs&&... args );
+
+		inline void setControl( size_type index, int8_t control ) noexcept;
+		inline void eraseAt( size_type index ) noexcept;
+		inline void resize( size_type newCapacity );
+		inline void destroyAll() noexcept;
+		inline void deallocate() noexcept;
+
+		[[nodiscard]] inline iterator iteratorAt( size_type index ) noexcept;
+		[[nodiscard]] inline const_iterator iteratorAt( size_type index ) const noexcept;
+
+		static inline size_type capacityFor( size_type count ) noexcept;
+		static inline size_type maxLoad( size_type capacity ) noexcept;
+
+		int8_t* m_control = nullptr;
+		value_type* m_slots = nullptr;
+		size_type m_capacity = 0;
+		size_type m_size = 0;
+		size_type m_growthLeft = 0;
+		[[no_unique_address]] THasher m_hasher{};
+		[[no_unique_address]] TKeyEqual m_equal{};
+		[[no_unique_address]] TSeedPolicy m_seedPolicy{};
+	};
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/FlatHashMap.inl"
@@ -0,0 +1,231 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FrozenMap.h
+ * @brief Compile-time perfect-hash map over string keys and a switch-on-string helper
+ * @details Declares FrozenMap, an immutable string-keyed map whose collision-free layout is
+ *          computed by a constexpr constructor, and StringSwitch, which turns a token list into
+ *          case labels. A lookup costs one string hash, one table load and one key compare.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+#include "Algorithms.h"
+#include "Hasher.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// FrozenMap
+	//=====================================================================
+
+	/**
+	 * @brief Immutable string-keyed map with a compile-time perfect hash
+	 * @tparam TValue Mapped type - a default-constructible literal type
+	 * @tparam N Number of entries
+	 * @tparam Policy String hash, policies::Crc32c (default) or policies::Fnv1a
+	 *
+	 * @details Keys are hashed once to 32 bits. The low bits pick a bucket whose 16-bit pilot,
+	 *          mixed with the hash by seedMix(), selects the key's slot (hash-and-displace). The
+	 *          constructor searches pilots bucket by bucket, largest first, and retries with a
+	 *          new hash seed if two keys share a hash. During constant evaluation keys are hashed
+	 *          with crc32cSoft() / fnv1a(); at run time CRC32-C uses the hardware instruction,
+	 *          which produces the same values. Unused slots hold a copy of the first entry, which
+	 *          can never match a key routed to them, so no occupancy flag is needed.
+	 *
+	 * Usage:
+	 * @code
+	 * constexpr auto METHODS = makeFrozenMap<int>( { { "GET", 1 }, { "PUT", 2 }, { "POST", 3 } } );
+	 * static_assert( *METHODS.find( "PUT" ) == 2 );
+	 * if ( const int* id = METHODS.find( token ) ) { ... }
+	 * @endcode
+	 */
+	template <typename TValue, std::size_t N, typename Policy = policies::Crc32c>
+	class FrozenMap final
+	{
+		static_assert( std::is_same_v<Policy, policies::Crc32c> || std::is_same_v<Policy, policies::Fnv1a>,
+			"FrozenMap requires a constexpr-capable policy: policies::Crc32c or policies::Fnv1a" );
+
+	public:
+		//----------------------------------------------
+		// Type definitions
+		//----------------------------------------------
+
+		using key_type = std::string_view;
+		using mapped_type = TValue;
+		using value_type = std::pair<std::string_view, TValue>;
+		using size_type = std::size_t;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Slots in the table (load factor at most 0.8) */
+		static constexpr std::size_t SLOT_COUNT{ std::bit_ceil( N + N / 4 + 1 ) };
+
+		/** @brief Buckets sharing a pilot (about two keys each) */
+		static constexpr std::size_t BUCKET_COUNT{ std::bit_ceil( N / 2 + 1 ) };
+
+		/** @brief Hash seeds tried before construction fails */
+		static constexpr uint32_t MAX_SEED_ATTEMPTS{ 64 };
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Lays out @p entries collision-free
+		 * @param[in] entries Key / value pairs; keys must be distinct and outlive the map
+		 * @throws std::invalid_argument on duplicate keys or if no seed works (a compile error in
+		 *         constant evaluation)
+		 */
+		constexpr explicit FrozenMap( const std::array<value_type, N>& entries );
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Finds @p key
+		 * @return Pointer to its value, or nullptr if absent
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] constexpr const TValue* find( std::string_view key ) const noexcept;
+
+		/** @brief Whether @p key is present */
+		[[nodiscard]] constexpr bool contains( std::string_view key ) const noexcept;
+
+		/**
+		 * @brief Value of @p key
+		 * @throws std::out_of_range if absent
+		 */
+		[[nodiscard]] constexpr const TValue& at( std::string_view key ) const;
+
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/** @brief Number of entries */
+		[[nodiscard]] static constexpr size_type size() noexcept;
+
+		/** @brief Hash seed selected by the constructor */
+		[[nodiscard]] constexpr uint32_t seed() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		/** @brief Attempts a layout with hash seed @p seed */
+		constexpr bool tryBuild( const std::array<value_type, N>& entries, uint32_t seed );
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		std::array<value_type, SLOT_COUNT> m_slots{};
+		std::array<uint16_t, BUCKET_COUNT> m_pilots{};
+		uint32_t m_seed = 0;
+	};
+
+	/**
+	 * @brief Builds a FrozenMap from a braced list of key / value pairs
+	 * @tparam TValue Mapped type
+	 * @tparam Policy String hash policy
+	 * @param[in] entries Key / value pairs
+	 * @return Frozen map; declare the result constexpr to build it at compile time
+	 */
+	template <typename TValue, typename Policy = policies::Crc32c, std::size_t N>
+	[[nodiscard]] constexpr FrozenMap<TValue, N, Policy> makeFrozenMap( const std::pair<std::string_view, TValue> ( &entries )[N] );
+
+	//=====================================================================
+	// StringSwitch
+	//=====================================================================
+
+	/**
+	 * @brief Maps a fixed token list to case labels for a switch statement
+	 * @tparam N Number of tokens
+	 * @tparam Policy String hash policy
+	 *
+	 * @details Token i maps to i; any other string maps to NO_MATCH. caseOf() is consteval and
+	 *          rejects strings that are not tokens, so a misspelled case label fails to compile.
+	 *
+	 * Usage:
+	 * @code
+	 * constexpr auto VERBS = makeStringSwitch( { "GET", "PUT", "POST" } );
+	 * switch ( VERBS( verb ) )
+	 * {
+	 *     case VERBS.caseOf( "GET" ): return get();
+	 *     case VERBS.caseOf( "PUT" ): return put();
+	 *     default: return unsupported();
+	 * }
+	 * @endcode
+	 */
+	template <std::size_t N, typename Policy = policies::Crc32c>
+	class StringSwitch final
+	{
+	public:
+		/** @brief Result for strings that are not tokens */
+		static constexpr std::size_t NO_MATCH{ N };
+
+		/**
+		 * @brief Builds the switch over @p tokens
+		 * @throws std::invalid_argument on duplicate tokens
+		 */
+		constexpr explicit StringSwitch( const std::array<std::string_view, N>& tokens );
+
+		/** @brief Index of @p token, or NO_MATCH */
+		[[nodiscard]] constexpr std::size_t operator()( std::string_view token ) const noexcept;
+
+		/**
+		 * @brief Case label of @p token
+		 * @details Compile error if @p token is not one of the tokens.
+		 */
+		[[nodiscard]] consteval std::size_t caseOf( std::string_view token ) const;
+
+	private:
+		/** @brief Pairs each token with its position */
+		static constexpr std::array<std::pair<std::string_view, std::size_t>, N> indexed( const std::array<std::string_view, N>& tokens );
+
+		FrozenMap<std::size_t, N, Policy> m_map;
+	};
+
+	/**
+	 * @brief Builds a StringSwitch from a braced list of tokens
+	 * @param[in] tokens Distinct tokens; case labels follow their order
+	 * @return String switch; declare the result constexpr
+	 */
+	template <typename Policy = policies::Crc32c, std::size_t N>
+	[[nodiscard]] constexpr StringSwitch<N, Policy> makeStringSwitch( const std::string_view ( &tokens )[N] );
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/FrozenMap.inl"
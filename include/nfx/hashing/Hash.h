@@ -84,6 +84,31 @@ namespace nfx::hashing
 	 */
 	template <typename T, Hash32or64 HashType = uint32_t, HashType Seed = ( sizeof( HashType ) == 4 ? constants::FNV_OFFSET_BASIS_32 : constants::FNV_OFFSET_BASIS_64 )>
 	[[nodiscard]] inline HashType hash( const T& value ) noexcept;
+
+	//=====================================================================
+	// Integer hash inversion
+	//=====================================================================
+
+	/**
+	 * @brief Recovers a 64-bit integer from its 64-bit hash
+	 * @tparam Seed The seed the value was hashed with (default: FNV_OFFSET_BASIS_64)
+	 * @param hash A value returned by `hash<uint64_t, uint64_t, Seed>()`
+	 * @return The hashed integer
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 *
+	 * @details
+	 * The 64-bit integer mixer (xor-shifts and multiplications by odd constants) is a bijection, so
+	 * `unhashInteger<Seed>( hash<uint64_t, uint64_t, Seed>( v ) ) == v` for every v except `Seed`
+	 * itself, which hashes to 0 like 0 does; 0 inverts to 0. With `Seed = 0` the round trip holds
+	 * for all 64-bit values, which lets a table store part of the hash instead of the key.
+	 *
+	 * @code
+	 * const uint64_t h = hash<uint64_t, uint64_t, 0>( 12345 );
+	 * const uint64_t v = unhashInteger<0>( h );   // 12345
+	 * @endcode
+	 */
+	template <uint64_t Seed = constants::FNV_OFFSET_BASIS_64>
+	[[nodiscard]] inline constexpr uint64_t unhashInteger( uint64_t hash ) noexcept;
 } // namespace nfx::hashing
 
 #include "nfx/detail/hashing/Hash.inl"
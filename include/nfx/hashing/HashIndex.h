@@ -0,0 +1,255 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file HashIndex.h
+ * @brief Immutable, memory-mappable hash index file: builder, zero-copy view and mapped reader
+ * @details Declares HashIndexBuilder, which lays out an open-addressed table of (hash, value) pairs
+ *          keyed by a stable Hasher in a versioned little-endian file, HashIndexView, which serves
+ *          lookups straight from the bytes, and MappedHashIndex, which maps such a file read-only.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "Hasher.h"
+#include "MappedFile.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// Hash index file format
+	//=====================================================================
+
+	/*
+	 * Layout (all words little-endian, 64-bit):
+	 *
+	 *   offset 0   header, 64 bytes
+	 *                [0] magic "NFXHIDX1"      [1] version | header size << 32
+	 *                [2] slot count (2^k)     [3] entry count
+	 *                [4] hasher check value   [5] offset of the slot array
+	 *                [6] reserved (0)         [7] reserved (0)
+	 *   offset 64  slot count x { stored hash, value }
+	 *
+	 * A stored hash of 0 marks an empty slot; a key whose hash is 0 is stored as 1. Slots are probed
+	 * linearly from `stored hash & ( slot count - 1 )` and the table is at most half full. The hasher
+	 * check value is the Hasher applied to a fixed string, so an index is never read with a hasher
+	 * (seed, policy or width) other than the one that built it.
+	 */
+
+	//=====================================================================
+	// HashIndexBuilder
+	//=====================================================================
+
+	/**
+	 * @brief Collects key / value pairs and writes them as an immutable hash index
+	 * @tparam THasher Stable 64-bit hash functor; the reader must use the same type
+	 *
+	 * @details Only the 64-bit hash of each key is stored, not the key: a lookup of a key that was
+	 *          never added can match only through a full 64-bit collision. Adding the same key twice,
+	 *          or two keys whose hashes collide, is reported by build(). Keys are told apart by their
+	 *          hash alone, so THasher needs full 64-bit entropy: the default FingerprintHasher has it,
+	 *          whereas the CRC32-C string hash of Hasher<uint64_t> collides within about 1M strings.
+	 *
+	 * Usage:
+	 * @code
+	 * HashIndexBuilder<> builder{ keys.size() };
+	 * for ( size_t i = 0; i < keys.size(); ++i ) { builder.add( keys[i], offsets[i] ); }
+	 * builder.write( "dataset.nfxidx" );
+	 * @endcode
+	 */
+	template <typename THasher = FingerprintHasher>
+	class HashIndexBuilder final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		HashIndexBuilder() = default;
+
+		/**
+		 * @brief Creates a builder expecting about @p expectedEntries entries
+		 * @param[in] expectedEntries Capacity to reserve
+		 */
+		explicit HashIndexBuilder( std::size_t expectedEntries );
+
+		//----------------------------------------------
+		// Population
+		//----------------------------------------------
+
+		/**
+		 * @brief Adds @p key with @p value
+		 * @param[in] key Any key type accepted by THasher
+		 * @param[in] value 64-bit payload, typically an offset into a data file
+		 */
+		template <typename TKey>
+		inline void add( const TKey& key, uint64_t value );
+
+		/** @brief Number of entries added */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		//----------------------------------------------
+		// Output
+		//----------------------------------------------
+
+		/**
+		 * @brief Lays out the complete index file in memory
+		 * @return File image, suitable for HashIndexView or for writing to disk
+		 * @throws std::invalid_argument on a duplicate key or 64-bit hash collision
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::vector<std::byte> build() const;
+
+		/**
+		 * @brief Builds the index and writes it to @p path
+		 * @throws std::invalid_argument as build(), std::runtime_error if the file cannot be written
+		 */
+		inline void write( const std::filesystem::path& path ) const;
+
+	private:
+		std::vector<std::pair<uint64_t, uint64_t>> m_entries;
+		[[no_unique_address]] THasher m_hasher{};
+	};
+
+	//=====================================================================
+	// HashIndexView
+	//=====================================================================
+
+	/**
+	 * @brief Read-only lookups directly on the bytes of a hash index file
+	 * @tparam THasher Hash functor the index was built with
+	 *
+	 * @details The view validates the header once and then reads slots in place - no copy, no
+	 *          parsing per lookup. The viewed bytes must outlive the view and be 8-byte aligned.
+	 */
+	template <typename THasher = FingerprintHasher>
+	class HashIndexView final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Creates an empty view on which every lookup misses */
+		HashIndexView() = default;
+
+		/**
+		 * @brief Validates and views a hash index image
+		 * @param[in] image Bytes of an index file
+		 * @throws std::runtime_error if the header is malformed, of another version, truncated or
+		 *         was produced by a different hasher
+		 */
+		explicit HashIndexView( std::span<const std::byte> image );
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Looks up @p key
+		 * @return Its value, or std::nullopt if absent
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <typename TKey>
+		[[nodiscard]] inline std::optional<uint64_t> find( const TKey& key ) const;
+
+		/** @brief Whether @p key is present */
+		template <typename TKey>
+		[[nodiscard]] inline bool contains( const TKey& key ) const;
+
+		/** @brief Number of entries */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		/** @brief Number of slots in the table */
+		[[nodiscard]] inline std::size_t slotCount() const noexcept;
+
+	private:
+		const uint64_t* m_slots = nullptr;
+		uint64_t m_mask = 0;
+		uint64_t m_size = 0;
+		[[no_unique_address]] THasher m_hasher{};
+	};
+
+	//=====================================================================
+	// MappedHashIndex
+	//=====================================================================
+
+	/**
+	 * @brief Hash index file mapped read-only into memory
+	 * @tparam THasher Hash functor the index was built with
+	 *
+	 * @details Opening costs one mmap / MapViewOfFile plus a header check, independent of the entry
+	 *          count; pages are faulted in on first access. Processes mapping the same file share its
+	 *          page-cache pages instead of each holding a private copy.
+	 */
+	template <typename THasher = FingerprintHasher>
+	class MappedHashIndex final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Maps the index file at @p path
+		 * @throws std::runtime_error if the file cannot be opened or mapped, or is not a valid index
+		 */
+		explicit MappedHashIndex( const std::filesystem::path& path );
+
+		MappedHashIndex( MappedHashIndex&& other ) noexcept;
+		MappedHashIndex& operator=( MappedHashIndex&& other ) noexcept;
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/** @copydoc HashIndexView::find */
+		template <typename TKey>
+		[[nodiscard]] inline std::optional<uint64_t> find( const TKey& key ) const;
+
+		/** @brief Whether @p key is present */
+		template <typename TKey>
+		[[nodiscard]] inline bool contains( const TKey& key ) const;
+
+		/** @brief Number of entries */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		/** @brief View over the mapped bytes */
+		[[nodiscard]] inline const HashIndexView<THasher>& view() const noexcept;
+
+	private:
+		MappedFile m_file;
+		HashIndexView<THasher> m_view;
+	};
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/HashIndex.inl"
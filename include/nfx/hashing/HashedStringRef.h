@@ -0,0 +1,152 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file HashedStringRef.h
+ * @brief 16-byte string reference carrying its length, prefix or hash, and short strings inline
+ * @details Declares HashedStringRef, a compact non-owning string key in the style of Umbra strings
+ *          whose equality test and Hasher overload settle most cases without reading heap bytes.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "Hasher.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// HashedStringRef
+	//=====================================================================
+
+	/**
+	 * @brief Compact string key: 4-byte length, then 12 bytes of inline characters or hash + pointer
+	 *
+	 * @details Layout (16 bytes, 8-byte aligned):
+	 *          - length <= INLINE_CAPACITY: [length][characters, zero padded to 12 bytes]
+	 *          - longer strings:            [length][32-bit hash][pointer to characters]
+	 *
+	 *          A short string is entirely inline, its first four characters forming the prefix word.
+	 *          A long string keeps the default Hasher<> (CRC32-C) value of its characters in that
+	 *          word instead: 16 bytes cannot hold length, prefix, pointer and hash, and a 32-bit hash
+	 *          rejects unequal strings of the same length far more often than a 4-character prefix.
+	 *          Equality therefore compares the first eight bytes, then either the inline bytes or,
+	 *          only when length and hash both match, the pointed-to characters.
+	 *
+	 *          The reference does not own long strings: their characters must outlive it (an arena,
+	 *          a StringInterner or a memory-mapped file, for instance). It can be compared only with
+	 *          other HashedStringRef values, so containers never mix it with a string hash computed
+	 *          differently.
+	 *
+	 * Usage:
+	 * @code
+	 * FlatHashMap<HashedStringRef, int, Hasher<>, std::equal_to<>> columns;
+	 * columns.try_emplace( HashedStringRef{ names.view( names.intern( "customer_id" ) ) }, 3 );
+	 * auto it = columns.find( HashedStringRef{ name } );  // hash computed once, reused by the table
+	 * @endcode
+	 */
+	class alignas( 8 ) HashedStringRef final
+	{
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Longest string stored inline */
+		static constexpr std::size_t INLINE_CAPACITY{ 12 };
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Creates an empty string reference */
+		HashedStringRef() = default;
+
+		/**
+		 * @brief References @p text, copying it inline if short and hashing it once otherwise
+		 * @param[in] text Characters; must outlive this reference if longer than INLINE_CAPACITY
+		 * @throws std::length_error if @p text is longer than 2^32 - 1 bytes
+		 */
+		explicit HashedStringRef( std::string_view text );
+
+		//----------------------------------------------
+		// Access
+		//----------------------------------------------
+
+		/** @brief Number of characters */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		/** @brief Whether the string is empty */
+		[[nodiscard]] inline bool empty() const noexcept;
+
+		/** @brief Whether the characters are stored inline */
+		[[nodiscard]] inline bool isInline() const noexcept;
+
+		/** @brief Pointer to the characters (inline storage for short strings) */
+		[[nodiscard]] inline const char* data() const noexcept;
+
+		/** @brief The characters as a string_view */
+		[[nodiscard]] inline std::string_view view() const noexcept;
+
+		/**
+		 * @brief Default Hasher<> value of the characters
+		 * @return The cached hash for long strings, computed from the inline bytes for short ones
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline uint32_t hash() const noexcept;
+
+		//----------------------------------------------
+		// Comparison
+		//----------------------------------------------
+
+		/** @brief Equality; reads heap characters only when length and cached hash both match */
+		[[nodiscard]] friend inline bool operator==( const HashedStringRef& lhs, const HashedStringRef& rhs ) noexcept
+		{
+			return lhs.equals( rhs );
+		}
+
+	private:
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		[[nodiscard]] inline uint32_t headWord() const noexcept;
+		[[nodiscard]] inline const char* pointer() const noexcept;
+		[[nodiscard]] inline bool equals( const HashedStringRef& other ) const noexcept;
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		uint32_t m_length = 0;
+		char m_bytes[INLINE_CAPACITY]{};
+	};
+
+	static_assert( sizeof( HashedStringRef ) == 16 );
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/HashedStringRef.inl"
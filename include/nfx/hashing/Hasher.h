@@ -25,8 +25,9 @@
 /**
  * @file Hasher.h
  * @brief STL-compatible hash functor for use with unordered containers
- * @details Provides Hasher<HashType, Seed> - a general-purpose hash functor supporting
- *          strings, integers, floats, pointers, enums, pairs, tuples, arrays, and custom types
+ * @details Provides Hasher<HashType, Seed, Policy> - a general-purpose hash functor supporting
+ *          strings, integers, floats, pointers, enums, pairs, tuples, arrays, and custom types,
+ *          with selectable string hashing policies (CRC32-C, FNV-1a, Larson, FarmHash, CityHash)
  */
 
 #pragma once
@@ -42,8 +43,8 @@
 #include <variant>
 #include <vector>
 
+#include "Algorithms.h"
 #include "Concepts.h"
-
 #include "Constants.h"
 
 namespace nfx::hashing
@@ -122,6 +123,111 @@ namespace nfx::hashing
 	{
 	};
 
+	class HashedStringRef;
+
+	//=====================================================================
+	// String hashing policies
+	//=====================================================================
+
+	namespace policies
+	{
+		/**
+		 * @brief CRC32-C string hashing (default policy)
+		 * @details Hardware-accelerated with SSE4.2 when available. 64-bit output runs two CRC32-C
+		 *          streams (normal and inverted bytes). Empty strings hash to 0 regardless of seed.
+		 */
+		struct Crc32c final
+		{
+			/**
+			 * @brief Hashes a string view with CRC32-C
+			 * @tparam HashType Hash value type - must be uint32_t or uint64_t
+			 * @tparam Seed Initial CRC register value
+			 * @param key String view to hash
+			 * @return Hash value
+			 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+			 */
+			template <Hash32or64 HashType, HashType Seed>
+			[[nodiscard]] static inline HashType hash( std::string_view key ) noexcept;
+		};
+
+		/**
+		 * @brief FNV-1a string hashing
+		 * @details Portable and fully deterministic without SIMD support. The seed is used as the
+		 *          offset basis. Empty strings hash to 0 regardless of seed.
+		 */
+		struct Fnv1a final
+		{
+			/**
+			 * @brief Hashes a string view with FNV-1a
+			 * @tparam HashType Hash value type - must be uint32_t or uint64_t
+			 * @tparam Seed Offset basis
+			 * @param key String view to hash
+			 * @return Hash value
+			 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+			 */
+			template <Hash32or64 HashType, HashType Seed>
+			[[nodiscard]] static inline HashType hash( std::string_view key ) noexcept;
+		};
+
+		/**
+		 * @brief Larson string hashing
+		 * @details Provided for benchmarking comparisons. Empty strings hash to 0 regardless of seed.
+		 */
+		struct Larson final
+		{
+			/**
+			 * @brief Hashes a string view with Larson's multiplicative hash
+			 * @tparam HashType Hash value type - must be uint32_t or uint64_t
+			 * @tparam Seed Initial hash value
+			 * @param key String view to hash
+			 * @return Hash value
+			 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+			 */
+			template <Hash32or64 HashType, HashType Seed>
+			[[nodiscard]] static inline HashType hash( std::string_view key ) noexcept;
+		};
+
+		/**
+		 * @brief FarmHash fingerprint string hashing
+		 * @details With Seed = 0 the 64-bit output is exactly farmFingerprint64() (BigQuery
+		 *          `FARM_FINGERPRINT`), including for empty strings. A non-zero seed selects
+		 *          farmHash64WithSeed(). 32-bit output folds the 64-bit value (high ^ low).
+		 */
+		struct FarmHash final
+		{
+			/**
+			 * @brief Hashes a string view with FarmHash
+			 * @tparam HashType Hash value type - must be uint32_t or uint64_t
+			 * @tparam Seed Seed value, 0 for the unseeded fingerprint
+			 * @param key String view to hash
+			 * @return Hash value
+			 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+			 */
+			template <Hash32or64 HashType, HashType Seed>
+			[[nodiscard]] static inline HashType hash( std::string_view key ) noexcept;
+		};
+
+		/**
+		 * @brief CityHash64 string hashing
+		 * @details With Seed = 0 the 64-bit output is exactly cityHash64(), including for empty
+		 *          strings. A non-zero seed selects the seeded cityHash64(). 32-bit output folds
+		 *          the 64-bit value (high ^ low).
+		 */
+		struct CityHash final
+		{
+			/**
+			 * @brief Hashes a string view with CityHash64
+			 * @tparam HashType Hash value type - must be uint32_t or uint64_t
+			 * @tparam Seed Seed value, 0 for the unseeded hash
+			 * @param key String view to hash
+			 * @return Hash value
+			 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+			 */
+			template <Hash32or64 HashType, HashType Seed>
+			[[nodiscard]] static inline HashType hash( std::string_view key ) noexcept;
+		};
+	} // namespace policies
+
 	//=====================================================================
 	// General-purpose STL-compatible hash functor
 	//=====================================================================
@@ -130,13 +236,14 @@ namespace nfx::hashing
 	 * @brief General-purpose STL-compatible hash functor supporting multiple types
 	 * @tparam HashType Hash value type - must be uint32_t or uint64_t (default: uint32_t)
 	 * @tparam Seed Initial seed value for hash calculation (default: FNV_OFFSET_BASIS_32 for 32-bit, FNV_OFFSET_BASIS_64 for 64-bit)
+	 * @tparam Policy String hashing algorithm (default: policies::Crc32c)
 	 *
 	 * @details This functor provides a unified hashing interface compatible with STL containers
 	 *          like std::unordered_map and std::unordered_set. It supports transparent lookup
 	 *          via the `is_transparent` type alias, allowing heterogeneous key comparisons.
 	 *
 	 *          **Supported Types:**
-	 *          - **Strings**: std::string, std::string_view, const char* → CRC32-C with SSE4.2 hardware acceleration (requires `-march=native`/`-msse4.2` or `/arch:AVX`)
+	 *          - **Strings**: std::string, std::string_view, const char* → Policy (default CRC32-C with SSE4.2 hardware acceleration, requires `-march=native`/`-msse4.2` or `/arch:AVX`)
 	 *          - **Integers**: All integral types → uses multiplicative hashing (Knuth/Wang)
 	 *          - **Pointers**: Generic pointers → hashes the address as uintptr_t
 	 *          - **Floating-point**: float, double → normalizes special values (+0/-0, NaN) and hashes bit representation
@@ -162,9 +269,12 @@ namespace nfx::hashing
 	 *          std::unordered_map<std::string, int, nfx::hashing::Hasher<>, std::equal_to<>> transparentMap;
 	 *          std::string_view key = "lookup";
 	 *          auto it = transparentMap.find(key); // No temporary string allocation
+	 *
+	 *          // FarmHash fingerprint policy (bit-exact with BigQuery FARM_FINGERPRINT)
+	 *          std::unordered_map<std::string, int, nfx::hashing::Hasher<uint64_t, 0, nfx::hashing::policies::FarmHash>> farmMap;
 	 *          @endcode
 	 */
-	template <Hash32or64 HashType = uint32_t, HashType Seed = ( sizeof( HashType ) == 4 ? constants::FNV_OFFSET_BASIS_32 : constants::FNV_OFFSET_BASIS_64 )>
+	template <Hash32or64 HashType = uint32_t, HashType Seed = ( sizeof( HashType ) == 4 ? constants::FNV_OFFSET_BASIS_32 : constants::FNV_OFFSET_BASIS_64 ), StringHashPolicy Policy = policies::Crc32c>
 	struct Hasher final
 	{
 		//----------------------------------------------
@@ -182,7 +292,7 @@ namespace nfx::hashing
 		//----------------------------------------------
 
 		/**
-		 * @brief Hashes a std::string_view using CRC32-C algorithm
+		 * @brief Hashes a std::string_view using the string hashing policy
 		 * @param key String view to hash
 		 * @return Hash value
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
@@ -190,7 +300,7 @@ namespace nfx::hashing
 		[[nodiscard]] inline HashType operator()( std::string_view key ) const noexcept;
 
 		/**
-		 * @brief Hashes a std::string using CRC32-C algorithm
+		 * @brief Hashes a std::string using the string hashing policy
 		 * @param key String to hash
 		 * @return Hash value
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
@@ -198,13 +308,24 @@ namespace nfx::hashing
 		[[nodiscard]] inline HashType operator()( const std::string& key ) const noexcept;
 
 		/**
-		 * @brief Hashes a C-style string using CRC32-C algorithm
+		 * @brief Hashes a C-style string using the string hashing policy
 		 * @param key Null-terminated string to hash
 		 * @return Hash value
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
 		[[nodiscard]] inline HashType operator()( const char* key ) const noexcept;
 
+		/**
+		 * @brief Hashes a HashedStringRef without reading its characters
+		 * @param key String reference to hash
+		 * @return The cached hash for the default 32-bit hasher; for 64-bit CRC32-C hashers, the
+		 *         cached hash and length mixed with this hasher's seed; otherwise the policy hash of
+		 *         the characters
+		 * @note Defined in HashedStringRef.h
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline HashType operator()( const HashedStringRef& key ) const noexcept;
+
 		//----------------------------------------------
 		// Integer type overloads
 		//----------------------------------------------
@@ -394,6 +515,20 @@ namespace nfx::hashing
 			HashType>
 		operator()( const TKey& key ) const noexcept;
 	};
+
+	//=====================================================================
+	// Full-entropy 64-bit hasher
+	//=====================================================================
+
+	/**
+	 * @brief 64-bit Hasher whose string hashes are FarmHash fingerprints
+	 * @details The default 64-bit CRC32-C string hash runs two streams that differ by a constant
+	 *          for a given length, so it carries about 32 bits of entropy: around 1M strings already
+	 *          give full 64-bit collisions. Static structures that identify keys by their 64-bit
+	 *          hash alone (MinimalPerfectHash, HashIndex) use this hasher by default. Integer and
+	 *          other non-string keys hash as with Hasher<uint64_t, 0>.
+	 */
+	using FingerprintHasher = Hasher<uint64_t, 0, policies::FarmHash>;
 } // namespace nfx::hashing
 
 #include "nfx/detail/hashing/Hasher.inl"
@@ -0,0 +1,203 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file HyperLogLog.h
+ * @brief HyperLogLog++ cardinality sketch with sparse and dense representations and AVX2 merge
+ * @details Declares HyperLogLog, which estimates the number of distinct 64-bit hashes it has seen
+ *          in 2^precision bytes, starts with an exact-precision sparse list for small cardinalities,
+ *          merges dense sketches 32 registers per instruction and serializes to a compact image.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Hasher.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// HyperLogLog
+	//=====================================================================
+
+	/**
+	 * @brief HyperLogLog++ distinct-count sketch fed by 64-bit hashes
+	 * @tparam THasher 64-bit hash functor used by insert(); must match across merged sketches
+	 *
+	 * @details Dense: the top `precision` bits of a hash select one of m = 2^precision registers,
+	 *          which keeps the largest rank (leading zeros + 1) of the remaining bits. Registers are
+	 *          one byte each, so merging is a byte-wise maximum: 32 registers per AVX2 VPMAXUB.
+	 *
+	 *          Sparse (HLL++): while few registers would be set, the sketch keeps a sorted list of
+	 *          (25-bit index, rank) entries plus an unsorted insertion buffer, and estimates by linear
+	 *          counting over 2^25 buckets, nearly exact for small sets. The list converts to dense
+	 *          registers, losslessly, once it would outgrow them.
+	 *
+	 *          The dense estimate uses Ertl's improved estimator over the register histogram, which
+	 *          is unbiased from empty to 2^64 without the empirical bias tables of the HLL++ paper.
+	 *          The relative standard error is about 1.04 / sqrt( m ): 0.81% at precision 14.
+	 *
+	 *          Image layout (little-endian): magic "NFXHLL01", version, precision | dense flag << 8 |
+	 *          entry count << 32, hasher check (4 x 8 bytes); then sparse entries as LEB128 deltas,
+	 *          or dense registers packed 6 bits each.
+	 *
+	 * Usage:
+	 * @code
+	 * HyperLogLog<> users;
+	 * users.insert( userId );
+	 * users.add( std::span<const uint64_t>{ batchOfHashes } );
+	 * shardTotal.merge( users );
+	 * const double distinct = shardTotal.estimate();
+	 * @endcode
+	 */
+	template <typename THasher = Hasher<uint64_t>>
+	class HyperLogLog final
+	{
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Smallest supported precision (16 registers) */
+		static constexpr unsigned int MIN_PRECISION{ 4 };
+
+		/** @brief Largest supported precision (262144 registers) */
+		static constexpr unsigned int MAX_PRECISION{ 18 };
+
+		/** @brief Default precision: 16 KiB of registers, 0.81% standard error */
+		static constexpr unsigned int DEFAULT_PRECISION{ 14 };
+
+		/** @brief Index bits of sparse entries */
+		static constexpr unsigned int SPARSE_PRECISION{ 25 };
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Creates an empty, sparse sketch
+		 * @param[in] precision Log2 of the register count, in [MIN_PRECISION, MAX_PRECISION]
+		 * @throws std::invalid_argument if @p precision is out of range
+		 */
+		explicit HyperLogLog( unsigned int precision = DEFAULT_PRECISION );
+
+		/**
+		 * @brief Restores a sketch from a serialized image
+		 * @param[in] image Bytes produced by serialize(); copied
+		 * @throws std::runtime_error if the image is malformed, truncated or built with a different hasher
+		 */
+		explicit HyperLogLog( std::span<const std::byte> image );
+
+		HyperLogLog( const HyperLogLog& ) = default;
+		HyperLogLog( HyperLogLog&& ) noexcept = default;
+		HyperLogLog& operator=( const HyperLogLog& ) = default;
+		HyperLogLog& operator=( HyperLogLog&& ) noexcept = default;
+		~HyperLogLog() = default;
+
+		//----------------------------------------------
+		// Modifiers
+		//----------------------------------------------
+
+		/** @brief Counts @p key, hashed with THasher */
+		template <typename TKey>
+		inline void insert( const TKey& key );
+
+		/** @brief Counts a key by its 64-bit hash */
+		inline void add( uint64_t hash );
+
+		/**
+		 * @brief Counts a run of keys by their 64-bit hashes
+		 * @details Equivalent to calling add() for each hash, with the representation checked once
+		 *          per run instead of once per hash.
+		 */
+		inline void add( std::span<const uint64_t> hashes );
+
+		/**
+		 * @brief Adds every key counted by @p other (register-wise maximum)
+		 * @param[in] other Sketch of the same precision
+		 * @throws std::invalid_argument if the precisions differ
+		 */
+		inline void merge( const HyperLogLog& other );
+
+		/** @brief Forgets every key and returns to the sparse representation */
+		inline void clear() noexcept;
+
+		//----------------------------------------------
+		// Query
+		//----------------------------------------------
+
+		/**
+		 * @brief Estimated number of distinct hashes counted
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline double estimate() const;
+
+		/** @brief Log2 of the register count */
+		[[nodiscard]] inline unsigned int precision() const noexcept;
+
+		/** @brief Whether the sketch still uses the sparse representation */
+		[[nodiscard]] inline bool isSparse() const noexcept;
+
+		//----------------------------------------------
+		// Serialization
+		//----------------------------------------------
+
+		/**
+		 * @brief Encodes the sketch into a compact portable image
+		 * @return Bytes accepted by the image constructor
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::vector<std::byte> serialize() const;
+
+	private:
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		/** @brief Merges the insertion buffer into the sorted sparse list; converts to dense when it outgrows the registers */
+		inline void flush();
+
+		/** @brief Moves every sparse entry into freshly allocated dense registers */
+		inline void toDense();
+
+		/** @brief Sorted sparse list including the insertion buffer, without modifying the sketch */
+		[[nodiscard]] inline std::vector<uint32_t> sparseEntries() const;
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		unsigned int m_precision;
+		std::vector<uint8_t> m_registers;
+		std::vector<uint32_t> m_sparse;
+		std::vector<uint32_t> m_pending;
+		[[no_unique_address]] THasher m_hasher{};
+	};
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/HyperLogLog.inl"
@@ -0,0 +1,331 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file LinearHashMap.h
+ * @brief Linear-hashing map that grows one bucket split at a time
+ * @details Declares LinearHashMap, a separately chained hash map whose bucket array is addressed
+ *          directly by the low bits of the Hasher output and grows incrementally, so no insertion
+ *          ever rehashes the whole table.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Concepts.h"
+#include "Hasher.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// LinearHashMap
+	//=====================================================================
+
+	/**
+	 * @brief Hash map with bounded per-insert rehash work (Litwin's linear hashing)
+	 * @tparam TKey Key type
+	 * @tparam TValue Mapped type
+	 * @tparam THasher Hash functor; its low bits address buckets directly
+	 * @tparam TKeyEqual Key equality predicate
+	 *
+	 * @details The table holds `2^level * INITIAL_BUCKETS + split` buckets. A key lives in bucket
+	 *          `hash mod 2^level * INITIAL_BUCKETS`, or in `hash mod 2^(level+1) * INITIAL_BUCKETS`
+	 *          when that first bucket has already been split in the current round. Whenever an
+	 *          insertion pushes the average chain length above max_load_factor(), exactly one bucket -
+	 *          the one at the split pointer - is divided in two by relinking its nodes; the split
+	 *          pointer then advances, and the level increments once every bucket of the round is split.
+	 *
+	 *          - Per-insert rehash work is one expected chain, not the whole table; there is no
+	 *            doubling pause. Buckets are allocated in fixed-size segments, so extending the bucket
+	 *            array never moves existing buckets either.
+	 *          - Each node stores its full hash, so splits never call the Hasher again.
+	 *          - Nodes never move: pointers and references to elements stay valid until erased, and
+	 *            iterators are invalidated only by insertion (a split may reorder chains) or erasure.
+	 *          - Heterogeneous lookup follows FlatHashMap: enabled when THasher and TKeyEqual are transparent.
+	 *
+	 * Usage:
+	 * @code
+	 * LinearHashMap<uint64_t, Session> sessions;
+	 * sessions.insert_or_assign( id, Session{ ... } );   // never stalls on a full-table rehash
+	 * if ( auto it = sessions.find( id ); it != sessions.end() ) { ... }
+	 * @endcode
+	 */
+	template <typename TKey, typename TValue, typename THasher = Hasher<uint64_t>, typename TKeyEqual = std::equal_to<>>
+	class LinearHashMap final
+	{
+		struct Node;
+
+	public:
+		//----------------------------------------------
+		// Type definitions
+		//----------------------------------------------
+
+		using key_type = TKey;
+		using mapped_type = TValue;
+		using value_type = std::pair<TKey, TValue>;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using hasher = THasher;
+		using key_equal = TKeyEqual;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Bucket count of an empty table (round 0) */
+		static constexpr size_type INITIAL_BUCKETS = 16;
+
+		/** @brief Buckets per directory segment */
+		static constexpr size_type SEGMENT_SIZE = 512;
+
+		/**
+		 * @brief Forward iterator over elements, bucket by bucket
+		 * @tparam IsConst Whether the iterator yields const references
+		 */
+		template <bool IsConst>
+		class Iterator final
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = LinearHashMap::value_type;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+			using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+			using map_pointer = std::conditional_t<IsConst, const LinearHashMap*, LinearHashMap*>;
+
+			Iterator() noexcept = default;
+
+			/** @brief Converts a mutable iterator into a const iterator */
+			template <bool OtherConst>
+				requires( IsConst && !OtherConst )
+			Iterator( const Iterator<OtherConst>& other ) noexcept
+				: m_map{ other.m_map },
+				  m_bucket{ other.m_bucket },
+				  m_node{ other.m_node }
+			{
+			}
+
+			[[nodiscard]] inline reference operator*() const noexcept;
+			[[nodiscard]] inline pointer operator->() const noexcept;
+			inline Iterator& operator++() noexcept;
+			inline Iterator operator++( int ) noexcept;
+
+			template <bool OtherConst>
+			[[nodiscard]] bool operator==( const Iterator<OtherConst>& other ) const noexcept
+			{
+				return m_node == other.m_node;
+			}
+
+		private:
+			friend class LinearHashMap;
+			template <bool>
+			friend class Iterator;
+
+			inline Iterator( map_pointer map, size_type bucket, Node* node ) noexcept;
+			inline void skipEmpty() noexcept;
+
+			map_pointer m_map = nullptr;
+			size_type m_bucket = 0;
+			Node* m_node = nullptr;
+		};
+
+		using iterator = Iterator<false>;
+		using const_iterator = Iterator<true>;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		LinearHashMap() = default;
+		LinearHashMap( std::initializer_list<value_type> init );
+		LinearHashMap( const LinearHashMap& other );
+		LinearHashMap( LinearHashMap&& other ) noexcept;
+		LinearHashMap& operator=( const LinearHashMap& other );
+		LinearHashMap& operator=( LinearHashMap&& other ) noexcept;
+		~LinearHashMap();
+
+		//----------------------------------------------
+		// Iterators
+		//----------------------------------------------
+
+		[[nodiscard]] inline iterator begin() noexcept;
+		[[nodiscard]] inline const_iterator begin() const noexcept;
+		[[nodiscard]] inline const_iterator cbegin() const noexcept;
+		[[nodiscard]] inline iterator end() noexcept;
+		[[nodiscard]] inline const_iterator end() const noexcept;
+		[[nodiscard]] inline const_iterator cend() const noexcept;
+
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/** @brief Whether the map holds no elements */
+		[[nodiscard]] inline bool empty() const noexcept;
+
+		/** @brief Number of elements */
+		[[nodiscard]] inline size_type size() const noexcept;
+
+		/** @brief Number of buckets currently addressable */
+		[[nodiscard]] inline size_type bucket_count() const noexcept;
+
+		/** @brief Average chain length */
+		[[nodiscard]] inline float load_factor() const noexcept;
+
+		/** @brief Average chain length above which an insertion splits one bucket */
+		[[nodiscard]] static constexpr float max_load_factor() noexcept
+		{
+			return 1.0f;
+		}
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Finds the element with key @p key
+		 * @return Iterator to the element, or end() if absent
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline iterator find( const TKey& key );
+		[[nodiscard]] inline const_iterator find( const TKey& key ) const;
+
+		/** @brief Heterogeneous find(), enabled when THasher and TKeyEqual are transparent */
+		template <typename TLookup>
+			requires TransparentLookup<THasher, TKeyEqual>
+		[[nodiscard]] inline iterator find( const TLookup& key );
+
+		template <typename TLookup>
+			requires TransparentLookup<THasher, TKeyEqual>
+		[[nodiscard]] inline const_iterator find( const TLookup& key ) const;
+
+		/** @brief Whether an element with key @p key exists */
+		[[nodiscard]] inline bool contains( const TKey& key ) const;
+
+		template <typename TLookup>
+			requires TransparentLookup<THasher, TKeyEqual>
+		[[nodiscard]] inline bool contains( const TLookup& key ) const;
+
+		/**
+		 * @brief Accesses the value of @p key
+		 * @throws std::out_of_range if the key is absent
+		 */
+		[[nodiscard]] inline TValue& at( const TKey& key );
+		[[nodiscard]] inline const TValue& at( const TKey& key ) const;
+
+		/** @brief Accesses the value of @p key, inserting a value-initialized one if absent */
+		inline TValue& operator[]( const TKey& key );
+		inline TValue& operator[]( TKey&& key );
+
+		//----------------------------------------------
+		// Modifiers
+		//----------------------------------------------
+
+		/**
+		 * @brief Inserts @p key or assigns to its value
+		 * @return Iterator to the element and whether it was inserted
+		 */
+		template <typename TMapped>
+		inline std::pair<iterator, bool> insert_or_assign( const TKey& key, TMapped&& value );
+
+		template <typename TMapped>
+		inline std::pair<iterator, bool> insert_or_assign( TKey&& key, TMapped&& value );
+
+		/**
+		 * @brief Constructs the value in place if @p key is absent
+		 * @return Iterator to the element and whether it was inserted
+		 */
+		template <typename... TArgs>
+		inline std::pair<iterator, bool> try_emplace( const TKey& key, TArgs&&... args );
+
+		template <typename... TArgs>
+		inline std::pair<iterator, bool> try_emplace( TKey&& key, TArgs&&... args );
+
+		/**
+		 * @brief Removes the element with key @p key
+		 * @return Number of elements removed (0 or 1)
+		 */
+		inline size_type erase( const TKey& key );
+
+		/** @brief Removes all elements and returns to the initial bucket count */
+		inline void clear() noexcept;
+
+		/** @brief Exchanges contents with @p other */
+		inline void swap( LinearHashMap& other ) noexcept;
+
+	private:
+		//----------------------------------------------
+		// Node
+		//----------------------------------------------
+
+		struct Node
+		{
+			value_type value;
+			uint64_t hash;
+			Node* next;
+		};
+
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		template <typename TLookup>
+		[[nodiscard]] inline uint64_t hashOf( const TLookup& key ) const;
+
+		[[nodiscard]] inline size_type bucketOf( uint64_t hash ) const noexcept;
+		[[nodiscard]] inline Node*& head( size_type bucket ) const noexcept;
+
+		template <typename TLookup>
+		[[nodiscard]] inline Node* findNode( const TLookup& key, uint64_t hash ) const;
+
+		template <typename TKeyArg, typename... TArgs>
+		inline std::pair<iterator, bool> emplaceUnique( TKeyArg&& key, TArgs&&... args );
+
+		inline void splitOne();
+		inline void destroyAll() noexcept;
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		std::vector<std::unique_ptr<Node*[]>> m_segments;
+		size_type m_roundBuckets = INITIAL_BUCKETS; // 2^level * INITIAL_BUCKETS
+		size_type m_split = 0;
+		size_type m_size = 0;
+		[[no_unique_address]] THasher m_hasher{};
+		[[no_unique_address]] TKeyEqual m_equal{};
+	};
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/LinearHashMap.inl"
@@ -0,0 +1,94 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file MappedFile.h
+ * @brief Read-only memory mapping of a whole file
+ * @details Declares MappedFile, the move-only owner of a read-only file mapping used by the
+ *          persisted index types (HashIndex, MinimalPerfectHash) to serve lookups in place.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// MappedFile
+	//=====================================================================
+
+	/**
+	 * @brief Whole file mapped read-only into the address space
+	 *
+	 * @details Uses mmap on POSIX systems and MapViewOfFile on Windows. The mapping starts on a
+	 *          page boundary, so word-aligned data in the file is word-aligned in memory. Pages
+	 *          are faulted in on first access and shared with other processes mapping the file.
+	 */
+	class MappedFile final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Creates an empty mapping */
+		MappedFile() = default;
+
+		/**
+		 * @brief Maps the file at @p path
+		 * @param[in] path File to map
+		 * @throws std::runtime_error if the file cannot be opened, is empty or cannot be mapped
+		 */
+		explicit MappedFile( const std::filesystem::path& path );
+
+		MappedFile( const MappedFile& ) = delete;
+		MappedFile& operator=( const MappedFile& ) = delete;
+
+		MappedFile( MappedFile&& other ) noexcept;
+		MappedFile& operator=( MappedFile&& other ) noexcept;
+
+		~MappedFile();
+
+		//----------------------------------------------
+		// Access
+		//----------------------------------------------
+
+		/** @brief Mapped bytes, empty if nothing is mapped */
+		[[nodiscard]] inline std::span<const std::byte> bytes() const noexcept;
+
+		/** @brief Size of the mapping in bytes */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+	private:
+		inline void unmap() noexcept;
+
+		const std::byte* m_data = nullptr;
+		std::size_t m_length = 0;
+	};
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/MappedFile.inl"
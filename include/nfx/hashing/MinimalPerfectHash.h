@@ -0,0 +1,216 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file MinimalPerfectHash.h
+ * @brief Minimal perfect hash function over a static key set
+ * @details Declares MinimalPerfectHash, a BBHash-style cascade of collision-free bit arrays built
+ *          in parallel from one Hasher evaluation per key. It maps each of n build keys to a
+ *          distinct index in [0, n) in about 2.9 bits per key, stores no keys, and serializes to
+ *          a little-endian image that can be queried in place from a MappedFile.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include "Hasher.h"
+#include "MappedFile.h"
+#include "RangeReduction.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// MinimalPerfectHash
+	//=====================================================================
+
+	/**
+	 * @brief Minimal perfect hash function (BBHash construction)
+	 * @tparam THasher Stable 64-bit hash functor, evaluated once per key. Two keys with equal hashes
+	 *                 cannot be separated, so it needs full 64-bit entropy; the default FarmHash
+	 *                 fingerprint has it, the CRC32-C string hash of Hasher<uint64_t> does not.
+	 *
+	 * @details Level l is a bit array of about gamma x (keys left) bits. Every remaining key is
+	 *          placed at a position derived from its hash and l; keys alone at their position set
+	 *          that bit and are done, colliding keys move on to level l + 1. A key's index is the
+	 *          rank of its bit across all levels, answered from a sampled popcount table. The few
+	 *          keys left after MAX_LEVELS levels are kept as a sorted list of hashes.
+	 *
+	 *          Both passes of every level run on all build threads: the occupancy arrays are set
+	 *          with atomic OR, so the image is identical whatever the thread count.
+	 *
+	 *          Image layout (64-bit little-endian words):
+	 *          - header: magic "NFXMPHF1", version | header size << 32, key count, level count,
+	 *            hasher check, fallback count, bit word count, reserved
+	 *          - per level: first bit word, bit count
+	 *          - level bit arrays, then one cumulative popcount per RANK_BLOCK_WORDS words
+	 *          - sorted hashes of the fallback keys
+	 *
+	 * Usage:
+	 * @code
+	 * auto mphf = MinimalPerfectHash<>::build( words );
+	 * table[mphf( "apple" )] = ...;          // index in [0, words.size())
+	 * mphf.write( "words.mphf" );
+	 * MinimalPerfectHash<> mapped{ MappedFile{ "words.mphf" } };
+	 * @endcode
+	 */
+	template <typename THasher = FingerprintHasher>
+	class MinimalPerfectHash final
+	{
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Levels before the remaining keys go to the fallback list */
+		static constexpr std::size_t MAX_LEVELS{ 40 };
+
+		/** @brief Bit words covered by one sampled rank */
+		static constexpr std::size_t RANK_BLOCK_WORDS{ 16 };
+
+		/** @brief Build parameters */
+		struct BuildOptions
+		{
+			/** @brief Bits per remaining key on each level; 1.0 minimizes space, larger values speed up queries */
+			double gamma = 1.0;
+
+			/** @brief Build threads; 0 uses std::thread::hardware_concurrency() */
+			std::size_t threadCount = 0;
+		};
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Creates an empty function */
+		MinimalPerfectHash() = default;
+
+		/**
+		 * @brief Builds the function for @p keys
+		 * @param[in] keys Random-access range of distinct keys accepted by THasher
+		 * @param[in] options Space / speed trade-off and thread count
+		 * @return Function mapping the keys onto [0, size())
+		 * @throws std::invalid_argument if two keys are equal or share a 64-bit hash, or gamma < 1
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <std::ranges::random_access_range TRange>
+		[[nodiscard]] static MinimalPerfectHash build( const TRange& keys, const BuildOptions& options = {} );
+
+		/**
+		 * @brief Views a serialized image without copying it
+		 * @param[in] image Bytes produced by serialize(); must outlive the function and be 8-byte aligned
+		 * @throws std::runtime_error if the image is malformed, truncated or built with a different hasher
+		 */
+		explicit MinimalPerfectHash( std::span<const std::byte> image );
+
+		/**
+		 * @brief Takes ownership of a mapped image file
+		 * @param[in] file Mapping of a file written by write()
+		 * @throws std::runtime_error as the image constructor
+		 */
+		explicit MinimalPerfectHash( MappedFile file );
+
+		MinimalPerfectHash( const MinimalPerfectHash& ) = delete;
+		MinimalPerfectHash& operator=( const MinimalPerfectHash& ) = delete;
+
+		MinimalPerfectHash( MinimalPerfectHash&& other ) noexcept;
+		MinimalPerfectHash& operator=( MinimalPerfectHash&& other ) noexcept;
+
+		~MinimalPerfectHash() = default;
+
+		//----------------------------------------------
+		// Query
+		//----------------------------------------------
+
+		/**
+		 * @brief Index of @p key
+		 * @param[in] key Key to look up
+		 * @return Distinct index in [0, size()) for each build key; an unspecified value in
+		 *         [0, size()] for any other key
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <typename TKey>
+		[[nodiscard]] inline uint64_t operator()( const TKey& key ) const noexcept;
+
+		/** @brief Number of keys */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		/** @brief Number of bit-array levels */
+		[[nodiscard]] inline std::size_t levelCount() const noexcept;
+
+		/** @brief Size of the serialized image in bits per key */
+		[[nodiscard]] inline double bitsPerKey() const noexcept;
+
+		//----------------------------------------------
+		// Serialization
+		//----------------------------------------------
+
+		/**
+		 * @brief Copies the image
+		 * @return Bytes accepted by the image constructor
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::vector<std::byte> serialize() const;
+
+		/**
+		 * @brief Writes the image to @p path
+		 * @throws std::runtime_error if the file cannot be written
+		 */
+		inline void write( const std::filesystem::path& path ) const;
+
+	private:
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		/** @brief Validates @p image and points the query fields into it */
+		inline void attach( std::span<const std::byte> image );
+
+		/** @brief Global rank of bit @p bit in word @p word */
+		[[nodiscard]] inline uint64_t rank( uint64_t word, uint64_t bit ) const noexcept;
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		std::vector<uint64_t> m_storage;
+		MappedFile m_file;
+		std::span<const uint64_t> m_image;
+		const uint64_t* m_levels = nullptr;
+		const uint64_t* m_bits = nullptr;
+		const uint64_t* m_ranks = nullptr;
+		const uint64_t* m_fallback = nullptr;
+		uint64_t m_size = 0;
+		uint64_t m_levelCount = 0;
+		uint64_t m_fallbackCount = 0;
+		[[no_unique_address]] THasher m_hasher{};
+	};
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/MinimalPerfectHash.inl"
@@ -0,0 +1,366 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file PersistentHashMap.h
+ * @brief Immutable hash array mapped trie with structural sharing, and an atomic snapshot root
+ * @details Declares PersistentHashMap, a HAMT whose updates return a new map that shares every
+ *          untouched node with the old one, and AtomicPersistentHashMap, which publishes successive
+ *          versions to concurrent readers who take snapshots with one wait-free atomic increment.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "Hasher.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// PersistentHashMap
+	//=====================================================================
+
+	/**
+	 * @brief Immutable hash map (HAMT) with O(log n) path-copying updates
+	 * @tparam TKey Key type
+	 * @tparam TValue Mapped type
+	 * @tparam THasher 64-bit hash functor
+	 * @tparam TKeyEqual Key equality predicate
+	 *
+	 * @details Each trie level consumes BITS_PER_LEVEL bits of the 64-bit hash. A node keeps two
+	 *          32-bit bitmaps - one for entries stored inline, one for child nodes - and packs both
+	 *          arrays densely, indexing them by the popcount of the bitmap below the hash fragment
+	 *          (CHAMP layout). Keys whose full hashes collide share a collision node below the last
+	 *          level. set() and erase() copy only the nodes on the path to the key and share the
+	 *          rest, so a map is cheap to copy and every old version stays valid and unchanged.
+	 *          Erasing keeps the trie canonical: a child left with a single entry is inlined.
+	 *
+	 * Usage:
+	 * @code
+	 * PersistentHashMap<std::string, int> v1;
+	 * auto v2 = v1.set( "timeout", 30 );     // v1 is still empty
+	 * auto v3 = v2.erase( "timeout" );
+	 * @endcode
+	 */
+	template <typename TKey, typename TValue, typename THasher = Hasher<uint64_t>, typename TKeyEqual = std::equal_to<TKey>>
+	class PersistentHashMap final
+	{
+	public:
+		//----------------------------------------------
+		// Type definitions
+		//----------------------------------------------
+
+		using key_type = TKey;
+		using mapped_type = TValue;
+		using value_type = std::pair<TKey, TValue>;
+		using size_type = std::size_t;
+		using hasher = THasher;
+		using key_equal = TKeyEqual;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Hash bits consumed per trie level */
+		static constexpr unsigned BITS_PER_LEVEL{ 5 };
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Creates an empty map */
+		PersistentHashMap() = default;
+
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/** @brief Number of entries */
+		[[nodiscard]] inline size_type size() const noexcept;
+
+		/** @brief Whether the map is empty */
+		[[nodiscard]] inline bool empty() const noexcept;
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Finds @p key
+		 * @return Pointer to its value, valid while any map sharing the node exists, or nullptr
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline const TValue* find( const TKey& key ) const;
+
+		/** @brief Whether @p key is present */
+		[[nodiscard]] inline bool contains( const TKey& key ) const;
+
+		/**
+		 * @brief Value of @p key
+		 * @throws std::out_of_range if absent
+		 */
+		[[nodiscard]] inline const TValue& at( const TKey& key ) const;
+
+		//----------------------------------------------
+		// Updates
+		//----------------------------------------------
+
+		/**
+		 * @brief Map with @p key set to @p value
+		 * @return New version; this map is unchanged
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline PersistentHashMap set( TKey key, TValue value ) const;
+
+		/**
+		 * @brief Map without @p key
+		 * @return New version (sharing this map's root if the key was absent)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline PersistentHashMap erase( const TKey& key ) const;
+
+		//----------------------------------------------
+		// Iteration
+		//----------------------------------------------
+
+		/**
+		 * @brief Calls @p function with every key / value pair, in trie order
+		 * @param[in] function Callable taking ( const TKey&, const TValue& )
+		 */
+		template <typename TFunction>
+		inline void for_each( TFunction&& function ) const;
+
+	private:
+		//----------------------------------------------
+		// Trie nodes
+		//----------------------------------------------
+
+		struct Entry
+		{
+			uint64_t hash;
+			value_type value;
+		};
+
+		struct Node;
+		using NodePtr = std::shared_ptr<const Node>;
+
+		/** @brief Trie node; below the last level, an unordered collision bucket */
+		struct Node
+		{
+			uint32_t entryMap = 0;
+			uint32_t childMap = 0;
+			std::vector<Entry> entries;
+			std::vector<NodePtr> children;
+		};
+
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		[[nodiscard]] static inline uint32_t fragmentBit( uint64_t hash, unsigned shift ) noexcept;
+		[[nodiscard]] static inline std::size_t indexOf( uint32_t map, uint32_t bit ) noexcept;
+		[[nodiscard]] static inline NodePtr mergeEntries( Entry first, Entry second, unsigned shift );
+		[[nodiscard]] inline NodePtr setIn( const NodePtr& node, Entry&& entry, unsigned shift, bool& added ) const;
+		[[nodiscard]] inline NodePtr eraseFrom( const NodePtr& node, uint64_t hash, const TKey& key, unsigned shift, bool& removed ) const;
+		template <typename TFunction>
+		static inline void visit( const Node& node, TFunction& function );
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		NodePtr m_root;
+		size_type m_size = 0;
+		[[no_unique_address]] THasher m_hasher{};
+		[[no_unique_address]] TKeyEqual m_keyEqual{};
+	};
+
+	//=====================================================================
+	// AtomicPersistentHashMap
+	//=====================================================================
+
+	/**
+	 * @brief Publishes PersistentHashMap versions to concurrent readers
+	 * @tparam TKey Key type
+	 * @tparam TValue Mapped type
+	 * @tparam THasher 64-bit hash functor
+	 * @tparam TKeyEqual Key equality predicate
+	 *
+	 * @details The root is one 64-bit atomic word: the version slot in the top 16 bits and the
+	 *          number of snapshots taken of that version in the low 48 bits. snapshot() is a
+	 *          single fetch_add on that word and releasing a snapshot a single fetch_add on the
+	 *          slot, so readers are wait-free and never touch a reference count shared with other
+	 *          readers' nodes. publish() swaps in a new slot and records how many snapshots the old
+	 *          version handed out; a retired slot is reused once as many have been released.
+	 *          Writers are serialized by a mutex and wait only if all MAX_VERSIONS slots are held
+	 *          by outstanding snapshots.
+	 *
+	 * Usage:
+	 * @code
+	 * AtomicPersistentHashMap<std::string, Route> routes;
+	 * routes.update( []( const auto& map ) { return map.set( "/api", Route{ ... } ); } );  // writer
+	 * auto snapshot = routes.snapshot();                                                   // reader
+	 * if ( const Route* route = snapshot->find( path ) ) { ... }
+	 * @endcode
+	 */
+	template <typename TKey, typename TValue, typename THasher = Hasher<uint64_t>, typename TKeyEqual = std::equal_to<TKey>>
+	class AtomicPersistentHashMap final
+	{
+	public:
+		//----------------------------------------------
+		// Type definitions
+		//----------------------------------------------
+
+		using map_type = PersistentHashMap<TKey, TValue, THasher, TKeyEqual>;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Versions that can be alive at once (current plus retired but still read) */
+		static constexpr std::size_t MAX_VERSIONS{ 64 };
+
+	private:
+		struct alignas( 64 ) Version
+		{
+			map_type map;
+			std::atomic<uint64_t> released{ 0 };
+			uint64_t acquired = 0;
+			bool inUse = false;
+			bool retired = false;
+		};
+
+	public:
+		//----------------------------------------------
+		// Snapshot
+		//----------------------------------------------
+
+		/** @brief Read-only view of one published version, released on destruction */
+		class Snapshot final
+		{
+		public:
+			Snapshot( const Snapshot& ) = delete;
+			Snapshot& operator=( const Snapshot& ) = delete;
+			inline Snapshot( Snapshot&& other ) noexcept;
+			inline Snapshot& operator=( Snapshot&& other ) noexcept;
+			inline ~Snapshot();
+
+			/** @brief The version's map */
+			[[nodiscard]] inline const map_type& operator*() const noexcept;
+
+			/** @brief The version's map */
+			[[nodiscard]] inline const map_type* operator->() const noexcept;
+
+		private:
+			friend class AtomicPersistentHashMap;
+
+			explicit inline Snapshot( Version* version ) noexcept;
+			inline void release() noexcept;
+
+			Version* m_version = nullptr;
+		};
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Publishes an empty map */
+		AtomicPersistentHashMap();
+
+		/** @brief Publishes @p initial */
+		explicit AtomicPersistentHashMap( map_type initial );
+
+		AtomicPersistentHashMap( const AtomicPersistentHashMap& ) = delete;
+		AtomicPersistentHashMap& operator=( const AtomicPersistentHashMap& ) = delete;
+
+		/** @brief Destroys all versions; no snapshot may outlive the map */
+		~AtomicPersistentHashMap() = default;
+
+		//----------------------------------------------
+		// Readers
+		//----------------------------------------------
+
+		/**
+		 * @brief Snapshot of the current version (wait-free)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline Snapshot snapshot() const noexcept;
+
+		/**
+		 * @brief Copy of the current version, independent of this object's lifetime
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline map_type load() const;
+
+		//----------------------------------------------
+		// Writers
+		//----------------------------------------------
+
+		/**
+		 * @brief Makes @p map the current version
+		 * @param[in] map New version
+		 */
+		inline void publish( map_type map );
+
+		/**
+		 * @brief Publishes the result of @p function applied to the current version
+		 * @param[in] function Callable taking const map_type& and returning map_type
+		 */
+		template <typename TFunction>
+		inline void update( TFunction&& function );
+
+	private:
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		/** @brief Frees retired versions whose snapshots have all been released */
+		inline void reclaim() noexcept;
+
+		/** @brief Publishes @p map; the writer mutex must be held */
+		inline void publishLocked( map_type&& map );
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		static constexpr unsigned SLOT_SHIFT{ 48 };
+		static constexpr uint64_t COUNT_MASK{ ( uint64_t{ 1 } << SLOT_SHIFT ) - 1 };
+
+		mutable std::array<Version, MAX_VERSIONS> m_versions;
+		alignas( 64 ) mutable std::atomic<uint64_t> m_root{ 0 };
+		std::mutex m_writerMutex;
+	};
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/PersistentHashMap.inl"
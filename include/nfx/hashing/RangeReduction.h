@@ -0,0 +1,126 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file RangeReduction.h
+ * @brief Multiply-high range reduction and Fibonacci hashing for bucket index computation
+ * @details Declares fastRange(), which maps a hash onto [0, range) for any range with one
+ *          multiply-high instead of a division, and fibonacciRange(), which maps a hash onto a
+ *          power-of-two range by keeping the high bits of a golden-ratio product. Both have
+ *          batched overloads that use AVX2 when the CPU supports it.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "Concepts.h"
+#include "Constants.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// Range reduction
+	//=====================================================================
+
+	//----------------------------------------------
+	// Scalar
+	//----------------------------------------------
+
+	/**
+	 * @brief Maps a hash uniformly onto [0, range) with a multiply-high (Lemire's fastrange)
+	 * @tparam HashType Hash value type - must be uint32_t or uint64_t
+	 * @param[in] hash Hash value; its high bits select the index
+	 * @param[in] range Number of buckets - any value, including non-powers of 2
+	 * @return ( hash * range ) >> bits of HashType, in [0, range - 1] (0 when range is 0)
+	 * @details Replaces `hash % range` at the cost of one multiplication. The index is monotonic in
+	 *          the hash, so the hash must be well mixed in its high bits: a hasher that only varies
+	 *          the low bits would collapse onto few buckets.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <Hash32or64 HashType>
+	[[nodiscard]] inline constexpr HashType fastRange( HashType hash, HashType range ) noexcept;
+
+	/**
+	 * @brief Maps a hash onto [0, 2^bits) with Fibonacci hashing
+	 * @tparam HashType Hash value type - must be uint32_t or uint64_t
+	 * @param[in] hash Hash value
+	 * @param[in] bits Log2 of the number of buckets - must be below the width of HashType
+	 * @return High @p bits bits of hash * 2^w / phi, in [0, 2^bits - 1]
+	 * @details The golden-ratio multiplication carries every input bit into the high bits of the
+	 *          product, so unlike `( x * c ) & ( size - 1 )` the index does not ignore the high bits
+	 *          of the hash and keeps working when the hash is weak in its low bits.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <Hash32or64 HashType>
+	[[nodiscard]] inline constexpr HashType fibonacciRange( HashType hash, unsigned int bits ) noexcept;
+
+	//----------------------------------------------
+	// Batched
+	//----------------------------------------------
+
+	/**
+	 * @brief Applies fastRange() to every hash of a run
+	 * @param[in] hashes Hash values
+	 * @param[in] range Number of buckets
+	 * @param[out] indexes Receives one index per hash - must hold at least hashes.size() elements and
+	 *             may be the same storage as @p hashes
+	 * @details Processes 8 hashes per instruction with AVX2 when the CPU supports it.
+	 */
+	inline void fastRange( std::span<const uint32_t> hashes, uint32_t range, std::span<uint32_t> indexes ) noexcept;
+
+	/**
+	 * @brief Applies fastRange() to every hash of a run
+	 * @param[in] hashes Hash values
+	 * @param[in] range Number of buckets
+	 * @param[out] indexes Receives one index per hash - must hold at least hashes.size() elements and
+	 *             may be the same storage as @p hashes
+	 * @details Processes 4 hashes per iteration with AVX2 when the CPU supports it, building each
+	 *          64-bit multiply-high from four 32-bit products.
+	 */
+	inline void fastRange( std::span<const uint64_t> hashes, uint64_t range, std::span<uint64_t> indexes ) noexcept;
+
+	/**
+	 * @brief Applies fibonacciRange() to every hash of a run
+	 * @param[in] hashes Hash values
+	 * @param[in] bits Log2 of the number of buckets - must be below 32
+	 * @param[out] indexes Receives one index per hash - must hold at least hashes.size() elements and
+	 *             may be the same storage as @p hashes
+	 * @details Processes 8 hashes per instruction with AVX2 when the CPU supports it.
+	 */
+	inline void fibonacciRange( std::span<const uint32_t> hashes, unsigned int bits, std::span<uint32_t> indexes ) noexcept;
+
+	/**
+	 * @brief Applies fibonacciRange() to every hash of a run
+	 * @param[in] hashes Hash values
+	 * @param[in] bits Log2 of the number of buckets - must be below 64
+	 * @param[out] indexes Receives one index per hash - must hold at least hashes.size() elements and
+	 *             may be the same storage as @p hashes
+	 * @details Processes 4 hashes per iteration with AVX2 when the CPU supports it.
+	 */
+	inline void fibonacciRange( std::span<const uint64_t> hashes, unsigned int bits, std::span<uint64_t> indexes ) noexcept;
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/RangeReduction.inl"
@@ -0,0 +1,239 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file SeedPolicies.h
+ * @brief Per-table seed policies for open-addressing tables
+ * @details Declares the policies a FlatHashMap uses to turn a key's hash into its probe start:
+ *          FixedSeed keeps the seedless layout, SaltedSeed gives every table instance its own seed,
+ *          and AdaptiveSeed watches probe lengths and reseeds the table through seedMix when they
+ *          become pathological.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "Algorithms.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// Per-instance salt
+	//=====================================================================
+
+	/**
+	 * @brief Seed unique to one table instance and unpredictable outside the process
+	 * @param[in] instance Address of the table (or of any object living as long as its layout)
+	 * @return Hash of @p instance and a random value drawn once per process
+	 * @details Pass it as the seed of seedMix(), bucketIndex() or batchLookup() so that two tables
+	 *          using the same Hasher still place keys independently: iterating one table and
+	 *          inserting into another then no longer delivers keys in the destination's probe order.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline uint64_t saltedSeed( const void* instance ) noexcept;
+
+	namespace policies
+	{
+		//=====================================================================
+		// Table seed policies
+		//=====================================================================
+
+		/*
+		 * A table seed policy is stored in the table and consulted on every probe and insertion:
+		 *
+		 *   MIXES_SEED                  false: probe start = hash >> 7; true: seedMix( seed(), hash, capacity )
+		 *   seed()                      current seed
+		 *   recordInsert( groups )      probe groups the new key needed beyond its home group;
+		 *                               returns true to request a reseed
+		 *   reseed()                    chooses a new seed; the table then rehashes at the same capacity
+		 *   onResize( capacity )        called whenever the table is rebuilt
+		 *
+		 * A copied table starts with a default-constructed policy (its elements are reinserted); a
+		 * moved table keeps its policy together with its slot layout.
+		 */
+
+		//----------------------------------------------
+		// FixedSeed
+		//----------------------------------------------
+
+		/**
+		 * @brief No seed: the probe start is taken directly from the hash
+		 * @details The default; costs nothing and never rehashes on its own.
+		 */
+		struct FixedSeed final
+		{
+			static constexpr bool MIXES_SEED{ false };
+
+			[[nodiscard]] constexpr uint64_t seed() const noexcept
+			{
+				return 0;
+			}
+
+			[[nodiscard]] constexpr bool recordInsert( std::size_t ) noexcept
+			{
+				return false;
+			}
+
+			constexpr void reseed() noexcept
+			{
+			}
+
+			constexpr void onResize( std::size_t ) noexcept
+			{
+			}
+		};
+
+		//----------------------------------------------
+		// SaltedSeed
+		//----------------------------------------------
+
+		/**
+		 * @brief A fixed seed per table instance, from saltedSeed()
+		 *
+		 * @details Tables sharing a Hasher and a fixed seed agree on key order: iterating one and
+		 *          inserting into a smaller one delivers keys in the order of their home slots, which
+		 *          piles them into ever longer clusters and makes the copy superlinear. Salting each
+		 *          instance decorrelates the layouts. The key is still hashed once; only the 64-bit hash
+		 *          is mixed with the salt by seedMix.
+		 */
+		class SaltedSeed final
+		{
+		public:
+			static constexpr bool MIXES_SEED{ true };
+
+			/** @brief Draws this instance's seed */
+			inline SaltedSeed() noexcept;
+
+			/** @brief This instance's seed */
+			[[nodiscard]] inline uint64_t seed() const noexcept;
+
+			[[nodiscard]] constexpr bool recordInsert( std::size_t ) noexcept
+			{
+				return false;
+			}
+
+			constexpr void reseed() noexcept
+			{
+			}
+
+			constexpr void onResize( std::size_t ) noexcept
+			{
+			}
+
+		private:
+			uint64_t m_seed;
+		};
+
+		//----------------------------------------------
+		// AdaptiveSeed
+		//----------------------------------------------
+
+		/**
+		 * @brief Reseeds the table when inserts show pathological probe lengths
+		 *
+		 * @details Inserts are observed in windows. At the end of a window the table is reseeded
+		 *          and rehashed in its current capacity if any insert needed more than
+		 *          MAX_PROBE_GROUPS extra groups, or if inserts averaged more than
+		 *          MAX_AVERAGE_PROBE_GROUPS. With random hashes at the 7/8 maximum load an extra group
+		 *          is needed about once per eight inserts, so either threshold means keys that
+		 *          collide after masking - a skewed distribution or an attack - and a fresh seed
+		 *          spreads them again.
+		 *
+		 *          Keys whose full 64-bit hashes are equal cannot be separated by any seed. To keep
+		 *          such input from rehashing forever, each reseed that does not follow a growth
+		 *          doubles the window, so rebuild work stays amortized O(1) per insert.
+		 *
+		 *          Every reseed increments reseedCount() and the process-wide totalReseeds()
+		 *          counter, which monitoring can export.
+		 */
+		class AdaptiveSeed final
+		{
+		public:
+			//----------------------------------------------
+			// Constants
+			//----------------------------------------------
+
+			static constexpr bool MIXES_SEED{ true };
+
+			/** @brief Extra probe groups a single insert may need before the window reseeds */
+			static constexpr std::size_t MAX_PROBE_GROUPS{ 16 };
+
+			/** @brief Average extra probe groups per insert tolerated over a window */
+			static constexpr std::size_t MAX_AVERAGE_PROBE_GROUPS{ 2 };
+
+			/** @brief Inserts per observation window after construction or growth */
+			static constexpr std::size_t INITIAL_WINDOW{ 128 };
+
+			//----------------------------------------------
+			// Table interface
+			//----------------------------------------------
+
+			/** @brief Current seed */
+			[[nodiscard]] inline uint64_t seed() const noexcept;
+
+			/**
+			 * @brief Records the probe length of one insert
+			 * @param[in] probeGroups Groups probed beyond the key's home group
+			 * @return true if the table should reseed now
+			 */
+			[[nodiscard]] inline bool recordInsert( std::size_t probeGroups ) noexcept;
+
+			/** @brief Switches to a new seed and counts the reseed */
+			inline void reseed() noexcept;
+
+			/** @brief Starts a new window; growth also resets the window length */
+			inline void onResize( std::size_t capacity ) noexcept;
+
+			//----------------------------------------------
+			// Statistics
+			//----------------------------------------------
+
+			/** @brief Reseeds performed by this table */
+			[[nodiscard]] inline uint64_t reseedCount() const noexcept;
+
+			/** @brief Longest insert probe, in extra groups, in the current window */
+			[[nodiscard]] inline std::size_t maxProbeGroups() const noexcept;
+
+			/** @brief Average insert probe, in extra groups, in the current window */
+			[[nodiscard]] inline double averageProbeGroups() const noexcept;
+
+			/** @brief Reseeds performed by all AdaptiveSeed tables in this process */
+			[[nodiscard]] static inline uint64_t totalReseeds() noexcept;
+
+		private:
+			uint64_t m_seed = 0;
+			uint64_t m_reseeds = 0;
+			std::size_t m_capacity = 0;
+			std::size_t m_window = INITIAL_WINDOW;
+			std::size_t m_inserts = 0;
+			std::size_t m_probeGroups = 0;
+			std::size_t m_maxProbeGroups = 0;
+		};
+	} // namespace policies
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/SeedPolicies.inl"
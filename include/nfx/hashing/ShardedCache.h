@@ -0,0 +1,353 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ShardedCache.h
+ * @brief Bounded, sharded LRU / CLOCK cache keyed through Hasher
+ * @details Declares ShardedCache and the LruCache / ClockCache aliases: a weight-bounded cache whose
+ *          shards each own a FlatHashMap index, an intrusive recency list and a node pool.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
+
+#include "Concepts.h"
+#include "FlatHashMap.h"
+#include "Hasher.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// Eviction policies
+	//=====================================================================
+
+	/** @brief Replacement policy of a ShardedCache */
+	enum class EvictionPolicy : uint8_t
+	{
+		/** @brief Exact least-recently-used order; a hit relinks its node under the shard's write lock */
+		Lru,
+
+		/** @brief CLOCK (second chance); a hit only sets a reference bit under the shard's read lock */
+		Clock
+	};
+
+	//=====================================================================
+	// ShardedCache
+	//=====================================================================
+
+	/**
+	 * @brief Thread-safe bounded cache sharded by the high bits of the key hash
+	 * @tparam TKey Key type
+	 * @tparam TValue Cached value type; returned by copy from get()
+	 * @tparam Policy Replacement policy
+	 * @tparam THasher Hash functor; the top bits select the shard
+	 * @tparam TKeyEqual Key equality predicate
+	 *
+	 * @details Capacity is expressed in weight units - one per entry by default, or any caller-defined
+	 *          cost such as bytes - and split evenly across shards. Each shard holds:
+	 *
+	 *          - a FlatHashMap from key to node;
+	 *          - an intrusive circular doubly-linked recency list threaded through the nodes;
+	 *          - a pool that carves nodes out of slabs and recycles evicted ones, so steady-state
+	 *            inserts perform no allocation besides the key and value themselves.
+	 *
+	 *          Writes (put, erase, eviction) take the shard's exclusive lock. With EvictionPolicy::Clock
+	 *          lookups only take the shared lock and set an atomic reference bit, so concurrent readers
+	 *          of a shard do not serialize; eviction gives referenced entries a second chance. With
+	 *          EvictionPolicy::Lru a hit moves its node to the front and therefore takes the exclusive lock.
+	 *
+	 * Usage:
+	 * @code
+	 * LruCache<std::string, std::string> cache{ 64 << 20 };   // 64 MiB budget
+	 * cache.put( key, value, key.size() + value.size() );
+	 * if ( auto hit = cache.get( key ) ) { ... }
+	 * @endcode
+	 */
+	template <typename TKey,
+		typename TValue,
+		EvictionPolicy Policy = EvictionPolicy::Lru,
+		typename THasher = Hasher<uint64_t>,
+		typename TKeyEqual = std::equal_to<>>
+	class ShardedCache final
+	{
+	public:
+		//----------------------------------------------
+		// Type definitions
+		//----------------------------------------------
+
+		using key_type = TKey;
+		using mapped_type = TValue;
+		using size_type = std::size_t;
+		using hasher = THasher;
+		using key_equal = TKeyEqual;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Creates a cache holding at most @p capacity weight units
+		 * @param[in] capacity Total weight budget, split evenly across shards
+		 * @param[in] shardCount Shard count, rounded up to a power of two; 0 selects four per hardware thread,
+		 *            or fewer when @p capacity is small. Either way the count is clamped so that every
+		 *            shard gets a budget of at least one unit.
+		 */
+		explicit ShardedCache( size_type capacity, size_type shardCount = 0 );
+
+		ShardedCache( const ShardedCache& ) = delete;
+		ShardedCache( ShardedCache&& ) = delete;
+		ShardedCache& operator=( const ShardedCache& ) = delete;
+		ShardedCache& operator=( ShardedCache&& ) = delete;
+
+		~ShardedCache();
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Copies the cached value of @p key and marks it recently used
+		 * @return The value, or std::nullopt on a miss
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::optional<TValue> get( const TKey& key );
+
+		/** @brief Heterogeneous get(), enabled when THasher and TKeyEqual are transparent */
+		template <typename TLookup>
+			requires TransparentLookup<THasher, TKeyEqual>
+		[[nodiscard]] inline std::optional<TValue> get( const TLookup& key );
+
+		/** @brief Whether @p key is cached; does not affect recency */
+		[[nodiscard]] inline bool contains( const TKey& key ) const;
+
+		//----------------------------------------------
+		// Modifiers
+		//----------------------------------------------
+
+		/**
+		 * @brief Inserts or replaces @p key, then evicts until its shard is within budget
+		 * @param[in] key Key
+		 * @param[in] value Value
+		 * @param[in] weight Cost of the entry in capacity units
+		 * @return false if @p weight alone exceeds a shard's budget (any previous entry for @p key is
+		 *         removed and nothing is cached), true otherwise
+		 */
+		inline bool put( const TKey& key, TValue value, size_type weight = 1 );
+
+		/**
+		 * @brief Removes @p key
+		 * @return Whether an entry was removed
+		 */
+		inline bool erase( const TKey& key );
+
+		/** @brief Removes every entry; pooled nodes are kept for reuse */
+		inline void clear();
+
+		//----------------------------------------------
+		// Statistics
+		//----------------------------------------------
+
+		/** @brief Number of cached entries (summed shard by shard) */
+		[[nodiscard]] inline size_type size() const;
+
+		/** @brief Total weight of the cached entries */
+		[[nodiscard]] inline size_type weight() const;
+
+		/** @brief Total weight budget */
+		[[nodiscard]] inline size_type capacity() const noexcept;
+
+		/** @brief Number of shards */
+		[[nodiscard]] inline size_type shardCount() const noexcept;
+
+		/** @brief Number of entries evicted to make room since construction */
+		[[nodiscard]] inline uint64_t evictions() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Intrusive node and pool
+		//----------------------------------------------
+
+		struct Link
+		{
+			Link* prev;
+			Link* next;
+		};
+
+		struct Node : Link
+		{
+			TKey key;
+			TValue value;
+			uint64_t hash; // Picks the shard and the index slot; kept so evictions and rehashes never hash the key again
+			size_type weight;
+			std::atomic<bool> referenced;
+		};
+
+		/** @brief Slab allocator recycling nodes through an intrusive free list */
+		class NodePool final
+		{
+		public:
+			NodePool() = default;
+			NodePool( const NodePool& ) = delete;
+			NodePool& operator=( const NodePool& ) = delete;
+			~NodePool();
+
+			template <typename TKeyArg>
+			[[nodiscard]] inline Node* create( TKeyArg&& key, TValue&& value, uint64_t hash, size_type weight );
+			inline void destroy( Node* node ) noexcept;
+
+		private:
+			static constexpr size_type SLAB_NODES = 64;
+
+			struct FreeNode
+			{
+				FreeNode* next;
+			};
+
+			std::vector<Node*> m_slabs;
+			FreeNode* m_free = nullptr;
+			size_type m_slabUsed = SLAB_NODES;
+		};
+
+		//----------------------------------------------
+		// Node index
+		//----------------------------------------------
+
+		/** @brief Hashes a node through its key, so the index does not store a second copy of it */
+		struct NodeHash
+		{
+			using is_transparent = void;
+
+			[[nodiscard]] inline uint64_t operator()( Node* node ) const noexcept
+			{
+				return node->hash;
+			}
+
+			template <typename TLookup>
+			[[nodiscard]] inline uint64_t operator()( const TLookup& key ) const
+			{
+				return static_cast<uint64_t>( hasher( key ) );
+			}
+
+			[[no_unique_address]] THasher hasher{};
+		};
+
+		/** @brief Compares nodes by identity and keys against a node's key */
+		struct NodeEqual
+		{
+			using is_transparent = void;
+
+			[[nodiscard]] inline bool operator()( Node* lhs, Node* rhs ) const noexcept
+			{
+				return lhs == rhs; // One node per key
+			}
+
+			template <typename TLookup>
+			[[nodiscard]] inline bool operator()( Node* node, const TLookup& key ) const
+			{
+				return keyEqual( node->key, key );
+			}
+
+			template <typename TLookup>
+			[[nodiscard]] inline bool operator()( const TLookup& key, Node* node ) const
+			{
+				return keyEqual( key, node->key );
+			}
+
+			[[no_unique_address]] TKeyEqual keyEqual{};
+		};
+
+		/** @brief Mapped type of the index; a node is its own key */
+		struct Indexed
+		{
+		};
+
+		//----------------------------------------------
+		// Shard
+		//----------------------------------------------
+
+		struct alignas( 64 ) Shard // One cache line apart: no false sharing between shard locks
+		{
+			mutable std::shared_mutex mutex;
+			FlatHashMap<Node*, Indexed, NodeHash, NodeEqual> index;
+			Link head{ &head, &head }; // Sentinel: head.next is the most recently inserted / used entry
+			NodePool pool;
+			size_type weight = 0;
+			size_type capacity = 0;
+		};
+
+		/** @brief Minimum weight budget per shard when the shard count is chosen automatically */
+		static constexpr size_type MIN_AUTO_SHARD_WEIGHT = 16;
+
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		/** @brief Hashes @p key once; the value picks the shard and is handed to the shard's index */
+		template <typename TLookup>
+		[[nodiscard]] inline uint64_t hashOf( const TLookup& key ) const;
+
+		[[nodiscard]] inline Shard& shardFor( uint64_t hash ) const noexcept;
+
+		template <typename TLookup>
+		[[nodiscard]] inline std::optional<TValue> getFrom( const TLookup& key, uint64_t hash );
+
+		static inline void unlink( Link* node ) noexcept;
+		static inline void pushFront( Shard& shard, Link* node ) noexcept;
+		inline void evictOne( Shard& shard );
+		inline void removeNode( Shard& shard, Node* node );
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		std::unique_ptr<Shard[]> m_shards;
+		size_type m_shardCount;
+		int m_shardShift;
+		size_type m_capacity;
+		std::atomic<uint64_t> m_evictions{ 0 };
+		[[no_unique_address]] THasher m_hasher{};
+	};
+
+	//=====================================================================
+	// Policy aliases
+	//=====================================================================
+
+	/** @brief Sharded cache with exact LRU replacement */
+	template <typename TKey, typename TValue, typename THasher = Hasher<uint64_t>, typename TKeyEqual = std::equal_to<>>
+	using LruCache = ShardedCache<TKey, TValue, EvictionPolicy::Lru, THasher, TKeyEqual>;
+
+	/** @brief Sharded cache with CLOCK replacement and shared-lock lookups */
+	template <typename TKey, typename TValue, typename THasher = Hasher<uint64_t>, typename TKeyEqual = std::equal_to<>>
+	using ClockCache = ShardedCache<TKey, TValue, EvictionPolicy::Clock, THasher, TKeyEqual>;
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/ShardedCache.inl"
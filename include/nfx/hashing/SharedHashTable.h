@@ -0,0 +1,316 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file SharedHashTable.h
+ * @brief Fixed-capacity hash table living in shared memory, with lock-free readers
+ * @details Declares SharedHashTable, an open-addressed table whose whole state - header and
+ *          buckets - sits in one shared-memory region addressed only by offsets, so several
+ *          processes can map it at different addresses and look keys up without a round trip.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+
+#include "Hasher.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// Shared hash table memory layout
+	//=====================================================================
+
+	/*
+	 * Layout (native 64-bit words; every process must share the same architecture):
+	 *
+	 *   offset 0   header, 128 bytes
+	 *                [0] magic "NFXSHMT1"        [1] version | header size << 32
+	 *                [2] bucket count (2^k)     [3] key bytes | value bytes << 32
+	 *                [4] hasher check value     [5] entry count (atomic)
+	 *                [6] writer lock (atomic)   [7] tombstone count (atomic)
+	 *                [8] compaction epoch       [9..15] reserved (0)
+	 *   offset 128 bucket count x { sequence, state, key words, value words }
+	 *
+	 * Buckets are probed linearly from `hash & ( bucket count - 1 )`. Each bucket carries a sequence
+	 * number that a writer makes odd while it changes the bucket and even again afterwards; readers
+	 * copy the bucket with relaxed atomic word loads and retry if the sequence moved (seqlock), so
+	 * they take no lock and never write to the region. The retries are bounded: a bucket whose
+	 * sequence stays odd (its writer died mid-update) reads as a miss. Writers serialize on the
+	 * header lock word, which holds the owner's process id.
+	 *
+	 * Erased buckets become tombstones, reused by later insertions. Once tombstones and entries
+	 * fill 7/8 of the buckets, with tombstones alone over 1/16, the writer rebuilds the table in
+	 * place so that misses find an empty bucket again. It makes the compaction epoch odd for the
+	 * duration, and readers repeat any probe that overlapped a rebuild.
+	 *
+	 * There are no pointers anywhere in the region. The magic is stored last, with release
+	 * ordering, so a process that sees it also sees an initialized table.
+	 */
+
+	//=====================================================================
+	// SharedHashTable
+	//=====================================================================
+
+	/**
+	 * @brief Open-addressed hash table in a shared-memory segment, readable from many processes
+	 * @tparam TKey Trivially copyable key type
+	 * @tparam TValue Trivially copyable value type
+	 * @tparam THasher Seed-stable 64-bit hash functor, identical in every process
+	 * @tparam TKeyEqual Key equality predicate
+	 *
+	 * @details The capacity is fixed when the region is created. Erased buckets become tombstones
+	 *          that later insertions reuse, and the table is rebuilt in place before they make
+	 *          lookups of absent keys probe too far. THasher must produce the same value for
+	 *          the same key in every process (the default Hasher does; a per-process random seed
+	 *          would not), which is verified through a check value stored in the header.
+	 *
+	 *          The writer lock records its owner's process id. A writer waiting on a process that
+	 *          has exited takes the lock over and repairs the table: a bucket left mid-update is
+	 *          dropped, the counters are recounted, and an interrupted compaction is closed (the
+	 *          entries it had not yet put back are lost). Until then readers keep working: lookups
+	 *          that reach a bucket left mid-update give up after a bounded number of retries and
+	 *          report a miss. Threads of one process are never taken over from each other, and a
+	 *          recycled process id delays recovery until that process exits too.
+	 *
+	 * Usage:
+	 * @code
+	 * // Owner process
+	 * auto sessions = SharedHashTable<uint64_t, Session>::create( "/sessions", 1 << 20 );
+	 * sessions.insert_or_assign( id, session );
+	 *
+	 * // Worker processes
+	 * auto sessions = SharedHashTable<uint64_t, Session>::open( "/sessions" );
+	 * if ( auto session = sessions.find( id ) ) { ... }
+	 * @endcode
+	 */
+	template <typename TKey, typename TValue, typename THasher = Hasher<uint64_t>, typename TKeyEqual = std::equal_to<TKey>>
+	class SharedHashTable final
+	{
+		static_assert( std::is_trivially_copyable_v<TKey> && std::is_default_constructible_v<TKey>,
+			"SharedHashTable keys are copied bytewise between processes" );
+		static_assert( std::is_trivially_copyable_v<TValue> && std::is_default_constructible_v<TValue>,
+			"SharedHashTable values are copied bytewise between processes" );
+
+	public:
+		//----------------------------------------------
+		// Type definitions
+		//----------------------------------------------
+
+		using key_type = TKey;
+		using mapped_type = TValue;
+		using size_type = std::size_t;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Header size in bytes */
+		static constexpr std::size_t HEADER_BYTES{ 128 };
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Bytes needed for a table of at least @p capacity entries
+		 * @param[in] capacity Minimum number of entries (rounded up to a power of two, at least 8)
+		 * @return Region size for initialize()
+		 */
+		[[nodiscard]] static inline std::size_t requiredBytes( std::size_t capacity ) noexcept;
+
+		/**
+		 * @brief Formats @p region as an empty table (e.g. a mapped memfd)
+		 * @param[in] region Writable memory of at least requiredBytes( capacity ), 8-byte aligned
+		 * @param[in] capacity Minimum number of entries
+		 * @return Non-owning table over @p region
+		 * @throws std::invalid_argument if the region is too small or misaligned
+		 */
+		[[nodiscard]] static SharedHashTable initialize( std::span<std::byte> region, std::size_t capacity );
+
+		/**
+		 * @brief Attaches to a region formatted by initialize() or create(), possibly in another process
+		 * @param[in] region The mapped region
+		 * @return Non-owning table over @p region
+		 * @throws std::runtime_error if the region does not hold a compatible table
+		 */
+		[[nodiscard]] static SharedHashTable attach( std::span<std::byte> region );
+
+		/**
+		 * @brief Creates the named shared-memory segment @p name and formats it
+		 * @param[in] name Segment name ("/name" on POSIX)
+		 * @param[in] capacity Minimum number of entries
+		 * @return Table owning its mapping
+		 * @throws std::runtime_error if the segment exists or cannot be created and mapped
+		 */
+		[[nodiscard]] static SharedHashTable create( const std::string& name, std::size_t capacity );
+
+		/**
+		 * @brief Maps the existing named segment @p name
+		 * @param[in] name Segment name
+		 * @return Table owning its mapping
+		 * @throws std::runtime_error if the segment cannot be opened or is not a compatible table
+		 */
+		[[nodiscard]] static SharedHashTable open( const std::string& name );
+
+		/**
+		 * @brief Removes the name of segment @p name; existing mappings stay valid
+		 * @return true if a segment was removed (always true on Windows, where it goes with its last handle)
+		 */
+		static bool remove( const std::string& name ) noexcept;
+
+		SharedHashTable( const SharedHashTable& ) = delete;
+		SharedHashTable& operator=( const SharedHashTable& ) = delete;
+
+		SharedHashTable( SharedHashTable&& other ) noexcept;
+		SharedHashTable& operator=( SharedHashTable&& other ) noexcept;
+
+		/** @brief Unmaps the region if this table owns it */
+		~SharedHashTable();
+
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/** @brief Number of entries */
+		[[nodiscard]] inline size_type size() const noexcept;
+
+		/** @brief Whether the table is empty */
+		[[nodiscard]] inline bool empty() const noexcept;
+
+		/** @brief Number of buckets, the maximum number of entries */
+		[[nodiscard]] inline size_type capacity() const noexcept;
+
+		//----------------------------------------------
+		// Lookup (lock-free)
+		//----------------------------------------------
+
+		/**
+		 * @brief Copy of the value of @p key
+		 * @return The value, or std::nullopt if absent or behind a bucket left mid-update by a dead writer
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::optional<TValue> find( const TKey& key ) const;
+
+		/** @brief Whether @p key is present */
+		[[nodiscard]] inline bool contains( const TKey& key ) const;
+
+		//----------------------------------------------
+		// Modifiers
+		//----------------------------------------------
+
+		/**
+		 * @brief Inserts @p key or overwrites its value
+		 * @return true if the key was inserted, false if it was assigned
+		 * @throws std::length_error if every bucket is occupied
+		 */
+		inline bool insert_or_assign( const TKey& key, const TValue& value );
+
+		/**
+		 * @brief Removes @p key
+		 * @return true if the key was present
+		 */
+		inline bool erase( const TKey& key );
+
+	private:
+		//----------------------------------------------
+		// Layout
+		//----------------------------------------------
+
+		static constexpr std::size_t KEY_WORDS{ ( sizeof( TKey ) + 7 ) / 8 };
+		static constexpr std::size_t VALUE_WORDS{ ( sizeof( TValue ) + 7 ) / 8 };
+		static constexpr std::size_t BUCKET_WORDS{ 2 + KEY_WORDS + VALUE_WORDS };
+		static constexpr std::size_t HEADER_WORDS{ HEADER_BYTES / 8 };
+
+		enum class BucketState : uint64_t
+		{
+			Empty = 0,
+			Full = 1,
+			Tombstone = 2
+		};
+
+		/** @brief Consistent copy of one bucket */
+		struct BucketCopy
+		{
+			BucketState state;
+			TKey key;
+			TValue value;
+		};
+
+		/** @brief Holds the cross-process writer lock for one scope, released on every exit path */
+		struct WriterGuard
+		{
+			explicit WriterGuard( SharedHashTable& table ) noexcept
+				: table{ table }
+			{
+				table.lockWriters();
+			}
+
+			WriterGuard( const WriterGuard& ) = delete;
+			WriterGuard& operator=( const WriterGuard& ) = delete;
+
+			~WriterGuard()
+			{
+				table.unlockWriters();
+			}
+
+			SharedHashTable& table;
+		};
+
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		SharedHashTable( uint64_t* words, std::size_t length, bool owned ) noexcept;
+
+		[[nodiscard]] static inline uint64_t hasherCheck();
+		[[nodiscard]] inline uint64_t* bucket( std::size_t index ) const noexcept;
+		[[nodiscard]] inline std::optional<BucketCopy> readBucket( std::size_t index ) const noexcept;
+		inline void writeBucket( std::size_t index, BucketState state, const TKey* key, const TValue* value ) noexcept;
+		inline void compactIfNeeded() noexcept;
+		inline void recoverFromDeadWriter() noexcept;
+		inline void lockWriters() noexcept;
+		inline void unlockWriters() noexcept;
+		inline void unmap() noexcept;
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		uint64_t* m_words = nullptr;
+		std::size_t m_length = 0;
+		std::size_t m_mask = 0;
+		bool m_owned = false;
+		[[no_unique_address]] THasher m_hasher{};
+		[[no_unique_address]] TKeyEqual m_keyEqual{};
+	};
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/SharedHashTable.inl"
@@ -0,0 +1,202 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file StringInterner.h
+ * @brief Concurrent, arena-backed string interner with dense 32-bit ids
+ * @details Declares StringInterner, which deduplicates strings through an open-addressed index of
+ *          atomic slots updated by compare-and-swap and stores their bytes in a bump-pointer arena.
+ *          Calls on different strings never wait for each other; a call that races the first
+ *          intern() of the same string blocks until that string's id is published.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "Hasher.h"
+
+namespace nfx::hashing
+{
+	//=====================================================================
+	// StringInterner
+	//=====================================================================
+
+	/**
+	 * @brief Thread-safe string interner returning dense ids and lifetime-stable string views
+	 *
+	 * @details Each distinct string is copied once into a chunked bump-pointer arena, next to its
+	 *          64-bit Hasher value and length, and receives the next id in 0, 1, 2, ... in order of
+	 *          first insertion. The index is an open-addressed array of atomic record pointers:
+	 *
+	 *          - intern() and find() probe without locks; an insert publishes its record with one
+	 *            compare-and-swap on an empty slot, so concurrent inserts of different strings never
+	 *            block each other, and concurrent inserts of the same string agree on one winner.
+	 *          - Ids are assigned after the CAS so that they stay dense, which makes the interner
+	 *            blocking rather than lock-free: a thread that meets a record whose id is still
+	 *            being assigned spins until the winner stores it. That is normally a few
+	 *            instructions, but a winner preempted in between holds up every intern() and find()
+	 *            of the same string until it runs again.
+	 *          - Views returned by view() and the ids themselves stay valid until the interner is
+	 *            destroyed; nothing is ever moved or freed earlier.
+	 *          - The capacity (maximum number of distinct strings) is fixed at construction so the
+	 *            index never rehashes; it is kept at most half full.
+	 *
+	 * Usage:
+	 * @code
+	 * StringInterner names{ 1u << 20 };
+	 * const uint32_t id = names.intern( "http.requests.total" );   // any thread
+	 * std::string_view name = names.view( id );                   // valid for the interner's lifetime
+	 * @endcode
+	 */
+	class StringInterner final
+	{
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Id returned by find() for strings that were never interned */
+		static constexpr uint32_t INVALID_ID = UINT32_MAX;
+
+		/** @brief Size of one arena chunk; longer strings get a dedicated allocation */
+		static constexpr std::size_t ARENA_CHUNK_SIZE = std::size_t{ 1 } << 20;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Creates an interner for up to @p capacity distinct strings
+		 * @param[in] capacity Maximum number of distinct strings
+		 */
+		explicit StringInterner( uint32_t capacity = 1u << 20 );
+
+		StringInterner( const StringInterner& ) = delete;
+		StringInterner( StringInterner&& ) = delete;
+		StringInterner& operator=( const StringInterner& ) = delete;
+		StringInterner& operator=( StringInterner&& ) = delete;
+
+		~StringInterner();
+
+		//----------------------------------------------
+		// Interning
+		//----------------------------------------------
+
+		/**
+		 * @brief Returns the id of @p text, inserting it if it is new
+		 * @param[in] text String to intern
+		 * @return Dense id in [0, capacity - 1]
+		 * @throws std::length_error if @p text is new and the interner is full
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline uint32_t intern( std::string_view text );
+
+		/**
+		 * @brief Looks up @p text without inserting it
+		 * @return Its id, or INVALID_ID if it was never interned
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline uint32_t find( std::string_view text ) const noexcept;
+
+		/**
+		 * @brief Returns the interned bytes of @p id
+		 * @param[in] id Id previously returned by intern() or find(), hence below size(); other
+		 *               values are undefined behavior (checked by an assertion in debug builds)
+		 * @return View valid for the lifetime of the interner
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::string_view view( uint32_t id ) const noexcept;
+
+		//----------------------------------------------
+		// Statistics
+		//----------------------------------------------
+
+		/** @brief Number of distinct strings interned */
+		[[nodiscard]] inline uint32_t size() const noexcept;
+
+		/** @brief Maximum number of distinct strings */
+		[[nodiscard]] inline uint32_t capacity() const noexcept;
+
+		/** @brief Bytes taken from the arena so far, including record headers, padding and large-string blocks */
+		[[nodiscard]] inline std::size_t arenaBytes() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Arena record
+		//----------------------------------------------
+
+		/** @brief Header stored in front of the string bytes */
+		struct Record
+		{
+			uint64_t hash;
+			std::atomic<uint32_t> id;
+			uint32_t length;
+
+			[[nodiscard]] const char* data() const noexcept
+			{
+				return reinterpret_cast<const char*>( this + 1 );
+			}
+		};
+
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		[[nodiscard]] inline const Record* probe( std::string_view text, uint64_t hash, Record* candidate, bool& inserted ) noexcept;
+		[[nodiscard]] inline Record* makeRecord( std::string_view text, uint64_t hash );
+		[[nodiscard]] inline void* allocate( std::size_t bytes );
+		[[nodiscard]] static inline bool matches( const Record* record, std::string_view text, uint64_t hash ) noexcept;
+		[[nodiscard]] static inline uint32_t publishedId( const Record* record ) noexcept;
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		static constexpr std::size_t MAX_CHUNKS = 4096;
+
+		struct LargeBlock
+		{
+			LargeBlock* next;
+		};
+
+		uint32_t m_capacity;
+		std::size_t m_indexMask;
+		std::unique_ptr<std::atomic<Record*>[]> m_index;
+		std::unique_ptr<std::atomic<const Record*>[]> m_records;
+		std::unique_ptr<std::atomic<char*>[]> m_chunks;
+		std::atomic<LargeBlock*> m_largeBlocks{ nullptr };
+		std::atomic<std::size_t> m_arenaOffset{ 0 };
+		std::atomic<std::size_t> m_largeBytes{ 0 };
+		std::atomic<uint32_t> m_reserved{ 0 };
+		std::atomic<uint32_t> m_nextId{ 0 };
+		Hasher<uint64_t> m_hasher{};
+	};
+} // namespace nfx::hashing
+
+#include "nfx/detail/hashing/StringInterner.inl"
@@ -0,0 +1,150 @@
+/**
+ * @file TESTS_BatchLookup.cpp
+ * @brief Tests for the batched hash-and-prefetch lookup pipeline
+ * @details Verifies that batchLookup() visits every key once, in order, with the bucket produced by
+ *          bucketIndex(), and that it drives a std::vector-backed linear-probing table correctly
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// Batched lookup tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test table
+	//----------------------------------------------
+
+	/** @brief Minimal linear-probing table; key 0 marks an empty slot */
+	struct LinearTable
+	{
+		struct Entry
+		{
+			uint64_t key = 0;
+			uint64_t value = 0;
+		};
+
+		explicit LinearTable( uint64_t bucketCount, uint64_t tableSeed )
+			: entries( bucketCount ),
+			  seed{ tableSeed }
+		{
+		}
+
+		void insert( uint64_t key, uint64_t value )
+		{
+			uint64_t bucket = bucketIndex( hasher, key, entries.size(), seed );
+			while ( entries[bucket].key != 0 )
+			{
+				bucket = ( bucket + 1 ) & ( entries.size() - 1 );
+			}
+			entries[bucket] = { key, value };
+		}
+
+		const Entry* probe( uint64_t key, uint64_t bucket ) const
+		{
+			while ( entries[bucket].key != 0 )
+			{
+				if ( entries[bucket].key == key )
+				{
+					return &entries[bucket];
+				}
+				bucket = ( bucket + 1 ) & ( entries.size() - 1 );
+			}
+
+			return nullptr;
+		}
+
+		std::vector<Entry> entries;
+		uint64_t seed;
+		Hasher<uint64_t> hasher;
+	};
+
+	//----------------------------------------------
+	// Pipeline ordering
+	//----------------------------------------------
+
+	TEST( BatchLookup, VisitsEveryKeyInOrder )
+	{
+		for ( const size_t count : { size_t{ 0 }, size_t{ 1 }, size_t{ 15 }, size_t{ 16 }, size_t{ 17 }, size_t{ 1000 } } )
+		{
+			std::vector<uint64_t> keys( count );
+			for ( size_t i = 0; i < count; ++i )
+			{
+				keys[i] = i * 7919 + 1;
+			}
+
+			std::vector<uint64_t> buckets( 1024 );
+			size_t expectedPosition = 0;
+			batchLookup(
+				keys, buckets.size(),
+				[&]( uint64_t bucket ) { return &buckets[bucket]; },
+				[&]( size_t position, uint64_t key, uint64_t bucket ) {
+					EXPECT_EQ( position, expectedPosition++ );
+					EXPECT_EQ( key, keys[position] );
+					EXPECT_EQ( bucket, bucketIndex( Hasher<uint64_t>{}, key, buckets.size(), 99 ) );
+				},
+				99 );
+			EXPECT_EQ( expectedPosition, count );
+		}
+	}
+
+	TEST( BatchLookup, StringKeysWithCustomDistance )
+	{
+		const std::vector<std::string> keys{ "alpha", "beta", "gamma", "delta", "epsilon" };
+		const Hasher<uint32_t> hasher;
+
+		size_t visited = 0;
+		batchLookup<2>(
+			keys, 64,
+			[]( uint64_t ) -> const void* { return nullptr; },
+			[&]( size_t, const std::string& key, uint64_t bucket ) {
+				EXPECT_EQ( bucket, bucketIndex( hasher, key, 64 ) );
+				EXPECT_LT( bucket, 64u );
+				++visited;
+			},
+			0, hasher );
+		EXPECT_EQ( visited, keys.size() );
+	}
+
+	//----------------------------------------------
+	// Vector-backed table
+	//----------------------------------------------
+
+	TEST( BatchLookup, ProbesVectorBackedTable )
+	{
+		LinearTable table{ 1 << 12, 0x5EED };
+		for ( uint64_t key = 1; key <= 3000; ++key )
+		{
+			table.insert( key, key * 10 );
+		}
+
+		std::vector<uint64_t> queries;
+		for ( uint64_t key = 1; key <= 6000; key += 3 )
+		{
+			queries.push_back( key );
+		}
+
+		size_t hits = 0;
+		batchLookup(
+			queries, table.entries.size(),
+			[&]( uint64_t bucket ) { return &table.entries[bucket]; },
+			[&]( size_t, uint64_t key, uint64_t bucket ) {
+				const auto* entry = table.probe( key, bucket );
+				EXPECT_EQ( entry != nullptr, key <= 3000 );
+				if ( entry )
+				{
+					EXPECT_EQ( entry->value, key * 10 );
+					++hits;
+				}
+			},
+			table.seed );
+		EXPECT_EQ( hits, 1000u );
+	}
+} // namespace nfx::hashing::test
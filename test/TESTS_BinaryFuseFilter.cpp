@@ -0,0 +1,150 @@
+/**
+ * @file TESTS_BinaryFuseFilter.cpp
+ * @brief Tests for the binary fuse filter
+ * @details Validates membership of every build key across set sizes, the false positive rate and
+ *          space, duplicate keys, that parallel and serial builds produce the same image, and
+ *          serialized, mapped and malformed images
+ */
+
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// BinaryFuseFilter tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	static std::vector<uint64_t> randomKeys( std::size_t count, uint64_t seed )
+	{
+		std::mt19937_64 rng{ seed };
+		std::vector<uint64_t> keys( count );
+		for ( auto& key : keys )
+		{
+			key = rng();
+		}
+
+		return keys;
+	}
+
+	//----------------------------------------------
+	// Membership
+	//----------------------------------------------
+
+	TEST( BinaryFuseFilter, ContainsEveryKeyAcrossSizes )
+	{
+		for ( const std::size_t count : { 0u, 1u, 2u, 3u, 10u, 100u, 1000u, 20000u } )
+		{
+			const auto keys = randomKeys( count, count );
+			const auto filter = BinaryFuseFilter<>::build( keys );
+			EXPECT_EQ( filter.size(), count );
+			for ( const auto key : keys )
+			{
+				ASSERT_TRUE( filter.contains( key ) ) << count;
+			}
+		}
+
+		const BinaryFuseFilter<> empty;
+		EXPECT_FALSE( empty.contains( uint64_t{ 1 } ) );
+	}
+
+	TEST( BinaryFuseFilter, FalsePositiveRateAndSpace )
+	{
+		constexpr std::size_t count = 1000000;
+		std::vector<std::string> keys;
+		keys.reserve( count );
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			keys.push_back( "key:" + std::to_string( i ) );
+		}
+		const auto filter = BinaryFuseFilter<>::build( keys );
+		for ( const auto& key : keys )
+		{
+			ASSERT_TRUE( filter.contains( key ) );
+		}
+
+		std::size_t falsePositives = 0;
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			falsePositives += filter.contains( "other:" + std::to_string( i ) );
+		}
+		const double rate = static_cast<double>( falsePositives ) / count;
+		EXPECT_GT( rate, 0.0033 );
+		EXPECT_LT( rate, 0.0045 );
+		EXPECT_LT( filter.bitsPerKey(), 9.1 );
+	}
+
+	TEST( BinaryFuseFilter, DuplicateKeysAreDropped )
+	{
+		auto keys = randomKeys( 5000, 3 );
+		keys.insert( keys.end(), keys.begin(), keys.begin() + 100 );
+		const auto filter = BinaryFuseFilter<>::build( keys );
+		EXPECT_EQ( filter.size(), 5000u );
+		for ( const auto key : keys )
+		{
+			ASSERT_TRUE( filter.contains( key ) );
+		}
+	}
+
+	TEST( BinaryFuseFilter, ParallelBuildMatchesSerialBuild )
+	{
+		const auto keys = randomKeys( 300000, 4 );
+		const auto serial = BinaryFuseFilter<>::build( keys, { .threadCount = 1 } );
+		const auto parallel = BinaryFuseFilter<>::build( keys, { .threadCount = 4 } );
+		EXPECT_EQ( serial.serialize(), parallel.serialize() );
+
+		const auto reseeded = BinaryFuseFilter<>::build( keys, { .threadCount = 1, .seed = 99 } );
+		EXPECT_NE( reseeded.serialize(), serial.serialize() );
+	}
+
+	//----------------------------------------------
+	// Images
+	//----------------------------------------------
+
+	TEST( BinaryFuseFilter, ImagesRoundTripAndRejectMalformedInput )
+	{
+		const auto keys = randomKeys( 10000, 5 );
+		const auto built = BinaryFuseFilter<>::build( keys );
+		const auto image = built.serialize();
+		const BinaryFuseFilter<> viewed{ image };
+		EXPECT_EQ( viewed.size(), built.size() );
+		for ( uint64_t key = 0; key < 10000; ++key )
+		{
+			ASSERT_EQ( viewed.contains( key ), built.contains( key ) );
+			ASSERT_TRUE( viewed.contains( keys[key] ) );
+		}
+
+		auto badMagic = image;
+		badMagic[0] = std::byte{ 'X' };
+		EXPECT_THROW( BinaryFuseFilter<>{ badMagic }, std::runtime_error );
+		const std::span<const std::byte> truncated{ image.data(), image.size() - 8 };
+		EXPECT_THROW( BinaryFuseFilter<>{ truncated }, std::runtime_error );
+		using OtherSeed = BinaryFuseFilter<Hasher<uint64_t, 1>>;
+		EXPECT_THROW( OtherSeed{ image }, std::runtime_error );
+
+		const auto path = std::filesystem::temp_directory_path() / "nfx_fuse_mapped.fuse";
+		built.write( path );
+		{
+			BinaryFuseFilter<> mapped{ MappedFile{ path } };
+			for ( const auto key : keys )
+			{
+				ASSERT_TRUE( mapped.contains( key ) );
+			}
+
+			BinaryFuseFilter<> moved{ std::move( mapped ) };
+			EXPECT_TRUE( moved.contains( keys[0] ) );
+			EXPECT_EQ( mapped.size(), 0u );
+		}
+		std::filesystem::remove( path );
+	}
+} // namespace nfx::hashing::test
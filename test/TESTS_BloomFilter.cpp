@@ -0,0 +1,130 @@
+/**
+ * @file TESTS_BloomFilter.cpp
+ * @brief Tests for the split block Bloom filter
+ * @details Validates the absence of false negatives, the false positive rate against the sizing
+ *          target, batched queries, union, and the serialized image
+ */
+
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// BloomFilter tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Membership
+	//----------------------------------------------
+
+	TEST( BloomFilter, NoFalseNegativesAndTargetRate )
+	{
+		constexpr std::size_t count = 200000;
+		BloomFilter<> filter{ count, 0.01 };
+		EXPECT_EQ( filter.byteSize(), filter.blockCount() * 32 );
+		EXPECT_LE( BloomFilter<>::expectedFalsePositiveRate( count, filter.blockCount() ), 0.01 );
+		EXPECT_GT( BloomFilter<>::expectedFalsePositiveRate( count, filter.blockCount() - 1 ), 0.01 );
+
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			filter.insert( "key:" + std::to_string( i ) );
+		}
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			ASSERT_TRUE( filter.contains( "key:" + std::to_string( i ) ) );
+		}
+
+		std::size_t falsePositives = 0;
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			falsePositives += filter.contains( "other:" + std::to_string( i ) );
+		}
+		const double rate = static_cast<double>( falsePositives ) / count;
+		EXPECT_GT( rate, 0.006 );
+		EXPECT_LT( rate, 0.013 );
+
+		EXPECT_THROW( ( BloomFilter<>{ count, 0.0 } ), std::invalid_argument );
+		EXPECT_THROW( ( BloomFilter<>{ count, 1.0 } ), std::invalid_argument );
+	}
+
+	TEST( BloomFilter, BatchedMatchesScalar )
+	{
+		const Hasher<uint64_t> hasher;
+		BloomFilter<> filter{ 5000, 0.05 };
+		std::vector<uint64_t> inserted;
+		for ( uint64_t key = 0; key < 5000; ++key )
+		{
+			inserted.push_back( hasher( key ) );
+		}
+		filter.insertHashes( inserted );
+
+		std::vector<uint64_t> probes;
+		for ( uint64_t key = 2500; key < 7531; ++key )
+		{
+			probes.push_back( hasher( key ) );
+		}
+		std::vector<bool> expected;
+		std::size_t expectedPositives = 0;
+		for ( const auto hash : probes )
+		{
+			expected.push_back( filter.containsHash( hash ) );
+			expectedPositives += expected.back();
+		}
+
+		auto results = std::make_unique<bool[]>( probes.size() );
+		EXPECT_EQ( filter.containsHashes( probes, std::span<bool>{ results.get(), probes.size() } ), expectedPositives );
+		for ( std::size_t i = 0; i < probes.size(); ++i )
+		{
+			ASSERT_EQ( results[i], expected[i] );
+		}
+		EXPECT_GE( expectedPositives, 2500u );
+	}
+
+	//----------------------------------------------
+	// Union and serialization
+	//----------------------------------------------
+
+	TEST( BloomFilter, MergeAndSerialize )
+	{
+		BloomFilter<> left{ 1000, 0.01 };
+		BloomFilter<> right{ 1000, 0.01 };
+		for ( uint64_t key = 0; key < 1000; ++key )
+		{
+			left.insert( key );
+			right.insert( key + 1000 );
+		}
+		left.merge( right );
+		for ( uint64_t key = 0; key < 2000; ++key )
+		{
+			ASSERT_TRUE( left.contains( key ) );
+		}
+		EXPECT_THROW( left.merge( BloomFilter<>{ 100000, 0.01 } ), std::invalid_argument );
+
+		const auto image = left.serialize();
+		EXPECT_EQ( image.size(), 64 + left.byteSize() );
+		const BloomFilter<> restored{ image };
+		EXPECT_EQ( restored.blockCount(), left.blockCount() );
+		EXPECT_EQ( restored.serialize(), image );
+		for ( uint64_t key = 0; key < 2000; ++key )
+		{
+			ASSERT_TRUE( restored.contains( key ) );
+		}
+
+		auto corrupt = image;
+		corrupt[0] = std::byte{ 0 };
+		EXPECT_THROW( BloomFilter<>{ corrupt }, std::runtime_error );
+		EXPECT_THROW( BloomFilter<>{ std::span<const std::byte>{ image }.first( image.size() - 4 ) }, std::runtime_error );
+		EXPECT_THROW( ( BloomFilter<Hasher<uint64_t, 1>>{ image } ), std::runtime_error );
+
+		left.clear();
+		EXPECT_FALSE( left.contains( uint64_t{ 1 } ) );
+	}
+} // namespace nfx::hashing::test
@@ -0,0 +1,330 @@
+/**
+ * @file TESTS_Checksums.cpp
+ * @brief Tests for buffer checksum functions
+ * @details Validates CRC32-C buffers, CRC-32 (IEEE 802.3) and CRC-64 (XZ, NVMe) against catalogued check values
+ *          and checks that the slicing, PCLMULQDQ and VPCLMULQDQ kernels, combination and
+ *          incremental state agree
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	using namespace nfx::hashing::constants;
+
+	//=====================================================================
+	// Checksum tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	static std::vector<std::byte> generateTestData( size_t length )
+	{
+		std::vector<std::byte> data( length );
+		for ( size_t i = 0; i < length; ++i )
+		{
+			data[i] = static_cast<std::byte>( ( i * 131 + 7 ) & 0xFF );
+		}
+
+		return data;
+	}
+
+	static const std::byte* bytes( std::string_view text )
+	{
+		return reinterpret_cast<const std::byte*>( text.data() );
+	}
+
+	/** @brief Finalized CRC-32 computed one byte at a time with the reference step */
+	static uint32_t crc32IeeeReference( const std::byte* data, size_t length )
+	{
+		uint32_t crc = CRC32_IEEE_INIT;
+		for ( size_t i = 0; i < length; ++i )
+		{
+			crc = crc32IeeeSoft( crc, static_cast<uint8_t>( data[i] ) );
+		}
+
+		return crc ^ CRC32_IEEE_INIT;
+	}
+
+	/** @brief Finalized CRC-64 computed one byte at a time with the given reference step */
+	template <uint64_t ( *Step )( uint64_t, uint8_t )>
+	static uint64_t crc64Reference( const std::byte* data, size_t length )
+	{
+		uint64_t crc = CRC64_INIT;
+		for ( size_t i = 0; i < length; ++i )
+		{
+			crc = Step( crc, static_cast<uint8_t>( data[i] ) );
+		}
+
+		return crc ^ CRC64_INIT;
+	}
+
+	static uint32_t crc32IeeeFinal( std::string_view text )
+	{
+		return crc32Ieee( CRC32_IEEE_INIT, bytes( text ), text.size() ) ^ CRC32_IEEE_INIT;
+	}
+
+	//----------------------------------------------
+	// CRC32-C buffers
+	//----------------------------------------------
+
+	TEST( Crc32cBuffer, MatchesByteStep )
+	{
+		const auto data = generateTestData( 3000 );
+		for ( size_t length = 0; length + 3 <= data.size(); length += ( length < 300 ? 1 : 53 ) )
+		{
+			const std::byte* p = data.data() + 3;
+			uint32_t expected = 0xFFFFFFFF;
+			for ( size_t i = 0; i < length; ++i )
+			{
+				expected = crc32cSoft( expected, static_cast<uint8_t>( p[i] ) );
+			}
+			EXPECT_EQ( crc32c( 0xFFFFFFFF, p, length ), expected ) << "length " << length;
+			EXPECT_EQ( crc32cSoft( 0xFFFFFFFF, p, length ), expected ) << "length " << length;
+		}
+
+		// CRC-32/ISCSI check value
+		EXPECT_EQ( ~crc32c( 0xFFFFFFFF, bytes( "123456789" ), 9 ), 0xE3069283u );
+	}
+
+	TEST( Crc32cBuffer, BlocksMatchSingleBuffer )
+	{
+		const auto data = generateTestData( 9 * 4097 );
+		for ( size_t blockSize : { size_t{ 0 }, size_t{ 1 }, size_t{ 7 }, size_t{ 8 }, size_t{ 13 }, size_t{ 512 }, size_t{ 4096 }, size_t{ 4097 } } )
+		{
+			for ( size_t count = 0; count <= 9; ++count )
+			{
+				std::vector<uint32_t> out( count + 1, 0xDEADBEEF );
+				crc32cBlocks( data.data(), blockSize, count, out.data() );
+				for ( size_t i = 0; i < count; ++i )
+				{
+					EXPECT_EQ( out[i], ~crc32c( 0xFFFFFFFF, data.data() + i * blockSize, blockSize ) )
+						<< "blockSize " << blockSize << " block " << i;
+				}
+				EXPECT_EQ( out[count], 0xDEADBEEFu ) << "wrote past count";
+			}
+		}
+	}
+
+	TEST( Crc32cBuffer, InterleavedLanesMatchSingleBuffer )
+	{
+		if ( !internal::hasSse42Support() )
+		{
+			GTEST_SKIP() << "SSE4.2 not supported";
+		}
+
+		// Long blocks may be routed to carry-less folding; check the interleaved lanes directly
+		const auto data = generateTestData( internal::CRC32C_BLOCK_LANES * 4099 );
+		for ( size_t blockSize : { size_t{ 300 }, size_t{ 4096 }, size_t{ 4099 } } )
+		{
+			uint32_t out[internal::CRC32C_BLOCK_LANES];
+			internal::crc32cBlocksHardware( data.data(), blockSize, out );
+			for ( size_t i = 0; i < internal::CRC32C_BLOCK_LANES; ++i )
+			{
+				EXPECT_EQ( out[i], ~crc32cSoft( 0xFFFFFFFF, data.data() + i * blockSize, blockSize ) ) << "blockSize " << blockSize;
+			}
+		}
+	}
+
+	TEST( Crc32cBuffer, MaskRoundTrip )
+	{
+		constexpr uint32_t crc = 0xE3069283;
+		static_assert( crc32cMask( crc ) == 0xC78AB0E5 );
+		static_assert( crc32cUnmask( crc32cMask( crc ) ) == crc );
+
+		for ( uint32_t value : { 0u, 1u, 0x80000000u, 0xFFFFFFFFu, 0x12345678u } )
+		{
+			EXPECT_NE( crc32cMask( value ), value );
+			EXPECT_NE( crc32cMask( crc32cMask( value ) ), value );
+			EXPECT_EQ( crc32cUnmask( crc32cMask( value ) ), value );
+			EXPECT_EQ( crc32cUnmask( crc32cUnmask( crc32cMask( crc32cMask( value ) ) ) ), value );
+		}
+	}
+
+	//----------------------------------------------
+	// CRC-32 (IEEE 802.3)
+	//----------------------------------------------
+
+	TEST( Crc32Ieee, CheckValues )
+	{
+		// CRC-32/ISO-HDLC catalogue check value and well-known zlib results
+		EXPECT_EQ( crc32IeeeFinal( "123456789" ), 0xCBF43926u );
+		EXPECT_EQ( crc32IeeeFinal( "" ), 0x00000000u );
+		EXPECT_EQ( crc32IeeeFinal( "a" ), 0xE8B7BE43u );
+		EXPECT_EQ( crc32IeeeFinal( "The quick brown fox jumps over the lazy dog" ), 0x414FA339u );
+	}
+
+	TEST( Crc32Ieee, ConstexprByteStep )
+	{
+		constexpr uint32_t crc = crc32IeeeSoft( crc32IeeeSoft( CRC32_IEEE_INIT, 'a' ), 'b' ) ^ CRC32_IEEE_INIT;
+		static_assert( crc == 0x9E83486D );
+		EXPECT_EQ( crc32Ieee( crc32Ieee( CRC32_IEEE_INIT, 'a' ), 'b' ) ^ CRC32_IEEE_INIT, crc );
+	}
+
+	TEST( Crc32Ieee, AllPathsMatchReference )
+	{
+		// Covers the bytewise tail, slicing-by-16, and both folding thresholds at every alignment
+		const auto data = generateTestData( 1200 );
+		for ( size_t offset = 0; offset < 4; ++offset )
+		{
+			for ( size_t length = 0; length + offset <= data.size(); length += ( length < 300 ? 1 : 37 ) )
+			{
+				const std::byte* p = data.data() + offset;
+				const uint32_t expected = crc32IeeeReference( p, length );
+				EXPECT_EQ( crc32IeeeSoft( CRC32_IEEE_INIT, p, length ) ^ CRC32_IEEE_INIT, expected ) << "length " << length;
+				EXPECT_EQ( crc32Ieee( CRC32_IEEE_INIT, p, length ) ^ CRC32_IEEE_INIT, expected ) << "length " << length;
+			}
+		}
+	}
+
+	TEST( Crc32Ieee, CarrylessKernelsMatchReference )
+	{
+		const auto data = generateTestData( 70000 );
+		const uint32_t expected = crc32IeeeReference( data.data(), data.size() );
+		EXPECT_EQ( crc32Ieee( CRC32_IEEE_INIT, data.data(), data.size() ) ^ CRC32_IEEE_INIT, expected );
+
+		if ( internal::hasPclmulqdqSupport() )
+		{
+			for ( size_t length : { 64, 65, 127, 128, 200, 1000 } )
+			{
+				EXPECT_EQ( internal::Crc32IeeeEngine::updatePclmul( CRC32_IEEE_INIT, data.data() + 1, length ) ^ CRC32_IEEE_INIT,
+					crc32IeeeReference( data.data() + 1, length ) )
+					<< "length " << length;
+			}
+			EXPECT_EQ( internal::Crc32IeeeEngine::updatePclmul( CRC32_IEEE_INIT, data.data(), data.size() ) ^ CRC32_IEEE_INIT, expected );
+		}
+		if ( internal::hasVpclmulqdqSupport() )
+		{
+			for ( size_t length : { 128, 129, 255, 256, 300, 1000 } )
+			{
+				EXPECT_EQ( internal::Crc32IeeeEngine::updateVpclmul( CRC32_IEEE_INIT, data.data() + 1, length ) ^ CRC32_IEEE_INIT,
+					crc32IeeeReference( data.data() + 1, length ) )
+					<< "length " << length;
+			}
+			EXPECT_EQ( internal::Crc32IeeeEngine::updateVpclmul( CRC32_IEEE_INIT, data.data(), data.size() ) ^ CRC32_IEEE_INIT, expected );
+		}
+	}
+
+	TEST( Crc32Ieee, Combine )
+	{
+		const auto data = generateTestData( 5000 );
+		const uint32_t whole = crc32IeeeReference( data.data(), data.size() );
+		for ( size_t split : { size_t{ 0 }, size_t{ 1 }, size_t{ 17 }, size_t{ 1024 }, size_t{ 4999 }, size_t{ 5000 } } )
+		{
+			const uint32_t first = crc32IeeeReference( data.data(), split );
+			const uint32_t second = crc32IeeeReference( data.data() + split, data.size() - split );
+			EXPECT_EQ( crc32IeeeCombine( first, second, data.size() - split ), whole ) << "split " << split;
+		}
+
+		static_assert( crc32IeeeCombine( 0xCBF43926, 0, 0 ) == 0xCBF43926 );
+	}
+
+	TEST( Crc32Ieee, IncrementalState )
+	{
+		const auto data = generateTestData( 3000 );
+		const uint32_t expected = crc32IeeeReference( data.data(), data.size() );
+
+		Crc32IeeeState state;
+		EXPECT_EQ( state.value(), 0u );
+
+		size_t position = 0;
+		for ( size_t chunk = 1; position < data.size(); chunk = chunk * 3 + 1 )
+		{
+			const size_t length = std::min( chunk, data.size() - position );
+			state.update( data.data() + position, length );
+			position += length;
+		}
+		EXPECT_EQ( state.value(), expected );
+
+		state.reset();
+		state.update( "1234" );
+		state.update( "56789" );
+		EXPECT_EQ( state.value(), 0xCBF43926u );
+	}
+
+	//----------------------------------------------
+	// CRC-64/XZ and CRC-64/NVME
+	//----------------------------------------------
+
+	TEST( Crc64, CheckValues )
+	{
+		// Catalogued check values of "123456789"
+		EXPECT_EQ( crc64Xz( CRC64_INIT, bytes( "123456789" ), 9 ) ^ CRC64_INIT, 0x995DC9BBDF1939FAull );
+		EXPECT_EQ( crc64Nvme( CRC64_INIT, bytes( "123456789" ), 9 ) ^ CRC64_INIT, 0xAE8B14860A799888ull );
+		EXPECT_EQ( crc64Xz( CRC64_INIT, bytes( "" ), 0 ) ^ CRC64_INIT, 0u );
+
+		constexpr uint64_t single = crc64XzSoft( CRC64_INIT, '1' );
+		EXPECT_EQ( crc64Xz( CRC64_INIT, '1' ), single );
+	}
+
+	TEST( Crc64, AllPathsMatchReference )
+	{
+		const auto data = generateTestData( 1200 );
+		for ( size_t offset = 0; offset < 3; ++offset )
+		{
+			for ( size_t length = 0; length + offset <= data.size(); length += ( length < 300 ? 1 : 37 ) )
+			{
+				const std::byte* p = data.data() + offset;
+				const uint64_t expectedXz = crc64Reference<crc64XzSoft>( p, length );
+				const uint64_t expectedNvme = crc64Reference<crc64NvmeSoft>( p, length );
+				EXPECT_EQ( crc64XzSoft( CRC64_INIT, p, length ) ^ CRC64_INIT, expectedXz ) << "length " << length;
+				EXPECT_EQ( crc64Xz( CRC64_INIT, p, length ) ^ CRC64_INIT, expectedXz ) << "length " << length;
+				EXPECT_EQ( crc64NvmeSoft( CRC64_INIT, p, length ) ^ CRC64_INIT, expectedNvme ) << "length " << length;
+				EXPECT_EQ( crc64Nvme( CRC64_INIT, p, length ) ^ CRC64_INIT, expectedNvme ) << "length " << length;
+			}
+		}
+	}
+
+	TEST( Crc64, CarrylessKernelsMatchReference )
+	{
+		const auto data = generateTestData( 70000 );
+		const uint64_t expected = crc64Reference<crc64NvmeSoft>( data.data() + 3, data.size() - 3 );
+
+		if ( internal::hasPclmulqdqSupport() )
+		{
+			EXPECT_EQ( internal::Crc64NvmeEngine::updatePclmul( CRC64_INIT, data.data() + 3, data.size() - 3 ) ^ CRC64_INIT, expected );
+			EXPECT_EQ( internal::Crc64XzEngine::updatePclmul( CRC64_INIT, data.data(), 100 ) ^ CRC64_INIT,
+				crc64Reference<crc64XzSoft>( data.data(), 100 ) );
+		}
+		if ( internal::hasVpclmulqdqSupport() )
+		{
+			EXPECT_EQ( internal::Crc64NvmeEngine::updateVpclmul( CRC64_INIT, data.data() + 3, data.size() - 3 ) ^ CRC64_INIT, expected );
+			EXPECT_EQ( internal::Crc64XzEngine::updateVpclmul( CRC64_INIT, data.data(), 300 ) ^ CRC64_INIT,
+				crc64Reference<crc64XzSoft>( data.data(), 300 ) );
+		}
+	}
+
+	TEST( Crc64, CombineAndIncrementalState )
+	{
+		const auto data = generateTestData( 4096 );
+		const uint64_t whole = crc64Reference<crc64NvmeSoft>( data.data(), data.size() );
+		for ( size_t split : { size_t{ 0 }, size_t{ 7 }, size_t{ 2048 }, size_t{ 4096 } } )
+		{
+			const uint64_t first = crc64Reference<crc64NvmeSoft>( data.data(), split );
+			const uint64_t second = crc64Reference<crc64NvmeSoft>( data.data() + split, data.size() - split );
+			EXPECT_EQ( crc64NvmeCombine( first, second, data.size() - split ), whole ) << "split " << split;
+		}
+
+		Crc64NvmeState nvme;
+		nvme.update( data.data(), 1000 );
+		nvme.update( data.data() + 1000, data.size() - 1000 );
+		EXPECT_EQ( nvme.value(), whole );
+
+		Crc64XzState xz;
+		xz.update( "12345" );
+		xz.update( "6789" );
+		EXPECT_EQ( xz.value(), 0x995DC9BBDF1939FAull );
+		EXPECT_EQ( crc64XzCombine( crc64Xz( CRC64_INIT, bytes( "12345" ), 5 ) ^ CRC64_INIT,
+					   crc64Xz( CRC64_INIT, bytes( "6789" ), 4 ) ^ CRC64_INIT, 4 ),
+			0x995DC9BBDF1939FAull );
+		xz.reset();
+		EXPECT_EQ( xz.value(), 0u );
+	}
+} // namespace nfx::hashing::test
@@ -0,0 +1,144 @@
+/**
+ * @file TESTS_CompactIntegerSet.cpp
+ * @brief Tests for the quotienting CompactIntegerSet
+ * @details Validates membership against std::unordered_set under random inserts and erases,
+ *          key recovery through unhashInteger, growth, and the shrinking slot width
+ */
+
+#include <algorithm>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// CompactIntegerSet tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Membership
+	//----------------------------------------------
+
+	TEST( CompactIntegerSet, InsertContainsErase )
+	{
+		CompactIntegerSet set;
+		EXPECT_TRUE( set.empty() );
+
+		EXPECT_TRUE( set.insert( 42 ) );
+		EXPECT_FALSE( set.insert( 42 ) );
+		EXPECT_TRUE( set.insert( 0 ) );
+		EXPECT_TRUE( set.insert( ~uint64_t{ 0 } ) );
+		EXPECT_EQ( set.size(), 3u );
+
+		EXPECT_TRUE( set.contains( 0 ) );
+		EXPECT_TRUE( set.contains( 42 ) );
+		EXPECT_TRUE( set.contains( ~uint64_t{ 0 } ) );
+		EXPECT_FALSE( set.contains( 43 ) );
+
+		EXPECT_TRUE( set.erase( 42 ) );
+		EXPECT_FALSE( set.erase( 42 ) );
+		EXPECT_FALSE( set.contains( 42 ) );
+		EXPECT_EQ( set.size(), 2u );
+	}
+
+	TEST( CompactIntegerSet, MatchesUnorderedSetUnderRandomOperations )
+	{
+		CompactIntegerSet set;
+		std::unordered_set<uint64_t> reference;
+		std::mt19937_64 gen( 7 );
+
+		for ( int i = 0; i < 400000; ++i )
+		{
+			// Small key range so inserts, duplicates and erases all happen often
+			const uint64_t key = gen() % 50000;
+			if ( gen() % 3 == 0 )
+			{
+				ASSERT_EQ( set.erase( key ), reference.erase( key ) == 1 );
+			}
+			else
+			{
+				ASSERT_EQ( set.insert( key ), reference.insert( key ).second );
+			}
+		}
+
+		EXPECT_EQ( set.size(), reference.size() );
+		for ( uint64_t key = 0; key < 50000; ++key )
+		{
+			ASSERT_EQ( set.contains( key ), reference.count( key ) == 1 ) << key;
+		}
+	}
+
+	//----------------------------------------------
+	// Key recovery
+	//----------------------------------------------
+
+	TEST( CompactIntegerSet, ForEachRecoversKeys )
+	{
+		std::vector<uint64_t> keys{ 0, 1, ~uint64_t{ 0 }, 0x8000000000000000ULL };
+		std::mt19937_64 gen( 11 );
+		for ( int i = 0; i < 10000; ++i )
+		{
+			keys.push_back( gen() );
+		}
+
+		CompactIntegerSet set;
+		for ( const auto key : keys )
+		{
+			set.insert( key );
+		}
+
+		std::vector<uint64_t> recovered;
+		set.for_each( [&]( uint64_t key ) { recovered.push_back( key ); } );
+
+		std::sort( keys.begin(), keys.end() );
+		std::sort( recovered.begin(), recovered.end() );
+		EXPECT_EQ( recovered, keys );
+	}
+
+	//----------------------------------------------
+	// Growth and footprint
+	//----------------------------------------------
+
+	TEST( CompactIntegerSet, SlotsNarrowAsTheTableGrows )
+	{
+		CompactIntegerSet set;
+		EXPECT_EQ( set.capacity(), 256u );
+		EXPECT_EQ( set.slotBits(), 64u );
+
+		for ( uint64_t i = 0; i < 1000000; ++i )
+		{
+			set.insert( i * 0x9E3779B97F4A7C15ULL );
+		}
+
+		EXPECT_EQ( set.capacity(), size_t{ 1 } << 21 );
+		EXPECT_EQ( set.slotBits(), 72u - 21u );
+		EXPECT_LT( set.memoryUsage(), set.capacity() * sizeof( uint64_t ) );
+		for ( uint64_t i = 0; i < 1000000; ++i )
+		{
+			ASSERT_TRUE( set.contains( i * 0x9E3779B97F4A7C15ULL ) );
+		}
+	}
+
+	TEST( CompactIntegerSet, ReserveAndClear )
+	{
+		CompactIntegerSet set{ 100000 };
+		const size_t capacity = set.capacity();
+		EXPECT_GE( capacity * 7, 100000u * 8 );
+
+		for ( uint64_t i = 0; i < 100000; ++i )
+		{
+			set.insert( i );
+		}
+		EXPECT_EQ( set.capacity(), capacity );
+
+		set.clear();
+		EXPECT_TRUE( set.empty() );
+		EXPECT_FALSE( set.contains( 5 ) );
+		EXPECT_EQ( set.capacity(), 256u );
+	}
+} // namespace nfx::hashing::test
@@ -0,0 +1,173 @@
+/**
+ * @file TESTS_ConcurrentHashMap.cpp
+ * @brief Tests for the sharded ConcurrentHashMap
+ * @details Validates single-threaded semantics, shard selection, single hashing per operation and
+ *          concurrent writers and readers
+ */
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// ConcurrentHashMap tests
+	//=====================================================================
+
+	namespace
+	{
+		/** @brief Hasher that counts its invocations */
+		struct CountingHasher
+		{
+			uint64_t operator()( uint64_t key ) const
+			{
+				++calls;
+
+				return Hasher<uint64_t>{}( key );
+			}
+
+			static inline std::size_t calls = 0;
+		};
+	} // namespace
+
+	//----------------------------------------------
+	// Single-threaded semantics
+	//----------------------------------------------
+
+	TEST( ConcurrentHashMap, BasicOperations )
+	{
+		ConcurrentHashMap<std::string, int> map{ 8 };
+		EXPECT_EQ( map.shardCount(), 8u );
+		EXPECT_TRUE( map.empty() );
+
+		EXPECT_TRUE( map.insert_or_assign( "alpha", 1 ) );
+		EXPECT_FALSE( map.insert_or_assign( "alpha", 2 ) );
+		EXPECT_TRUE( map.insert_or_assign( std::string{ "beta" }, 3 ) );
+
+		EXPECT_EQ( map.find( "alpha" ), 2 );
+		EXPECT_EQ( map.find( std::string_view{ "gamma" } ), std::nullopt );
+		EXPECT_TRUE( map.contains( std::string_view{ "beta" } ) );
+		EXPECT_EQ( map.size(), 2u );
+
+		int seen = 0;
+		EXPECT_TRUE( map.visit( std::string_view{ "beta" }, [&seen]( const int& value ) { seen = value; } ) );
+		EXPECT_EQ( seen, 3 );
+
+		EXPECT_EQ( map.erase( std::string_view{ "alpha" } ), 1u );
+		EXPECT_EQ( map.erase( "alpha" ), 0u );
+		map.clear();
+		EXPECT_TRUE( map.empty() );
+	}
+
+	TEST( ConcurrentHashMap, ShardCountRoundsUpToPowerOfTwo )
+	{
+		EXPECT_EQ( ( ConcurrentHashMap<int, int>{ 0 }.shardCount() ), 1u );
+		EXPECT_EQ( ( ConcurrentHashMap<int, int>{ 5 }.shardCount() ), 8u );
+		EXPECT_TRUE( std::has_single_bit( ConcurrentHashMap<int, int>::defaultShardCount() ) );
+	}
+
+	TEST( ConcurrentHashMap, HashesEachKeyOnce )
+	{
+		ConcurrentHashMap<uint64_t, int, CountingHasher> map{ 4 };
+		map.reserve( 256 ); // No rehash below, so every hasher call comes from an operation
+		CountingHasher::calls = 0;
+
+		for ( uint64_t key = 0; key < 64; ++key )
+		{
+			map.insert_or_assign( key, static_cast<int>( key ) );
+		}
+		EXPECT_EQ( CountingHasher::calls, 64u );
+
+		for ( uint64_t key = 0; key < 64; ++key )
+		{
+			EXPECT_EQ( map.find( key ), static_cast<int>( key ) );
+			EXPECT_TRUE( map.contains( key ) );
+			EXPECT_EQ( map.erase( key ), 1u );
+		}
+		EXPECT_EQ( CountingHasher::calls, 64u * 4 );
+	}
+
+	TEST( ConcurrentHashMap, ForEachVisitsEveryElement )
+	{
+		ConcurrentHashMap<uint64_t, uint64_t> map{ 16 };
+		map.reserve( 10000 );
+		for ( uint64_t i = 0; i < 10000; ++i )
+		{
+			map.insert_or_assign( i, i * 2 );
+		}
+
+		uint64_t count = 0;
+		uint64_t sum = 0;
+		map.for_each( [&]( const uint64_t& key, const uint64_t& value ) {
+			EXPECT_EQ( value, key * 2 );
+			++count;
+			sum += key;
+		} );
+		EXPECT_EQ( count, 10000u );
+		EXPECT_EQ( sum, 10000u * 9999u / 2 );
+	}
+
+	//----------------------------------------------
+	// Concurrency
+	//----------------------------------------------
+
+	TEST( ConcurrentHashMap, ConcurrentWritersAndReaders )
+	{
+		constexpr uint64_t THREADS = 4;
+		constexpr uint64_t PER_THREAD = 20000;
+
+		ConcurrentHashMap<uint64_t, uint64_t> map;
+		std::atomic<bool> writersDone{ false };
+		std::atomic<uint64_t> inconsistent{ 0 };
+
+		std::vector<std::thread> threads;
+		for ( uint64_t t = 0; t < THREADS; ++t )
+		{
+			threads.emplace_back( [&map, t] {
+				for ( uint64_t i = 0; i < PER_THREAD; ++i )
+				{
+					const uint64_t key = t * PER_THREAD + i;
+					map.insert_or_assign( key, key + 1 );
+					if ( i % 4 == 0 )
+					{
+						map.erase( key );
+					}
+				}
+			} );
+		}
+
+		std::thread reader{ [&] {
+			while ( !writersDone.load() )
+			{
+				for ( uint64_t key = 0; key < THREADS * PER_THREAD; key += 97 )
+				{
+					if ( const auto value = map.find( key ); value && *value != key + 1 )
+					{
+						inconsistent.fetch_add( 1 );
+					}
+				}
+			}
+		} };
+
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+		writersDone.store( true );
+		reader.join();
+
+		EXPECT_EQ( inconsistent.load(), 0u );
+		EXPECT_EQ( map.size(), THREADS * PER_THREAD * 3 / 4 );
+		for ( uint64_t key = 0; key < THREADS * PER_THREAD; ++key )
+		{
+			EXPECT_EQ( map.contains( key ), key % PER_THREAD % 4 != 0 );
+		}
+	}
+} // namespace nfx::hashing::test
@@ -0,0 +1,167 @@
+/**
+ * @file TESTS_Crc.cpp
+ * @brief Tests for the parameterized Crc<> engine
+ * @details Validates catalogued CRC variants against their check values and verifies that the
+ *          bit-forward and reflected kernels, combination and incremental state agree
+ */
+
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// Parameterized CRC tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	static std::vector<std::byte> generateTestData( size_t length )
+	{
+		std::vector<std::byte> data( length );
+		for ( size_t i = 0; i < length; ++i )
+		{
+			data[i] = static_cast<std::byte>( ( i * 131 + 7 ) & 0xFF );
+		}
+
+		return data;
+	}
+
+	/** @brief Feeds the buffer one byte at a time, exercising only the bytewise kernel */
+	template <typename CrcType>
+	static typename CrcType::ValueType bytewise( const std::byte* data, size_t length )
+	{
+		CrcType state;
+		for ( size_t i = 0; i < length; ++i )
+		{
+			state.update( data + i, 1 );
+		}
+
+		return state.value();
+	}
+
+	template <typename CrcType>
+	static void expectConsistent()
+	{
+		const auto data = generateTestData( 1500 );
+		for ( size_t length = 0; length + 1 <= data.size(); length += ( length < 300 ? 1 : 41 ) )
+		{
+			const std::byte* p = data.data() + 1;
+			const auto expected = bytewise<CrcType>( p, length );
+			EXPECT_EQ( CrcType::compute( p, length ), expected ) << "length " << length;
+
+			const size_t split = length / 3;
+			const auto first = CrcType::compute( p, split );
+			const auto second = CrcType::compute( p + split, length - split );
+			EXPECT_EQ( CrcType::combine( first, second, length - split ), expected ) << "length " << length;
+		}
+	}
+
+	//----------------------------------------------
+	// Catalogue check values
+	//----------------------------------------------
+
+	TEST( Crc, CatalogueCheckValues )
+	{
+		// Check values of "123456789" from the CRC catalogue
+		EXPECT_EQ( Crc8Smbus::compute( "123456789" ), 0xF4u );
+		EXPECT_EQ( Crc8MaximDow::compute( "123456789" ), 0xA1u );
+		EXPECT_EQ( Crc16Arc::compute( "123456789" ), 0xBB3Du );
+		EXPECT_EQ( Crc16Kermit::compute( "123456789" ), 0x2189u );
+		EXPECT_EQ( Crc16IbmSdlc::compute( "123456789" ), 0x906Eu );
+		EXPECT_EQ( Crc16Xmodem::compute( "123456789" ), 0x31C3u );
+		EXPECT_EQ( Crc16CcittFalse::compute( "123456789" ), 0x29B1u );
+		EXPECT_EQ( Crc24OpenPgp::compute( "123456789" ), 0x21CF02u );
+		EXPECT_EQ( Crc32IsoHdlc::compute( "123456789" ), 0xCBF43926u );
+		EXPECT_EQ( Crc32Iscsi::compute( "123456789" ), 0xE3069283u );
+		EXPECT_EQ( Crc32Bzip2::compute( "123456789" ), 0xFC891918u );
+		EXPECT_EQ( Crc32Mpeg2::compute( "123456789" ), 0x0376E6E7u );
+		EXPECT_EQ( Crc64Ecma182::compute( "123456789" ), 0x6C40DF5F0B497347ull );
+		EXPECT_EQ( Crc64GoIso::compute( "123456789" ), 0xB90956C775A41001ull );
+		EXPECT_EQ( Crc64Xz::compute( "123456789" ), 0x995DC9BBDF1939FAull );
+		EXPECT_EQ( Crc64Nvme::compute( "123456789" ), 0xAE8B14860A799888ull );
+
+		// CRC-12/UMTS: odd width with ReflectIn != ReflectOut
+		EXPECT_EQ( ( Crc<12, 0x80F, 0x000, false, true, 0x000>::compute( "123456789" ) ), 0xDAFu );
+	}
+
+	TEST( Crc, CompileTimeEvaluation )
+	{
+		static_assert( Crc16CcittFalse::compute( "123456789" ) == 0x29B1 );
+		static_assert( Crc32Iscsi::compute( "123456789" ) == 0xE3069283 );
+		static_assert( Crc64Ecma182::compute( "123456789" ) == 0x6C40DF5F0B497347ull );
+		static_assert( Crc32Bzip2::combine( Crc32Bzip2::compute( "1234" ), Crc32Bzip2::compute( "56789" ), 5 ) == 0xFC891918 );
+		static_assert( std::is_same_v<Crc24OpenPgp::ValueType, uint32_t> );
+	}
+
+	//----------------------------------------------
+	// Kernel consistency
+	//----------------------------------------------
+
+	TEST( Crc, ReflectedVariantsConsistent )
+	{
+		expectConsistent<Crc8MaximDow>();
+		expectConsistent<Crc16Kermit>();
+		expectConsistent<Crc32IsoHdlc>();
+		expectConsistent<Crc64GoIso>();
+	}
+
+	TEST( Crc, ForwardVariantsConsistent )
+	{
+		expectConsistent<Crc8Smbus>();
+		expectConsistent<Crc16CcittFalse>();
+		expectConsistent<Crc24OpenPgp>();
+		expectConsistent<Crc32Bzip2>();
+		expectConsistent<Crc64Ecma182>();
+		expectConsistent<Crc<12, 0x80F, 0x000, false, true, 0x000>>();
+	}
+
+	TEST( Crc, ForwardCarrylessKernelsMatchSoftware )
+	{
+		using Engine = internal::crc::Forward<32, 0x04C11DB7>;
+		const auto data = generateTestData( 20000 );
+		const uint64_t expected = Engine::updateSoft( Engine::ONE * 0x1234567, data.data() + 5, data.size() - 5 );
+
+		if ( internal::hasPclmulqdqSupport() )
+		{
+			EXPECT_EQ( Engine::updatePclmul( Engine::ONE * 0x1234567, data.data() + 5, data.size() - 5 ), expected );
+		}
+		if ( internal::hasVpclmulqdqSupport() )
+		{
+			EXPECT_EQ( Engine::updateVpclmul( Engine::ONE * 0x1234567, data.data() + 5, data.size() - 5 ), expected );
+		}
+	}
+
+	TEST( Crc, MatchesDedicatedFunctions )
+	{
+		const auto data = generateTestData( 4096 );
+		EXPECT_EQ( Crc32Iscsi::compute( data.data(), data.size() ), ~crc32c( ~0u, data.data(), data.size() ) );
+		EXPECT_EQ( Crc32IsoHdlc::compute( data.data(), data.size() ), ~crc32Ieee( ~0u, data.data(), data.size() ) );
+		EXPECT_EQ( Crc64Xz::compute( data.data(), data.size() ), ~crc64Xz( ~0ull, data.data(), data.size() ) );
+		EXPECT_EQ( Crc64Nvme::compute( data.data(), data.size() ), ~crc64Nvme( ~0ull, data.data(), data.size() ) );
+	}
+
+	//----------------------------------------------
+	// Incremental state
+	//----------------------------------------------
+
+	TEST( Crc, IncrementalState )
+	{
+		Crc24OpenPgp state;
+		EXPECT_EQ( state.value(), Crc24OpenPgp::compute( "" ) );
+
+		state.update( "1234" );
+		state.update( "56789" );
+		EXPECT_EQ( state.value(), 0x21CF02u );
+
+		state.reset();
+		state.update( "123456789" );
+		EXPECT_EQ( state.value(), 0x21CF02u );
+	}
+} // namespace nfx::hashing::test
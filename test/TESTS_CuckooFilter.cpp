@@ -0,0 +1,110 @@
+/**
+ * @file TESTS_CuckooFilter.cpp
+ * @brief Tests for the cuckoo filter
+ * @details Validates the absence of false negatives up to a full table, false positive rates of
+ *          both fingerprint widths, deletion (including of duplicates), and recovery of the victim
+ *          slot after an erase
+ */
+
+#include <bit>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// CuckooFilter tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Membership
+	//----------------------------------------------
+
+	TEST( CuckooFilter, FillsPastNinetyPercentWithoutFalseNegatives )
+	{
+		CuckooFilter<uint16_t> filter{ 100000 };
+		EXPECT_TRUE( std::has_single_bit( filter.bucketCount() ) );
+		EXPECT_EQ( filter.capacity(), filter.bucketCount() * 4 );
+		EXPECT_EQ( filter.byteSize(), filter.capacity() * 2 );
+
+		uint64_t inserted = 0;
+		while ( filter.insert( inserted ) )
+		{
+			++inserted;
+		}
+		EXPECT_EQ( filter.size(), inserted );
+		EXPECT_GT( filter.loadFactor(), 0.9 );
+		for ( uint64_t key = 0; key < inserted; ++key )
+		{
+			ASSERT_TRUE( filter.contains( key ) ) << key;
+		}
+
+		// Erasing frees room: the parked fingerprint is placed again and insertions resume
+		for ( uint64_t key = 0; key < inserted; key += 2 )
+		{
+			ASSERT_TRUE( filter.erase( key ) );
+		}
+		for ( uint64_t key = 1; key < inserted; key += 2 )
+		{
+			ASSERT_TRUE( filter.contains( key ) ) << key;
+		}
+		EXPECT_TRUE( filter.insert( inserted ) );
+		EXPECT_TRUE( filter.contains( inserted ) );
+
+		filter.clear();
+		EXPECT_EQ( filter.size(), 0u );
+		EXPECT_FALSE( filter.contains( uint64_t{ 1 } ) );
+	}
+
+	TEST( CuckooFilter, FalsePositiveRates )
+	{
+		constexpr std::size_t count = 100000;
+		CuckooFilter<uint8_t> small{ count };
+		CuckooFilter<uint16_t> large{ count };
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			ASSERT_TRUE( small.insert( "key:" + std::to_string( i ) ) );
+			ASSERT_TRUE( large.insert( "key:" + std::to_string( i ) ) );
+		}
+
+		std::size_t smallHits = 0;
+		std::size_t largeHits = 0;
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			const std::string other = "other:" + std::to_string( i );
+			smallHits += small.contains( other );
+			largeHits += large.contains( other );
+		}
+
+		// At most 2 buckets x 4 slots / 2^bits, scaled by the load factor
+		EXPECT_LT( static_cast<double>( smallHits ) / count, 8.0 / 255.0 );
+		EXPECT_GT( smallHits, 0u );
+		EXPECT_LT( static_cast<double>( largeHits ) / count, 8.0 / 65535.0 * 1.5 );
+	}
+
+	//----------------------------------------------
+	// Deletion
+	//----------------------------------------------
+
+	TEST( CuckooFilter, EraseRemovesOneCopy )
+	{
+		CuckooFilter<uint16_t> filter{ 64 };
+		EXPECT_FALSE( filter.erase( "apple" ) );
+		ASSERT_TRUE( filter.insert( "apple" ) );
+		ASSERT_TRUE( filter.insert( "apple" ) );
+		ASSERT_TRUE( filter.insert( "pear" ) );
+		EXPECT_EQ( filter.size(), 3u );
+
+		EXPECT_TRUE( filter.erase( "apple" ) );
+		EXPECT_TRUE( filter.contains( "apple" ) );
+		EXPECT_TRUE( filter.erase( "apple" ) );
+		EXPECT_FALSE( filter.contains( "apple" ) );
+		EXPECT_FALSE( filter.erase( "apple" ) );
+		EXPECT_TRUE( filter.contains( "pear" ) );
+		EXPECT_EQ( filter.size(), 1u );
+	}
+} // namespace nfx::hashing::test
@@ -0,0 +1,241 @@
+/**
+ * @file TESTS_Fingerprint.cpp
+ * @brief Tests for FarmHash and CityHash fingerprint functions
+ * @details Validates farmFingerprint64, cityHash64 and cityHash128 against reference vectors
+ *          and checks their use as Hasher string hashing policies
+ */
+
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	using namespace nfx::hashing::constants;
+
+	//=====================================================================
+	// Fingerprint tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	static std::string generateTestData( size_t length )
+	{
+		std::string data;
+		data.reserve( length );
+		for ( size_t i = 0; i < length; ++i )
+		{
+			data.push_back( static_cast<char>( ( i * 131 + 7 ) & 0xFF ) );
+		}
+
+		return data;
+	}
+
+	static std::string repeat( std::string_view pattern, size_t count )
+	{
+		std::string result;
+		for ( size_t i = 0; i < count; ++i )
+		{
+			result.append( pattern );
+		}
+
+		return result;
+	}
+
+	//----------------------------------------------
+	// FarmHash fingerprint
+	//----------------------------------------------
+
+	TEST( FarmFingerprint, EmptyInput )
+	{
+		// FarmHash returns k2 for empty input
+		EXPECT_EQ( farmFingerprint64( "" ), CITY_K2 );
+	}
+
+	TEST( FarmFingerprint, GuavaReferenceVectors )
+	{
+		// Reference values from Guava's FarmHashFingerprint64Test
+		EXPECT_EQ( static_cast<int64_t>( farmFingerprint64( "test" ) ), 8581389452482819506LL );
+		EXPECT_EQ( static_cast<int64_t>( farmFingerprint64( repeat( "test", 8 ) ) ), -4196240717365766262LL );
+		EXPECT_EQ( static_cast<int64_t>( farmFingerprint64( repeat( "test", 64 ) ) ), 3500507768004279527LL );
+	}
+
+	TEST( FarmFingerprint, BigQueryReferenceVectors )
+	{
+		// Reference values from the BigQuery FARM_FINGERPRINT documentation
+		EXPECT_EQ( static_cast<int64_t>( farmFingerprint64( "1footrue" ) ), -1541654101129638711LL );
+		EXPECT_EQ( static_cast<int64_t>( farmFingerprint64( "2applefalse" ) ), 2794438866806483259LL );
+		EXPECT_EQ( static_cast<int64_t>( farmFingerprint64( "3true" ) ), -4880158226897771312LL );
+	}
+
+	TEST( FarmFingerprint, ShortInputsMatchCityHash )
+	{
+		// farmhashna and CityHash 1.1 share the 0-32 byte paths
+		const std::string data = generateTestData( 32 );
+		for ( size_t len = 0; len <= 32; ++len )
+		{
+			std::string_view view{ data.data(), len };
+			EXPECT_EQ( farmFingerprint64( view ), cityHash64( view ) ) << "Length " << len;
+		}
+	}
+
+	TEST( FarmFingerprint, AllLengthsDistinct )
+	{
+		const std::string data = generateTestData( 300 );
+		std::unordered_map<uint64_t, size_t> seen;
+		for ( size_t len = 0; len <= data.size(); ++len )
+		{
+			auto [it, inserted] = seen.emplace( farmFingerprint64( std::string_view{ data.data(), len } ), len );
+			EXPECT_TRUE( inserted ) << "Lengths " << it->second << " and " << len << " collide";
+		}
+	}
+
+	TEST( FarmFingerprint, SeededVariant )
+	{
+		const std::string data = generateTestData( 100 );
+
+		// Hash64WithSeed(s, seed) = HashLen16(Hash64(s) - k2, seed)
+		EXPECT_NE( farmHash64WithSeed( data, 1 ), farmFingerprint64( data ) );
+		EXPECT_NE( farmHash64WithSeed( data, 1 ), farmHash64WithSeed( data, 2 ) );
+		EXPECT_EQ( farmHash64WithSeed( data, 42 ), farmHash64WithSeed( data, 42 ) );
+	}
+
+	//----------------------------------------------
+	// CityHash64
+	//----------------------------------------------
+
+	TEST( CityHash, CityHash64ReferenceVectors )
+	{
+		// Reference values produced by CityHash 1.1 (Abseil's absl::hash_internal::CityHash64)
+		// over data[i] = (i * 131 + 7) & 0xFF, unseeded and with seed 0x1234567890ABCDEF
+		struct Vector
+		{
+			size_t length;
+			uint64_t hash;
+			uint64_t seeded;
+		};
+
+		constexpr Vector vectors[]{
+			{ 0, 0x9ae16a3b2f90404fULL, 0x15615811497ca75fULL },
+			{ 1, 0x57821efdee1b7472ULL, 0x9390fe72873a8a6dULL },
+			{ 3, 0xbeedf37b20babe01ULL, 0x357fcfa9bc0130abULL },
+			{ 4, 0x78e5c39592d63067ULL, 0xa1ba3f1573d53562ULL },
+			{ 7, 0x04dd505220c44e7eULL, 0x1f49125e2d1a220bULL },
+			{ 8, 0xc19f34cbc54f4865ULL, 0xfa24a3e9e662cc98ULL },
+			{ 15, 0x390ab3fd476b7830ULL, 0x36cc78e1c9b3731dULL },
+			{ 16, 0x08b48f7ec30e084eULL, 0xca433f18c4f9dccfULL },
+			{ 17, 0xe8255d05f537d5f5ULL, 0x7165a52771482004ULL },
+			{ 31, 0x27c23ea18dbddfc4ULL, 0x6c6fe36be3da5e54ULL },
+			{ 32, 0xeff8e4a51615d6dfULL, 0x6d002dda9d36a73eULL },
+			{ 33, 0xae01ad7aafc8f9d0ULL, 0xe60f8ee9fb7a7836ULL },
+			{ 48, 0x612d843c2cb5616dULL, 0x35622074d61d9578ULL },
+			{ 63, 0x815e60fd3a645a96ULL, 0x1acffbdad2e00e67ULL },
+			{ 64, 0x4bc22968f81c207eULL, 0x560c340b077f50cfULL },
+			{ 65, 0xa85db1d278c7ac66ULL, 0x0295ed7b3223d833ULL },
+			{ 100, 0x237f36c1e03a15d9ULL, 0x0ac89dddc6586053ULL },
+			{ 127, 0x92754ecffe772377ULL, 0x4ac6dcdb648b2ed5ULL },
+			{ 128, 0xaad7cf44dc004b0cULL, 0xfe535ca5d28119ffULL },
+			{ 129, 0x9e58deaaa50a6a1aULL, 0x32f94240e6e2b3d0ULL },
+			{ 200, 0x88b41254c3e9901aULL, 0xc1e5d5df0f6117f3ULL },
+			{ 255, 0x99c8a7dae84371a5ULL, 0xb4451c46093230d3ULL },
+			{ 256, 0x80e345ced4143875ULL, 0x9aa8958a96d65088ULL },
+			{ 300, 0x4159085572b4634bULL, 0x2cb249bd13de209fULL },
+		};
+
+		const std::string data = generateTestData( 300 );
+		for ( const auto& vector : vectors )
+		{
+			std::string_view view{ data.data(), vector.length };
+			EXPECT_EQ( cityHash64( view ), vector.hash ) << "Length " << vector.length;
+			EXPECT_EQ( cityHash64( view, 0x1234567890ABCDEFULL ), vector.seeded ) << "Length " << vector.length;
+		}
+	}
+
+	//----------------------------------------------
+	// CityHash128
+	//----------------------------------------------
+
+	TEST( CityHash, CityHash128SeedDerivation )
+	{
+		// Inputs of 16+ bytes seed the tail hash with the first 16 bytes
+		const std::string data = generateTestData( 300 );
+		for ( size_t len : { 16, 17, 100, 143, 144, 300 } )
+		{
+			std::string_view view{ data.data(), len };
+			uint64_t first;
+			uint64_t second;
+			std::memcpy( &first, view.data(), 8 );
+			std::memcpy( &second, view.data() + 8, 8 );
+
+			EXPECT_EQ( cityHash128( view ), cityHash128( view.substr( 16 ), Hash128{ first, second + CITY_K0 } ) ) << "Length " << len;
+		}
+
+		// Shorter inputs use the (k0, k1) seed
+		EXPECT_EQ( cityHash128( "short" ), cityHash128( "short", Hash128{ CITY_K0, CITY_K1 } ) );
+	}
+
+	TEST( CityHash, CityHash128AllLengthsDistinct )
+	{
+		const std::string data = generateTestData( 300 );
+		std::unordered_map<uint64_t, size_t> seenLow;
+		std::unordered_map<uint64_t, size_t> seenHigh;
+		for ( size_t len = 0; len <= data.size(); ++len )
+		{
+			Hash128 h = cityHash128( std::string_view{ data.data(), len } );
+			EXPECT_NE( h.low, h.high );
+			EXPECT_TRUE( seenLow.emplace( h.low, len ).second ) << "Length " << len;
+			EXPECT_TRUE( seenHigh.emplace( h.high, len ).second ) << "Length " << len;
+		}
+	}
+
+	//----------------------------------------------
+	// Hasher policies
+	//----------------------------------------------
+
+	TEST( FingerprintPolicy, FarmHashPolicyMatchesFingerprint )
+	{
+		Hasher<uint64_t, 0, policies::FarmHash> hasher;
+
+		EXPECT_EQ( hasher( "1footrue" ), farmFingerprint64( "1footrue" ) );
+		EXPECT_EQ( hasher( std::string{ "2applefalse" } ), farmFingerprint64( "2applefalse" ) );
+		EXPECT_EQ( hasher( std::string_view{} ), CITY_K2 );
+
+		// Seeded and 32-bit variants
+		EXPECT_EQ( ( Hasher<uint64_t, 7, policies::FarmHash>{}( "key" ) ), farmHash64WithSeed( "key", 7 ) );
+		const uint64_t fingerprint = farmFingerprint64( "key" );
+		EXPECT_EQ( ( Hasher<uint32_t, 0, policies::FarmHash>{}( "key" ) ), static_cast<uint32_t>( fingerprint ^ ( fingerprint >> 32 ) ) );
+	}
+
+	TEST( FingerprintPolicy, CityHashPolicyMatchesCityHash64 )
+	{
+		Hasher<uint64_t, 0, policies::CityHash> hasher;
+
+		EXPECT_EQ( hasher( "hello" ), cityHash64( "hello" ) );
+		EXPECT_EQ( ( Hasher<uint64_t, 99, policies::CityHash>{}( "hello" ) ), cityHash64( "hello", 99 ) );
+	}
+
+	TEST( FingerprintPolicy, PolicyAppliesToNestedStrings )
+	{
+		Hasher<uint64_t, 0, policies::FarmHash> hasher;
+		std::pair<std::string, int> key{ "join_key", 1 };
+
+		EXPECT_EQ( hasher( key ), combine<uint64_t>( farmFingerprint64( "join_key" ), hasher( 1 ) ) );
+	}
+
+	TEST( FingerprintPolicy, UnorderedMapUsage )
+	{
+		std::unordered_map<std::string, int, Hasher<uint64_t, 0, policies::FarmHash>, std::equal_to<>> map;
+		map["alpha"] = 1;
+		map["beta"] = 2;
+
+		EXPECT_EQ( map.find( std::string_view{ "alpha" } )->second, 1 );
+		EXPECT_EQ( map.find( std::string_view{ "beta" } )->second, 2 );
+		EXPECT_EQ( map.find( std::string_view{ "gamma" } ), map.end() );
+	}
+} // namespace nfx::hashing::test
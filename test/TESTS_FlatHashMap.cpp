@@ -0,0 +1,319 @@
+/**
+ * @file TESTS_FlatHashMap.cpp
+ * @brief Tests for the Swiss-table FlatHashMap
+ * @details Validates lookup, insertion, erasure with tombstones, growth, heterogeneous lookup,
+ *          precomputed hashes, iteration, value semantics and rehash rollback against
+ *          std::unordered_map as the reference
+ */
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// FlatHashMap tests
+	//=====================================================================
+
+	namespace
+	{
+		/** @brief Value whose move may throw, so rehashing must copy it; copies fail on demand */
+		struct FragileValue
+		{
+			static inline int copiesLeft = -1;
+
+			FragileValue( int v )
+				: value{ v }
+			{
+			}
+
+			FragileValue( const FragileValue& other )
+				: value{ other.value }
+			{
+				if ( copiesLeft == 0 )
+				{
+					throw std::runtime_error{ "copy failed" };
+				}
+				copiesLeft -= copiesLeft > 0 ? 1 : 0;
+			}
+
+			FragileValue( FragileValue&& other ) noexcept( false )
+				: value{ other.value }
+			{
+				other.value = -1;
+			}
+
+			FragileValue& operator=( const FragileValue& ) = default;
+
+			int value;
+		};
+	} // namespace
+
+	//----------------------------------------------
+	// Basic operations
+	//----------------------------------------------
+
+	TEST( FlatHashMap, InsertFindErase )
+	{
+		FlatHashMap<uint64_t, int> map;
+		EXPECT_TRUE( map.empty() );
+		EXPECT_EQ( map.find( 1 ), map.end() );
+
+		EXPECT_TRUE( map.insert( { 1, 10 } ).second );
+		EXPECT_FALSE( map.insert( { 1, 20 } ).second );
+		EXPECT_EQ( map.find( 1 )->second, 10 );
+
+		EXPECT_FALSE( map.insert_or_assign( 1, 30 ).second );
+		EXPECT_EQ( map.at( 1 ), 30 );
+		EXPECT_TRUE( map.try_emplace( 2, 40 ).second );
+		EXPECT_FALSE( map.try_emplace( 2, 50 ).second );
+		EXPECT_EQ( map[2], 40 );
+		EXPECT_EQ( map[3], 0 );
+		EXPECT_EQ( map.size(), 3u );
+
+		EXPECT_EQ( map.erase( 2 ), 1u );
+		EXPECT_EQ( map.erase( 2 ), 0u );
+		EXPECT_FALSE( map.contains( 2 ) );
+		EXPECT_THROW( static_cast<void>( map.at( 2 ) ), std::out_of_range );
+		EXPECT_EQ( map.size(), 2u );
+	}
+
+	TEST( FlatHashMap, EraseByIteratorVisitsEveryElement )
+	{
+		FlatHashMap<int, int> map;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			map[i] = i;
+		}
+
+		size_t erased = 0;
+		for ( auto it = map.begin(); it != map.end(); )
+		{
+			if ( it->first % 2 == 0 )
+			{
+				it = map.erase( it );
+				++erased;
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		EXPECT_EQ( erased, 500u );
+		EXPECT_EQ( map.size(), 500u );
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( key % 2, 1 );
+			EXPECT_EQ( key, value );
+		}
+	}
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	TEST( FlatHashMap, ReserveAvoidsRehash )
+	{
+		FlatHashMap<uint32_t, uint32_t> map;
+		map.reserve( 10000 );
+		const size_t capacity = map.capacity();
+		EXPECT_GE( static_cast<float>( capacity ) * ( FlatHashMap<uint32_t, uint32_t>::max_load_factor() ), 10000.0f );
+
+		for ( uint32_t i = 0; i < 10000; ++i )
+		{
+			map[i] = i;
+		}
+		EXPECT_EQ( map.capacity(), capacity );
+		EXPECT_LE( map.load_factor(), ( FlatHashMap<uint32_t, uint32_t>::max_load_factor() ) );
+	}
+
+	TEST( FlatHashMap, TombstoneChurnDoesNotGrow )
+	{
+		// Repeated insert/erase cycles at a constant size reclaim tombstones instead of doubling
+		FlatHashMap<uint64_t, uint64_t> map;
+		map.reserve( 512 );
+		const size_t capacity = map.capacity();
+
+		for ( uint64_t i = 0; i < 200000; ++i )
+		{
+			map[i] = i;
+			if ( i >= 256 )
+			{
+				ASSERT_EQ( map.erase( i - 256 ), 1u );
+			}
+		}
+
+		EXPECT_EQ( map.size(), 256u );
+		EXPECT_EQ( map.capacity(), capacity );
+		for ( uint64_t i = 200000 - 256; i < 200000; ++i )
+		{
+			EXPECT_EQ( map.at( i ), i );
+		}
+	}
+
+	TEST( FlatHashMap, ClearKeepsCapacity )
+	{
+		FlatHashMap<int, int> map{ { 1, 1 }, { 2, 2 }, { 3, 3 } };
+		const size_t capacity = map.capacity();
+		map.clear();
+
+		EXPECT_TRUE( map.empty() );
+		EXPECT_EQ( map.capacity(), capacity );
+		EXPECT_EQ( map.begin(), map.end() );
+		map[4] = 4;
+		EXPECT_EQ( map.size(), 1u );
+	}
+
+	//----------------------------------------------
+	// Heterogeneous lookup
+	//----------------------------------------------
+
+	TEST( FlatHashMap, TransparentStringLookup )
+	{
+		FlatHashMap<std::string, int> map;
+		map["alpha"] = 1;
+		map["beta"] = 2;
+
+		const std::string_view key = "alpha";
+		EXPECT_TRUE( map.contains( key ) );
+		EXPECT_EQ( map.find( key )->second, 1 );
+		EXPECT_TRUE( map.contains( "beta" ) );
+		EXPECT_EQ( map.erase( std::string_view{ "beta" } ), 1u );
+		EXPECT_FALSE( map.contains( "beta" ) );
+	}
+
+	TEST( FlatHashMap, PrecomputedHash )
+	{
+		FlatHashMap<std::string, int> map;
+		const Hasher<uint64_t> hasher;
+		const uint64_t alpha = hasher( std::string_view{ "alpha" } );
+
+		EXPECT_TRUE( map.insert_or_assign( std::string{ "alpha" }, alpha, 1 ).second );
+		EXPECT_FALSE( map.insert_or_assign( std::string{ "alpha" }, alpha, 2 ).second );
+		EXPECT_EQ( map.find( "alpha" )->second, 2 ); // Agrees with lookups that hash themselves
+		EXPECT_EQ( map.find( std::string_view{ "alpha" }, alpha )->second, 2 );
+		EXPECT_TRUE( map.contains( std::string_view{ "alpha" }, alpha ) );
+
+		map["beta"] = 3;
+		EXPECT_EQ( map.erase( std::string_view{ "alpha" }, alpha ), 1u );
+		EXPECT_FALSE( map.contains( "alpha" ) );
+		EXPECT_EQ( map.size(), 1u );
+	}
+
+	//----------------------------------------------
+	// Value semantics
+	//----------------------------------------------
+
+	TEST( FlatHashMap, CopyAndMove )
+	{
+		FlatHashMap<std::string, std::string> map;
+		for ( int i = 0; i < 500; ++i )
+		{
+			map[std::to_string( i )] = std::string( 32, static_cast<char>( 'a' + i % 26 ) );
+		}
+
+		FlatHashMap<std::string, std::string> copy{ map };
+		EXPECT_EQ( copy.size(), map.size() );
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( copy.at( key ), value );
+		}
+
+		FlatHashMap<std::string, std::string> moved{ std::move( copy ) };
+		EXPECT_EQ( moved.size(), 500u );
+		EXPECT_TRUE( copy.empty() );
+
+		copy = moved;
+		moved = std::move( map );
+		EXPECT_EQ( copy.size(), 500u );
+		EXPECT_EQ( moved.size(), 500u );
+		EXPECT_EQ( copy.at( "42" ), moved.at( "42" ) );
+	}
+
+	TEST( FlatHashMap, FailedRehashLeavesMapIntact )
+	{
+		FlatHashMap<uint64_t, FragileValue> map;
+		uint64_t key = 0;
+		while ( map.size() < 14 )
+		{
+			map.insert_or_assign( key, FragileValue{ static_cast<int>( key ) } );
+			++key;
+		}
+
+		// The next growth throws halfway through copying the elements over
+		FragileValue::copiesLeft = 7;
+		const std::size_t sizeBefore = map.size();
+		EXPECT_THROW( map.reserve( 1000 ), std::runtime_error );
+		FragileValue::copiesLeft = -1;
+
+		ASSERT_EQ( map.size(), sizeBefore );
+		for ( uint64_t k = 0; k < key; ++k )
+		{
+			ASSERT_EQ( map.at( k ).value, static_cast<int>( k ) );
+		}
+
+		map.reserve( 1000 );
+		for ( uint64_t k = 0; k < key; ++k )
+		{
+			ASSERT_EQ( map.at( k ).value, static_cast<int>( k ) );
+		}
+	}
+
+	//----------------------------------------------
+	// Reference model
+	//----------------------------------------------
+
+	TEST( FlatHashMap, MatchesUnorderedMap )
+	{
+		FlatHashMap<uint64_t, uint64_t> map;
+		std::unordered_map<uint64_t, uint64_t> reference;
+
+		std::mt19937_64 gen( 42 );
+		for ( uint64_t step = 0; step < 300000; ++step )
+		{
+			const uint64_t key = gen() % 4096;
+			switch ( gen() % 3 )
+			{
+				case 0:
+				{
+					map.insert_or_assign( key, step );
+					reference.insert_or_assign( key, step );
+					break;
+				}
+				case 1:
+				{
+					ASSERT_EQ( map.erase( key ), reference.erase( key ) );
+					break;
+				}
+				default:
+				{
+					const auto it = map.find( key );
+					const auto expected = reference.find( key );
+					ASSERT_EQ( it == map.end(), expected == reference.end() );
+					if ( it != map.end() )
+					{
+						ASSERT_EQ( it->second, expected->second );
+					}
+					break;
+				}
+			}
+		}
+
+		ASSERT_EQ( map.size(), reference.size() );
+		size_t visited = 0;
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( reference.at( key ), value );
+			++visited;
+		}
+		EXPECT_EQ( visited, reference.size() );
+	}
+} // namespace nfx::hashing::test
@@ -0,0 +1,188 @@
+/**
+ * @file TESTS_FrozenMap.cpp
+ * @brief Tests for the compile-time perfect-hash FrozenMap and StringSwitch
+ * @details Validates compile-time and run-time lookups, both hash policies, missing keys,
+ *          duplicate detection and switch-on-string dispatch
+ */
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// FrozenMap tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Fixtures
+	//----------------------------------------------
+
+	static constexpr auto HTTP_METHODS = makeFrozenMap<int>( {
+		{ "GET", 1 },
+		{ "HEAD", 2 },
+		{ "POST", 3 },
+		{ "PUT", 4 },
+		{ "DELETE", 5 },
+		{ "CONNECT", 6 },
+		{ "OPTIONS", 7 },
+		{ "TRACE", 8 },
+		{ "PATCH", 9 },
+	} );
+
+	static constexpr auto GREEK = makeFrozenMap<char, policies::Fnv1a>( { { "alpha", 'a' }, { "beta", 'b' }, { "gamma", 'g' } } );
+
+	static constexpr auto HEADERS = makeStringSwitch( {
+		"accept",
+		"accept-encoding",
+		"accept-language",
+		"authorization",
+		"cache-control",
+		"connection",
+		"content-encoding",
+		"content-length",
+		"content-type",
+		"cookie",
+		"date",
+		"etag",
+		"expect",
+		"host",
+		"if-match",
+		"if-modified-since",
+		"if-none-match",
+		"last-modified",
+		"location",
+		"origin",
+		"pragma",
+		"range",
+		"referer",
+		"server",
+		"set-cookie",
+		"transfer-encoding",
+		"upgrade",
+		"user-agent",
+		"vary",
+		"via",
+		"",
+	} );
+
+	//----------------------------------------------
+	// Compile-time evaluation
+	//----------------------------------------------
+
+	static_assert( *HTTP_METHODS.find( "GET" ) == 1 );
+	static_assert( HTTP_METHODS.at( "PATCH" ) == 9 );
+	static_assert( !HTTP_METHODS.contains( "get" ) );
+	static_assert( GREEK.at( "beta" ) == 'b' );
+	static_assert( HEADERS( "host" ) == 13 );
+	static_assert( HEADERS( "x-unknown" ) == HEADERS.NO_MATCH );
+
+	//----------------------------------------------
+	// Run-time lookup
+	//----------------------------------------------
+
+	TEST( FrozenMap, RuntimeLookupMatchesCompileTimeLayout )
+	{
+		const std::vector<std::string> methods{ "GET", "HEAD", "POST", "PUT", "DELETE", "CONNECT", "OPTIONS", "TRACE", "PATCH" };
+		for ( std::size_t i = 0; i < methods.size(); ++i )
+		{
+			const int* value = HTTP_METHODS.find( methods[i] );
+			ASSERT_NE( value, nullptr ) << methods[i];
+			EXPECT_EQ( *value, static_cast<int>( i ) + 1 );
+		}
+
+		EXPECT_EQ( HTTP_METHODS.find( "GE" ), nullptr );
+		EXPECT_EQ( HTTP_METHODS.find( "GETS" ), nullptr );
+		EXPECT_EQ( HTTP_METHODS.find( "" ), nullptr );
+		EXPECT_THROW( (void)HTTP_METHODS.at( "BREW" ), std::out_of_range );
+		EXPECT_EQ( HTTP_METHODS.size(), 9u );
+	}
+
+	TEST( FrozenMap, Fnv1aPolicy )
+	{
+		const std::string gamma{ "gamma" };
+		EXPECT_EQ( GREEK.at( gamma ), 'g' );
+		EXPECT_FALSE( GREEK.contains( "delta" ) );
+	}
+
+	TEST( FrozenMap, LargeKeySetBuiltAtRunTime )
+	{
+		std::vector<std::string> storage;
+		for ( int i = 0; i < 500; ++i )
+		{
+			storage.push_back( "token_" + std::to_string( i ) );
+		}
+
+		std::array<std::pair<std::string_view, int>, 500> entries{};
+		for ( int i = 0; i < 500; ++i )
+		{
+			entries[i] = { storage[i], i };
+		}
+		const FrozenMap<int, 500> map{ entries };
+
+		for ( int i = 0; i < 500; ++i )
+		{
+			ASSERT_EQ( map.at( storage[i] ), i );
+		}
+		EXPECT_FALSE( map.contains( "token_500" ) );
+	}
+
+	TEST( FrozenMap, EmptyMap )
+	{
+		static constexpr FrozenMap<int, 0> empty{ {} };
+
+		EXPECT_EQ( empty.find( "" ), nullptr );
+		EXPECT_EQ( empty.size(), 0u );
+	}
+
+	TEST( FrozenMap, RejectsDuplicateKeys )
+	{
+		const std::array<std::pair<std::string_view, int>, 3> entries{ { { "a", 1 }, { "b", 2 }, { "a", 3 } } };
+
+		EXPECT_THROW( ( FrozenMap<int, 3>{ entries } ), std::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// StringSwitch
+	//----------------------------------------------
+
+	static int headerClass( std::string_view name )
+	{
+		switch ( HEADERS( name ) )
+		{
+			case HEADERS.caseOf( "content-length" ):
+			case HEADERS.caseOf( "content-type" ):
+			case HEADERS.caseOf( "content-encoding" ):
+				return 1;
+			case HEADERS.caseOf( "host" ):
+				return 2;
+			case HEADERS.caseOf( "" ):
+				return 3;
+			default:
+				return 0;
+		}
+	}
+
+	TEST( StringSwitch, DispatchesOnTokens )
+	{
+		EXPECT_EQ( headerClass( std::string{ "content-type" } ), 1 );
+		EXPECT_EQ( headerClass( "content-length" ), 1 );
+		EXPECT_EQ( headerClass( "host" ), 2 );
+		EXPECT_EQ( headerClass( "" ), 3 );
+		EXPECT_EQ( headerClass( "accept" ), 0 );
+		EXPECT_EQ( headerClass( "x-forwarded-for" ), 0 );
+	}
+
+	TEST( StringSwitch, IndicesFollowTokenOrder )
+	{
+		EXPECT_EQ( HEADERS( "accept" ), 0u );
+		EXPECT_EQ( HEADERS( "via" ), 29u );
+		EXPECT_EQ( HEADERS( "Host" ), HEADERS.NO_MATCH );
+	}
+} // namespace nfx::hashing::test
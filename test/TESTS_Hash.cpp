@@ -7,6 +7,7 @@
 
 #include <array>
 #include <optional>
+#include <random>
 #include <string>
 #include <tuple>
 #include <variant>
@@ -294,6 +295,37 @@ namespace nfx::hashing::test
 		auto expected2 = Hasher<uint32_t, seed>{}( "hello" );
 		EXPECT_EQ( h2, expected2 );
 	}
+
+	//----------------------------------------------
+	// Integer hash inversion tests
+	//----------------------------------------------
+
+	TEST( Hash, UnhashIntegerInvertsUnseededHash )
+	{
+		static_assert( unhashInteger<0>( 0 ) == 0 );
+
+		std::mt19937_64 gen( 42 );
+		for ( int i = 0; i < 100000; ++i )
+		{
+			const uint64_t value = gen();
+			ASSERT_EQ( unhashInteger<0>( hash<uint64_t, uint64_t, 0>( value ) ), value );
+		}
+		EXPECT_EQ( unhashInteger<0>( hash<uint64_t, uint64_t, 0>( ~uint64_t{ 0 } ) ), ~uint64_t{ 0 } );
+	}
+
+	TEST( Hash, UnhashIntegerInvertsSeededHash )
+	{
+		for ( uint64_t value = 0; value < 10000; ++value )
+		{
+			ASSERT_EQ( unhashInteger( hash<uint64_t, uint64_t>( value ) ), value );
+		}
+
+		constexpr uint64_t seed = 0x0123456789ABCDEFULL;
+		EXPECT_EQ( ( unhashInteger<seed>( hash<uint64_t, uint64_t, seed>( 987654321 ) ) ), 987654321u );
+
+		// The seed itself hashes to 0, like 0 does, and is the one value that does not round-trip
+		EXPECT_EQ( ( hash<uint64_t, uint64_t, seed>( seed ) ), 0u );
+	}
 } // namespace nfx::hashing::test
 
 //=====================================================================
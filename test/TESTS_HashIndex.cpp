@@ -0,0 +1,224 @@
+/**
+ * @file TESTS_HashIndex.cpp
+ * @brief Tests for the immutable memory-mappable hash index
+ * @details Validates build / lookup round trips in memory and through a mapped file, header
+ *          validation, hasher mismatch detection and duplicate key rejection
+ */
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// HashIndex tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	static std::filesystem::path temporaryIndexPath( const std::string& name )
+	{
+		return std::filesystem::temp_directory_path() / ( "nfx_hashindex_" + name + ".nfxidx" );
+	}
+
+	//----------------------------------------------
+	// In-memory image
+	//----------------------------------------------
+
+	TEST( HashIndex, RoundTripsIntegerKeys )
+	{
+		HashIndexBuilder<> builder{ 10000 };
+		for ( uint64_t i = 0; i < 10000; ++i )
+		{
+			builder.add( i, i * 3 );
+		}
+		const auto image = builder.build();
+
+		HashIndexView<> view{ image };
+		EXPECT_EQ( view.size(), 10000u );
+		EXPECT_EQ( view.slotCount(), 32768u );
+		EXPECT_EQ( image.size(), 64u + 16u * view.slotCount() );
+
+		for ( uint64_t i = 0; i < 10000; ++i )
+		{
+			ASSERT_EQ( view.find( i ), i * 3 );
+		}
+		for ( uint64_t i = 10000; i < 20000; ++i )
+		{
+			ASSERT_FALSE( view.contains( i ) );
+		}
+	}
+
+	TEST( HashIndex, RoundTripsStringKeys )
+	{
+		HashIndexBuilder<> builder;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			builder.add( "key-" + std::to_string( i ), static_cast<uint64_t>( i ) );
+		}
+		const auto image = builder.build();
+
+		HashIndexView<> view{ image };
+		for ( int i = 0; i < 1000; ++i )
+		{
+			ASSERT_EQ( view.find( std::string_view{ "key-" + std::to_string( i ) } ), static_cast<uint64_t>( i ) );
+		}
+		EXPECT_EQ( view.find( std::string_view{ "key-1000" } ), std::nullopt );
+	}
+
+	TEST( HashIndex, RoundTripsMillionRandomStrings )
+	{
+		// Enough keys for 64-bit CRC32-C string hashes to collide; the default hasher must not
+		std::vector<std::string> keys( 1000000, std::string( 16, ' ' ) );
+		std::mt19937_64 gen( 11 );
+		for ( auto& key : keys )
+		{
+			for ( auto& ch : key )
+			{
+				ch = static_cast<char>( 'a' + gen() % 26 );
+			}
+		}
+
+		HashIndexBuilder<> builder{ keys.size() };
+		for ( std::size_t i = 0; i < keys.size(); ++i )
+		{
+			builder.add( keys[i], i );
+		}
+		const auto image = builder.build();
+
+		HashIndexView<> view{ image };
+		EXPECT_EQ( view.size(), keys.size() );
+		for ( std::size_t i = 0; i < keys.size(); ++i )
+		{
+			ASSERT_EQ( view.find( keys[i] ), i );
+		}
+	}
+
+	TEST( HashIndex, EmptyIndex )
+	{
+		const auto image = HashIndexBuilder<>{}.build();
+		HashIndexView<> view{ image };
+
+		EXPECT_EQ( view.size(), 0u );
+		EXPECT_EQ( view.slotCount(), 16u );
+		EXPECT_FALSE( view.contains( 0 ) );
+
+		HashIndexView<> unbound;
+		EXPECT_FALSE( unbound.contains( 0 ) );
+	}
+
+	TEST( HashIndex, HeaderIsLittleEndianAndVersioned )
+	{
+		HashIndexBuilder<> builder;
+		builder.add( 1, 2 );
+		const auto image = builder.build();
+
+		EXPECT_EQ( std::memcmp( image.data(), "NFXHIDX1", 8 ), 0 );
+		EXPECT_EQ( static_cast<unsigned char>( image[8] ), 1 );
+		EXPECT_EQ( static_cast<unsigned char>( image[12] ), 64 );
+	}
+
+	//----------------------------------------------
+	// Validation
+	//----------------------------------------------
+
+	TEST( HashIndex, RejectsDuplicateKeys )
+	{
+		HashIndexBuilder<> builder;
+		builder.add( std::string_view{ "same" }, 1 );
+		builder.add( std::string_view{ "other" }, 2 );
+		builder.add( std::string_view{ "same" }, 3 );
+
+		EXPECT_THROW( (void)builder.build(), std::invalid_argument );
+	}
+
+	TEST( HashIndex, RejectsMalformedImages )
+	{
+		HashIndexBuilder<> builder;
+		builder.add( 7, 7 );
+		const auto image = builder.build();
+
+		auto badMagic = image;
+		badMagic[0] = std::byte{ 'X' };
+		EXPECT_THROW( HashIndexView<>{ badMagic }, std::runtime_error );
+
+		auto badVersion = image;
+		badVersion[8] = std::byte{ 2 };
+		EXPECT_THROW( HashIndexView<>{ badVersion }, std::runtime_error );
+
+		const std::span<const std::byte> truncated{ image.data(), image.size() - 16 };
+		EXPECT_THROW( HashIndexView<>{ truncated }, std::runtime_error );
+
+		const std::span<const std::byte> headerOnly{ image.data(), 32 };
+		EXPECT_THROW( HashIndexView<>{ headerOnly }, std::runtime_error );
+	}
+
+	TEST( HashIndex, RejectsDifferentHasher )
+	{
+		HashIndexBuilder<Hasher<uint64_t, 1>> builder;
+		builder.add( 7, 7 );
+		const auto image = builder.build();
+
+		using SeedOne = HashIndexView<Hasher<uint64_t, 1>>;
+		using SeedTwo = HashIndexView<Hasher<uint64_t, 2>>;
+		EXPECT_NO_THROW( SeedOne{ image } );
+		EXPECT_THROW( SeedTwo{ image }, std::runtime_error );
+	}
+
+	//----------------------------------------------
+	// Mapped file
+	//----------------------------------------------
+
+	TEST( HashIndex, MapsWrittenFile )
+	{
+		const auto path = temporaryIndexPath( "mapped" );
+
+		std::mt19937_64 gen( 7 );
+		std::vector<uint64_t> keys( 50000 );
+		HashIndexBuilder<> builder{ keys.size() };
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			keys[i] = gen();
+			builder.add( keys[i], i );
+		}
+		builder.write( path );
+
+		{
+			MappedHashIndex<> index{ path };
+			EXPECT_EQ( index.size(), keys.size() );
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				ASSERT_EQ( index.find( keys[i] ), i );
+			}
+
+			MappedHashIndex<> moved{ std::move( index ) };
+			EXPECT_EQ( moved.find( keys[0] ), 0u );
+			EXPECT_EQ( moved.view().size(), keys.size() );
+		}
+
+		std::filesystem::remove( path );
+	}
+
+	TEST( HashIndex, MappingFailuresThrow )
+	{
+		EXPECT_THROW( MappedHashIndex<>{ temporaryIndexPath( "missing" ) }, std::runtime_error );
+
+		const auto path = temporaryIndexPath( "garbage" );
+		{
+			std::ofstream file{ path, std::ios::binary };
+			file << std::string( 256, 'x' );
+		}
+		EXPECT_THROW( MappedHashIndex<>{ path }, std::runtime_error );
+		std::filesystem::remove( path );
+	}
+} // namespace nfx::hashing::test
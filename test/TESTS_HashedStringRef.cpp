@@ -0,0 +1,118 @@
+/**
+ * @file TESTS_HashedStringRef.cpp
+ * @brief Tests for the compact hashed string reference
+ * @details Validates layout, inline and pointer storage, equality across the inline boundary,
+ *          hash consistency with Hasher, mismatch rejection without reading heap characters, and
+ *          use as a FlatHashMap key
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// HashedStringRef tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Storage
+	//----------------------------------------------
+
+	TEST( HashedStringRef, InlineAndPointerStorage )
+	{
+		static_assert( sizeof( HashedStringRef ) == 16 );
+
+		const HashedStringRef empty;
+		EXPECT_TRUE( empty.empty() );
+		EXPECT_EQ( empty.view(), "" );
+
+		const std::string shortText = "twelve_chars";
+		const HashedStringRef shortRef{ shortText };
+		EXPECT_TRUE( shortRef.isInline() );
+		EXPECT_EQ( shortRef.view(), shortText );
+		EXPECT_NE( shortRef.data(), shortText.data() );
+
+		const std::string longText = "thirteen_char";
+		const HashedStringRef longRef{ longText };
+		EXPECT_FALSE( longRef.isInline() );
+		EXPECT_EQ( longRef.data(), longText.data() );
+		EXPECT_EQ( longRef.size(), 13u );
+	}
+
+	//----------------------------------------------
+	// Equality and hashing
+	//----------------------------------------------
+
+	TEST( HashedStringRef, EqualityAndHashMatchCharacters )
+	{
+		const std::vector<std::string> texts{ "", "a", "abcd", "abce", "abcdefghijkl", "abcdefghijkm", "abcdefghijklm", "abcdefghijkln", std::string( 1000, 'x' ) };
+		for ( const auto& a : texts )
+		{
+			const std::string copy = a;
+			const HashedStringRef lhs{ a };
+			const HashedStringRef rhs{ copy };
+			EXPECT_EQ( lhs, rhs );
+			EXPECT_EQ( lhs.hash(), Hasher<>{}( a ) );
+			EXPECT_EQ( Hasher<>{}( lhs ), Hasher<>{}( a ) );
+			EXPECT_EQ( ( Hasher<uint64_t>{}( lhs ) ), ( Hasher<uint64_t>{}( rhs ) ) );
+			EXPECT_EQ( ( Hasher<uint64_t, 0, policies::FarmHash>{}( lhs ) ), ( Hasher<uint64_t, 0, policies::FarmHash>{}( a ) ) );
+			for ( const auto& b : texts )
+			{
+				EXPECT_EQ( lhs == HashedStringRef{ b }, a == b );
+			}
+		}
+
+		EXPECT_NE( Hasher<uint64_t>{}( HashedStringRef{ "abcdefghijklm" } ), ( Hasher<uint64_t, 7>{}( HashedStringRef{ "abcdefghijklm" } ) ) );
+	}
+
+	TEST( HashedStringRef, MismatchDoesNotReadCharacters )
+	{
+		const std::string kept = "session:0000000000000001";
+		const HashedStringRef keptRef{ kept };
+
+		// The referenced characters are freed; comparing must stop at length and hash
+		auto freed = std::make_unique<std::string>( "session:0000000000000002" );
+		const HashedStringRef danglingRef{ *freed };
+		const uint32_t cachedHash = Hasher<>{}( *freed );
+		freed.reset();
+
+		EXPECT_FALSE( keptRef == danglingRef );
+		EXPECT_EQ( Hasher<>{}( danglingRef ), cachedHash );
+		EXPECT_NE( Hasher<uint64_t>{}( danglingRef ), Hasher<uint64_t>{}( keptRef ) );
+	}
+
+	//----------------------------------------------
+	// Container keys
+	//----------------------------------------------
+
+	TEST( HashedStringRef, FlatHashMapKey )
+	{
+		std::vector<std::string> names;
+		for ( int i = 0; i < 2000; ++i )
+		{
+			names.push_back( ( i % 2 ? "column_with_a_long_name_" : "col" ) + std::to_string( i ) );
+		}
+
+		FlatHashMap<HashedStringRef, int, Hasher<>, std::equal_to<>> map;
+		for ( int i = 0; i < 2000; ++i )
+		{
+			map.try_emplace( HashedStringRef{ names[i] }, i );
+		}
+
+		EXPECT_EQ( map.size(), 2000u );
+		for ( int i = 0; i < 2000; ++i )
+		{
+			const std::string probe = names[i];
+			const auto it = map.find( HashedStringRef{ probe } );
+			ASSERT_NE( it, map.end() );
+			EXPECT_EQ( it->second, i );
+		}
+		EXPECT_EQ( map.find( HashedStringRef{ "column_with_a_long_name_x" } ), map.end() );
+	}
+} // namespace nfx::hashing::test
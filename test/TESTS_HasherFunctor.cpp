@@ -1,8 +1,9 @@
 /**
  * @file TESTS_HasherFunctor.cpp
  * @brief Tests for STL-compatible Hasher functor
- * @details Tests for Hasher<HashType, Seed> supporting strings, integers, floats,
- *          pointers, enums, pairs, tuples, arrays, vectors, spans, optionals, and variants
+ * @details Tests for Hasher<HashType, Seed, Policy> supporting strings, integers, floats,
+ *          pointers, enums, pairs, tuples, arrays, vectors, spans, optionals, variants,
+ *          and string hashing policies
  */
 
 #include <unordered_set>
@@ -351,6 +352,34 @@ namespace nfx::hashing::test
 		EXPECT_EQ( hash1, hasher2( test ) );
 	}
 
+	TEST( HasherFunctor, StringHashPolicies )
+	{
+		std::string_view key{ "policy" };
+
+		// Default policy is CRC32-C
+		EXPECT_EQ( ( Hasher<uint32_t>{}( key ) ), ( Hasher<uint32_t, FNV_OFFSET_BASIS_32, policies::Crc32c>{}( key ) ) );
+
+		// FNV-1a policy uses the seed as offset basis
+		uint64_t fnv{ FNV_OFFSET_BASIS_64 };
+		for ( char ch : key )
+		{
+			fnv = fnv1a<uint64_t>( fnv, static_cast<uint8_t>( ch ) );
+		}
+		EXPECT_EQ( ( Hasher<uint64_t, FNV_OFFSET_BASIS_64, policies::Fnv1a>{}( key ) ), fnv );
+
+		// Larson policy
+		uint32_t larsonHash{ 0 };
+		for ( char ch : key )
+		{
+			larsonHash = larson( larsonHash, static_cast<uint8_t>( ch ) );
+		}
+		EXPECT_EQ( ( Hasher<uint32_t, 0, policies::Larson>{}( key ) ), larsonHash );
+
+		// In-house policies keep the empty-string identity
+		EXPECT_EQ( ( Hasher<uint32_t, FNV_OFFSET_BASIS_32, policies::Fnv1a>{}( "" ) ), 0u );
+		EXPECT_EQ( ( Hasher<uint64_t, 0, policies::Larson>{}( "" ) ), 0u );
+	}
+
 	TEST( HasherFunctor, ConsistencyAcrossTypes )
 	{
 		Hasher<> hasher;
@@ -0,0 +1,186 @@
+/**
+ * @file TESTS_HyperLogLog.cpp
+ * @brief Tests for the HyperLogLog++ sketch
+ * @details Validates estimation error across cardinalities and the sparse to dense transition,
+ *          batched insertion, merges against sketches of the union, and image round trips
+ */
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// HyperLogLog tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Estimation
+	//----------------------------------------------
+
+	TEST( HyperLogLog, EstimatesWithinErrorBoundAcrossCardinalities )
+	{
+		EXPECT_THROW( HyperLogLog<>{ 3 }, std::invalid_argument );
+		EXPECT_THROW( HyperLogLog<>{ 19 }, std::invalid_argument );
+
+		HyperLogLog<> sketch;
+		EXPECT_EQ( sketch.precision(), HyperLogLog<>::DEFAULT_PRECISION );
+		EXPECT_EQ( sketch.estimate(), 0.0 );
+
+		uint64_t inserted = 0;
+		for ( const uint64_t target : { 10u, 100u, 1000u, 4000u, 20000u, 100000u, 1000000u } )
+		{
+			for ( ; inserted < target; ++inserted )
+			{
+				sketch.insert( inserted );
+			}
+
+			// Five standard errors of 1.04 / sqrt( 2^14 ); sparse mode is far tighter
+			const double error = std::abs( sketch.estimate() - static_cast<double>( target ) ) / static_cast<double>( target );
+			EXPECT_LT( error, sketch.isSparse() ? 0.01 : 0.041 ) << target;
+			if ( target <= 1000 )
+			{
+				EXPECT_TRUE( sketch.isSparse() ) << target;
+			}
+			if ( target >= 20000 )
+			{
+				EXPECT_FALSE( sketch.isSparse() ) << target;
+			}
+		}
+
+		// Duplicates do not move the estimate
+		const double before = sketch.estimate();
+		for ( uint64_t key = 0; key < 1000; ++key )
+		{
+			sketch.insert( key );
+		}
+		EXPECT_EQ( sketch.estimate(), before );
+
+		sketch.clear();
+		EXPECT_TRUE( sketch.isSparse() );
+		EXPECT_EQ( sketch.estimate(), 0.0 );
+	}
+
+	TEST( HyperLogLog, BatchedAddMatchesSingleAdds )
+	{
+		const Hasher<uint64_t> hasher;
+		std::vector<uint64_t> hashes;
+		for ( uint64_t key = 0; key < 50000; ++key )
+		{
+			hashes.push_back( hasher( key ) );
+		}
+
+		for ( const unsigned int precision : { 4u, 10u, 14u } )
+		{
+			HyperLogLog<> single{ precision };
+			for ( const auto hash : hashes )
+			{
+				single.add( hash );
+			}
+
+			// Batches straddle the sparse to dense transition
+			HyperLogLog<> batched{ precision };
+			const std::span<const uint64_t> all{ hashes };
+			for ( std::size_t offset = 0; offset < hashes.size(); offset += 777 )
+			{
+				batched.add( all.subspan( offset, std::min<std::size_t>( 777, hashes.size() - offset ) ) );
+			}
+			EXPECT_EQ( batched.serialize(), single.serialize() ) << precision;
+		}
+	}
+
+	//----------------------------------------------
+	// Merge
+	//----------------------------------------------
+
+	TEST( HyperLogLog, MergeMatchesSketchOfUnion )
+	{
+		const auto sketchOf = []( uint64_t begin, uint64_t end, unsigned int precision = HyperLogLog<>::DEFAULT_PRECISION ) {
+			HyperLogLog<> sketch{ precision };
+			for ( uint64_t key = begin; key < end; ++key )
+			{
+				sketch.insert( key );
+			}
+
+			return sketch;
+		};
+
+		// Sparse with sparse
+		auto left = sketchOf( 0, 500 );
+		left.merge( sketchOf( 250, 750 ) );
+		EXPECT_TRUE( left.isSparse() );
+		EXPECT_EQ( left.estimate(), sketchOf( 0, 750 ).estimate() );
+
+		// Dense with dense, dense with sparse and sparse with dense
+		auto dense = sketchOf( 0, 200000 );
+		dense.merge( sketchOf( 100000, 300000 ) );
+		dense.merge( sketchOf( 300000, 300100 ) );
+		const auto expected = sketchOf( 0, 300100 );
+		EXPECT_EQ( dense.serialize(), expected.serialize() );
+
+		auto sparse = sketchOf( 300000, 300100 );
+		sparse.merge( sketchOf( 0, 300000 ) );
+		EXPECT_FALSE( sparse.isSparse() );
+		EXPECT_EQ( sparse.serialize(), expected.serialize() );
+
+		// Register counts below and above one AVX2 lane
+		for ( const unsigned int precision : { 4u, 6u, 18u } )
+		{
+			auto small = sketchOf( 0, 400000, precision );
+			small.merge( sketchOf( 200000, 600000, precision ) );
+			EXPECT_EQ( small.serialize(), sketchOf( 0, 600000, precision ).serialize() ) << precision;
+		}
+
+		HyperLogLog<> other{ 12 };
+		EXPECT_THROW( left.merge( other ), std::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// Images
+	//----------------------------------------------
+
+	TEST( HyperLogLog, ImagesRoundTripAndRejectMalformedInput )
+	{
+		HyperLogLog<> sparse;
+		for ( uint64_t key = 0; key < 1000; ++key )
+		{
+			sparse.insert( key );
+		}
+		const auto sparseImage = sparse.serialize();
+		EXPECT_LT( sparseImage.size(), 32u + 4u * 1000u );
+		const HyperLogLog<> sparseCopy{ sparseImage };
+		EXPECT_TRUE( sparseCopy.isSparse() );
+		EXPECT_EQ( sparseCopy.estimate(), sparse.estimate() );
+		EXPECT_EQ( sparseCopy.serialize(), sparseImage );
+
+		HyperLogLog<> dense;
+		for ( uint64_t key = 0; key < 100000; ++key )
+		{
+			dense.insert( key );
+		}
+		const auto denseImage = dense.serialize();
+		EXPECT_EQ( denseImage.size(), 32u + ( 1u << 14 ) / 4 * 3 );
+		const HyperLogLog<> denseCopy{ denseImage };
+		EXPECT_FALSE( denseCopy.isSparse() );
+		EXPECT_EQ( denseCopy.estimate(), dense.estimate() );
+		EXPECT_EQ( denseCopy.serialize(), denseImage );
+
+		auto badMagic = denseImage;
+		badMagic[0] = std::byte{ 'X' };
+		EXPECT_THROW( HyperLogLog<>{ badMagic }, std::runtime_error );
+		const std::span<const std::byte> truncated{ denseImage.data(), denseImage.size() - 3 };
+		EXPECT_THROW( HyperLogLog<>{ truncated }, std::runtime_error );
+		auto badRegister = denseImage;
+		badRegister.back() = std::byte{ 0xFF };
+		EXPECT_THROW( HyperLogLog<>{ badRegister }, std::runtime_error );
+		auto trailing = sparseImage;
+		trailing.push_back( std::byte{ 0 } );
+		EXPECT_THROW( HyperLogLog<>{ trailing }, std::runtime_error );
+		using OtherSeed = HyperLogLog<Hasher<uint64_t, 1>>;
+		EXPECT_THROW( OtherSeed{ sparseImage }, std::runtime_error );
+	}
+} // namespace nfx::hashing::test
@@ -0,0 +1,119 @@
+/**
+ * @file TESTS_LinearHashMap.cpp
+ * @brief Tests for the linear-hashing LinearHashMap
+ * @details Validates incremental bucket splitting, lookup across split rounds, erasure,
+ *          iteration, heterogeneous lookup and agreement with std::unordered_map
+ */
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// LinearHashMap tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Incremental growth
+	//----------------------------------------------
+
+	TEST( LinearHashMap, GrowsOneBucketPerInsertion )
+	{
+		using Map = LinearHashMap<uint64_t, uint64_t>;
+		Map map;
+		EXPECT_EQ( map.bucket_count(), Map::INITIAL_BUCKETS );
+
+		for ( uint64_t i = 0; i < 5000; ++i )
+		{
+			const size_t before = map.bucket_count();
+			map[i] = i;
+			EXPECT_LE( map.bucket_count() - before, 1u );
+			EXPECT_LE( map.load_factor(), Map::max_load_factor() );
+		}
+		EXPECT_EQ( map.bucket_count(), 5000u );
+
+		for ( uint64_t i = 0; i < 5000; ++i )
+		{
+			ASSERT_EQ( map.at( i ), i );
+		}
+	}
+
+	TEST( LinearHashMap, ReferencesSurviveSplits )
+	{
+		LinearHashMap<int, std::string> map;
+		std::string& first = map[0];
+		first = "stable";
+		for ( int i = 1; i < 10000; ++i )
+		{
+			map[i] = std::to_string( i );
+		}
+
+		EXPECT_EQ( &first, &map.find( 0 )->second );
+		EXPECT_EQ( first, "stable" );
+	}
+
+	//----------------------------------------------
+	// Lookup and modification
+	//----------------------------------------------
+
+	TEST( LinearHashMap, BasicOperations )
+	{
+		LinearHashMap<std::string, int> map{ { "alpha", 1 }, { "beta", 2 } };
+		EXPECT_EQ( map.size(), 2u );
+		EXPECT_TRUE( map.contains( std::string_view{ "alpha" } ) );
+		EXPECT_EQ( map.find( std::string_view{ "beta" } )->second, 2 );
+
+		EXPECT_FALSE( map.insert_or_assign( "alpha", 10 ).second );
+		EXPECT_TRUE( map.try_emplace( "gamma", 3 ).second );
+		EXPECT_FALSE( map.try_emplace( "gamma", 4 ).second );
+		EXPECT_EQ( map["alpha"], 10 );
+		EXPECT_EQ( map["gamma"], 3 );
+
+		EXPECT_EQ( map.erase( "beta" ), 1u );
+		EXPECT_EQ( map.erase( "beta" ), 0u );
+		EXPECT_EQ( map.find( "beta" ), map.end() );
+
+		LinearHashMap<std::string, int> copy{ map };
+		map.clear();
+		EXPECT_TRUE( map.empty() );
+		EXPECT_EQ( copy.size(), 2u );
+		EXPECT_EQ( copy["gamma"], 3 );
+	}
+
+	TEST( LinearHashMap, MatchesUnorderedMap )
+	{
+		LinearHashMap<uint64_t, uint64_t> map;
+		std::unordered_map<uint64_t, uint64_t> reference;
+
+		std::mt19937_64 gen( 7 );
+		for ( uint64_t step = 0; step < 200000; ++step )
+		{
+			const uint64_t key = gen() % 20000;
+			if ( gen() % 4 == 0 )
+			{
+				ASSERT_EQ( map.erase( key ), reference.erase( key ) );
+			}
+			else
+			{
+				map.insert_or_assign( key, step );
+				reference.insert_or_assign( key, step );
+			}
+		}
+
+		ASSERT_EQ( map.size(), reference.size() );
+		size_t visited = 0;
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( reference.at( key ), value );
+			++visited;
+		}
+		EXPECT_EQ( visited, reference.size() );
+	}
+} // namespace nfx::hashing::test
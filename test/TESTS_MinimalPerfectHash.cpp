@@ -0,0 +1,194 @@
+/**
+ * @file TESTS_MinimalPerfectHash.cpp
+ * @brief Tests for the BBHash-style MinimalPerfectHash
+ * @details Validates that build keys map bijectively onto [0, n), parallel and serial builds
+ *          agree, serialized and mapped images answer identically, and invalid input is rejected
+ */
+
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// MinimalPerfectHash tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	static std::vector<uint64_t> randomKeys( std::size_t count, uint64_t seed )
+	{
+		std::vector<uint64_t> keys( count );
+		std::mt19937_64 gen( seed );
+		for ( auto& key : keys )
+		{
+			key = gen();
+		}
+
+		return keys;
+	}
+
+	template <typename TFunction, typename TKeys>
+	static void expectMinimalPerfect( const TFunction& function, const TKeys& keys )
+	{
+		std::vector<bool> used( keys.size(), false );
+		for ( const auto& key : keys )
+		{
+			const uint64_t index = function( key );
+			ASSERT_LT( index, keys.size() );
+			ASSERT_FALSE( used[index] ) << "index " << index << " assigned twice";
+			used[index] = true;
+		}
+	}
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	TEST( MinimalPerfectHash, MapsIntegerKeysBijectively )
+	{
+		const auto keys = randomKeys( 200000, 1 );
+		const auto mphf = MinimalPerfectHash<>::build( keys );
+
+		EXPECT_EQ( mphf.size(), keys.size() );
+		expectMinimalPerfect( mphf, keys );
+		EXPECT_LT( mphf.bitsPerKey(), 3.2 );
+	}
+
+	TEST( MinimalPerfectHash, MapsStringKeysBijectively )
+	{
+		std::vector<std::string> keys;
+		for ( int i = 0; i < 20000; ++i )
+		{
+			keys.push_back( "sku-" + std::to_string( i * 7919 ) );
+		}
+		const auto mphf = MinimalPerfectHash<>::build( keys );
+
+		expectMinimalPerfect( mphf, keys );
+		EXPECT_EQ( mphf( std::string_view{ keys[5] } ), mphf( keys[5] ) );
+	}
+
+	TEST( MinimalPerfectHash, MapsMillionRandomStrings )
+	{
+		// Enough keys for 64-bit CRC32-C string hashes to collide; the default hasher must not
+		std::vector<std::string> keys( 1000000, std::string( 16, ' ' ) );
+		std::mt19937_64 gen( 9 );
+		for ( auto& key : keys )
+		{
+			for ( auto& ch : key )
+			{
+				ch = static_cast<char>( 'a' + gen() % 26 );
+			}
+		}
+		const auto mphf = MinimalPerfectHash<>::build( keys );
+
+		EXPECT_EQ( mphf.size(), keys.size() );
+		expectMinimalPerfect( mphf, keys );
+	}
+
+	TEST( MinimalPerfectHash, SmallAndEmptySets )
+	{
+		const auto empty = MinimalPerfectHash<>::build( std::vector<uint64_t>{} );
+		EXPECT_EQ( empty.size(), 0u );
+		EXPECT_EQ( empty( 42 ), 0u );
+
+		const std::vector<uint64_t> one{ 42 };
+		EXPECT_EQ( MinimalPerfectHash<>::build( one )( 42 ), 0u );
+
+		const auto few = randomKeys( 10, 2 );
+		expectMinimalPerfect( MinimalPerfectHash<>::build( few ), few );
+	}
+
+	TEST( MinimalPerfectHash, LargerGammaUsesFewerLevels )
+	{
+		const auto keys = randomKeys( 100000, 3 );
+		const auto compact = MinimalPerfectHash<>::build( keys, { .gamma = 1.0 } );
+		const auto fast = MinimalPerfectHash<>::build( keys, { .gamma = 2.0 } );
+
+		expectMinimalPerfect( fast, keys );
+		EXPECT_LT( fast.levelCount(), compact.levelCount() );
+		EXPECT_GT( fast.bitsPerKey(), compact.bitsPerKey() );
+	}
+
+	TEST( MinimalPerfectHash, ParallelBuildMatchesSerialBuild )
+	{
+		const auto keys = randomKeys( 300000, 4 );
+		const auto serial = MinimalPerfectHash<>::build( keys, { .threadCount = 1 } );
+		const auto parallel = MinimalPerfectHash<>::build( keys, { .threadCount = 4 } );
+
+		EXPECT_EQ( serial.serialize(), parallel.serialize() );
+	}
+
+	TEST( MinimalPerfectHash, RejectsInvalidInput )
+	{
+		const std::vector<uint64_t> duplicates{ 1, 2, 3, 2 };
+		EXPECT_THROW( (void)MinimalPerfectHash<>::build( duplicates ), std::invalid_argument );
+
+		const std::vector<uint64_t> keys{ 1, 2, 3 };
+		EXPECT_THROW( (void)MinimalPerfectHash<>::build( keys, { .gamma = 0.5 } ), std::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// Serialization
+	//----------------------------------------------
+
+	TEST( MinimalPerfectHash, ImageRoundTrip )
+	{
+		const auto keys = randomKeys( 50000, 5 );
+		const auto built = MinimalPerfectHash<>::build( keys );
+		const auto image = built.serialize();
+
+		const MinimalPerfectHash<> viewed{ image };
+		EXPECT_EQ( viewed.size(), built.size() );
+		for ( const auto key : keys )
+		{
+			ASSERT_EQ( viewed( key ), built( key ) );
+		}
+	}
+
+	TEST( MinimalPerfectHash, RejectsMalformedImages )
+	{
+		const auto keys = randomKeys( 1000, 6 );
+		const auto image = MinimalPerfectHash<>::build( keys ).serialize();
+
+		auto badMagic = image;
+		badMagic[0] = std::byte{ 'X' };
+		EXPECT_THROW( MinimalPerfectHash<>{ badMagic }, std::runtime_error );
+
+		const std::span<const std::byte> truncated{ image.data(), image.size() - 8 };
+		EXPECT_THROW( MinimalPerfectHash<>{ truncated }, std::runtime_error );
+
+		using OtherSeed = MinimalPerfectHash<Hasher<uint64_t, 1>>;
+		EXPECT_THROW( OtherSeed{ image }, std::runtime_error );
+	}
+
+	TEST( MinimalPerfectHash, MapsWrittenFile )
+	{
+		const auto path = std::filesystem::temp_directory_path() / "nfx_mphf_mapped.mphf";
+		const auto keys = randomKeys( 100000, 7 );
+		const auto built = MinimalPerfectHash<>::build( keys );
+		built.write( path );
+
+		{
+			MinimalPerfectHash<> mapped{ MappedFile{ path } };
+			for ( const auto key : keys )
+			{
+				ASSERT_EQ( mapped( key ), built( key ) );
+			}
+
+			MinimalPerfectHash<> moved{ std::move( mapped ) };
+			EXPECT_EQ( moved( keys[0] ), built( keys[0] ) );
+			EXPECT_EQ( mapped.size(), 0u );
+		}
+
+		std::filesystem::remove( path );
+	}
+} // namespace nfx::hashing::test
@@ -0,0 +1,264 @@
+/**
+ * @file TESTS_PersistentHashMap.cpp
+ * @brief Tests for the persistent HAMT and its atomic snapshot root
+ * @details Validates versions against std::unordered_map under random updates, persistence of old
+ *          versions, full-hash collisions, canonical erasure, and snapshot consistency and
+ *          reclamation under a concurrent writer
+ */
+
+#include <atomic>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// PersistentHashMap tests
+	//=====================================================================
+
+	namespace
+	{
+		/** @brief Every key hashes alike: forces collision nodes below the last level */
+		struct ConstantHasher
+		{
+			uint64_t operator()( int ) const noexcept
+			{
+				return 0x0123456789abcdefULL;
+			}
+		};
+
+		/** @brief Only the low 8 bits vary: forces deep single-child chains */
+		struct HighBitsHasher
+		{
+			uint64_t operator()( int key ) const noexcept
+			{
+				return static_cast<uint64_t>( key & 0xff ) << 56;
+			}
+		};
+
+		template <typename TMap>
+		std::unordered_map<int, int> contents( const TMap& map )
+		{
+			std::unordered_map<int, int> result;
+			map.for_each( [&]( int key, int value ) { result.emplace( key, value ); } );
+
+			return result;
+		}
+	} // namespace
+
+	//----------------------------------------------
+	// Basic operations
+	//----------------------------------------------
+
+	TEST( PersistentHashMap, SetFindErase )
+	{
+		const PersistentHashMap<std::string, int> empty;
+		EXPECT_TRUE( empty.empty() );
+		EXPECT_EQ( empty.find( "a" ), nullptr );
+
+		const auto v1 = empty.set( "a", 1 ).set( "b", 2 );
+		const auto v2 = v1.set( "a", 10 );
+		const auto v3 = v2.erase( "b" );
+
+		EXPECT_EQ( v1.size(), 2u );
+		EXPECT_EQ( v1.at( "a" ), 1 );
+		EXPECT_EQ( v2.size(), 2u );
+		EXPECT_EQ( v2.at( "a" ), 10 );
+		EXPECT_EQ( v3.size(), 1u );
+		EXPECT_FALSE( v3.contains( "b" ) );
+		EXPECT_TRUE( v2.contains( "b" ) );
+		EXPECT_THROW( (void)v3.at( "b" ), std::out_of_range );
+
+		EXPECT_TRUE( v3.erase( "a" ).empty() );
+		EXPECT_EQ( v3.erase( "missing" ).size(), 1u );
+		EXPECT_TRUE( empty.empty() );
+	}
+
+	TEST( PersistentHashMap, MatchesUnorderedMapAcrossVersions )
+	{
+		std::mt19937_64 gen( 11 );
+		std::vector<PersistentHashMap<int, int>> versions( 1 );
+		std::vector<std::unordered_map<int, int>> references( 1 );
+
+		for ( int i = 0; i < 20000; ++i )
+		{
+			const int key = static_cast<int>( gen() % 3000 );
+			auto reference = references.back();
+			if ( gen() % 3 == 0 )
+			{
+				versions.push_back( versions.back().erase( key ) );
+				reference.erase( key );
+			}
+			else
+			{
+				versions.push_back( versions.back().set( key, i ) );
+				reference[key] = i;
+			}
+			references.push_back( std::move( reference ) );
+		}
+
+		// Every old version must still hold exactly what it held when created
+		for ( std::size_t v = 0; v < versions.size(); v += 997 )
+		{
+			ASSERT_EQ( versions[v].size(), references[v].size() );
+			EXPECT_EQ( contents( versions[v] ), references[v] );
+			for ( int key = 0; key < 3000; ++key )
+			{
+				const auto it = references[v].find( key );
+				const int* value = versions[v].find( key );
+				ASSERT_EQ( value != nullptr, it != references[v].end() );
+				if ( value )
+				{
+					EXPECT_EQ( *value, it->second );
+				}
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Degenerate hashes
+	//----------------------------------------------
+
+	TEST( PersistentHashMap, FullHashCollisions )
+	{
+		PersistentHashMap<int, int, ConstantHasher> map;
+		for ( int i = 0; i < 50; ++i )
+		{
+			map = map.set( i, i * 2 );
+		}
+		map = map.set( 7, -7 );
+		EXPECT_EQ( map.size(), 50u );
+		EXPECT_EQ( map.at( 7 ), -7 );
+		EXPECT_EQ( map.at( 49 ), 98 );
+		EXPECT_FALSE( map.contains( 50 ) );
+
+		for ( int i = 0; i < 50; i += 2 )
+		{
+			map = map.erase( i );
+		}
+		EXPECT_EQ( map.size(), 25u );
+		EXPECT_FALSE( map.contains( 0 ) );
+		EXPECT_EQ( map.at( 49 ), 98 );
+	}
+
+	TEST( PersistentHashMap, ErasureCollapsesChains )
+	{
+		PersistentHashMap<int, int, HighBitsHasher> map;
+		std::unordered_map<int, int> reference;
+		for ( int i = 0; i < 256; ++i )
+		{
+			map = map.set( i, i );
+			reference[i] = i;
+		}
+		for ( int i = 0; i < 256; ++i )
+		{
+			if ( i % 5 != 0 )
+			{
+				map = map.erase( i );
+				reference.erase( i );
+			}
+		}
+		EXPECT_EQ( contents( map ), reference );
+
+		for ( const auto& [key, value] : reference )
+		{
+			map = map.erase( key );
+		}
+		EXPECT_TRUE( map.empty() );
+		EXPECT_EQ( map.find( 0 ), nullptr );
+	}
+
+	//=====================================================================
+	// AtomicPersistentHashMap tests
+	//=====================================================================
+
+	TEST( AtomicPersistentHashMap, SnapshotOutlivesPublish )
+	{
+		AtomicPersistentHashMap<int, int> map;
+		map.update( []( const auto& current ) { return current.set( 1, 1 ); } );
+
+		auto before = map.snapshot();
+		map.update( []( const auto& current ) { return current.set( 1, 2 ).set( 2, 2 ); } );
+		auto after = map.snapshot();
+
+		EXPECT_EQ( before->size(), 1u );
+		EXPECT_EQ( before->at( 1 ), 1 );
+		EXPECT_EQ( after->size(), 2u );
+		EXPECT_EQ( ( *after ).at( 1 ), 2 );
+		EXPECT_EQ( map.load().size(), 2u );
+	}
+
+	TEST( AtomicPersistentHashMap, RetiredVersionsAreReclaimed )
+	{
+		AtomicPersistentHashMap<int, std::shared_ptr<int>> map;
+		auto payload = std::make_shared<int>( 5 );
+		const std::weak_ptr<int> watch = payload;
+		map.publish( map.load().set( 0, std::move( payload ) ) );
+
+		auto held = map.snapshot();
+		map.publish( {} );
+		map.publish( {} );
+		EXPECT_FALSE( watch.expired() );
+
+		held = map.snapshot();
+		map.publish( {} );
+		EXPECT_TRUE( watch.expired() );
+
+		// More publishes than slots, with no readers holding on
+		for ( std::size_t i = 0; i < 4 * AtomicPersistentHashMap<int, int>::MAX_VERSIONS; ++i )
+		{
+			map.publish( {} );
+		}
+		EXPECT_TRUE( map.snapshot()->empty() );
+	}
+
+	TEST( AtomicPersistentHashMap, ReadersSeeConsistentVersions )
+	{
+		constexpr int VERSIONS = 2000;
+		AtomicPersistentHashMap<int, int> map;
+		std::atomic<bool> done{ false };
+		std::atomic<int> failures{ 0 };
+
+		std::vector<std::thread> readers;
+		for ( int t = 0; t < 3; ++t )
+		{
+			readers.emplace_back( [&] {
+				while ( !done.load( std::memory_order_acquire ) )
+				{
+					// Version v holds keys 0..v-1, key k mapped to k + 1
+					const auto snapshot = map.snapshot();
+					const int version = static_cast<int>( snapshot->size() );
+					for ( int key = 0; key < version; key += 1 + version / 16 )
+					{
+						const int* value = snapshot->find( key );
+						if ( value == nullptr || *value != key + 1 )
+						{
+							failures.fetch_add( 1 );
+						}
+					}
+				}
+			} );
+		}
+
+		for ( int v = 1; v <= VERSIONS; ++v )
+		{
+			map.update( [v]( const auto& current ) { return current.set( v - 1, v ); } );
+		}
+		done.store( true, std::memory_order_release );
+		for ( auto& reader : readers )
+		{
+			reader.join();
+		}
+
+		EXPECT_EQ( failures.load(), 0 );
+		EXPECT_EQ( map.load().size(), static_cast<std::size_t>( VERSIONS ) );
+	}
+} // namespace nfx::hashing::test
@@ -0,0 +1,131 @@
+/**
+ * @file TESTS_RangeReduction.cpp
+ * @brief Tests for fastrange and Fibonacci range reduction
+ * @details Validates the scalar reductions against 128-bit reference arithmetic, bounds for
+ *          non-power-of-two ranges, bucket balance, and that the batched overloads match the
+ *          scalar ones for every tail length and when writing in place
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// Range reduction tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Scalar
+	//----------------------------------------------
+
+	TEST( RangeReduction, ScalarMatchesReference )
+	{
+		static_assert( fastRange<uint32_t>( 0xFFFFFFFFu, 1000u ) == 999u );
+		static_assert( fastRange<uint64_t>( ~uint64_t{ 0 }, 3 ) == 2 );
+		static_assert( fibonacciRange<uint64_t>( 12345, 0 ) == 0 );
+
+		std::mt19937_64 rng{ 7 };
+		for ( int i = 0; i < 10000; ++i )
+		{
+			const uint64_t hash = rng();
+			const uint64_t range = rng() >> ( i % 64 );
+			const auto expected = static_cast<uint64_t>( ( static_cast<unsigned __int128>( hash ) * range ) >> 64 );
+			ASSERT_EQ( fastRange<uint64_t>( hash, range ), expected );
+
+			const auto hash32 = static_cast<uint32_t>( hash );
+			const auto range32 = static_cast<uint32_t>( range );
+			ASSERT_EQ( fastRange<uint32_t>( hash32, range32 ), static_cast<uint32_t>( ( uint64_t{ hash32 } * range32 ) >> 32 ) );
+
+			const unsigned int bits = static_cast<unsigned int>( i % 64 );
+			const uint64_t index = fibonacciRange<uint64_t>( hash, bits );
+			ASSERT_EQ( index, bits == 0 ? 0 : ( hash * constants::GOLDEN_RATIO_64 ) >> ( 64 - bits ) );
+			ASSERT_LT( index, uint64_t{ 1 } << bits );
+			ASSERT_LT( fibonacciRange<uint32_t>( hash32, bits % 32 ), uint64_t{ 1 } << ( bits % 32 ) );
+		}
+	}
+
+	TEST( RangeReduction, NonPowerOfTwoRangeIsBalanced )
+	{
+		constexpr uint64_t range = 1000003;
+		constexpr std::size_t samples = range * 8;
+		std::vector<uint32_t> counts( range, 0 );
+		const Hasher<uint64_t> hasher;
+		for ( uint64_t key = 0; key < samples; ++key )
+		{
+			const uint64_t index = fastRange<uint64_t>( hasher( key ), range );
+			ASSERT_LT( index, range );
+			++counts[index];
+		}
+
+		// Poisson( 8 ): a handful of buckets beyond 30 would mean the high bits are not used
+		std::size_t empty = 0;
+		for ( const auto count : counts )
+		{
+			empty += count == 0;
+			ASSERT_LT( count, 30u );
+		}
+		EXPECT_LT( empty, range / 1000 );
+
+		// Hashes differing only in their high bits, which a mask would send to one bucket, spread out
+		std::vector<bool> seen( 1024, false );
+		for ( uint64_t key = 0; key < 1024; ++key )
+		{
+			seen[fibonacciRange<uint64_t>( key << 40, 10 )] = true;
+		}
+		EXPECT_GT( std::count( seen.begin(), seen.end(), true ), 600 );
+	}
+
+	//----------------------------------------------
+	// Batched
+	//----------------------------------------------
+
+	TEST( RangeReduction, BatchedMatchesScalar )
+	{
+		std::mt19937_64 rng{ 11 };
+		for ( std::size_t count = 0; count <= 37; ++count )
+		{
+			std::vector<uint64_t> hashes64( count );
+			std::vector<uint32_t> hashes32( count );
+			for ( std::size_t i = 0; i < count; ++i )
+			{
+				hashes64[i] = rng();
+				hashes32[i] = static_cast<uint32_t>( rng() );
+			}
+			const uint64_t range64 = rng() >> ( count % 48 );
+			const auto range32 = static_cast<uint32_t>( rng() >> ( 32 + count % 24 ) );
+			const unsigned int bits = static_cast<unsigned int>( count % 32 );
+
+			std::vector<uint64_t> out64( count );
+			std::vector<uint32_t> out32( count );
+			fastRange( hashes64, range64, out64 );
+			fastRange( hashes32, range32, out32 );
+			for ( std::size_t i = 0; i < count; ++i )
+			{
+				ASSERT_EQ( out64[i], fastRange<uint64_t>( hashes64[i], range64 ) );
+				ASSERT_EQ( out32[i], fastRange<uint32_t>( hashes32[i], range32 ) );
+			}
+
+			fibonacciRange( hashes64, bits + 32, out64 );
+			fibonacciRange( hashes32, bits, out32 );
+			for ( std::size_t i = 0; i < count; ++i )
+			{
+				ASSERT_EQ( out64[i], fibonacciRange<uint64_t>( hashes64[i], bits + 32 ) );
+				ASSERT_EQ( out32[i], fibonacciRange<uint32_t>( hashes32[i], bits ) );
+			}
+
+			// In place
+			std::vector<uint64_t> inPlace = hashes64;
+			fastRange( inPlace, range64, inPlace );
+			for ( std::size_t i = 0; i < count; ++i )
+			{
+				ASSERT_EQ( inPlace[i], fastRange<uint64_t>( hashes64[i], range64 ) );
+			}
+		}
+	}
+} // namespace nfx::hashing::test
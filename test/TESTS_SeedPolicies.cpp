@@ -0,0 +1,192 @@
+/**
+ * @file TESTS_SeedPolicies.cpp
+ * @brief Tests for the FlatHashMap table seed policies
+ * @details Validates per-instance salts, that AdaptiveSeed reseeds when keys collide after masking and then probes
+ *          short again, that full-hash collisions only reseed with backoff, that contents survive
+ *          reseeding, and that the process-wide reseed counter advances
+ */
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// Table seed policy tests
+	//=====================================================================
+
+	namespace
+	{
+		/** @brief The key is its own hash, so tests can choose hashes directly */
+		struct IdentityHasher
+		{
+			uint64_t operator()( uint64_t key ) const noexcept
+			{
+				return key;
+			}
+		};
+
+		/** @brief Every key has the same full hash */
+		struct ConstantHasher
+		{
+			uint64_t operator()( uint64_t ) const noexcept
+			{
+				return 0x9e3779b97f4a7c15ULL;
+			}
+		};
+
+		template <typename THasher>
+		using AdaptiveMap = FlatHashMap<uint64_t, uint64_t, THasher, std::equal_to<>, policies::AdaptiveSeed>;
+
+		/** @brief Distinct hashes that seed 0 sends to the same probe start in a table of @p capacity slots */
+		std::vector<uint64_t> collidingUnderSeedZero( std::size_t count, std::size_t capacity )
+		{
+			std::vector<uint64_t> keys;
+			for ( uint64_t candidate = 1; keys.size() < count; ++candidate )
+			{
+				if ( seedMix<uint64_t>( 0, candidate, capacity ) == 0 )
+				{
+					keys.push_back( candidate );
+				}
+			}
+
+			return keys;
+		}
+	} // namespace
+
+	//----------------------------------------------
+	// FixedSeed
+	//----------------------------------------------
+
+	TEST( SeedPolicies, FixedSeedIsTheDefault )
+	{
+		static_assert( std::is_same_v<FlatHashMap<int, int>::seed_policy_type, policies::FixedSeed> );
+
+		FlatHashMap<int, int> map;
+		map[1] = 1;
+		EXPECT_EQ( map.seed_policy().seed(), 0u );
+	}
+
+	//----------------------------------------------
+	// SaltedSeed
+	//----------------------------------------------
+
+	TEST( SeedPolicies, SaltedSeedDiffersPerInstance )
+	{
+		int first = 0;
+		int second = 0;
+		EXPECT_NE( saltedSeed( &first ), saltedSeed( &second ) );
+		EXPECT_EQ( saltedSeed( &first ), saltedSeed( &first ) );
+
+		using SaltedMap = FlatHashMap<uint64_t, uint64_t, Hasher<uint64_t>, std::equal_to<>, policies::SaltedSeed>;
+		SaltedMap source;
+		for ( uint64_t key = 0; key < 50000; ++key )
+		{
+			source.try_emplace( key, key + 1 );
+		}
+
+		// Copying iterates the source: the copy must use its own seed and still find everything
+		const SaltedMap copy{ source };
+		EXPECT_NE( copy.seed_policy().seed(), source.seed_policy().seed() );
+		const uint64_t sourceSeed = source.seed_policy().seed();
+		const SaltedMap moved{ std::move( source ) };
+		EXPECT_EQ( moved.seed_policy().seed(), sourceSeed );
+		for ( uint64_t key = 0; key < 50000; ++key )
+		{
+			ASSERT_EQ( copy.at( key ), key + 1 );
+			ASSERT_EQ( moved.at( key ), key + 1 );
+		}
+	}
+
+	//----------------------------------------------
+	// AdaptiveSeed
+	//----------------------------------------------
+
+	TEST( SeedPolicies, AdaptiveSeedSpreadsMaskCollisions )
+	{
+		constexpr std::size_t KEY_COUNT = 1500;
+		AdaptiveMap<IdentityHasher> map;
+		map.reserve( KEY_COUNT );
+		const std::size_t capacity = map.capacity();
+		const auto keys = collidingUnderSeedZero( KEY_COUNT, capacity );
+		const uint64_t before = policies::AdaptiveSeed::totalReseeds();
+
+		for ( const auto key : keys )
+		{
+			map.try_emplace( key, key * 3 );
+		}
+
+		// The first window is pathological; the new seed scatters the keys and growth never happens
+		EXPECT_GE( map.seed_policy().reseedCount(), 1u );
+		EXPECT_LE( map.seed_policy().reseedCount(), 2u );
+		EXPECT_NE( map.seed_policy().seed(), 0u );
+		EXPECT_EQ( map.capacity(), capacity );
+		EXPECT_GE( policies::AdaptiveSeed::totalReseeds(), before + map.seed_policy().reseedCount() );
+
+		// Probe lengths are back to normal
+		for ( uint64_t i = 0; i < 64; ++i )
+		{
+			map.erase( keys[i] );
+		}
+		for ( uint64_t i = 0; i < 64; ++i )
+		{
+			map.try_emplace( keys[i], keys[i] * 3 );
+		}
+		EXPECT_LT( map.seed_policy().averageProbeGroups(), 1.0 );
+		EXPECT_LT( map.seed_policy().maxProbeGroups(), policies::AdaptiveSeed::MAX_PROBE_GROUPS / 2 );
+
+		ASSERT_EQ( map.size(), KEY_COUNT );
+		for ( const auto key : keys )
+		{
+			ASSERT_EQ( map.at( key ), key * 3 );
+		}
+	}
+
+	TEST( SeedPolicies, FullHashCollisionsBackOff )
+	{
+		constexpr uint64_t KEY_COUNT = 3000;
+		AdaptiveMap<ConstantHasher> map;
+		for ( uint64_t key = 0; key < KEY_COUNT; ++key )
+		{
+			map.try_emplace( key, key );
+		}
+
+		// No seed can help; doubling windows bound the reseeds to a few per capacity
+		EXPECT_GE( map.seed_policy().reseedCount(), 1u );
+		EXPECT_LE( map.seed_policy().reseedCount(), 40u );
+		ASSERT_EQ( map.size(), KEY_COUNT );
+		for ( uint64_t key = 0; key < KEY_COUNT; key += 7 )
+		{
+			ASSERT_EQ( map.at( key ), key );
+		}
+	}
+
+	TEST( SeedPolicies, AdaptiveSeedQuietOnRandomKeys )
+	{
+		AdaptiveMap<Hasher<uint64_t>> map;
+		std::unordered_map<uint64_t, uint64_t> reference;
+		for ( uint64_t key = 0; key < 200000; ++key )
+		{
+			map.try_emplace( key * 0x10001, key );
+			reference.emplace( key * 0x10001, key );
+		}
+
+		EXPECT_EQ( map.seed_policy().reseedCount(), 0u );
+		EXPECT_EQ( map.size(), reference.size() );
+
+		// Copies start from a fresh policy; moves keep the seed with the layout
+		const AdaptiveMap<Hasher<uint64_t>> copy{ map };
+		EXPECT_EQ( copy.size(), map.size() );
+		AdaptiveMap<Hasher<uint64_t>> moved{ std::move( map ) };
+		for ( const auto& [key, value] : reference )
+		{
+			ASSERT_EQ( moved.at( key ), value );
+			ASSERT_EQ( copy.at( key ), value );
+		}
+	}
+} // namespace nfx::hashing::test
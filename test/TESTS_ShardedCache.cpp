@@ -0,0 +1,266 @@
+/**
+ * @file TESTS_ShardedCache.cpp
+ * @brief Tests for the sharded LRU / CLOCK cache
+ * @details Validates replacement order, weight accounting, replacement of existing keys, shard
+ *          budgets of small caches, single storage and single hashing of keys and concurrent
+ *          access for both eviction policies
+ */
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// ShardedCache tests
+	//=====================================================================
+
+	namespace
+	{
+		/** @brief Key that counts its live copies */
+		struct CountedKey
+		{
+			explicit CountedKey( int id )
+				: id{ id }
+			{
+				++live;
+			}
+
+			CountedKey( const CountedKey& other )
+				: id{ other.id }
+			{
+				++live;
+			}
+
+			~CountedKey()
+			{
+				--live;
+			}
+
+			bool operator==( const CountedKey& other ) const
+			{
+				return id == other.id;
+			}
+
+			int id;
+			static inline int live = 0;
+		};
+
+		struct CountedKeyHash
+		{
+			uint64_t operator()( const CountedKey& key ) const
+			{
+				return Hasher<uint64_t>{}( key.id );
+			}
+		};
+
+		/** @brief Hasher that counts its invocations */
+		struct CountingHasher
+		{
+			uint64_t operator()( uint64_t key ) const
+			{
+				++calls;
+
+				return Hasher<uint64_t>{}( key );
+			}
+
+			static inline std::size_t calls = 0;
+		};
+	} // namespace
+
+	//----------------------------------------------
+	// Replacement order
+	//----------------------------------------------
+
+	TEST( ShardedCache, LruEvictsLeastRecentlyUsed )
+	{
+		LruCache<int, int> cache{ 3, 1 };
+		cache.put( 1, 10 );
+		cache.put( 2, 20 );
+		cache.put( 3, 30 );
+		EXPECT_EQ( cache.get( 1 ), 10 ); // 1 becomes most recent; 2 is now the oldest
+
+		cache.put( 4, 40 );
+		EXPECT_FALSE( cache.contains( 2 ) );
+		EXPECT_TRUE( cache.contains( 1 ) );
+		EXPECT_TRUE( cache.contains( 3 ) );
+		EXPECT_TRUE( cache.contains( 4 ) );
+		EXPECT_EQ( cache.size(), 3u );
+		EXPECT_EQ( cache.evictions(), 1u );
+	}
+
+	TEST( ShardedCache, ClockGivesReferencedEntriesASecondChance )
+	{
+		ClockCache<int, int> cache{ 3, 1 };
+		cache.put( 1, 10 );
+		cache.put( 2, 20 );
+		cache.put( 3, 30 );
+		EXPECT_EQ( cache.get( 1 ), 10 ); // sets the reference bit of the oldest entry
+
+		cache.put( 4, 40 );
+		EXPECT_TRUE( cache.contains( 1 ) );
+		EXPECT_FALSE( cache.contains( 2 ) );
+
+		// 1 was moved to the front with its bit cleared, so it ages like a fresh insert
+		cache.put( 5, 50 );
+		EXPECT_FALSE( cache.contains( 3 ) );
+		cache.put( 6, 60 );
+		EXPECT_FALSE( cache.contains( 4 ) );
+		EXPECT_TRUE( cache.contains( 1 ) );
+		cache.put( 7, 70 );
+		EXPECT_FALSE( cache.contains( 1 ) );
+	}
+
+	//----------------------------------------------
+	// Weights
+	//----------------------------------------------
+
+	TEST( ShardedCache, ByteWeightedCapacity )
+	{
+		LruCache<std::string, std::string> cache{ 100, 1 };
+		EXPECT_TRUE( cache.put( "a", std::string( 40, 'a' ), 40 ) );
+		EXPECT_TRUE( cache.put( "b", std::string( 40, 'b' ), 40 ) );
+		EXPECT_EQ( cache.weight(), 80u );
+
+		EXPECT_TRUE( cache.put( "c", std::string( 30, 'c' ), 30 ) ); // evicts "a"
+		EXPECT_FALSE( cache.contains( "a" ) );
+		EXPECT_EQ( cache.weight(), 70u );
+
+		EXPECT_TRUE( cache.put( "b", std::string( 10, 'b' ), 10 ) ); // replacement updates the weight
+		EXPECT_EQ( cache.weight(), 40u );
+		EXPECT_EQ( cache.get( std::string_view{ "b" } )->size(), 10u );
+
+		EXPECT_FALSE( cache.put( "c", std::string( 200, 'c' ), 200 ) ); // too heavy: dropped
+		EXPECT_FALSE( cache.contains( "c" ) );
+		EXPECT_EQ( cache.weight(), 10u );
+	}
+
+	TEST( ShardedCache, EraseAndClearRecycleNodes )
+	{
+		LruCache<int, std::string> cache{ 1000, 4 };
+		for ( int round = 0; round < 3; ++round )
+		{
+			for ( int i = 0; i < 500; ++i )
+			{
+				cache.put( i, std::to_string( i ) );
+			}
+			EXPECT_TRUE( cache.erase( 7 ) );
+			EXPECT_FALSE( cache.erase( 7 ) );
+			EXPECT_EQ( cache.size(), 499u );
+			cache.clear();
+			EXPECT_EQ( cache.size(), 0u );
+			EXPECT_EQ( cache.weight(), 0u );
+		}
+	}
+
+	TEST( ShardedCache, CapacitySmallerThanShardCount )
+	{
+		LruCache<int, int> explicitShards{ 100, 256 };
+		EXPECT_LE( explicitShards.shardCount(), 100u );
+		ClockCache<int, int> automatic{ 3 };
+		EXPECT_LE( automatic.shardCount(), 3u );
+
+		for ( int i = 0; i < 1000; ++i )
+		{
+			EXPECT_TRUE( explicitShards.put( i, i ) );
+			EXPECT_TRUE( automatic.put( i, i ) );
+		}
+		EXPECT_EQ( explicitShards.size(), 100u );
+		EXPECT_EQ( explicitShards.weight(), 100u );
+		EXPECT_GT( automatic.size(), 0u );
+		EXPECT_LE( automatic.size(), 3u );
+		EXPECT_TRUE( explicitShards.contains( 999 ) );
+		EXPECT_TRUE( automatic.contains( 999 ) );
+	}
+
+	TEST( ShardedCache, StoresEachKeyOnce )
+	{
+		{
+			LruCache<CountedKey, int, CountedKeyHash> cache{ 64, 1 };
+			for ( int i = 0; i < 64; ++i )
+			{
+				cache.put( CountedKey{ i }, i );
+			}
+			EXPECT_EQ( cache.size(), 64u );
+			EXPECT_EQ( CountedKey::live, 64 );
+			EXPECT_EQ( cache.get( CountedKey{ 5 } ), 5 );
+		}
+		EXPECT_EQ( CountedKey::live, 0 );
+	}
+
+	TEST( ShardedCache, HashesEachKeyOnce )
+	{
+		LruCache<uint64_t, int, CountingHasher> cache{ 256, 4 };
+		CountingHasher::calls = 0;
+		for ( uint64_t key = 0; key < 64; ++key )
+		{
+			cache.put( key, static_cast<int>( key ) );
+		}
+		EXPECT_EQ( CountingHasher::calls, 64u );
+
+		for ( uint64_t key = 0; key < 64; ++key )
+		{
+			EXPECT_EQ( cache.get( key ), static_cast<int>( key ) );
+			EXPECT_TRUE( cache.contains( key ) );
+			EXPECT_TRUE( cache.erase( key ) );
+		}
+		EXPECT_EQ( CountingHasher::calls, 64u * 4 );
+
+		// Evictions and index growth reuse the hash stored in each node
+		LruCache<uint64_t, int, CountingHasher> small{ 16, 1 };
+		CountingHasher::calls = 0;
+		for ( uint64_t key = 0; key < 1000; ++key )
+		{
+			small.put( key, static_cast<int>( key ) );
+		}
+		EXPECT_EQ( CountingHasher::calls, 1000u );
+		EXPECT_EQ( small.evictions(), 1000u - 16 );
+	}
+
+	//----------------------------------------------
+	// Concurrency
+	//----------------------------------------------
+
+	template <typename TCache>
+	static void hammer()
+	{
+		TCache cache{ 1024, 8 };
+		std::vector<std::thread> threads;
+		for ( uint64_t t = 0; t < 4; ++t )
+		{
+			threads.emplace_back( [&cache, t] {
+				for ( uint64_t i = 0; i < 20000; ++i )
+				{
+					const uint64_t key = ( i * 31 + t ) % 4096;
+					if ( const auto value = cache.get( key ) )
+					{
+						EXPECT_EQ( *value, key * 3 );
+					}
+					else
+					{
+						cache.put( key, key * 3 );
+					}
+				}
+			} );
+		}
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+
+		EXPECT_LE( cache.weight(), cache.capacity() );
+		EXPECT_EQ( cache.weight(), cache.size() );
+	}
+
+	TEST( ShardedCache, ConcurrentAccess )
+	{
+		hammer<LruCache<uint64_t, uint64_t>>();
+		hammer<ClockCache<uint64_t, uint64_t>>();
+	}
+} // namespace nfx::hashing::test
@@ -0,0 +1,402 @@
+/**
+ * @file TESTS_SharedHashTable.cpp
+ * @brief Tests for the shared-memory hash table
+ * @details Validates lookups against std::unordered_map, tombstone reuse and the capacity limit,
+ *          short miss probes after erase/insert churn, access through two mappings at different
+ *          addresses and from a forked process, header validation, bounded reads of a bucket left
+ *          mid-update, takeover of a writer lock held by a dead process, and torn-read freedom of
+ *          lock-free readers under a concurrent writer
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+#if !defined( _WIN32 )
+#	include <sys/mman.h>
+#	include <sys/wait.h>
+#	include <unistd.h>
+#endif
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// SharedHashTable tests
+	//=====================================================================
+
+	namespace
+	{
+		struct Session
+		{
+			uint64_t user;
+			uint64_t expiry;
+			uint32_t flags;
+		};
+
+		/** @brief Segment name unique to this process and test */
+		std::string segmentName( const char* test )
+		{
+#if defined( _WIN32 )
+			return std::string{ "nfx-" } + test;
+#else
+			return "/nfx-" + std::to_string( ::getpid() ) + "-" + test;
+#endif
+		}
+
+		std::vector<std::byte> alignedRegion( std::size_t bytes )
+		{
+			// std::vector<std::byte> storage from operator new is at least 8-byte aligned
+			return std::vector<std::byte>( bytes );
+		}
+	} // namespace
+
+	//----------------------------------------------
+	// Single process
+	//----------------------------------------------
+
+	TEST( SharedHashTable, MatchesUnorderedMapInRegion )
+	{
+		using Table = SharedHashTable<uint64_t, uint64_t>;
+		auto region = alignedRegion( Table::requiredBytes( 4096 ) );
+		auto table = Table::initialize( region, 4096 );
+		EXPECT_EQ( table.capacity(), 4096u );
+		EXPECT_TRUE( table.empty() );
+
+		std::unordered_map<uint64_t, uint64_t> reference;
+		std::mt19937_64 gen( 3 );
+		for ( int i = 0; i < 100000; ++i )
+		{
+			const uint64_t key = gen() % 3000;
+			if ( gen() % 3 == 0 )
+			{
+				EXPECT_EQ( table.erase( key ), reference.erase( key ) == 1 );
+			}
+			else
+			{
+				EXPECT_EQ( table.insert_or_assign( key, i ), reference.insert_or_assign( key, i ).second );
+			}
+		}
+
+		EXPECT_EQ( table.size(), reference.size() );
+		for ( uint64_t key = 0; key < 3000; ++key )
+		{
+			const auto it = reference.find( key );
+			const auto value = table.find( key );
+			ASSERT_EQ( value.has_value(), it != reference.end() );
+			if ( value )
+			{
+				EXPECT_EQ( *value, it->second );
+			}
+		}
+	}
+
+	TEST( SharedHashTable, FullTableAndTombstoneReuse )
+	{
+		using Table = SharedHashTable<uint32_t, Session>;
+		auto region = alignedRegion( Table::requiredBytes( 8 ) );
+		auto table = Table::initialize( region, 8 );
+
+		for ( uint32_t key = 0; key < 8; ++key )
+		{
+			EXPECT_TRUE( table.insert_or_assign( key, Session{ key, key * 10u, 1 } ) );
+		}
+		EXPECT_THROW( table.insert_or_assign( 100, Session{} ), std::length_error );
+		EXPECT_FALSE( table.insert_or_assign( 3, Session{ 3, 99, 2 } ) );
+		EXPECT_EQ( table.find( 3 )->expiry, 99u );
+		EXPECT_FALSE( table.contains( 100 ) );
+
+		EXPECT_TRUE( table.erase( 5 ) );
+		EXPECT_FALSE( table.contains( 5 ) );
+		EXPECT_TRUE( table.insert_or_assign( 100, Session{ 100, 1, 0 } ) );
+		EXPECT_EQ( table.size(), 8u );
+		EXPECT_EQ( table.find( 100 )->user, 100u );
+		for ( uint32_t key = 0; key < 8; ++key )
+		{
+			EXPECT_EQ( table.contains( key ), key != 5 );
+		}
+	}
+
+	TEST( SharedHashTable, ChurnKeepsMissProbesShort )
+	{
+		using Table = SharedHashTable<uint64_t, uint64_t>;
+		constexpr std::size_t capacity = 1024;
+		auto region = alignedRegion( Table::requiredBytes( capacity ) );
+		auto table = Table::initialize( region, capacity );
+
+		// Hold ~600 live keys while every step erases one and inserts a fresh one, so without
+		// compaction tombstones would take over every empty bucket
+		std::unordered_map<uint64_t, uint64_t> reference;
+		std::vector<uint64_t> live;
+		std::mt19937_64 gen( 11 );
+		uint64_t next = 0;
+		for ( ; next < 600; ++next )
+		{
+			table.insert_or_assign( next, next * 3 );
+			reference.emplace( next, next * 3 );
+			live.push_back( next );
+		}
+		for ( int step = 0; step < 50000; ++step )
+		{
+			const std::size_t victim = static_cast<std::size_t>( gen() % live.size() );
+			ASSERT_TRUE( table.erase( live[victim] ) );
+			reference.erase( live[victim] );
+			live[victim] = next;
+			ASSERT_TRUE( table.insert_or_assign( next, next * 3 ) );
+			reference.emplace( next, next * 3 );
+			++next;
+		}
+
+		ASSERT_EQ( table.size(), reference.size() );
+		for ( const auto& [key, value] : reference )
+		{
+			ASSERT_EQ( table.find( key ), std::optional<uint64_t>{ value } );
+		}
+		EXPECT_FALSE( table.contains( next ) );
+
+		// A miss starting at any home bucket stops at the first empty bucket (state word 0)
+		constexpr std::size_t bucketBytes = ( 2 + 1 + 1 ) * 8;
+		const auto state = [&]( std::size_t index ) {
+			return *reinterpret_cast<const uint64_t*>( region.data() + Table::HEADER_BYTES + index * bucketBytes + 8 );
+		};
+		std::size_t total = 0;
+		std::size_t longest = 0;
+		for ( std::size_t home = 0; home < capacity; ++home )
+		{
+			std::size_t length = 1;
+			while ( length <= capacity && state( ( home + length - 1 ) % capacity ) != 0 )
+			{
+				++length;
+			}
+			total += length;
+			longest = std::max( longest, length );
+		}
+		EXPECT_LT( total / capacity, 32u );
+		EXPECT_LT( longest, capacity / 4 );
+	}
+
+	TEST( SharedHashTable, AttachRejectsIncompatibleRegions )
+	{
+		using Table = SharedHashTable<uint64_t, uint64_t>;
+		auto region = alignedRegion( Table::requiredBytes( 64 ) );
+		EXPECT_THROW( (void)Table::attach( region ), std::runtime_error );
+
+		auto table = Table::initialize( region, 64 );
+		table.insert_or_assign( 1, 2 );
+		EXPECT_EQ( *Table::attach( region ).find( 1 ), 2u );
+
+		using OtherValue = SharedHashTable<uint64_t, uint32_t>;
+		using OtherSeed = SharedHashTable<uint64_t, uint64_t, Hasher<uint64_t, 12345>>;
+		EXPECT_THROW( (void)OtherValue::attach( region ), std::runtime_error );
+		EXPECT_THROW( (void)OtherSeed::attach( region ), std::runtime_error );
+		EXPECT_THROW( (void)Table::initialize( std::span{ region }.first( 64 ), 64 ), std::invalid_argument );
+	}
+
+	TEST( SharedHashTable, ReaderGivesUpOnBucketLeftMidUpdate )
+	{
+		using Table = SharedHashTable<uint64_t, uint64_t>;
+		auto region = alignedRegion( Table::requiredBytes( 64 ) );
+		auto table = Table::initialize( region, 64 );
+		table.insert_or_assign( 1, 10 );
+		table.insert_or_assign( 2, 20 );
+
+		// Simulate a writer that died inside a bucket update: make key 1's home bucket sequence odd
+		constexpr std::size_t bucketBytes = ( 2 + 1 + 1 ) * 8;
+		const std::size_t home = static_cast<std::size_t>( Hasher<uint64_t>{}( uint64_t{ 1 } ) ) & ( table.capacity() - 1 );
+		auto* sequence = reinterpret_cast<uint64_t*>( region.data() + Table::HEADER_BYTES + home * bucketBytes );
+		ASSERT_EQ( *sequence % 2, 0u );
+		*sequence += 1;
+
+		EXPECT_EQ( table.find( 1 ), std::nullopt );
+		const std::size_t homeOf2 = static_cast<std::size_t>( Hasher<uint64_t>{}( uint64_t{ 2 } ) ) & ( table.capacity() - 1 );
+		if ( homeOf2 != home )
+		{
+			EXPECT_EQ( table.find( 2 ), std::optional<uint64_t>{ 20 } );
+		}
+	}
+
+	TEST( SharedHashTable, ThrowingPredicatesReleaseWriterLock )
+	{
+		struct ThrowingEqual
+		{
+			bool operator()( uint64_t a, uint64_t b ) const
+			{
+				if ( a == 13 || b == 13 )
+				{
+					throw std::runtime_error{ "unlucky key" };
+				}
+				return a == b;
+			}
+		};
+
+		using Table = SharedHashTable<uint64_t, uint64_t, Hasher<uint64_t>, ThrowingEqual>;
+		auto region = alignedRegion( Table::requiredBytes( 64 ) );
+		auto table = Table::initialize( region, 64 );
+		table.insert_or_assign( 13, 1 );
+
+		// Assigning and erasing compare against the stored key and throw under the writer lock
+		EXPECT_THROW( table.insert_or_assign( 13, 2 ), std::runtime_error );
+		EXPECT_THROW( table.erase( 13 ), std::runtime_error );
+
+		// A leaked lock would deadlock here
+		EXPECT_TRUE( table.insert_or_assign( 14, 3 ) );
+		EXPECT_EQ( table.find( 14 ), std::optional<uint64_t>{ 3 } );
+	}
+
+	//----------------------------------------------
+	// Named segments
+	//----------------------------------------------
+
+	TEST( SharedHashTable, TwoMappingsShareOneTable )
+	{
+		using Table = SharedHashTable<uint64_t, Session>;
+		const std::string name = segmentName( "two-mappings" );
+		auto owner = Table::create( name, 1024 );
+		auto reader = Table::open( name );
+		EXPECT_THROW( (void)Table::create( name, 1024 ), std::runtime_error );
+
+		owner.insert_or_assign( 7, Session{ 70, 700, 1 } );
+		ASSERT_TRUE( reader.contains( 7 ) );
+		EXPECT_EQ( reader.find( 7 )->expiry, 700u );
+
+		reader.erase( 7 );
+		EXPECT_FALSE( owner.contains( 7 ) );
+		EXPECT_TRUE( Table::remove( name ) );
+		EXPECT_THROW( (void)Table::open( name ), std::runtime_error );
+	}
+
+#if !defined( _WIN32 )
+	TEST( SharedHashTable, VisibleAcrossProcesses )
+	{
+		using Table = SharedHashTable<uint64_t, uint64_t>;
+		const std::string name = segmentName( "fork" );
+		auto table = Table::create( name, 1 << 12 );
+
+		const pid_t child = ::fork();
+		ASSERT_GE( child, 0 );
+		if ( child == 0 )
+		{
+			auto shared = Table::open( name );
+			for ( uint64_t key = 0; key < 1000; ++key )
+			{
+				shared.insert_or_assign( key, key * key );
+			}
+			::_exit( 0 );
+		}
+
+		int status = 0;
+		ASSERT_EQ( ::waitpid( child, &status, 0 ), child );
+		ASSERT_TRUE( WIFEXITED( status ) && WEXITSTATUS( status ) == 0 );
+		EXPECT_EQ( table.size(), 1000u );
+		for ( uint64_t key = 0; key < 1000; ++key )
+		{
+			ASSERT_EQ( table.find( key ), std::optional<uint64_t>{ key * key } );
+		}
+		Table::remove( name );
+	}
+
+	TEST( SharedHashTable, WriterTakesOverLockOfDeadProcess )
+	{
+		struct ExitingEqual
+		{
+			bool operator()( uint64_t stored, uint64_t probe ) const
+			{
+				if ( probe == 13 )
+				{
+					// Dies holding the writer lock
+					::_exit( 0 );
+				}
+				return stored == probe;
+			}
+		};
+
+		using Table = SharedHashTable<uint64_t, uint64_t, Hasher<uint64_t>, ExitingEqual>;
+		const std::size_t bytes = Table::requiredBytes( 64 );
+		void* mapping = ::mmap( nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0 );
+		ASSERT_NE( mapping, MAP_FAILED );
+		const std::span region{ static_cast<std::byte*>( mapping ), bytes };
+		auto table = Table::initialize( region, 64 );
+		for ( uint64_t key = 0; key < 10; ++key )
+		{
+			table.insert_or_assign( key, key + 100 );
+		}
+
+		const pid_t child = ::fork();
+		ASSERT_GE( child, 0 );
+		if ( child == 0 )
+		{
+			auto shared = Table::attach( region );
+			shared.insert_or_assign( 13, 0 );
+			shared.insert_or_assign( 13, 1 );
+			::_exit( 1 );
+		}
+
+		int status = 0;
+		ASSERT_EQ( ::waitpid( child, &status, 0 ), child );
+		ASSERT_TRUE( WIFEXITED( status ) && WEXITSTATUS( status ) == 0 );
+
+		// A lock left held by the dead child would hang here
+		EXPECT_TRUE( table.insert_or_assign( 14, 114 ) );
+		for ( uint64_t key = 0; key < 10; ++key )
+		{
+			EXPECT_EQ( table.find( key ), std::optional<uint64_t>{ key + 100 } );
+		}
+		EXPECT_EQ( table.find( 14 ), std::optional<uint64_t>{ 114 } );
+		EXPECT_EQ( table.size(), table.contains( 13 ) ? 12u : 11u );
+		::munmap( mapping, bytes );
+	}
+#endif
+
+	//----------------------------------------------
+	// Concurrency
+	//----------------------------------------------
+
+	TEST( SharedHashTable, ReadersNeverSeeTornValues )
+	{
+		using Table = SharedHashTable<uint64_t, Session>;
+		auto region = alignedRegion( Table::requiredBytes( 256 ) );
+		auto writer = Table::initialize( region, 256 );
+		for ( uint64_t key = 0; key < 64; ++key )
+		{
+			writer.insert_or_assign( key, Session{ 0, 0, 0 } );
+		}
+
+		std::atomic<bool> done{ false };
+		std::atomic<int> torn{ 0 };
+		std::vector<std::thread> readers;
+		for ( int t = 0; t < 2; ++t )
+		{
+			readers.emplace_back( [&] {
+				const auto reader = Table::attach( region );
+				uint64_t key = 0;
+				while ( !done.load( std::memory_order_acquire ) )
+				{
+					const auto session = reader.find( key++ % 64 );
+					if ( !session || session->user != session->expiry || session->flags != static_cast<uint32_t>( session->user ) )
+					{
+						torn.fetch_add( 1 );
+					}
+				}
+			} );
+		}
+
+		for ( uint64_t round = 1; round <= 20000; ++round )
+		{
+			writer.insert_or_assign( round % 64, Session{ round, round, static_cast<uint32_t>( round ) } );
+		}
+		done.store( true, std::memory_order_release );
+		for ( auto& reader : readers )
+		{
+			reader.join();
+		}
+
+		EXPECT_EQ( torn.load(), 0 );
+	}
+} // namespace nfx::hashing::test
@@ -0,0 +1,125 @@
+/**
+ * @file TESTS_StringInterner.cpp
+ * @brief Tests for the concurrent StringInterner
+ * @details Validates deduplication, dense ids, view stability, large strings, capacity limits
+ *          and concurrent interning of overlapping string sets
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/Hashing.h>
+
+namespace nfx::hashing::test
+{
+	//=====================================================================
+	// StringInterner tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Single-threaded semantics
+	//----------------------------------------------
+
+	TEST( StringInterner, DeduplicatesWithDenseIds )
+	{
+		StringInterner interner{ 16 };
+		EXPECT_EQ( interner.find( "alpha" ), StringInterner::INVALID_ID );
+
+		EXPECT_EQ( interner.intern( "alpha" ), 0u );
+		EXPECT_EQ( interner.intern( "beta" ), 1u );
+		EXPECT_EQ( interner.intern( std::string{ "alpha" } ), 0u );
+		EXPECT_EQ( interner.intern( "" ), 2u );
+		EXPECT_EQ( interner.intern( "" ), 2u );
+
+		EXPECT_EQ( interner.find( "beta" ), 1u );
+		EXPECT_EQ( interner.view( 0 ), "alpha" );
+		EXPECT_EQ( interner.view( 2 ), "" );
+		EXPECT_EQ( interner.size(), 3u );
+	}
+
+	TEST( StringInterner, ViewsStayValidAcrossChunks )
+	{
+		StringInterner interner{ 100000 };
+		std::vector<std::string_view> views;
+		for ( int i = 0; i < 100000; ++i )
+		{
+			const std::string text = "metric.name." + std::to_string( i );
+			views.push_back( interner.view( interner.intern( text ) ) );
+		}
+
+		EXPECT_GT( interner.arenaBytes(), StringInterner::ARENA_CHUNK_SIZE );
+		for ( int i = 0; i < 100000; ++i )
+		{
+			EXPECT_EQ( views[static_cast<size_t>( i )], "metric.name." + std::to_string( i ) );
+		}
+	}
+
+	TEST( StringInterner, LargeStrings )
+	{
+		StringInterner interner{ 4 };
+		const std::string large( StringInterner::ARENA_CHUNK_SIZE, 'x' );
+
+		const uint32_t id = interner.intern( large );
+		EXPECT_EQ( interner.intern( large ), id );
+		EXPECT_EQ( interner.view( id ), large );
+	}
+
+	TEST( StringInterner, ThrowsWhenFull )
+	{
+		StringInterner interner{ 2 };
+		static_cast<void>( interner.intern( "a" ) );
+		static_cast<void>( interner.intern( "b" ) );
+
+		EXPECT_THROW( static_cast<void>( interner.intern( "c" ) ), std::length_error );
+		EXPECT_EQ( interner.intern( "a" ), 0u );
+		EXPECT_EQ( interner.size(), 2u );
+	}
+
+	//----------------------------------------------
+	// Concurrency
+	//----------------------------------------------
+
+	TEST( StringInterner, ConcurrentInternAgreesOnIds )
+	{
+		constexpr int THREADS = 4;
+		constexpr int DISTINCT = 20000;
+
+		StringInterner interner{ DISTINCT };
+		std::vector<std::vector<uint32_t>> ids( THREADS, std::vector<uint32_t>( DISTINCT ) );
+
+		std::vector<std::thread> threads;
+		for ( int t = 0; t < THREADS; ++t )
+		{
+			threads.emplace_back( [&interner, &ids, t] {
+				// Every thread interns the same strings, starting at a different offset
+				for ( int i = 0; i < DISTINCT; ++i )
+				{
+					const int index = ( i + t * DISTINCT / THREADS ) % DISTINCT;
+					ids[static_cast<size_t>( t )][static_cast<size_t>( index )] = interner.intern( "label:" + std::to_string( index ) );
+				}
+			} );
+		}
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+
+		ASSERT_EQ( interner.size(), static_cast<uint32_t>( DISTINCT ) );
+		std::vector<bool> seen( DISTINCT, false );
+		for ( int i = 0; i < DISTINCT; ++i )
+		{
+			const uint32_t id = ids[0][static_cast<size_t>( i )];
+			for ( int t = 1; t < THREADS; ++t )
+			{
+				EXPECT_EQ( ids[static_cast<size_t>( t )][static_cast<size_t>( i )], id );
+			}
+			ASSERT_LT( id, static_cast<uint32_t>( DISTINCT ) );
+			EXPECT_FALSE( seen[id] );
+			seen[id] = true;
+			EXPECT_EQ( interner.view( id ), "label:" + std::to_string( i ) );
+		}
+	}
+} // namespace nfx::hashing::test